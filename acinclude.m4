@@ -6,6 +6,16 @@ dnl Function to detect if libfsapfs dependencies are available
 AC_DEFUN([AX_LIBFSAPFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsapfs/libfsapfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libfsapfs/libfsapfs_uncached_file_io_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([errno.h fcntl.h unistd.h])
+
+    AC_CHECK_FUNCS([close lseek open read])
+
+    AX_LIBCFILE_CHECK_FUNC_POSIX_FADVISE
+  ])
 ])
 
 dnl Function to detect if fsapfstools dependencies are available
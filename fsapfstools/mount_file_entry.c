@@ -221,6 +221,22 @@ int mount_file_entry_free(
 			memory_free(
 			 ( *file_entry )->name );
 		}
+		if( ( *file_entry )->directory_cursor != NULL )
+		{
+			if( libfsapfs_cursor_free(
+			     &( ( *file_entry )->directory_cursor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory cursor.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfsapfs_file_entry_free(
 		     &( ( *file_entry )->fsapfs_file_entry ),
 		     error ) != 1 )
@@ -631,6 +647,55 @@ int mount_file_entry_get_inode_change_time(
 	return( 1 );
 }
 
+/* Retrieves the identifier
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_identifier(
+     mount_file_entry_t *file_entry,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_identifier";
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_entry_get_identifier(
+	     file_entry->fsapfs_file_entry,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the file mode
  * Returns 1 if successful or -1 on error
  */
@@ -899,6 +964,54 @@ int mount_file_entry_get_number_of_sub_file_entries(
 	return( 1 );
 }
 
+/* Retrieves the cached name of the sub file entry for the specific index
+ * The name is escaped and must be freed after use
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_file_entry_get_cached_sub_file_entry_name(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     system_character_t **name,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_cached_sub_file_entry_name";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_file_system_get_cached_filename_by_index(
+	          file_entry->file_system,
+	          file_entry->fsapfs_file_entry,
+	          sub_file_entry_index,
+	          name,
+	          name_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached name of sub file entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the sub file entry for the specific index
  * Returns 1 if successful or -1 on error
  */
@@ -912,6 +1025,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 	system_character_t *filename                  = NULL;
 	static char *function                         = "mount_file_entry_get_sub_file_entry_by_index";
 	size_t filename_size                          = 0;
+	int result                                    = 0;
 
 	if( file_entry == NULL )
 	{
@@ -962,23 +1076,338 @@ int mount_file_entry_get_sub_file_entry_by_index(
 
 		goto on_error;
 	}
-	if( mount_file_system_get_filename_from_file_entry(
+	/* The escaped filename of a previously listed sub file entry is cached
+	 */
+	result = mount_file_system_get_cached_filename_by_index(
+	          file_entry->file_system,
+	          file_entry->fsapfs_file_entry,
+	          sub_file_entry_index,
+	          &filename,
+	          &filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached filename of sub file entry: %d.",
+		 function,
+		 sub_file_entry_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( mount_file_system_get_filename_from_file_entry(
+		     file_entry->file_system,
+		     sub_fsapfs_file_entry,
+		     &filename,
+		     &filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename of sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( mount_file_entry_initialize(
+	     sub_file_entry,
 	     file_entry->file_system,
+	     filename,
+	     filename_size - 1,
 	     sub_fsapfs_file_entry,
-	     &filename,
-	     &filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename of sub file entry: %d.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub file entry: %d.",
 		 function,
 		 sub_file_entry_index );
 
 		goto on_error;
 	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( sub_fsapfs_file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &sub_fsapfs_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Positions the directory cursor at a specific sub file entry
+ * The directory cursor is reused when the sub file entry is at or after its current position,
+ * which makes reading a directory in consecutive parts linear in the number of sub file entries
+ * Returns 1 if successful, 0 if no such sub file entry or -1 on error
+ */
+int mount_file_entry_set_directory_cursor_index(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     libcerror_error_t **error )
+{
+	static char *function  = "mount_file_entry_set_directory_cursor_index";
+	size_t key_data_size   = 0;
+	size_t value_data_size = 0;
+	uint64_t identifier    = 0;
+	uint8_t record_type    = 0;
+	int result             = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid sub file entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry->directory_cursor != NULL )
+	 && ( file_entry->directory_cursor_index > sub_file_entry_index ) )
+	{
+		if( libfsapfs_cursor_free(
+		     &( file_entry->directory_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory cursor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( file_entry->directory_cursor == NULL )
+	{
+		if( libfsapfs_file_entry_get_directory_cursor(
+		     file_entry->fsapfs_file_entry,
+		     &( file_entry->directory_cursor ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory cursor.",
+			 function );
+
+			return( -1 );
+		}
+		file_entry->directory_cursor_index     = 0;
+		file_entry->directory_cursor_is_at_end = 0;
+	}
+	while( ( file_entry->directory_cursor_is_at_end == 0 )
+	    && ( file_entry->directory_cursor_index < sub_file_entry_index ) )
+	{
+		result = libfsapfs_cursor_move_to_next_record(
+		          file_entry->directory_cursor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to move directory cursor to sub file entry: %d.",
+			 function,
+			 file_entry->directory_cursor_index + 1 );
+
+			libfsapfs_cursor_free(
+			 &( file_entry->directory_cursor ),
+			 NULL );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			file_entry->directory_cursor_is_at_end = 1;
+		}
+		file_entry->directory_cursor_index += 1;
+	}
+	if( file_entry->directory_cursor_is_at_end != 0 )
+	{
+		return( 0 );
+	}
+	result = libfsapfs_cursor_get_record(
+	          file_entry->directory_cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory cursor record.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		file_entry->directory_cursor_is_at_end = 1;
+	}
+	return( result );
+}
+
+/* Retrieves the sub file entry the directory cursor is positioned at
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_directory_cursor_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_entry_t *sub_fsapfs_file_entry = NULL;
+	system_character_t *filename                  = NULL;
+	static char *function                         = "mount_file_entry_get_directory_cursor_sub_file_entry";
+	size_t filename_size                          = 0;
+	int result                                    = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry->directory_cursor == NULL )
+	 || ( file_entry->directory_cursor_is_at_end != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - directory cursor not positioned at a sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_cursor_get_sub_file_entry(
+	     file_entry->directory_cursor,
+	     &sub_fsapfs_file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entry: %d.",
+		 function,
+		 file_entry->directory_cursor_index );
+
+		goto on_error;
+	}
+	/* The escaped filename of a previously listed sub file entry is cached
+	 */
+	result = mount_file_system_get_cached_filename_by_index(
+	          file_entry->file_system,
+	          file_entry->fsapfs_file_entry,
+	          file_entry->directory_cursor_index,
+	          &filename,
+	          &filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached filename of sub file entry: %d.",
+		 function,
+		 file_entry->directory_cursor_index );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( mount_file_system_get_filename_from_file_entry(
+		     file_entry->file_system,
+		     sub_fsapfs_file_entry,
+		     &filename,
+		     &filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve filename of sub file entry: %d.",
+			 function,
+			 file_entry->directory_cursor_index );
+
+			goto on_error;
+		}
+	}
 	if( mount_file_entry_initialize(
 	     sub_file_entry,
 	     file_entry->file_system,
@@ -993,7 +1422,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
 		 "%s: unable to initialize sub file entry: %d.",
 		 function,
-		 sub_file_entry_index );
+		 file_entry->directory_cursor_index );
 
 		goto on_error;
 	}
@@ -52,6 +52,18 @@ struct mount_file_entry
 	/* The file entry
 	 */
 	libfsapfs_file_entry_t *fsapfs_file_entry;
+
+	/* The directory cursor
+	 */
+	libfsapfs_cursor_t *directory_cursor;
+
+	/* The index of the sub file entry the directory cursor is positioned at
+	 */
+	int directory_cursor_index;
+
+	/* Value to indicate the directory cursor is positioned after the last sub file entry
+	 */
+	uint8_t directory_cursor_is_at_end;
 };
 
 int mount_file_entry_initialize(
@@ -91,6 +103,11 @@ int mount_file_entry_get_inode_change_time(
      uint64_t *inode_change_time,
      libcerror_error_t **error );
 
+int mount_file_entry_get_identifier(
+     mount_file_entry_t *file_entry,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_file_mode(
      mount_file_entry_t *file_entry,
      uint16_t *file_mode,
@@ -118,12 +135,29 @@ int mount_file_entry_get_number_of_sub_file_entries(
      int *number_of_sub_entries,
      libcerror_error_t **error );
 
+int mount_file_entry_get_cached_sub_file_entry_name(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     system_character_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
 int mount_file_entry_get_sub_file_entry_by_index(
      mount_file_entry_t *file_entry,
      int sub_file_entry_index,
      mount_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_set_directory_cursor_index(
+     mount_file_entry_t *file_entry,
+     int sub_file_entry_index,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_directory_cursor_sub_file_entry(
+     mount_file_entry_t *file_entry,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
 ssize_t mount_file_entry_read_buffer_at_offset(
          mount_file_entry_t *file_entry,
          void *buffer,
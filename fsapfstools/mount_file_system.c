@@ -44,6 +44,7 @@
 #include "fsapfstools_libfsapfs.h"
 #include "fsapfstools_libuna.h"
 #include "mount_file_system.h"
+#include "mount_path_cache.h"
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
@@ -198,6 +199,22 @@ int mount_file_system_initialize(
 
 #endif /* defined( HAVE_CLOCK_GETTIME ) */
 
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBOSXFUSE )
+	if( mount_path_cache_initialize(
+	     &( ( *file_system )->path_cache ),
+	     MOUNT_PATH_CACHE_MAXIMUM_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -234,6 +251,22 @@ int mount_file_system_free(
 	}
 	if( *file_system != NULL )
 	{
+		if( ( *file_system )->path_cache != NULL )
+		{
+			if( mount_path_cache_free(
+			     &( ( *file_system )->path_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *file_system );
 
@@ -1278,3 +1311,165 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the cached value of a specific path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_file_system_get_cached_value_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_cached_value_by_path";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_cache == NULL )
+	{
+		return( 0 );
+	}
+	result = mount_path_cache_get_value_by_path(
+	          file_system->path_cache,
+	          path,
+	          path_length,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from path cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the cached value of a specific path
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_system_set_cached_value_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_set_cached_value_by_path";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( mount_path_cache_set_value_by_path(
+	     file_system->path_cache,
+	     path,
+	     path_length,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value in path cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cached filename of a specific sub file entry
+ * The filename is escaped and must be freed after use
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_file_system_get_cached_filename_by_index(
+     mount_file_system_t *file_system,
+     libfsapfs_file_entry_t *fsapfs_parent_file_entry,
+     int sub_file_entry_index,
+     system_character_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "mount_file_system_get_cached_filename_by_index";
+	uint64_t parent_identifier = 0;
+	int result                 = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system->path_cache == NULL )
+	{
+		return( 0 );
+	}
+	if( libfsapfs_file_entry_get_identifier(
+	     fsapfs_parent_file_entry,
+	     &parent_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent identifier.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_path_cache_get_name_by_index(
+	          file_system->path_cache,
+	          parent_identifier,
+	          sub_file_entry_index,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from path cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
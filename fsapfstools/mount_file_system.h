@@ -27,6 +27,7 @@
 
 #include "fsapfstools_libcerror.h"
 #include "fsapfstools_libfsapfs.h"
+#include "mount_path_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -43,6 +44,12 @@ struct mount_file_system
 	/* The volume
 	 */
 	libfsapfs_volume_t *fsapfs_volume;
+
+	/* The path cache
+	 * The path cache is not thread-safe and therefore only created for FUSE,
+	 * which uses a single-threaded event loop
+	 */
+	mount_path_cache_t *path_cache;
 };
 
 int mount_file_system_initialize(
@@ -102,6 +109,28 @@ int mount_file_system_get_filename_from_file_entry(
      size_t *filename_size,
      libcerror_error_t **error );
 
+int mount_file_system_get_cached_value_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
+int mount_file_system_set_cached_value_by_path(
+     mount_file_system_t *file_system,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
+int mount_file_system_get_cached_filename_by_index(
+     mount_file_system_t *file_system,
+     libfsapfs_file_entry_t *fsapfs_parent_file_entry,
+     int sub_file_entry_index,
+     system_character_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
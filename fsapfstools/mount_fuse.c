@@ -41,6 +41,7 @@
 #include "fsapfstools_unused.h"
 #include "mount_fuse.h"
 #include "mount_handle.h"
+#include "mount_path_cache.h"
 
 extern mount_handle_t *fsapfsmount_mount_handle;
 
@@ -121,155 +122,187 @@ int mount_fuse_set_stat_info(
 	return( 1 );
 }
 
-/* Fills a directory entry
+/* Retrieves the cache value of a file entry
+ * The parent identifier and sub file entry index are not set
  * Returns 1 if successful or -1 on error
  */
-int mount_fuse_filldir(
-     void *buffer,
-     fuse_fill_dir_t filler,
-     const char *name,
-     struct stat *stat_info,
+int mount_fuse_get_file_entry_value(
      mount_file_entry_t *file_entry,
+     mount_path_cache_value_t *value,
      libcerror_error_t **error )
 {
-	static char *function      = "mount_fuse_filldir";
-	size64_t file_size         = 0;
-	uint64_t access_time       = 0;
-	uint64_t inode_change_time = 0;
-	uint64_t modification_time = 0;
-	uint16_t file_mode         = 0;
+	static char *function = "mount_fuse_get_file_entry_value";
 
-	if( filler == NULL )
+	if( value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filler.",
+		 "%s: invalid value.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry != NULL )
+	if( memory_set(
+	     value,
+	     0,
+	     sizeof( mount_path_cache_value_t ) ) == NULL )
 	{
-		if( mount_file_entry_get_size(
-		     file_entry,
-		     &file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear value.",
+		 function );
 
-			return( -1 );
-		}
-		if( mount_file_entry_get_file_mode(
-		     file_entry,
-		     &file_mode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file mode.",
-			 function );
+		return( -1 );
+	}
+	value->sub_file_entry_index = -1;
 
-			return( -1 );
-		}
-		if( mount_file_entry_get_access_time(
-		     file_entry,
-		     &access_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve access time.",
-			 function );
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &( value->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
 
-			return( -1 );
-		}
-		if( mount_file_entry_get_modification_time(
-		     file_entry,
-		     &modification_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve modification time.",
-			 function );
+		return( -1 );
+	}
+	if( mount_file_entry_get_file_mode(
+	     file_entry,
+	     &( value->file_mode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
 
-			return( -1 );
-		}
-		if( mount_file_entry_get_inode_change_time(
-		     file_entry,
-		     &inode_change_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode change time.",
-			 function );
+		return( -1 );
+	}
+	if( mount_file_entry_get_access_time(
+	     file_entry,
+	     &( value->access_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( memory_set(
-	     stat_info,
-	     0,
-	     sizeof( struct stat ) ) == NULL )
+	if( mount_file_entry_get_modification_time(
+	     file_entry,
+	     &( value->modification_time ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear stat info.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
 		 function );
 
 		return( -1 );
 	}
-	if( mount_fuse_set_stat_info(
-	     stat_info,
-	     file_size,
-	     file_mode,
-	     (int64_t) access_time,
-	     (int64_t) inode_change_time,
-	     (int64_t) modification_time,
+	if( mount_file_entry_get_inode_change_time(
+	     file_entry,
+	     &( value->inode_change_time ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set stat info.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change time.",
 		 function );
 
 		return( -1 );
 	}
-	if( filler(
-	     buffer,
-	     name,
+	return( 1 );
+}
+
+/* Fills a directory entry
+ * If value is NULL the stat info is cleared
+ * The next offset is the offset readdir is called with to continue after the directory entry
+ * Returns 1 if successful, 0 if the buffer is full or -1 on error
+ */
+int mount_fuse_filldir(
+     void *buffer,
+     fuse_fill_dir_t filler,
+     const char *name,
+     struct stat *stat_info,
+     const mount_path_cache_value_t *value,
+     off_t next_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_filldir";
+
+	if( filler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filler.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
 	     stat_info,
-	     0 ) == 1 )
+	     0,
+	     sizeof( struct stat ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set directory entry.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
 		 function );
 
 		return( -1 );
 	}
+	if( value != NULL )
+	{
+		if( mount_fuse_set_stat_info(
+		     stat_info,
+		     value->size,
+		     value->file_mode,
+		     (int64_t) value->access_time,
+		     (int64_t) value->inode_change_time,
+		     (int64_t) value->modification_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set stat info.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( filler(
+	     buffer,
+	     name,
+	     stat_info,
+	     next_offset ) != 0 )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
@@ -653,28 +686,34 @@ on_error:
 }
 
 /* Reads a directory
+ * The names and stat info of the sub file entries are cached by path
+ * so that repeated listings and stat calls do not need to query the file entries
  * Returns 0 if successful or a negative errno value otherwise
  */
 int mount_fuse_readdir(
      const char *path,
      void *buffer,
      fuse_fill_dir_t filler,
-     off_t offset FSAPFSTOOLS_ATTRIBUTE_UNUSED,
+     off_t offset,
      struct fuse_file_info *file_info FSAPFSTOOLS_ATTRIBUTE_UNUSED )
 {
+	mount_path_cache_value_t value;
+
 	struct stat *stat_info                = NULL;
 	libcerror_error_t *error              = NULL;
 	mount_file_entry_t *parent_file_entry = NULL;
 	mount_file_entry_t *sub_file_entry    = NULL;
 	static char *function                 = "mount_fuse_readdir";
 	char *name                            = NULL;
+	char *sub_path                        = NULL;
 	size_t name_size                      = 0;
-	int number_of_sub_file_entries        = 0;
+	size_t path_length                    = 0;
+	size_t sub_path_index                 = 0;
+	size_t sub_path_size                  = 0;
+	uint64_t identifier                   = 0;
 	int result                            = 0;
 	int sub_file_entry_index              = 0;
 
-	FSAPFSTOOLS_UNREFERENCED_PARAMETER( offset )
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -723,6 +762,14 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
+	path_length = narrow_string_length(
+	               path );
+
+	while( ( path_length > 0 )
+	    && ( path[ path_length - 1 ] == '/' ) )
+	{
+		path_length--;
+	}
 	stat_info = memory_allocate_structure(
 	             struct stat );
 
@@ -735,112 +782,195 @@ int mount_fuse_readdir(
 		 "%s: unable to create stat info.",
 		 function );
 
-		result = errno;
+		result = -ENOMEM;
 
 		goto on_error;
 	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     ".",
-	     stat_info,
-	     (mount_file_entry_t *) file_info->fh,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set self directory entry.",
-		 function );
+	/* The offset of the self directory entry is 1, of the parent directory entry 2
+	 * and of sub file entry N it is N + 3
+	 */
+	result = 1;
 
-		result = -EIO;
+	if( offset < 1 )
+	{
+		if( mount_fuse_get_file_entry_value(
+		     (mount_file_entry_t *) file_info->fh,
+		     &value,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve self directory entry value.",
+			 function );
 
-		goto on_error;
-	}
-	result = mount_file_entry_get_parent_file_entry(
-	          (mount_file_entry_t *) file_info->fh,
-	          &parent_file_entry,
-	          &error );
+			result = -EIO;
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent file entry.",
-		 function );
+			goto on_error;
+		}
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          ".",
+		          stat_info,
+		          &value,
+		          1,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set self directory entry.",
+			 function );
 
-		result = -EIO;
+			result = -EIO;
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( mount_fuse_filldir(
-	     buffer,
-	     filler,
-	     "..",
-	     stat_info,
-	     parent_file_entry,
-	     &error ) != 1 )
+	if( ( result != 0 )
+	 && ( offset < 2 ) )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set parent directory entry.",
-		 function );
+		result = mount_file_entry_get_parent_file_entry(
+		          (mount_file_entry_t *) file_info->fh,
+		          &parent_file_entry,
+		          &error );
 
-		result = -EIO;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent file entry.",
+			 function );
 
-		goto on_error;
+			result = -EIO;
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( mount_fuse_get_file_entry_value(
+			     parent_file_entry,
+			     &value,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve parent directory entry value.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          "..",
+		          stat_info,
+		          ( parent_file_entry != NULL ) ? &value : NULL,
+		          2,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set parent directory entry.",
+			 function );
+
+			result = -EIO;
+
+			goto on_error;
+		}
+		if( parent_file_entry != NULL )
+		{
+			if( mount_file_entry_free(
+			     &parent_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free parent file entry.",
+				 function );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
 	}
-	if( mount_file_entry_free(
-	     &parent_file_entry,
-	     &error ) != 1 )
+	if( result == 0 )
 	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free parent file entry.",
-		 function );
+		memory_free(
+		 stat_info );
 
-		result = -EIO;
+		return( 0 );
+	}
+	if( offset > 2 )
+	{
+		if( ( offset - 2 ) > (off_t) INT_MAX )
+		{
+			memory_free(
+			 stat_info );
 
-		goto on_error;
+			return( 0 );
+		}
+		sub_file_entry_index = (int) ( offset - 2 );
 	}
-	if( mount_file_entry_get_number_of_sub_file_entries(
+	if( mount_file_entry_get_identifier(
 	     (mount_file_entry_t *) file_info->fh,
-	     &number_of_sub_file_entries,
+	     &identifier,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
+		 "%s: unable to retrieve identifier.",
 		 function );
 
 		result = -EIO;
 
 		goto on_error;
 	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
+	/* The sub file entries are read with a directory cursor that is kept with the file handle
+	 * so that a directory listing that does not fit in a single buffer is continued where it stopped
+	 */
+	result = mount_file_entry_set_directory_cursor_index(
+	          (mount_file_entry_t *) file_info->fh,
+	          sub_file_entry_index,
+	          &error );
+
+	while( result == 1 )
 	{
-		if( mount_file_entry_get_sub_file_entry_by_index(
-		     (mount_file_entry_t *) file_info->fh,
-		     sub_file_entry_index,
-		     &sub_file_entry,
-		     &error ) != 1 )
+		result = mount_file_entry_get_cached_sub_file_entry_name(
+		          (mount_file_entry_t *) file_info->fh,
+		          sub_file_entry_index,
+		          &name,
+		          &name_size,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d.",
+			 "%s: unable to retrieve sub file entry: %d cached name.",
 			 function,
 			 sub_file_entry_index );
 
@@ -848,16 +978,92 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name_size(
-		     sub_file_entry,
-		     &name_size,
-		     &error ) != 1 )
+		else if( result == 0 )
+		{
+			if( mount_file_entry_get_directory_cursor_sub_file_entry(
+			     (mount_file_entry_t *) file_info->fh,
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			if( mount_file_entry_get_name_size(
+			     sub_file_entry,
+			     &name_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name size.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			name = narrow_string_allocate(
+			        name_size );
+
+			if( name == NULL )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sub file entry: %d name.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			if( mount_file_entry_get_name(
+			     sub_file_entry,
+			     name,
+			     name_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		/* The path of the sub file entry is: path + '/' + name
+		 */
+		sub_path_size = path_length + 1 + name_size;
+
+		sub_path = narrow_string_allocate(
+		            sub_path_size );
+
+		if( sub_path == NULL )
 		{
 			libcerror_error_set(
 			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name size.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub file entry: %d path.",
 			 function,
 			 sub_file_entry_index );
 
@@ -865,33 +1071,36 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
-		name = narrow_string_allocate(
-		        name_size );
-
-		if( name == NULL )
+		if( narrow_string_copy(
+		     sub_path,
+		     path,
+		     path_length ) == NULL )
 		{
 			libcerror_error_set(
 			 &error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub file entry: %d name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy path.",
 			 function );
 
 			result = -EIO;
 
 			goto on_error;
 		}
-		if( mount_file_entry_get_name(
-		     sub_file_entry,
+		sub_path_index = path_length;
+
+		sub_path[ sub_path_index++ ] = '/';
+
+		if( narrow_string_copy(
+		     &( sub_path[ sub_path_index ] ),
 		     name,
-		     name_size,
-		     &error ) != 1 )
+		     name_size - 1 ) == NULL )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy sub file entry: %d name.",
 			 function,
 			 sub_file_entry_index );
 
@@ -899,13 +1108,104 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
-		if( mount_fuse_filldir(
-		     buffer,
-		     filler,
-		     name,
-		     stat_info,
-		     sub_file_entry,
-		     &error ) != 1 )
+		sub_path[ sub_path_size - 1 ] = 0;
+
+		result = 0;
+
+		if( sub_file_entry == NULL )
+		{
+			result = mount_handle_get_cached_value_by_path(
+			          fsapfsmount_mount_handle,
+			          sub_path,
+			          &value,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d cached value.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			if( sub_file_entry == NULL )
+			{
+				if( mount_file_entry_get_directory_cursor_sub_file_entry(
+				     (mount_file_entry_t *) file_info->fh,
+				     &sub_file_entry,
+				     &error ) != 1 )
+				{
+					libcerror_error_set(
+					 &error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub file entry: %d.",
+					 function,
+					 sub_file_entry_index );
+
+					result = -EIO;
+
+					goto on_error;
+				}
+			}
+			if( mount_fuse_get_file_entry_value(
+			     sub_file_entry,
+			     &value,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d value.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+			value.parent_identifier    = identifier;
+			value.sub_file_entry_index = sub_file_entry_index;
+
+			if( mount_handle_set_cached_value_by_path(
+			     fsapfsmount_mount_handle,
+			     sub_path,
+			     &value,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set sub file entry: %d cached value.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		result = mount_fuse_filldir(
+		          buffer,
+		          filler,
+		          name,
+		          stat_info,
+		          &value,
+		          (off_t) sub_file_entry_index + 3,
+		          &error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 &error,
@@ -918,27 +1218,61 @@ int mount_fuse_readdir(
 
 			goto on_error;
 		}
+		memory_free(
+		 sub_path );
+
+		sub_path = NULL;
+
 		memory_free(
 		 name );
 
 		name = NULL;
 
-		if( mount_file_entry_free(
-		     &sub_file_entry,
-		     &error ) != 1 )
+		if( sub_file_entry != NULL )
 		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
+			if( mount_file_entry_free(
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				result = -EIO;
+
+				goto on_error;
+			}
+		}
+		/* Stop when the buffer is full, the directory cursor remains positioned at the sub file entry
+		 */
+		if( result == 0 )
+		{
+			break;
+		}
+		sub_file_entry_index++;
 
-			result = -EIO;
+		result = mount_file_entry_set_directory_cursor_index(
+		          (mount_file_entry_t *) file_info->fh,
+		          sub_file_entry_index,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to position directory cursor at sub file entry: %d.",
+		 function,
+		 sub_file_entry_index );
 
-			goto on_error;
-		}
+		result = -EIO;
+
+		goto on_error;
 	}
 	memory_free(
 	 stat_info );
@@ -953,6 +1287,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
 	if( name != NULL )
 	{
 		memory_free(
@@ -1042,20 +1381,18 @@ on_error:
 }
 
 /* Retrieves the file stat info
+ * The stat info is cached by path
  * Returns 0 if successful or a negative errno value otherwise
  */
 int mount_fuse_getattr(
      const char *path,
      struct stat *stat_info )
 {
+	mount_path_cache_value_t value;
+
 	libcerror_error_t *error       = NULL;
 	mount_file_entry_t *file_entry = NULL;
 	static char *function          = "mount_fuse_getattr";
-	size64_t file_size             = 0;
-	uint64_t access_time           = 0;
-	uint64_t inode_change_time     = 0;
-	uint64_t modification_time     = 0;
-	uint16_t file_mode             = 0;
 	int result                     = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1105,14 +1442,14 @@ int mount_fuse_getattr(
 		 "%s: unable to clear stat info.",
 		 function );
 
-		result = errno;
+		result = -EIO;
 
 		goto on_error;
 	}
-	result = mount_handle_get_file_entry_by_path(
+	result = mount_handle_get_cached_value_by_path(
 	          fsapfsmount_mount_handle,
 	          path,
-	          &file_entry,
+	          &value,
 	          &error );
 
 	if( result == -1 )
@@ -1121,105 +1458,97 @@ int mount_fuse_getattr(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value for: %s.",
+		 "%s: unable to retrieve cached value for: %s.",
 		 function,
 		 path );
 
-		result = -ENOENT;
+		result = -EIO;
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		return( -ENOENT );
-	}
-	if( mount_file_entry_get_size(
-	     file_entry,
-	     &file_size,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry size.",
-		 function );
-
-		result = -EIO;
+		result = mount_handle_get_file_entry_by_path(
+		          fsapfsmount_mount_handle,
+		          path,
+		          &file_entry,
+		          &error );
 
-		goto on_error;
-	}
-	if( mount_file_entry_get_file_mode(
-	     file_entry,
-	     &file_mode,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file mode.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value for: %s.",
+			 function,
+			 path );
 
-		result = -EIO;
+			result = -ENOENT;
 
-		goto on_error;
-	}
-	if( mount_file_entry_get_access_time(
-	     file_entry,
-	     &access_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve access time.",
-		 function );
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( -ENOENT );
+		}
+		if( mount_fuse_get_file_entry_value(
+		     file_entry,
+		     &value,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file entry value.",
+			 function );
 
-		result = -EIO;
+			result = -EIO;
 
-		goto on_error;
-	}
-	if( mount_file_entry_get_modification_time(
-	     file_entry,
-	     &modification_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve modification time.",
-		 function );
+			goto on_error;
+		}
+		if( mount_file_entry_free(
+		     &file_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file entry.",
+			 function );
 
-		result = -EIO;
+			result = -EIO;
 
-		goto on_error;
-	}
-	if( mount_file_entry_get_inode_change_time(
-	     file_entry,
-	     &inode_change_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode change time.",
-		 function );
+			goto on_error;
+		}
+		if( mount_handle_set_cached_value_by_path(
+		     fsapfsmount_mount_handle,
+		     path,
+		     &value,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached value for: %s.",
+			 function,
+			 path );
 
-		result = -EIO;
+			result = -EIO;
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( mount_fuse_set_stat_info(
 	     stat_info,
-	     file_size,
-	     file_mode,
-	     (int64_t) access_time,
-	     (int64_t) inode_change_time,
-	     (int64_t) modification_time,
+	     value.size,
+	     value.file_mode,
+	     (int64_t) value.access_time,
+	     (int64_t) value.inode_change_time,
+	     (int64_t) value.modification_time,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1233,21 +1562,6 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
-	if( mount_file_entry_free(
-	     &file_entry,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
 	return( 0 );
 
 on_error:
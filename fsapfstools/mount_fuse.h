@@ -41,6 +41,7 @@
 #include "fsapfstools_libfsapfs.h"
 #include "mount_file_entry.h"
 #include "mount_handle.h"
+#include "mount_path_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -57,12 +58,18 @@ int mount_fuse_set_stat_info(
      int64_t modification_time,
      libcerror_error_t **error );
 
+int mount_fuse_get_file_entry_value(
+     mount_file_entry_t *file_entry,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
 int mount_fuse_filldir(
      void *buffer,
      fuse_fill_dir_t filler,
      const char *name,
      struct stat *stat_info,
-     mount_file_entry_t *file_entry,
+     const mount_path_cache_value_t *value,
+     off_t next_offset,
      libcerror_error_t **error );
 
 int mount_fuse_open(
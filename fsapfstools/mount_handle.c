@@ -33,6 +33,7 @@
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 #include "mount_handle.h"
+#include "mount_path_cache.h"
 
 #if !defined( LIBFSAPFS_HAVE_BFIO )
 
@@ -1155,3 +1156,128 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the cached value of a specific path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_handle_get_cached_value_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_get_cached_value_by_path";
+	size_t path_length    = 0;
+	int result            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( ( path_length >= 2 )
+	 && ( path[ path_length - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	result = mount_file_system_get_cached_value_by_path(
+	          mount_handle->file_system,
+	          path,
+	          path_length,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the cached value of a specific path
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_cached_value_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_cached_value_by_path";
+	size_t path_length    = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( ( path_length >= 2 )
+	 && ( path[ path_length - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_length--;
+	}
+	if( mount_file_system_set_cached_value_by_path(
+	     mount_handle->file_system,
+	     path,
+	     path_length,
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cached value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -31,6 +31,7 @@
 #include "fsapfstools_libfsapfs.h"
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
+#include "mount_path_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -145,6 +146,18 @@ int mount_handle_get_file_entry_by_path(
      mount_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int mount_handle_get_cached_value_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
+int mount_handle_set_cached_value_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,861 @@
+/*
+ * Mount path cache
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fsapfstools_libcerror.h"
+#include "fsapfstools_libcpath.h"
+#include "mount_path_cache.h"
+
+/* Creates a path cache
+ * Make sure the value path_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_path_cache_initialize(
+     mount_path_cache_t **path_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "mount_path_cache_initialize";
+	size_t buckets_size        = 0;
+	size_t entries_size        = 0;
+	uint32_t number_of_buckets = 1;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use a power of 2 number of buckets of at least twice the number of entries
+	 */
+	while( number_of_buckets < ( 2 * (uint32_t) maximum_number_of_entries ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	*path_cache = memory_allocate_structure(
+	               mount_path_cache_t );
+
+	if( *path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *path_cache,
+	     0,
+	     sizeof( mount_path_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path cache.",
+		 function );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+
+		return( -1 );
+	}
+	entries_size = sizeof( mount_path_cache_entry_t ) * maximum_number_of_entries;
+
+	( *path_cache )->entries = (mount_path_cache_entry_t *) memory_allocate(
+	                                                         entries_size );
+
+	if( ( *path_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	buckets_size = sizeof( mount_path_cache_entry_t * ) * number_of_buckets;
+
+	( *path_cache )->path_buckets = (mount_path_cache_entry_t **) memory_allocate(
+	                                                               buckets_size );
+
+	if( ( *path_cache )->path_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *path_cache )->path_buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_cache )->index_buckets = (mount_path_cache_entry_t **) memory_allocate(
+	                                                                buckets_size );
+
+	if( ( *path_cache )->index_buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *path_cache )->index_buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *path_cache )->maximum_number_of_entries = maximum_number_of_entries;
+	( *path_cache )->number_of_buckets         = number_of_buckets;
+
+	return( 1 );
+
+on_error:
+	if( *path_cache != NULL )
+	{
+		if( ( *path_cache )->index_buckets != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->index_buckets );
+		}
+		if( ( *path_cache )->path_buckets != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->path_buckets );
+		}
+		if( ( *path_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *path_cache )->entries );
+		}
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a path cache
+ * Returns 1 if successful or -1 on error
+ */
+int mount_path_cache_free(
+     mount_path_cache_t **path_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_path_cache_free";
+	int entry_index       = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < ( *path_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *path_cache )->entries[ entry_index ].path != NULL )
+			{
+				memory_free(
+				 ( *path_cache )->entries[ entry_index ].path );
+			}
+		}
+		memory_free(
+		 ( *path_cache )->index_buckets );
+
+		memory_free(
+		 ( *path_cache )->path_buckets );
+
+		memory_free(
+		 ( *path_cache )->entries );
+
+		memory_free(
+		 *path_cache );
+
+		*path_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of a path
+ * Returns the hash
+ */
+uint32_t mount_path_cache_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length )
+{
+	size_t path_index = 0;
+	uint32_t hash     = 0x811c9dc5UL;
+
+	/* The hash is the 32-bit FNV-1a hash of the path characters
+	 */
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		hash ^= (uint32_t) path[ path_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Calculates the hash of a parent identifier and sub file entry index
+ * Returns the hash
+ */
+uint32_t mount_path_cache_calculate_index_hash(
+          uint64_t parent_identifier,
+          int sub_file_entry_index )
+{
+	uint64_t value_64bit = 0;
+
+	value_64bit  = parent_identifier * 0x9e3779b97f4a7c15ULL;
+	value_64bit ^= (uint64_t) (uint32_t) sub_file_entry_index;
+	value_64bit *= 0xff51afd7ed558ccdULL;
+
+	return( (uint32_t) ( value_64bit >> 32 ) );
+}
+
+/* Marks an entry as the most recently used entry
+ */
+void mount_path_cache_touch_entry(
+      mount_path_cache_t *path_cache,
+      mount_path_cache_entry_t *entry )
+{
+	if( ( path_cache == NULL )
+	 || ( entry == NULL )
+	 || ( path_cache->most_recently_used_entry == entry ) )
+	{
+		return;
+	}
+	/* Remove the entry from the used list
+	 */
+	if( entry->previous_used_entry != NULL )
+	{
+		entry->previous_used_entry->next_used_entry = entry->next_used_entry;
+	}
+	if( entry->next_used_entry != NULL )
+	{
+		entry->next_used_entry->previous_used_entry = entry->previous_used_entry;
+	}
+	if( path_cache->least_recently_used_entry == entry )
+	{
+		path_cache->least_recently_used_entry = entry->previous_used_entry;
+	}
+	/* Insert the entry at the front of the used list
+	 */
+	entry->previous_used_entry = NULL;
+	entry->next_used_entry     = path_cache->most_recently_used_entry;
+
+	if( path_cache->most_recently_used_entry != NULL )
+	{
+		path_cache->most_recently_used_entry->previous_used_entry = entry;
+	}
+	path_cache->most_recently_used_entry = entry;
+
+	if( path_cache->least_recently_used_entry == NULL )
+	{
+		path_cache->least_recently_used_entry = entry;
+	}
+}
+
+/* Removes an entry from the hash buckets and the used list
+ */
+void mount_path_cache_unlink_entry(
+      mount_path_cache_t *path_cache,
+      mount_path_cache_entry_t *entry )
+{
+	mount_path_cache_entry_t **bucket_entry = NULL;
+	uint32_t bucket_index                   = 0;
+
+	if( ( path_cache == NULL )
+	 || ( entry == NULL ) )
+	{
+		return;
+	}
+	bucket_index = entry->path_hash & ( path_cache->number_of_buckets - 1 );
+	bucket_entry = &( path_cache->path_buckets[ bucket_index ] );
+
+	while( *bucket_entry != NULL )
+	{
+		if( *bucket_entry == entry )
+		{
+			*bucket_entry = entry->next_path_entry;
+
+			break;
+		}
+		bucket_entry = &( ( *bucket_entry )->next_path_entry );
+	}
+	if( entry->value.sub_file_entry_index >= 0 )
+	{
+		bucket_index = mount_path_cache_calculate_index_hash(
+		                entry->value.parent_identifier,
+		                entry->value.sub_file_entry_index );
+
+		bucket_index &= path_cache->number_of_buckets - 1;
+		bucket_entry  = &( path_cache->index_buckets[ bucket_index ] );
+
+		while( *bucket_entry != NULL )
+		{
+			if( *bucket_entry == entry )
+			{
+				*bucket_entry = entry->next_index_entry;
+
+				break;
+			}
+			bucket_entry = &( ( *bucket_entry )->next_index_entry );
+		}
+	}
+	if( entry->previous_used_entry != NULL )
+	{
+		entry->previous_used_entry->next_used_entry = entry->next_used_entry;
+	}
+	if( entry->next_used_entry != NULL )
+	{
+		entry->next_used_entry->previous_used_entry = entry->previous_used_entry;
+	}
+	if( path_cache->most_recently_used_entry == entry )
+	{
+		path_cache->most_recently_used_entry = entry->next_used_entry;
+	}
+	if( path_cache->least_recently_used_entry == entry )
+	{
+		path_cache->least_recently_used_entry = entry->previous_used_entry;
+	}
+	entry->next_path_entry     = NULL;
+	entry->next_index_entry    = NULL;
+	entry->previous_used_entry = NULL;
+	entry->next_used_entry     = NULL;
+}
+
+/* Retrieves the entry of a specific path
+ * The entry is marked as the most recently used entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_path_cache_get_entry_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	mount_path_cache_entry_t *bucket_entry = NULL;
+	static char *function                  = "mount_path_cache_get_entry_by_path";
+	uint32_t path_hash                     = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	path_hash = mount_path_cache_calculate_path_hash(
+	             path,
+	             path_length );
+
+	bucket_entry = path_cache->path_buckets[ path_hash & ( path_cache->number_of_buckets - 1 ) ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->path_hash == path_hash )
+		 && ( bucket_entry->path_length == path_length )
+		 && ( memory_compare(
+		       bucket_entry->path,
+		       path,
+		       sizeof( system_character_t ) * path_length ) == 0 ) )
+		{
+			mount_path_cache_touch_entry(
+			 path_cache,
+			 bucket_entry );
+
+			*entry = bucket_entry;
+
+			return( 1 );
+		}
+		bucket_entry = bucket_entry->next_path_entry;
+	}
+	return( 0 );
+}
+
+/* Retrieves the value of a specific path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_path_cache_get_value_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	mount_path_cache_entry_t *entry = NULL;
+	static char *function           = "mount_path_cache_get_value_by_path";
+	int result                      = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          path,
+	          path_length,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*value = entry->value;
+	}
+	return( result );
+}
+
+/* Retrieves the name of a specific sub file entry of a parent directory
+ * The name is the escaped name as used in the path of the entry
+ * The name must be freed after use
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_path_cache_get_name_by_index(
+     mount_path_cache_t *path_cache,
+     uint64_t parent_identifier,
+     int sub_file_entry_index,
+     system_character_t **name,
+     size_t *name_size,
+     libcerror_error_t **error )
+{
+	mount_path_cache_entry_t *bucket_entry = NULL;
+	static char *function                  = "mount_path_cache_get_name_by_index";
+	size_t safe_name_size                  = 0;
+	uint32_t bucket_index                  = 0;
+
+	if( path_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry_index < 0 )
+	{
+		return( 0 );
+	}
+	bucket_index = mount_path_cache_calculate_index_hash(
+	                parent_identifier,
+	                sub_file_entry_index );
+
+	bucket_entry = path_cache->index_buckets[ bucket_index & ( path_cache->number_of_buckets - 1 ) ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->value.parent_identifier == parent_identifier )
+		 && ( bucket_entry->value.sub_file_entry_index == sub_file_entry_index ) )
+		{
+			break;
+		}
+		bucket_entry = bucket_entry->next_index_entry;
+	}
+	if( bucket_entry == NULL )
+	{
+		return( 0 );
+	}
+	safe_name_size = bucket_entry->path_length - bucket_entry->name_index + 1;
+
+	*name = system_string_allocate(
+	         safe_name_size );
+
+	if( *name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     *name,
+	     &( bucket_entry->path[ bucket_entry->name_index ] ),
+	     safe_name_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 *name );
+
+		*name = NULL;
+
+		return( -1 );
+	}
+	( *name )[ safe_name_size - 1 ] = 0;
+
+	*name_size = safe_name_size;
+
+	mount_path_cache_touch_entry(
+	 path_cache,
+	 bucket_entry );
+
+	return( 1 );
+}
+
+/* Sets the value of a specific path
+ * If the cache is full the least recently used entry is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int mount_path_cache_set_value_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error )
+{
+	mount_path_cache_entry_t *entry = NULL;
+	system_character_t *entry_path  = NULL;
+	static char *function           = "mount_path_cache_set_value_by_path";
+	size_t name_index               = 0;
+	uint32_t bucket_index           = 0;
+	int result                      = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          path,
+	          path_length,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		entry_path = system_string_allocate(
+		              path_length + 1 );
+
+		if( entry_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create path.",
+			 function );
+
+			return( -1 );
+		}
+		if( system_string_copy(
+		     entry_path,
+		     path,
+		     path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			memory_free(
+			 entry_path );
+
+			return( -1 );
+		}
+		entry_path[ path_length ] = 0;
+
+		if( path_cache->number_of_entries < path_cache->maximum_number_of_entries )
+		{
+			entry = &( path_cache->entries[ path_cache->number_of_entries++ ] );
+
+			if( memory_set(
+			     entry,
+			     0,
+			     sizeof( mount_path_cache_entry_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear entry.",
+				 function );
+
+				path_cache->number_of_entries -= 1;
+
+				memory_free(
+				 entry_path );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			entry = path_cache->least_recently_used_entry;
+
+			mount_path_cache_unlink_entry(
+			 path_cache,
+			 entry );
+
+			memory_free(
+			 entry->path );
+		}
+		for( name_index = path_length;
+		     name_index > 0;
+		     name_index-- )
+		{
+			if( path[ name_index - 1 ] == (system_character_t) LIBCPATH_SEPARATOR )
+			{
+				break;
+			}
+		}
+		entry->path        = entry_path;
+		entry->path_length = path_length;
+		entry->name_index  = name_index;
+		entry->path_hash   = mount_path_cache_calculate_path_hash(
+		                      path,
+		                      path_length );
+
+		bucket_index = entry->path_hash & ( path_cache->number_of_buckets - 1 );
+
+		entry->next_path_entry                    = path_cache->path_buckets[ bucket_index ];
+		path_cache->path_buckets[ bucket_index ] = entry;
+	}
+	else if( entry->value.sub_file_entry_index >= 0 )
+	{
+		/* Remove the entry from the index bucket since the index can change
+		 */
+		mount_path_cache_unlink_entry(
+		 path_cache,
+		 entry );
+
+		bucket_index = entry->path_hash & ( path_cache->number_of_buckets - 1 );
+
+		entry->next_path_entry                    = path_cache->path_buckets[ bucket_index ];
+		path_cache->path_buckets[ bucket_index ] = entry;
+	}
+	entry->value = *value;
+
+	if( entry->value.sub_file_entry_index >= 0 )
+	{
+		bucket_index = mount_path_cache_calculate_index_hash(
+		                entry->value.parent_identifier,
+		                entry->value.sub_file_entry_index );
+
+		bucket_index &= path_cache->number_of_buckets - 1;
+
+		entry->next_index_entry                   = path_cache->index_buckets[ bucket_index ];
+		path_cache->index_buckets[ bucket_index ] = entry;
+	}
+	mount_path_cache_touch_entry(
+	 path_cache,
+	 entry );
+
+	return( 1 );
+}
+
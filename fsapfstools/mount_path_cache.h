@@ -0,0 +1,208 @@
+/*
+ * Mount path cache
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_PATH_CACHE_H )
+#define _MOUNT_PATH_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fsapfstools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of entries in the path cache
+ */
+#define MOUNT_PATH_CACHE_MAXIMUM_NUMBER_OF_ENTRIES	16384
+
+typedef struct mount_path_cache_value mount_path_cache_value_t;
+
+struct mount_path_cache_value
+{
+	/* The identifier of the parent directory
+	 */
+	uint64_t parent_identifier;
+
+	/* The index of the entry in the parent directory or -1 if not known
+	 */
+	int sub_file_entry_index;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+
+	/* The access time
+	 */
+	uint64_t access_time;
+
+	/* The inode change time
+	 */
+	uint64_t inode_change_time;
+
+	/* The modification time
+	 */
+	uint64_t modification_time;
+};
+
+typedef struct mount_path_cache_entry mount_path_cache_entry_t;
+
+struct mount_path_cache_entry
+{
+	/* The path, which contains the escaped name as the last segment
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The index of the name in the path
+	 */
+	size_t name_index;
+
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The value
+	 */
+	mount_path_cache_value_t value;
+
+	/* The next entry with the same path hash bucket
+	 */
+	mount_path_cache_entry_t *next_path_entry;
+
+	/* The next entry with the same sub file entry index hash bucket
+	 */
+	mount_path_cache_entry_t *next_index_entry;
+
+	/* The previous (more recently used) entry
+	 */
+	mount_path_cache_entry_t *previous_used_entry;
+
+	/* The next (less recently used) entry
+	 */
+	mount_path_cache_entry_t *next_used_entry;
+};
+
+typedef struct mount_path_cache mount_path_cache_t;
+
+struct mount_path_cache
+{
+	/* The entries
+	 */
+	mount_path_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The path hash buckets
+	 */
+	mount_path_cache_entry_t **path_buckets;
+
+	/* The sub file entry index hash buckets
+	 */
+	mount_path_cache_entry_t **index_buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	mount_path_cache_entry_t *most_recently_used_entry;
+
+	/* The least recently used entry
+	 */
+	mount_path_cache_entry_t *least_recently_used_entry;
+};
+
+int mount_path_cache_initialize(
+     mount_path_cache_t **path_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int mount_path_cache_free(
+     mount_path_cache_t **path_cache,
+     libcerror_error_t **error );
+
+uint32_t mount_path_cache_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length );
+
+uint32_t mount_path_cache_calculate_index_hash(
+          uint64_t parent_identifier,
+          int sub_file_entry_index );
+
+void mount_path_cache_touch_entry(
+      mount_path_cache_t *path_cache,
+      mount_path_cache_entry_t *entry );
+
+void mount_path_cache_unlink_entry(
+      mount_path_cache_t *path_cache,
+      mount_path_cache_entry_t *entry );
+
+int mount_path_cache_get_entry_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int mount_path_cache_get_value_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
+int mount_path_cache_get_name_by_index(
+     mount_path_cache_t *path_cache,
+     uint64_t parent_identifier,
+     int sub_file_entry_index,
+     system_character_t **name,
+     size_t *name_size,
+     libcerror_error_t **error );
+
+int mount_path_cache_set_value_by_path(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     size_t path_length,
+     const mount_path_cache_value_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_PATH_CACHE_H ) */
+
@@ -135,15 +135,15 @@ struct fsapfs_container_superblock
 	 */
 	uint8_t unknown9[ 4 ];
 
-	/* Unknown
+	/* The checkpoint descriptor index
 	 * Consists of 4 bytes
 	 */
-	uint8_t unknown10[ 4 ];
+	uint8_t checkpoint_descriptor_index[ 4 ];
 
-	/* Unknown
+	/* The checkpoint descriptor number of blocks
 	 * Consists of 4 bytes
 	 */
-	uint8_t unknown11[ 4 ];
+	uint8_t checkpoint_descriptor_number_of_blocks[ 4 ];
 
 	/* Unknown
 	 * Consists of 4 bytes
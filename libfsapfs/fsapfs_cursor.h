@@ -0,0 +1,93 @@
+/*
+ * The serialized cursor definitions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSAPFS_CURSOR_H )
+#define _FSAPFS_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsapfs_cursor_header fsapfs_cursor_header_t;
+
+struct fsapfs_cursor_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "fsapfscr"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The volume transaction identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t transaction_identifier[ 8 ];
+
+	/* The directory identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t directory_identifier[ 8 ];
+
+	/* The number of levels
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_levels[ 4 ];
+
+	/* The key data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_data_size[ 4 ];
+};
+
+typedef struct fsapfs_cursor_level fsapfs_cursor_level_t;
+
+struct fsapfs_cursor_level
+{
+	/* The node block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t block_number[ 8 ];
+
+	/* The entry index
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry_index[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSAPFS_CURSOR_H ) */
+
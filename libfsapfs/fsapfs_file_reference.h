@@ -0,0 +1,72 @@
+/*
+ * The file reference definitions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSAPFS_FILE_REFERENCE_H )
+#define _FSAPFS_FILE_REFERENCE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsapfs_file_reference fsapfs_file_reference_t;
+
+struct fsapfs_file_reference
+{
+	/* The volume transaction identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t transaction_identifier[ 8 ];
+
+	/* The identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t identifier[ 8 ];
+
+	/* The parent identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t parent_identifier[ 8 ];
+
+	/* The data stream size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_stream_size[ 8 ];
+
+	/* The modification time
+	 * Consists of 8 bytes
+	 */
+	uint8_t modification_time[ 8 ];
+
+	/* The file mode
+	 * Consists of 2 bytes
+	 */
+	uint8_t file_mode[ 2 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSAPFS_FILE_REFERENCE_H ) */
+
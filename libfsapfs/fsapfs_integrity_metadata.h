@@ -0,0 +1,97 @@
+/*
+ * The APFS integrity metadata definitions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSAPFS_INTEGRITY_METADATA_H )
+#define _FSAPFS_INTEGRITY_METADATA_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fsapfs_integrity_metadata fsapfs_integrity_metadata_t;
+
+struct fsapfs_integrity_metadata
+{
+	/* The object checksum
+	 * Consists of 8 bytes
+	 */
+	uint8_t object_checksum[ 8 ];
+
+	/* The object identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t object_identifier[ 8 ];
+
+	/* The object transaction identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t object_transaction_identifier[ 8 ];
+
+	/* The object type
+	 * Consists of 4 bytes
+	 */
+	uint8_t object_type[ 4 ];
+
+	/* The object subtype
+	 * Consists of 4 bytes
+	 */
+	uint8_t object_subtype[ 4 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The hash type
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_type[ 4 ];
+
+	/* The root hash offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t root_hash_offset[ 4 ];
+
+	/* The broken transaction identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t broken_transaction_identifier[ 8 ];
+
+	/* Unknown (reserved)
+	 * Consists of 72 bytes
+	 */
+	uint8_t unknown1[ 72 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FSAPFS_INTEGRITY_METADATA_H ) */
+
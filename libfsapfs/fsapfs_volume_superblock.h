@@ -384,6 +384,37 @@ struct fsapfs_volume_superblock
 	 * Consists of 32 bytes
 	 */
 	uint8_t unknown62[ 32 ];
+
+	/* The volume group identifier
+	 * Consists of 16 bytes
+	 * Contains an UUID
+	 */
+	uint8_t volume_group_identifier[ 16 ];
+
+	/* The integrity metadata object identifier
+	 * Consists of 8 bytes
+	 */
+	uint8_t integrity_metadata_object_identifier[ 8 ];
+
+	/* The file extent tree block number
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_extent_tree_block_number[ 8 ];
+
+	/* The file extent tree object type
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_extent_tree_object_type[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown63[ 4 ];
+
+	/* Unknown
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown64[ 8 ];
 };
 
 #if defined( __cplusplus )
@@ -0,0 +1,520 @@
+/*
+ * Block buffer pool functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_block_buffer_pool.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+/* Creates a block buffer pool
+ * Make sure the value block_buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_initialize(
+     libfsapfs_block_buffer_pool_t **block_buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_buffer_pool_initialize";
+
+	if( block_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*block_buffer_pool = memory_allocate_structure(
+	                      libfsapfs_block_buffer_pool_t );
+
+	if( *block_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_buffer_pool,
+	     0,
+	     sizeof( libfsapfs_block_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block buffer pool.",
+		 function );
+
+		memory_free(
+		 *block_buffer_pool );
+
+		*block_buffer_pool = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *block_buffer_pool )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *block_buffer_pool != NULL )
+	{
+		memory_free(
+		 *block_buffer_pool );
+
+		*block_buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block buffer pool
+ * Buffers that were retrieved from the pool and not released are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_free(
+     libfsapfs_block_buffer_pool_t **block_buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_buffer_pool_free";
+	int buffer_index      = 0;
+	int result            = 1;
+
+	if( block_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_buffer_pool != NULL )
+	{
+		for( buffer_index = 0;
+		     buffer_index < ( *block_buffer_pool )->number_of_buffers;
+		     buffer_index++ )
+		{
+			if( libfsapfs_block_buffer_pool_free_aligned_buffer(
+			     &( ( *block_buffer_pool )->buffers[ buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free buffer: %d.",
+				 function,
+				 buffer_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *block_buffer_pool )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *block_buffer_pool );
+
+		*block_buffer_pool = NULL;
+	}
+	return( result );
+}
+
+/* Allocates a buffer that is aligned to LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT
+ * so it can also be used for unbuffered (direct) IO
+ * The pointer of the underlying allocation is stored in front of the aligned buffer
+ * The buffer must be freed with libfsapfs_block_buffer_pool_free_aligned_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *allocated_buffer = NULL;
+	static char *function     = "libfsapfs_block_buffer_pool_allocate_aligned_buffer";
+	intptr_t aligned_address  = 0;
+
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT - sizeof( uint8_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	allocated_buffer = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * ( buffer_size + LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT + sizeof( uint8_t * ) ) );
+
+	if( allocated_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_address  = (intptr_t) &( allocated_buffer[ sizeof( uint8_t * ) ] );
+	aligned_address += LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT - 1;
+	aligned_address &= ~( (intptr_t) LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT - 1 );
+
+	*buffer = (uint8_t *) aligned_address;
+
+	( (uint8_t **) *buffer )[ -1 ] = allocated_buffer;
+
+	return( 1 );
+}
+
+/* Frees a buffer allocated with libfsapfs_block_buffer_pool_allocate_aligned_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_free_aligned_buffer(
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_buffer_pool_free_aligned_buffer";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 ( (uint8_t **) *buffer )[ -1 ] );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves a buffer from the block buffer pool
+ * A new aligned buffer is allocated if no buffer of the requested size is available
+ * The buffer must be returned with libfsapfs_block_buffer_pool_release_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_get_buffer(
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_buffer_pool_get_buffer";
+
+	if( block_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_buffer_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( block_buffer_pool->number_of_buffers > 0 )
+	 && ( block_buffer_pool->buffer_size == buffer_size ) )
+	{
+		block_buffer_pool->number_of_buffers -= 1;
+
+		*buffer = block_buffer_pool->buffers[ block_buffer_pool->number_of_buffers ];
+
+		block_buffer_pool->buffers[ block_buffer_pool->number_of_buffers ] = NULL;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_buffer_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( *buffer == NULL )
+	{
+		if( libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+		     buffer_size,
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *buffer != NULL )
+	{
+		libfsapfs_block_buffer_pool_free_aligned_buffer(
+		 buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Returns a buffer to the block buffer pool
+ * The buffer is cleared before it is made available for reuse, it is freed
+ * if the pool is full or the buffer size differs from the pool buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_buffer_pool_release_buffer(
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_buffer_pool_release_buffer";
+	int result            = 1;
+
+	if( block_buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     *buffer,
+	     0,
+	     buffer_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_buffer_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libfsapfs_block_buffer_pool_free_aligned_buffer(
+		 buffer,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	/* The pool takes the size of the first buffer that is returned to it
+	 */
+	if( block_buffer_pool->number_of_buffers == 0 )
+	{
+		block_buffer_pool->buffer_size = buffer_size;
+	}
+	if( ( result == 1 )
+	 && ( block_buffer_pool->buffer_size == buffer_size )
+	 && ( block_buffer_pool->number_of_buffers < LIBFSAPFS_BLOCK_BUFFER_POOL_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		block_buffer_pool->buffers[ block_buffer_pool->number_of_buffers ] = *buffer;
+
+		block_buffer_pool->number_of_buffers += 1;
+
+		*buffer = NULL;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_buffer_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( *buffer != NULL )
+	{
+		if( libfsapfs_block_buffer_pool_free_aligned_buffer(
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
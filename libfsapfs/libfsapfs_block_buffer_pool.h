@@ -0,0 +1,93 @@
+/*
+ * Block buffer pool functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_BLOCK_BUFFER_POOL_H )
+#define _LIBFSAPFS_BLOCK_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_block_buffer_pool libfsapfs_block_buffer_pool_t;
+
+struct libfsapfs_block_buffer_pool
+{
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffers that are available for reuse
+	 */
+	uint8_t *buffers[ LIBFSAPFS_BLOCK_BUFFER_POOL_MAXIMUM_NUMBER_OF_BUFFERS ];
+
+	/* The number of buffers that are available for reuse
+	 */
+	int number_of_buffers;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_block_buffer_pool_initialize(
+     libfsapfs_block_buffer_pool_t **block_buffer_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_block_buffer_pool_free(
+     libfsapfs_block_buffer_pool_t **block_buffer_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libfsapfs_block_buffer_pool_free_aligned_buffer(
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libfsapfs_block_buffer_pool_get_buffer(
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     size_t buffer_size,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libfsapfs_block_buffer_pool_release_buffer(
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     uint8_t **buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_BLOCK_BUFFER_POOL_H ) */
+
@@ -33,6 +33,7 @@
 #include "libfsapfs_libcnotify.h"
 
 #include "fsapfs_btree.h"
+#include "fsapfs_file_extent_tree.h"
 #include "fsapfs_object.h"
 #include "fsapfs_object_map.h"
 
@@ -490,6 +491,11 @@ int libfsapfs_btree_node_read_data(
 					value_data_size = (uint16_t) sizeof( fsapfs_object_map_btree_value_t );
 					break;
 
+				case 0x0000001fUL:
+					key_data_size   = (uint16_t) sizeof( fsapfs_file_extent_tree_key_t );
+					value_data_size = (uint16_t) sizeof( fsapfs_file_extent_tree_value_t );
+					break;
+
 				default:
 					libcerror_error_set(
 					 error,
@@ -503,7 +509,17 @@ int libfsapfs_btree_node_read_data(
 			}
 			if( ( btree_node->node_header->flags & 0x0002 ) == 0 )
 			{
-				value_data_size = 8;
+				/* The branch node value of a hashed B-tree contains
+				 * the child object identifier followed by a 64-byte hash
+				 */
+				if( ( btree_node->node_header->flags & 0x0008 ) != 0 )
+				{
+					value_data_size = 8 + 64;
+				}
+				else
+				{
+					value_data_size = 8;
+				}
 			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -924,3 +940,132 @@ int libfsapfs_btree_node_get_entry_by_index(
 	return( 1 );
 }
 
+/* Determines if the node is a root node
+ * Returns 1 if the node is a root node, 0 if not or -1 on error
+ */
+int libfsapfs_btree_node_is_root_node(
+     libfsapfs_btree_node_t *btree_node,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_btree_node_is_root_node";
+
+	if( btree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_node->node_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree node - missing node header.",
+		 function );
+
+		return( -1 );
+	}
+	return( btree_node->node_header->flags & 0x0001 );
+}
+
+/* Retrieves the amount of memory used by the B-tree node
+ * This includes the node header, footer and the entries with their key and value data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_btree_node_get_memory_usage(
+     libfsapfs_btree_node_t *btree_node,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	static char *function                = "libfsapfs_btree_node_get_memory_usage";
+	size64_t safe_memory_usage           = 0;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
+
+	if( btree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libfsapfs_btree_node_t );
+
+	if( btree_node->node_header != NULL )
+	{
+		safe_memory_usage += sizeof( libfsapfs_btree_node_header_t );
+	}
+	if( btree_node->footer != NULL )
+	{
+		safe_memory_usage += sizeof( libfsapfs_btree_footer_t );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     btree_node->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     btree_node->entries_array,
+		     entry_index,
+		     (intptr_t **) &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d from array.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		safe_memory_usage += sizeof( intptr_t * );
+
+		if( btree_entry != NULL )
+		{
+			safe_memory_usage += sizeof( libfsapfs_btree_entry_t )
+			                   + btree_entry->key_data_size
+			                   + btree_entry->value_data_size;
+		}
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
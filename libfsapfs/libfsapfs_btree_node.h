@@ -95,6 +95,15 @@ int libfsapfs_btree_node_get_entry_by_index(
      libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error );
 
+int libfsapfs_btree_node_is_root_node(
+     libfsapfs_btree_node_t *btree_node,
+     libcerror_error_t **error );
+
+int libfsapfs_btree_node_get_memory_usage(
+     libfsapfs_btree_node_t *btree_node,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,550 @@
+/*
+ * Cache memory usage functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_usage.h"
+#include "libfsapfs_data_block.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libfcache.h"
+
+/* Retrieves the amount of memory used by the B-tree nodes in a node cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_usage_get_node_cache_memory_usage(
+     libfcache_cache_t *node_cache,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_cache_usage_get_node_cache_memory_usage";
+	size64_t node_memory_usage           = 0;
+	size64_t safe_memory_usage           = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     node_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libfcache_cache_get_value_by_index(
+		     node_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		node = NULL;
+
+		if( cache_value != NULL )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree node from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( node == NULL )
+		{
+			continue;
+		}
+		if( libfsapfs_btree_node_get_memory_usage(
+		     node,
+		     &node_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of B-tree node: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		safe_memory_usage += node_memory_usage;
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
+/* Retrieves the amount of memory used by the data blocks in a data block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+     libfcache_cache_t *data_block_cache,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	static char *function                = "libfsapfs_cache_usage_get_data_block_cache_memory_usage";
+	size64_t safe_memory_usage           = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     data_block_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( libfcache_cache_get_value_by_index(
+		     data_block_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		data_block = NULL;
+
+		if( cache_value != NULL )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data block from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( data_block != NULL )
+		{
+			safe_memory_usage += sizeof( libfsapfs_data_block_t ) + data_block->data_size;
+		}
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
+/* Trims a node cache
+ * Only B-tree nodes of the trim level are removed, where the root node is
+ * considered a root node even if it is also a leaf node
+ * Nodes are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_usage_trim_node_cache(
+     libfcache_cache_t *node_cache,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_cache_usage_trim_node_cache";
+	size64_t node_memory_usage           = 0;
+	int cache_entry_index                = 0;
+	int node_trim_level                  = 0;
+	int number_of_cache_entries          = 0;
+	int result                           = 0;
+
+	if( ( trim_level != LIBFSAPFS_CACHE_TRIM_LEVEL_LEAF_NODES )
+	 && ( trim_level != LIBFSAPFS_CACHE_TRIM_LEVEL_BRANCH_NODES )
+	 && ( trim_level != LIBFSAPFS_CACHE_TRIM_LEVEL_ROOT_NODES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported trim level.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     node_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( *memory_usage <= target_memory_usage )
+		{
+			break;
+		}
+		if( libfcache_cache_get_value_by_index(
+		     node_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		node = NULL;
+
+		if( cache_value != NULL )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree node from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( node == NULL )
+		{
+			continue;
+		}
+		result = libfsapfs_btree_node_is_root_node(
+		          node,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node: %d is a root node.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			node_trim_level = LIBFSAPFS_CACHE_TRIM_LEVEL_ROOT_NODES;
+		}
+		else
+		{
+			result = libfsapfs_btree_node_is_leaf_node(
+			          node,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if B-tree node: %d is a leaf node.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				node_trim_level = LIBFSAPFS_CACHE_TRIM_LEVEL_LEAF_NODES;
+			}
+			else
+			{
+				node_trim_level = LIBFSAPFS_CACHE_TRIM_LEVEL_BRANCH_NODES;
+			}
+		}
+		if( node_trim_level != trim_level )
+		{
+			continue;
+		}
+		if( libfsapfs_btree_node_get_memory_usage(
+		     node,
+		     &node_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of B-tree node: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( libfcache_cache_clear_value_by_index(
+		     node_cache,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( node_memory_usage < *memory_usage )
+		{
+			*memory_usage -= node_memory_usage;
+		}
+		else
+		{
+			*memory_usage = 0;
+		}
+	}
+	return( 1 );
+}
+
+/* Trims a data block cache
+ * Data blocks are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed data blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_usage_trim_data_block_cache(
+     libfcache_cache_t *data_block_cache,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	static char *function                = "libfsapfs_cache_usage_trim_data_block_cache";
+	size64_t data_block_memory_usage     = 0;
+	int cache_entry_index                = 0;
+	int number_of_cache_entries          = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_entries(
+	     data_block_cache,
+	     &number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_entry_index = 0;
+	     cache_entry_index < number_of_cache_entries;
+	     cache_entry_index++ )
+	{
+		if( *memory_usage <= target_memory_usage )
+		{
+			break;
+		}
+		if( libfcache_cache_get_value_by_index(
+		     data_block_cache,
+		     cache_entry_index,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		data_block = NULL;
+
+		if( cache_value != NULL )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data block from cache value: %d.",
+				 function,
+				 cache_entry_index );
+
+				return( -1 );
+			}
+		}
+		if( data_block == NULL )
+		{
+			continue;
+		}
+		data_block_memory_usage = sizeof( libfsapfs_data_block_t ) + data_block->data_size;
+
+		if( libfcache_cache_clear_value_by_index(
+		     data_block_cache,
+		     cache_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear cache value: %d.",
+			 function,
+			 cache_entry_index );
+
+			return( -1 );
+		}
+		if( data_block_memory_usage < *memory_usage )
+		{
+			*memory_usage -= data_block_memory_usage;
+		}
+		else
+		{
+			*memory_usage = 0;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,63 @@
+/*
+ * Cache memory usage functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_CACHE_USAGE_H )
+#define _LIBFSAPFS_CACHE_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfsapfs_cache_usage_get_node_cache_memory_usage(
+     libfcache_cache_t *node_cache,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+     libfcache_cache_t *data_block_cache,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_usage_trim_node_cache(
+     libfcache_cache_t *node_cache,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_usage_trim_data_block_cache(
+     libfcache_cache_t *data_block_cache,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_CACHE_USAGE_H ) */
+
@@ -24,10 +24,16 @@
 #include <memory.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libfsapfs_checkpoint_map.h"
 #include "libfsapfs_checkpoint_map_entry.h"
 #include "libfsapfs_checksum.h"
+#include "libfsapfs_data_block.h"
 #include "libfsapfs_debug.h"
+#include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
@@ -164,6 +170,11 @@ int libfsapfs_checkpoint_map_free(
 
 			result = -1;
 		}
+		if( ( *checkpoint_map )->sorted_entries != NULL )
+		{
+			memory_free(
+			 ( *checkpoint_map )->sorted_entries );
+		}
 		memory_free(
 		 *checkpoint_map );
 
@@ -256,10 +267,278 @@ int libfsapfs_checkpoint_map_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsapfs_checkpoint_map_sort_entries(
+	     checkpoint_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a checkpoint map that can span multiple blocks from the checkpoint descriptor area
+ * The checkpoint descriptor area is circular, the blocks of the checkpoint are stored
+ * from the checkpoint descriptor index onwards and the checkpoint map blocks precede
+ * the container superblock
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_checkpoint_map_read_descriptor_area(
+     libfsapfs_checkpoint_map_t *checkpoint_map,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t descriptor_area_block_number,
+     uint32_t descriptor_area_number_of_blocks,
+     uint32_t checkpoint_descriptor_index,
+     uint32_t checkpoint_descriptor_number_of_blocks,
+     libcerror_error_t **error )
+{
+	libfsapfs_data_block_t *data_block     = NULL;
+	uint8_t *block_data                    = NULL;
+	static char *function                  = "libfsapfs_checkpoint_map_read_descriptor_area";
+	off64_t file_offset                    = 0;
+	ssize_t read_count                     = 0;
+	uint64_t map_transaction_identifier    = 0;
+	uint64_t object_transaction_identifier = 0;
+	uint32_t block_index                   = 0;
+	uint32_t number_of_blocks              = 0;
+	uint32_t number_of_map_blocks          = 0;
+	uint32_t object_type                   = 0;
+
+	if( checkpoint_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint map.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size < sizeof( fsapfs_checkpoint_map_t ) )
+	 || ( (size_t) io_handle->block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The most significant bit of the number of blocks indicates
+	 * the checkpoint descriptor area is not contiguous
+	 */
+	number_of_blocks = descriptor_area_number_of_blocks & 0x7fffffffUL;
+
+	if( checkpoint_descriptor_index >= number_of_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint descriptor index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( checkpoint_descriptor_number_of_blocks == 0 )
+	 || ( checkpoint_descriptor_number_of_blocks > number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint descriptor number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is retrieved from and returned to the block buffer pool of the IO handle
+	 */
+	if( libfsapfs_data_block_initialize_from_pool(
+	     &data_block,
+	     io_handle->block_buffer_pool,
+	     (size_t) io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		goto on_error;
+	}
+	block_data  = data_block->data;
+	block_index = checkpoint_descriptor_index;
+
+	for( number_of_map_blocks = 0;
+	     number_of_map_blocks < checkpoint_descriptor_number_of_blocks;
+	     number_of_map_blocks++ )
+	{
+		file_offset = (off64_t) ( descriptor_area_block_number + block_index ) * io_handle->block_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading checkpoint map block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 number_of_map_blocks,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     file_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek checkpoint map offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              block_data,
+		              (size_t) io_handle->block_size,
+		              error );
+
+		if( read_count != (ssize_t) io_handle->block_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint map data.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_checkpoint_map_t *) block_data )->object_type,
+		 object_type );
+
+		/* Stop at the container superblock that follows a checkpoint map
+		 * of which the last block is not flagged as such
+		 */
+		if( ( number_of_map_blocks > 0 )
+		 && ( object_type != 0x4000000cUL ) )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_checkpoint_map_t *) block_data )->object_transaction_identifier,
+		 object_transaction_identifier );
+
+		if( number_of_map_blocks == 0 )
+		{
+			map_transaction_identifier = object_transaction_identifier;
+		}
+		else if( object_transaction_identifier != map_transaction_identifier )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+			 "%s: mismatch in checkpoint map block: %" PRIu32 " transaction identifier.",
+			 function,
+			 number_of_map_blocks );
+
+			goto on_error;
+		}
+		if( libfsapfs_checkpoint_map_read_data(
+		     checkpoint_map,
+		     block_data,
+		     (size_t) io_handle->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read checkpoint map block: %" PRIu32 ".",
+			 function,
+			 number_of_map_blocks );
+
+			goto on_error;
+		}
+		if( ( checkpoint_map->flags & 0x00000001UL ) != 0 )
+		{
+			break;
+		}
+		block_index = ( block_index + 1 ) % number_of_blocks;
+	}
+	if( libfsapfs_data_block_free(
+	     &data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_checkpoint_map_sort_entries(
+	     checkpoint_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort entries.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libfsapfs_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the checkpoint map
+ * The entries are appended to the entries of previously read checkpoint map blocks
+ * and are not sorted, use libfsapfs_checkpoint_map_sort_entries after the last block
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_checkpoint_map_read_data(
@@ -281,7 +560,6 @@ int libfsapfs_checkpoint_map_read_data(
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit                        = 0;
-	uint32_t value_32bit                        = 0;
 #endif
 
 	if( checkpoint_map == NULL )
@@ -366,6 +644,14 @@ int libfsapfs_checkpoint_map_read_data(
 
 		goto on_error;
 	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_checkpoint_map_t *) data )->object_transaction_identifier,
+	 checkpoint_map->transaction_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_checkpoint_map_t *) data )->flags,
+	 checkpoint_map->flags );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (fsapfs_checkpoint_map_t *) data )->number_of_entries,
 	 number_of_map_entries );
@@ -386,13 +672,10 @@ int libfsapfs_checkpoint_map_read_data(
 		 function,
 		 value_64bit );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_checkpoint_map_t *) data )->object_transaction_identifier,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: object transaction identifier\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 checkpoint_map->transaction_identifier );
 
 		libcnotify_printf(
 		 "%s: object type\t\t\t\t: 0x%08" PRIx32 "\n",
@@ -404,15 +687,12 @@ int libfsapfs_checkpoint_map_read_data(
 		 function,
 		 object_subtype );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsapfs_checkpoint_map_t *) data )->flags,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: flags\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 value_32bit );
+		 checkpoint_map->flags );
 		libfsapfs_debug_print_checkpoint_flags(
-		 value_32bit );
+		 checkpoint_map->flags );
 		libcnotify_printf(
 		 "\n" );
 
@@ -542,19 +822,34 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the physical address of a specific object identifier
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Compares two checkpoint map entries by object identifier
+ * Returns -1 if the first entry is smaller, 1 if larger or 0 if equal
  */
-int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+int libfsapfs_checkpoint_map_entry_compare_by_object_identifier(
+     const void *first_map_entry,
+     const void *second_map_entry )
+{
+	const libfsapfs_checkpoint_map_entry_t *first  = *( (libfsapfs_checkpoint_map_entry_t * const *) first_map_entry );
+	const libfsapfs_checkpoint_map_entry_t *second = *( (libfsapfs_checkpoint_map_entry_t * const *) second_map_entry );
+
+	if( first->object_identifier != second->object_identifier )
+	{
+		return( ( first->object_identifier < second->object_identifier ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the entries by object identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_checkpoint_map_sort_entries(
      libfsapfs_checkpoint_map_t *checkpoint_map,
-     uint64_t object_identifier,
-     uint64_t *physical_address,
      libcerror_error_t **error )
 {
-	libfsapfs_checkpoint_map_entry_t *map_entry = NULL;
-	static char *function                       = "libfsapfs_checkpoint_map_get_physical_address_by_object_identifier";
-	int entry_index                             = 0;
-	int number_of_entries                       = 0;
+	libfsapfs_checkpoint_map_entry_t **sorted_entries = NULL;
+	static char *function                             = "libfsapfs_checkpoint_map_sort_entries";
+	int entry_index                                   = 0;
+	int number_of_entries                             = 0;
 
 	if( checkpoint_map == NULL )
 	{
@@ -567,31 +862,55 @@ int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
 
 		return( -1 );
 	}
-	if( physical_address == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     checkpoint_map->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid physical address.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from array.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     checkpoint_map->entries_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	if( number_of_entries == 0 )
+	{
+		checkpoint_map->number_of_sorted_entries = 0;
+
+		return( 1 );
+	}
+	if( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_checkpoint_map_entry_t * ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
+	sorted_entries = (libfsapfs_checkpoint_map_entry_t **) memory_reallocate(
+	                                                        checkpoint_map->sorted_entries,
+	                                                        sizeof( libfsapfs_checkpoint_map_entry_t * ) * number_of_entries );
+
+	if( sorted_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	checkpoint_map->sorted_entries           = sorted_entries;
+	checkpoint_map->number_of_sorted_entries = 0;
+
 	for( entry_index = 0;
 	     entry_index < number_of_entries;
 	     entry_index++ )
@@ -599,7 +918,7 @@ int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
 		if( libcdata_array_get_entry_by_index(
 		     checkpoint_map->entries_array,
 		     entry_index,
-		     (intptr_t **) &map_entry,
+		     (intptr_t **) &( sorted_entries[ entry_index ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -612,7 +931,7 @@ int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
 
 			return( -1 );
 		}
-		if( map_entry == NULL )
+		if( sorted_entries[ entry_index ] == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -624,13 +943,80 @@ int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
 
 			return( -1 );
 		}
-		if( object_identifier == map_entry->object_identifier )
+	}
+	if( number_of_entries > 1 )
+	{
+		qsort(
+		 sorted_entries,
+		 (size_t) number_of_entries,
+		 sizeof( libfsapfs_checkpoint_map_entry_t * ),
+		 &libfsapfs_checkpoint_map_entry_compare_by_object_identifier );
+	}
+	checkpoint_map->number_of_sorted_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the physical address of a specific object identifier
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+     libfsapfs_checkpoint_map_t *checkpoint_map,
+     uint64_t object_identifier,
+     uint64_t *physical_address,
+     libcerror_error_t **error )
+{
+	libfsapfs_checkpoint_map_entry_t *map_entry = NULL;
+	static char *function                       = "libfsapfs_checkpoint_map_get_physical_address_by_object_identifier";
+	int entry_index                             = 0;
+	int first_entry_index                       = 0;
+	int last_entry_index                        = 0;
+
+	if( checkpoint_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint map.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid physical address.",
+		 function );
+
+		return( -1 );
+	}
+	first_entry_index = 0;
+	last_entry_index  = checkpoint_map->number_of_sorted_entries - 1;
+
+	while( first_entry_index <= last_entry_index )
+	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		map_entry = checkpoint_map->sorted_entries[ entry_index ];
+
+		if( object_identifier < map_entry->object_identifier )
+		{
+			last_entry_index = entry_index - 1;
+		}
+		else if( object_identifier > map_entry->object_identifier )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else
 		{
 			*physical_address = map_entry->physical_address;
 
 			return( 1 );
 		}
-		map_entry = NULL;
 	}
 	return( 0 );
 }
@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_checkpoint_map_entry.h"
+#include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
@@ -37,9 +39,25 @@ typedef struct libfsapfs_checkpoint_map libfsapfs_checkpoint_map_t;
 
 struct libfsapfs_checkpoint_map
 {
+	/* The (object) transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
 	/* The entries array
 	 */
 	libcdata_array_t *entries_array;
+
+	/* The entries sorted by object identifier
+	 */
+	libfsapfs_checkpoint_map_entry_t **sorted_entries;
+
+	/* The number of sorted entries
+	 */
+	int number_of_sorted_entries;
 };
 
 int libfsapfs_checkpoint_map_initialize(
@@ -56,12 +74,30 @@ int libfsapfs_checkpoint_map_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsapfs_checkpoint_map_read_descriptor_area(
+     libfsapfs_checkpoint_map_t *checkpoint_map,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t descriptor_area_block_number,
+     uint32_t descriptor_area_number_of_blocks,
+     uint32_t checkpoint_descriptor_index,
+     uint32_t checkpoint_descriptor_number_of_blocks,
+     libcerror_error_t **error );
+
 int libfsapfs_checkpoint_map_read_data(
      libfsapfs_checkpoint_map_t *checkpoint_map,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_checkpoint_map_entry_compare_by_object_identifier(
+     const void *first_map_entry,
+     const void *second_map_entry );
+
+int libfsapfs_checkpoint_map_sort_entries(
+     libfsapfs_checkpoint_map_t *checkpoint_map,
+     libcerror_error_t **error );
+
 int libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
      libfsapfs_checkpoint_map_t *checkpoint_map,
      uint64_t object_identifier,
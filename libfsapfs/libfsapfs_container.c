@@ -25,6 +25,10 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "libfsapfs_checkpoint_map.h"
 #include "libfsapfs_container.h"
 #include "libfsapfs_container_data_handle.h"
@@ -41,10 +45,12 @@
 #include "libfsapfs_libcnotify.h"
 #include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_carver.h"
 #include "libfsapfs_object.h"
 #include "libfsapfs_object_map.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_object_map_descriptor.h"
+#include "libfsapfs_uncached_file_io_handle.h"
 #include "libfsapfs_volume.h"
 
 /* Creates a container
@@ -227,172 +233,282 @@ int libfsapfs_container_free(
 	return( result );
 }
 
-/* Signals the container to abort its current activity
+/* Creates a container shared state
+ * Make sure the value shared_state is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_signal_abort(
-     libfsapfs_container_t *container,
+int libfsapfs_container_shared_state_initialize(
+     libfsapfs_container_shared_state_t **shared_state,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_signal_abort";
+	static char *function = "libfsapfs_container_shared_state_initialize";
 
-	if( container == NULL )
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
+		 "%s: invalid shared state.",
 		 function );
 
 		return( -1 );
 	}
-	internal_container = (libfsapfs_internal_container_t *) container;
-
-	if( internal_container->io_handle == NULL )
+	if( *shared_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid container - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared state value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_container->io_handle->abort = 1;
-
-	return( 1 );
-}
-
-/* Opens a container
- * Returns 1 if successful or -1 on error
- */
-int libfsapfs_container_open(
-     libfsapfs_container_t *container,
-     const char *filename,
-     int access_flags,
-     libcerror_error_t **error )
-{
-	libbfio_handle_t *file_io_handle                   = NULL;
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_open";
-	size_t filename_length                             = 0;
+	*shared_state = memory_allocate_structure(
+	                 libfsapfs_container_shared_state_t );
 
-	if( container == NULL )
+	if( *shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_container = (libfsapfs_internal_container_t *) container;
-
-	if( filename == NULL )
+	if( memory_set(
+	     *shared_state,
+	     0,
+	     sizeof( libfsapfs_container_shared_state_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *shared_state )->read_write_lock ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	return( 1 );
+
+on_error:
+	if( *shared_state != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
-		 function );
+		memory_free(
+		 *shared_state );
 
-		return( -1 );
+		*shared_state = NULL;
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	return( -1 );
+}
+
+/* Frees a container shared state and the metadata it references
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_shared_state_free(
+     libfsapfs_container_shared_state_t **shared_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_container_shared_state_free";
+	int result            = 1;
+
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared state.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( *shared_state != NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		/* The container data handle is freed by the data block vector
+		 */
+		if( ( *shared_state )->superblock != NULL )
+		{
+			if( libfsapfs_container_superblock_free(
+			     &( ( *shared_state )->superblock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free container superblock.",
+				 function );
 
-		goto on_error;
-	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->fusion_middle_tree != NULL )
+		{
+			if( libfsapfs_fusion_middle_tree_free(
+			     &( ( *shared_state )->fusion_middle_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free Fusion middle tree.",
+				 function );
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->checkpoint_map != NULL )
+		{
+			if( libfsapfs_checkpoint_map_free(
+			     &( ( *shared_state )->checkpoint_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free checkpoint map.",
+				 function );
 
-		goto on_error;
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->data_block_vector != NULL )
+		{
+			if( libfdata_vector_free(
+			     &( ( *shared_state )->data_block_vector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block vector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->object_map_btree != NULL )
+		{
+			if( libfsapfs_object_map_btree_free(
+			     &( ( *shared_state )->object_map_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free object map B-tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->key_bag != NULL )
+		{
+			if( libfsapfs_container_key_bag_free(
+			     &( ( *shared_state )->key_bag ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key bag.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->checkpoints != NULL )
+		{
+			memory_free(
+			 ( *shared_state )->checkpoints );
+		}
+		if( ( *shared_state )->io_handle != NULL )
+		{
+			if( libfsapfs_io_handle_free(
+			     &( ( *shared_state )->io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *shared_state )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *shared_state );
+
+		*shared_state = NULL;
 	}
-	if( libfsapfs_container_open_file_io_handle(
-	     container,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Grabs a reference to a container shared state
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_shared_state_grab_reference(
+     libfsapfs_container_shared_state_t *shared_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_container_shared_state_grab_reference";
+
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open container: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared state.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_container->read_write_lock,
+	     shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -402,14 +518,14 @@ int libfsapfs_container_open(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_container->file_io_handle_created_in_library = 1;
+	shared_state->reference_count += 1;
 
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
-	     internal_container->read_write_lock,
+	     shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -419,152 +535,45 @@ int libfsapfs_container_open(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_container->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-        return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Opens a container
+/* Releases a reference to a container shared state
+ * The shared state and the metadata it references are freed when the last reference is released
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_open_wide(
-     libfsapfs_container_t *container,
-     const wchar_t *filename,
-     int access_flags,
+int libfsapfs_container_shared_state_release_reference(
+     libfsapfs_container_shared_state_t **shared_state,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle                   = NULL;
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_open_wide";
-	size_t filename_length                             = 0;
-
-	if( container == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
-		 function );
-
-		return( -1 );
-	}
-	internal_container = (libfsapfs_internal_container_t *) container;
+	libfsapfs_container_shared_state_t *safe_shared_state = NULL;
+	static char *function                              = "libfsapfs_container_shared_state_release_reference";
+	int reference_count                                = 0;
 
-	if( filename == NULL )
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 "%s: invalid shared state.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
-		 function );
-
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
-	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
-
-		goto on_error;
-	}
-#endif
-	filename_length = wide_string_length(
-	                   filename );
-
-	if( libbfio_file_set_name_wide(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+	if( *shared_state == NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	if( libfsapfs_container_open_file_io_handle(
-	     container,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open container: %ls.",
-		 function,
-		 filename );
+	safe_shared_state = *shared_state;
+	*shared_state     = NULL;
 
-		goto on_error;
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_container->read_write_lock,
+	     safe_shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -574,14 +583,16 @@ int libfsapfs_container_open_wide(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_container->file_io_handle_created_in_library = 1;
+	safe_shared_state->reference_count -= 1;
+
+	reference_count = safe_shared_state->reference_count;
 
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
-	     internal_container->read_write_lock,
+	     safe_shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -591,104 +602,172 @@ int libfsapfs_container_open_wide(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_container->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( file_io_handle != NULL )
+	if( reference_count <= 0 )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		if( libfsapfs_container_shared_state_free(
+		     &safe_shared_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free shared state.",
+			 function );
+
+			return( -1 );
+		}
 	}
-        return( -1 );
+	return( 1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Opens a container using a Basic File IO (bfio) handle
+/* Clones a container
+ * The clone uses its own file IO handle but shares the metadata and caches
+ * of the source container. The shared metadata is reference counted so that
+ * the source container can be freed before the clone
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_open_file_io_handle(
-     libfsapfs_container_t *container,
-     libbfio_handle_t *file_io_handle,
-     int access_flags,
+int libfsapfs_container_clone(
+     libfsapfs_container_t **destination_container,
+     libfsapfs_container_t *source_container,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_open_file_io_handle";
-	int bfio_access_flags                              = 0;
-	int file_io_handle_is_open                         = 0;
-	int file_io_handle_opened_in_library               = 0;
+	libfsapfs_internal_container_t *internal_destination_container = NULL;
+	libfsapfs_internal_container_t *internal_source_container      = NULL;
+	static char *function                                          = "libfsapfs_container_clone";
+	int file_io_handle_is_open                                     = 0;
 
-	if( container == NULL )
+	if( destination_container == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
+		 "%s: invalid destination container.",
 		 function );
 
 		return( -1 );
 	}
-	internal_container = (libfsapfs_internal_container_t *) container;
-
-	if( internal_container->file_io_handle != NULL )
+	if( *destination_container != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - file IO handle already set.",
+		 "%s: invalid destination container value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( source_container == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid source container.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	internal_source_container = (libfsapfs_internal_container_t *) source_container;
+
+	if( internal_source_container->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid source container - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_source_container->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) != 0 )
+#endif
+	if( internal_source_container->shared_state == NULL )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+		if( libfsapfs_container_shared_state_initialize(
+		     &( internal_source_container->shared_state ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared state.",
+			 function );
+
+			goto on_error;
+		}
+		/* From here on the metadata is owned by the shared state and
+		 * freed when the last container referencing it is closed
+		 */
+		internal_source_container->shared_state->io_handle             = internal_source_container->io_handle;
+		internal_source_container->shared_state->superblock            = internal_source_container->superblock;
+		internal_source_container->shared_state->fusion_middle_tree    = internal_source_container->fusion_middle_tree;
+		internal_source_container->shared_state->checkpoint_map        = internal_source_container->checkpoint_map;
+		internal_source_container->shared_state->container_data_handle = internal_source_container->container_data_handle;
+		internal_source_container->shared_state->data_block_vector     = internal_source_container->data_block_vector;
+		internal_source_container->shared_state->object_map_btree      = internal_source_container->object_map_btree;
+		internal_source_container->shared_state->key_bag               = internal_source_container->key_bag;
+		internal_source_container->shared_state->checkpoints           = internal_source_container->checkpoints;
+		internal_source_container->shared_state->number_of_checkpoints = internal_source_container->number_of_checkpoints;
+
+		/* The reference of the source container, the shared state is not
+		 * visible to other containers yet so no locking is needed here
+		 */
+		internal_source_container->shared_state->reference_count = 1;
+	}
+	if( libfsapfs_container_initialize(
+	     destination_container,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination container.",
+		 function );
+
+		goto on_error;
+	}
+	internal_destination_container = (libfsapfs_internal_container_t *) *destination_container;
+
+	if( libbfio_handle_clone(
+	     &( internal_destination_container->file_io_handle ),
+	     internal_source_container->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
 	}
+	internal_destination_container->file_io_handle_created_in_library = 1;
+
 	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
+	                          internal_destination_container->file_io_handle,
 	                          error );
 
 	if( file_io_handle_is_open == -1 )
@@ -697,7 +776,7 @@ int libfsapfs_container_open_file_io_handle(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open container.",
+		 "%s: unable to determine if file IO handle is open.",
 		 function );
 
 		goto on_error;
@@ -705,8 +784,8 @@ int libfsapfs_container_open_file_io_handle(
 	else if( file_io_handle_is_open == 0 )
 	{
 		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
+		     internal_destination_container->file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -718,44 +797,40 @@ int libfsapfs_container_open_file_io_handle(
 
 			goto on_error;
 		}
-		file_io_handle_opened_in_library = 1;
+		internal_destination_container->file_io_handle_opened_in_library = 1;
 	}
-	if( libfsapfs_internal_container_open_read(
-	     internal_container,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file IO handle.",
-		 function );
+	internal_destination_container->io_handle->bytes_per_sector = internal_source_container->io_handle->bytes_per_sector;
+	internal_destination_container->io_handle->block_size       = internal_source_container->io_handle->block_size;
+	internal_destination_container->io_handle->container_size   = internal_source_container->io_handle->container_size;
+	internal_destination_container->io_handle->uncached_access  = internal_source_container->io_handle->uncached_access;
 
-		goto on_error;
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_container->read_write_lock,
+	if( libfsapfs_container_shared_state_grab_reference(
+	     internal_source_container->shared_state,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab reference to shared state.",
 		 function );
 
 		goto on_error;
 	}
-#endif
-	internal_container->file_io_handle                   = file_io_handle;
-	internal_container->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_destination_container->shared_state          = internal_source_container->shared_state;
+	internal_destination_container->superblock            = internal_destination_container->shared_state->superblock;
+	internal_destination_container->fusion_middle_tree    = internal_destination_container->shared_state->fusion_middle_tree;
+	internal_destination_container->checkpoint_map        = internal_destination_container->shared_state->checkpoint_map;
+	internal_destination_container->container_data_handle = internal_destination_container->shared_state->container_data_handle;
+	internal_destination_container->data_block_vector     = internal_destination_container->shared_state->data_block_vector;
+	internal_destination_container->object_map_btree      = internal_destination_container->shared_state->object_map_btree;
+	internal_destination_container->key_bag               = internal_destination_container->shared_state->key_bag;
+	internal_destination_container->checkpoints           = internal_destination_container->shared_state->checkpoints;
+	internal_destination_container->number_of_checkpoints = internal_destination_container->shared_state->number_of_checkpoints;
 
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
-	     internal_container->read_write_lock,
+	     internal_source_container->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -765,34 +840,39 @@ int libfsapfs_container_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_container->file_io_handle                   = NULL;
-		internal_container->file_io_handle_opened_in_library = 0;
+		libfsapfs_container_free(
+		 destination_container,
+		 NULL );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	if( *destination_container != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libfsapfs_container_free(
+		 destination_container,
+		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_source_container->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Closes a container
- * Returns 0 if successful or -1 on error
+/* Signals the container to abort its current activity
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_close(
+int libfsapfs_container_signal_abort(
      libfsapfs_container_t *container,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_close";
-	int result                                         = 0;
+	static char *function                              = "libfsapfs_container_signal_abort";
 
 	if( container == NULL )
 	{
@@ -807,195 +887,195 @@ int libfsapfs_container_close(
 	}
 	internal_container = (libfsapfs_internal_container_t *) container;
 
-	if( internal_container->file_io_handle == NULL )
+	if( internal_container->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid container - missing file IO handle.",
+		 "%s: invalid container - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_container->read_write_lock,
-	     error ) != 1 )
+	internal_container->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens a container
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_open(
+     libfsapfs_container_t *container,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_open";
+	size_t filename_length                             = 0;
+
+	if( container == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( internal_container->file_io_handle_created_in_library != 0 )
-		{
-			if( libfsapfs_debug_print_read_offsets(
-			     internal_container->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+	internal_container = (libfsapfs_internal_container_t *) container;
 
-				result = -1;
-			}
-		}
-	}
-#endif
-	if( internal_container->file_io_handle_opened_in_library != 0 )
+	if( filename == NULL )
 	{
-		if( libbfio_handle_close(
-		     internal_container->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-			result = -1;
-		}
-		internal_container->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_container->file_io_handle_created_in_library != 0 )
+	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( libbfio_handle_free(
-		     &( internal_container->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-			result = -1;
-		}
-		internal_container->file_io_handle_created_in_library = 0;
+		return( -1 );
 	}
-	internal_container->file_io_handle = NULL;
-
-	if( libfsapfs_io_handle_clear(
-	     internal_container->io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_container->superblock != NULL )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_UNCACHED ) != 0 )
 	{
-		if( libfsapfs_container_superblock_free(
-		     &( internal_container->superblock ),
+#if defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT )
+		if( libfsapfs_uncached_file_initialize(
+		     &file_io_handle,
+		     filename,
+		     filename_length + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free container superblock.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create uncached file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: uncached access not supported.",
+		 function );
+
+		goto on_error;
+#endif
 	}
-	if( internal_container->fusion_middle_tree != NULL )
+	else
 	{
-		if( libfsapfs_fusion_middle_tree_free(
-		     &( internal_container->fusion_middle_tree ),
+		if( libbfio_file_initialize(
+		     &file_io_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free Fusion middle tree.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	if( internal_container->checkpoint_map != NULL )
-	{
-		if( libfsapfs_checkpoint_map_free(
-		     &( internal_container->checkpoint_map ),
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free checkpoint map.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-	if( libfdata_vector_free(
-	     &( internal_container->data_block_vector ),
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free data block vector.",
-		 function );
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( internal_container->object_map_btree != NULL )
+#endif
+	if( libfsapfs_container_open_file_io_handle(
+	     container,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
 	{
-		if( libfsapfs_object_map_btree_free(
-		     &( internal_container->object_map_btree ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free object map B-tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container: %s.",
+		 function,
+		 filename );
 
-			result = -1;
-		}
+		goto on_error;
 	}
-	if( internal_container->key_bag != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfsapfs_container_key_bag_free(
-		     &( internal_container->key_bag ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key bag.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-			result = -1;
-		}
+		goto on_error;
 	}
+#endif
+	internal_container->file_io_handle_created_in_library = 1;
+
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_container->read_write_lock,
@@ -1008,42 +1088,40 @@ int libfsapfs_container_close(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		return( -1 );
+		internal_container->file_io_handle_created_in_library = 0;
+
+		goto on_error;
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+        return( -1 );
 }
 
-/* Opens a container for reading
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a container
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_internal_container_open_read(
-     libfsapfs_internal_container_t *internal_container,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+int libfsapfs_container_open_wide(
+     libfsapfs_container_t *container,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
-	libfsapfs_container_data_handle_t *container_data_handle    = NULL;
-	libfsapfs_container_superblock_t *container_superblock      = NULL;
-	libfsapfs_container_superblock_t *container_superblock_swap = NULL;
-	libfsapfs_object_t *object                                  = NULL;
-	libfsapfs_object_map_t *object_map                          = NULL;
-	static char *function                                       = "libfsapfs_internal_container_open_read";
-	uint64_t checkpoint_map_block_number                        = 0;
-	uint64_t checkpoint_map_transaction_identifier              = 0;
-	uint64_t metadata_block_index                               = 0;
-	int element_index                                           = 0;
-	int result                                                  = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	libfsapfs_checkpoint_map_t *checkpoint_map                  = NULL;
-	libfsapfs_container_reaper_t *container_reaper              = NULL;
-	libfsapfs_space_manager_t *space_manager                    = NULL;
-	uint64_t reaper_block_number                                = 0;
-	uint64_t space_manager_block_number                         = 0;
-#endif
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_open_wide";
+	size_t filename_length                             = 0;
 
-	if( internal_container == NULL )
+	if( container == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1054,841 +1132,3929 @@ int libfsapfs_internal_container_open_read(
 
 		return( -1 );
 	}
-	if( internal_container->io_handle == NULL )
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid container - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_container->superblock != NULL )
+	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - superblock map value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_container->fusion_middle_tree != NULL )
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - Fusion middle tree value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_container->checkpoint_map != NULL )
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_UNCACHED ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - checkpoint map value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: uncached access currently not supported for wide character filenames.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_container->data_block_vector != NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - data block vector already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_container->object_map_btree != NULL )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set track offsets read in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+#endif
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+                libcerror_error_set(
+                 error,
+                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+                 "%s: unable to set filename in file IO handle.",
+                 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_container_open_file_io_handle(
+	     container,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - object map B-tree value already set.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container: %ls.",
+		 function,
+		 filename );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_container->key_bag != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - key bag value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading container superblock:\n" );
+		goto on_error;
 	}
 #endif
-	if( libfsapfs_container_superblock_initialize(
-	     &( internal_container->superblock ),
+	internal_container->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container superblock.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		internal_container->file_io_handle_created_in_library = 0;
+
 		goto on_error;
 	}
-	if( libfsapfs_container_superblock_read_file_io_handle(
-	     internal_container->superblock,
-	     file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+        return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a container using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_open_file_io_handle(
+     libfsapfs_container_t *container,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_open_file_io_handle";
+	int bfio_access_flags                              = 0;
+	int file_io_handle_is_open                         = 0;
+	int file_io_handle_opened_in_library               = 0;
+
+	if( container == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read container superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_container->io_handle->block_size     = internal_container->superblock->block_size;
-	internal_container->io_handle->container_size = (size64_t) internal_container->superblock->number_of_blocks * (size64_t) internal_container->io_handle->block_size;
+	internal_container = (libfsapfs_internal_container_t *) container;
 
-#if !defined( HAVE_DEBUG_OUTPUT )
-	if( ( internal_container->superblock->incompatible_features_flags & 0x0000000000000100UL ) != 0 )
+	if( internal_container->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: Fusion drive not supported.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - file IO handle already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( file_io_handle == NULL )
 	{
-		libcnotify_printf(
-		 "Scanning checkpoint descriptor area:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libfsapfs_object_initialize(
-	     &object,
-	     error ) != 1 )
+	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	file_offset = (off64_t) internal_container->superblock->checkpoint_descriptor_area_block_number * internal_container->io_handle->block_size;
-
-	for( metadata_block_index = 0;
-	     metadata_block_index <= internal_container->superblock->checkpoint_descriptor_area_number_of_blocks;
-	     metadata_block_index++ )
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libfsapfs_object_read_file_io_handle(
-		     object,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
-		{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_UNCACHED ) != 0 )
+	{
+		internal_container->io_handle->uncached_access = 1;
+	}
+	if( libfsapfs_internal_container_open_read(
+	     internal_container,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_container->file_io_handle                   = file_io_handle;
+	internal_container->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_container->file_io_handle                   = NULL;
+		internal_container->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Opens a container using a Basic File IO (bfio) pool
+ * The handles in the pool must all refer to the same container and the pool
+ * must not limit the number of open handles. The first handle is used to read
+ * the container metadata, file entries are spread over all handles and read
+ * their data through the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_open_file_io_pool(
+     libfsapfs_container_t *container,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_open_file_io_pool";
+	int bfio_access_flags                              = 0;
+	int file_io_handle_is_open                         = 0;
+	int file_io_pool_opened_in_library                 = 0;
+	int maximum_number_of_open_handles                 = 0;
+	int number_of_file_io_handles                      = 0;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_io_handles <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_maximum_number_of_open_handles(
+	     file_io_pool,
+	     &maximum_number_of_open_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of open handles.",
+		 function );
+
+		return( -1 );
+	}
+	/* The file entries read their data through the pool but their metadata,
+	 * such as the file system B-tree, from the pool handles directly
+	 * hence all the handles need to remain open
+	 */
+	if( ( maximum_number_of_open_handles != LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES )
+	 && ( maximum_number_of_open_handles < number_of_file_io_handles ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file IO pool - maximum number of open handles is less than number of handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_pool_get_handle(
+	     file_io_pool,
+	     0,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: 0 from pool.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open container.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_pool_open(
+		     file_io_pool,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO pool.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_pool_opened_in_library = 1;
+	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_UNCACHED ) != 0 )
+	{
+		internal_container->io_handle->uncached_access = 1;
+	}
+	if( libfsapfs_internal_container_open_read(
+	     internal_container,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_container->file_io_handle                 = file_io_handle;
+	internal_container->file_io_pool                   = file_io_pool;
+	internal_container->file_io_pool_opened_in_library = file_io_pool_opened_in_library;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_container->file_io_handle                 = NULL;
+		internal_container->file_io_pool                   = NULL;
+		internal_container->file_io_pool_opened_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_pool_opened_in_library != 0 )
+	{
+		libbfio_pool_close_all(
+		 file_io_pool,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a container
+ * Returns 0 if successful or -1 on error
+ */
+int libfsapfs_container_close(
+     libfsapfs_container_t *container,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_close";
+	int result                                         = 0;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_container->file_io_handle_created_in_library != 0 )
+		{
+			if( libfsapfs_debug_print_read_offsets(
+			     internal_container->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#endif
+	if( internal_container->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_container->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_container->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_container->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_container->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_container->file_io_handle_created_in_library = 0;
+	}
+	if( internal_container->file_io_pool_opened_in_library != 0 )
+	{
+		if( libbfio_pool_close_all(
+		     internal_container->file_io_pool,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO pool.",
+			 function );
+
+			result = -1;
+		}
+		internal_container->file_io_pool_opened_in_library = 0;
+	}
+	internal_container->file_io_handle = NULL;
+	internal_container->file_io_pool   = NULL;
+
+	if( internal_container->shared_state != NULL )
+	{
+		/* The metadata owned by the shared state is freed when the last reference
+		 * is released, metadata specific to a checkpoint view is owned by this
+		 * container and freed below
+		 */
+		if( internal_container->superblock == internal_container->shared_state->superblock )
+		{
+			internal_container->superblock = NULL;
+		}
+		if( internal_container->fusion_middle_tree == internal_container->shared_state->fusion_middle_tree )
+		{
+			internal_container->fusion_middle_tree = NULL;
+		}
+		if( internal_container->checkpoint_map == internal_container->shared_state->checkpoint_map )
+		{
+			internal_container->checkpoint_map = NULL;
+		}
+		if( internal_container->container_data_handle == internal_container->shared_state->container_data_handle )
+		{
+			internal_container->container_data_handle = NULL;
+		}
+		if( internal_container->data_block_vector == internal_container->shared_state->data_block_vector )
+		{
+			internal_container->data_block_vector = NULL;
+		}
+		if( internal_container->object_map_btree == internal_container->shared_state->object_map_btree )
+		{
+			internal_container->object_map_btree = NULL;
+		}
+		if( internal_container->key_bag == internal_container->shared_state->key_bag )
+		{
+			internal_container->key_bag = NULL;
+		}
+		if( internal_container->checkpoints == internal_container->shared_state->checkpoints )
+		{
+			internal_container->checkpoints           = NULL;
+			internal_container->number_of_checkpoints = 0;
+		}
+		if( internal_container->io_handle == internal_container->shared_state->io_handle )
+		{
+			/* The IO handle is still referenced by the shared metadata
+			 * so the container continues with a new IO handle
+			 */
+			internal_container->io_handle = NULL;
+
+			if( libfsapfs_io_handle_initialize(
+			     &( internal_container->io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( internal_container->io_handle != NULL )
+	{
+		if( libfsapfs_io_handle_clear(
+		     internal_container->io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_container->superblock != NULL )
+	{
+		if( libfsapfs_container_superblock_free(
+		     &( internal_container->superblock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free container superblock.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_container->fusion_middle_tree != NULL )
+	{
+		if( libfsapfs_fusion_middle_tree_free(
+		     &( internal_container->fusion_middle_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Fusion middle tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_container->checkpoint_map != NULL )
+	{
+		if( libfsapfs_checkpoint_map_free(
+		     &( internal_container->checkpoint_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free checkpoint map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfdata_vector_free(
+	     &( internal_container->data_block_vector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data block vector.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_container->object_map_btree != NULL )
+	{
+		if( libfsapfs_object_map_btree_free(
+		     &( internal_container->object_map_btree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free object map B-tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_container->key_bag != NULL )
+	{
+		if( libfsapfs_container_key_bag_free(
+		     &( internal_container->key_bag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key bag.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_container->checkpoints != NULL )
+	{
+		memory_free(
+		 internal_container->checkpoints );
+
+		internal_container->checkpoints           = NULL;
+		internal_container->number_of_checkpoints = 0;
+	}
+	if( libfsapfs_container_shared_state_release_reference(
+	     &( internal_container->shared_state ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release reference to shared state.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the block number of a container superblock or checkpoint map of a checkpoint
+ * The checkpoint is looked up by transaction identifier and added if not present
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_checkpoints_set_block_number(
+     libfsapfs_container_checkpoint_t *checkpoints,
+     int *number_of_checkpoints,
+     int maximum_number_of_checkpoints,
+     uint64_t transaction_identifier,
+     uint64_t block_number,
+     uint32_t object_type,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_checkpoint_t *checkpoint = NULL;
+	static char *function                        = "libfsapfs_container_checkpoints_set_block_number";
+	int checkpoint_index                         = 0;
+
+	if( checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( object_type != 0x4000000cUL )
+	 && ( object_type != 0x80000001UL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported object type: 0x%08" PRIx32 ".",
+		 function,
+		 object_type );
+
+		return( -1 );
+	}
+	for( checkpoint_index = 0;
+	     checkpoint_index < *number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( checkpoints[ checkpoint_index ].transaction_identifier == transaction_identifier )
+		{
+			checkpoint = &( checkpoints[ checkpoint_index ] );
+
+			break;
+		}
+	}
+	if( checkpoint == NULL )
+	{
+		if( *number_of_checkpoints >= maximum_number_of_checkpoints )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of checkpoints value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		checkpoint = &( checkpoints[ *number_of_checkpoints ] );
+
+		checkpoint->transaction_identifier = transaction_identifier;
+
+		*number_of_checkpoints += 1;
+	}
+	/* A checkpoint map can span multiple blocks, the first block is used
+	 */
+	if( object_type == 0x4000000cUL )
+	{
+		if( checkpoint->checkpoint_map_block_number == 0 )
+		{
+			checkpoint->checkpoint_map_block_number = block_number;
+		}
+	}
+	else
+	{
+		checkpoint->superblock_block_number = block_number;
+	}
+	return( 1 );
+}
+
+/* Compares two checkpoints by transaction identifier, most recent first
+ * Returns -1 if the first checkpoint is more recent, 1 if less recent or 0 if equal
+ */
+int libfsapfs_container_checkpoint_compare(
+     const void *first_checkpoint,
+     const void *second_checkpoint )
+{
+	const libfsapfs_container_checkpoint_t *first  = (const libfsapfs_container_checkpoint_t *) first_checkpoint;
+	const libfsapfs_container_checkpoint_t *second = (const libfsapfs_container_checkpoint_t *) second_checkpoint;
+
+	if( first->transaction_identifier != second->transaction_identifier )
+	{
+		return( ( first->transaction_identifier > second->transaction_identifier ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Opens a container for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_container_open_read(
+     libfsapfs_internal_container_t *internal_container,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_checkpoint_t *checkpoints               = NULL;
+	libfsapfs_container_data_handle_t *container_data_handle    = NULL;
+	libfsapfs_container_superblock_t *container_superblock      = NULL;
+	libfsapfs_container_superblock_t *container_superblock_swap = NULL;
+	libfsapfs_object_t *object                                  = NULL;
+	libfsapfs_object_map_t *object_map                          = NULL;
+	static char *function                                       = "libfsapfs_internal_container_open_read";
+	size_t checkpoints_size                                     = 0;
+	uint64_t checkpoint_map_block_number                        = 0;
+	uint64_t checkpoint_map_transaction_identifier              = 0;
+	uint64_t metadata_block_index                               = 0;
+	int checkpoint_index                                        = 0;
+	int element_index                                           = 0;
+	int maximum_number_of_checkpoints                           = 0;
+	int number_of_checkpoints                                   = 0;
+	int result                                                  = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	libfsapfs_checkpoint_map_t *checkpoint_map                  = NULL;
+	libfsapfs_container_reaper_t *container_reaper              = NULL;
+	libfsapfs_space_manager_t *space_manager                    = NULL;
+	uint64_t reaper_block_number                                = 0;
+	uint64_t space_manager_block_number                         = 0;
+#endif
+
+	if( internal_container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - superblock map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->fusion_middle_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - Fusion middle tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->checkpoint_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - checkpoint map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->data_block_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - data block vector already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->object_map_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - object map B-tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->key_bag != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - key bag value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->checkpoints != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - checkpoints value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading container superblock:\n" );
+	}
+#endif
+	if( libfsapfs_container_superblock_initialize(
+	     &( internal_container->superblock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container superblock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_container_superblock_read_file_io_handle(
+	     internal_container->superblock,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read container superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	internal_container->io_handle->block_size     = internal_container->superblock->block_size;
+	internal_container->io_handle->container_size = (size64_t) internal_container->superblock->number_of_blocks * (size64_t) internal_container->io_handle->block_size;
+
+#if !defined( HAVE_DEBUG_OUTPUT )
+	if( ( internal_container->superblock->incompatible_features_flags & 0x0000000000000100UL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: Fusion drive not supported.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Scanning checkpoint descriptor area:\n" );
+	}
+#endif
+	if( libfsapfs_object_initialize(
+	     &object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) internal_container->superblock->checkpoint_descriptor_area_number_of_blocks >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_container_checkpoint_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid container superblock - checkpoint descriptor area number of blocks value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every block in the checkpoint descriptor area can contribute at most one checkpoint
+	 */
+	maximum_number_of_checkpoints = (int) internal_container->superblock->checkpoint_descriptor_area_number_of_blocks + 1;
+
+	checkpoints_size = sizeof( libfsapfs_container_checkpoint_t ) * maximum_number_of_checkpoints;
+
+	checkpoints = (libfsapfs_container_checkpoint_t *) memory_allocate(
+	                                                    checkpoints_size );
+
+	if( checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoints.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     checkpoints,
+	     0,
+	     checkpoints_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoints.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) internal_container->superblock->checkpoint_descriptor_area_block_number * internal_container->io_handle->block_size;
+
+	for( metadata_block_index = 0;
+	     metadata_block_index <= internal_container->superblock->checkpoint_descriptor_area_number_of_blocks;
+	     metadata_block_index++ )
+	{
+		if( libfsapfs_object_read_file_io_handle(
+		     object,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read object at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		switch( object->type )
+		{
+			case 0x4000000c:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading checkpoint map:\n" );
+
+					if( libfsapfs_checkpoint_map_initialize(
+					     &checkpoint_map,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create backup checkpoint map.",
+						 function );
+
+						goto on_error;
+					}
+					if( libfsapfs_checkpoint_map_read_file_io_handle(
+					     checkpoint_map,
+					     file_io_handle,
+					     file_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read backup checkpoint map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+						 function,
+						 file_offset,
+						 file_offset );
+
+						goto on_error;
+					}
+					if( libfsapfs_checkpoint_map_free(
+					     &checkpoint_map,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free backup checkpoint map.",
+						 function );
+
+						goto on_error;
+					}
+				}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+				if( object->transaction_identifier > checkpoint_map_transaction_identifier )
+				{
+					checkpoint_map_block_number           = internal_container->superblock->checkpoint_descriptor_area_block_number + metadata_block_index;
+					checkpoint_map_transaction_identifier = object->transaction_identifier;
+				}
+				if( libfsapfs_container_checkpoints_set_block_number(
+				     checkpoints,
+				     &number_of_checkpoints,
+				     maximum_number_of_checkpoints,
+				     object->transaction_identifier,
+				     internal_container->superblock->checkpoint_descriptor_area_block_number + metadata_block_index,
+				     object->type,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set checkpoint map block number.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			case 0x80000001:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading container superblock:\n" );
+				}
+#endif
+				if( libfsapfs_container_superblock_initialize(
+				     &container_superblock,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create backup container superblock.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsapfs_container_superblock_read_file_io_handle(
+				     container_superblock,
+				     file_io_handle,
+				     file_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read backup container superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 file_offset,
+					 file_offset );
+
+					goto on_error;
+				}
+				if( libfsapfs_container_checkpoints_set_block_number(
+				     checkpoints,
+				     &number_of_checkpoints,
+				     maximum_number_of_checkpoints,
+				     object->transaction_identifier,
+				     internal_container->superblock->checkpoint_descriptor_area_block_number + metadata_block_index,
+				     object->type,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set checkpoint container superblock block number.",
+					 function );
+
+					goto on_error;
+				}
+				if( container_superblock->object_transaction_identifier > internal_container->superblock->object_transaction_identifier )
+				{
+					container_superblock_swap      = internal_container->superblock;
+					internal_container->superblock = container_superblock;
+					container_superblock           = container_superblock_swap;
+				}
+				if( libfsapfs_container_superblock_free(
+				     &container_superblock,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free backup container superblock.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			default:
+				break;
+		}
+		file_offset += internal_container->io_handle->block_size;
+	}
+	if( libfsapfs_object_free(
+	     &object,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only retain the checkpoints of which both the container superblock
+	 * and the checkpoint map are present in the checkpoint descriptor area
+	 */
+	element_index = 0;
+
+	for( checkpoint_index = 0;
+	     checkpoint_index < number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( ( checkpoints[ checkpoint_index ].superblock_block_number != 0 )
+		 && ( checkpoints[ checkpoint_index ].checkpoint_map_block_number != 0 ) )
+		{
+			checkpoints[ element_index++ ] = checkpoints[ checkpoint_index ];
+		}
+	}
+	number_of_checkpoints = element_index;
+	element_index         = 0;
+
+	if( number_of_checkpoints > 1 )
+	{
+		qsort(
+		 checkpoints,
+		 (size_t) number_of_checkpoints,
+		 sizeof( libfsapfs_container_checkpoint_t ),
+		 &libfsapfs_container_checkpoint_compare );
+	}
+	internal_container->checkpoints           = checkpoints;
+	internal_container->number_of_checkpoints = number_of_checkpoints;
+
+	checkpoints = NULL;
+
+	if( checkpoint_map_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing checkpoint map block number.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading checkpoint map:\n" );
+	}
+#endif
+	if( libfsapfs_checkpoint_map_initialize(
+	     &( internal_container->checkpoint_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_checkpoint_map_read_descriptor_area(
+	     internal_container->checkpoint_map,
+	     internal_container->io_handle,
+	     file_io_handle,
+	     internal_container->superblock->checkpoint_descriptor_area_block_number,
+	     internal_container->superblock->checkpoint_descriptor_area_number_of_blocks,
+	     internal_container->superblock->checkpoint_descriptor_index,
+	     internal_container->superblock->checkpoint_descriptor_number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint map from checkpoint descriptor area.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_container->superblock->fusion_middle_tree_block_number != 0 )
+		{
+			libcnotify_printf(
+			 "Reading Fusion middle tree:\n" );
+
+			file_offset = internal_container->superblock->fusion_middle_tree_block_number * internal_container->io_handle->block_size;
+
+			if( libfsapfs_fusion_middle_tree_initialize(
+			     &( internal_container->fusion_middle_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create Fusion middle tree.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsapfs_fusion_middle_tree_read_file_io_handle(
+			     internal_container->fusion_middle_tree,
+			     file_io_handle,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read Fusion middle tree at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+		if( internal_container->superblock->space_manager_object_identifier > 0 )
+		{
+			libcnotify_printf(
+			 "Reading space manager:\n" );
+
+			if( libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+			     internal_container->checkpoint_map,
+			     internal_container->superblock->space_manager_object_identifier,
+			     &space_manager_block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine space manager block number from object identifier: 0x08%" PRIx64 ".",
+				 function,
+				 internal_container->superblock->space_manager_object_identifier );
+
+				goto on_error;
+			}
+			file_offset = space_manager_block_number * internal_container->io_handle->block_size;
+
+			if( libfsapfs_space_manager_initialize(
+			     &space_manager,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create space manager.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsapfs_space_manager_read_file_io_handle(
+			     space_manager,
+			     file_io_handle,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read space manager at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( libfsapfs_space_manager_free(
+			     &space_manager,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free space manager.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( internal_container->superblock->reaper_object_identifier > 0 )
+		{
+			libcnotify_printf(
+			 "Reading reaper:\n" );
+
+			if( libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+			     internal_container->checkpoint_map,
+			     internal_container->superblock->reaper_object_identifier,
+			     &reaper_block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine reaper block number from object identifier: 0x08%" PRIx64 ".",
+				 function,
+				 internal_container->superblock->reaper_object_identifier );
+
+				goto on_error;
+			}
+			file_offset = reaper_block_number * internal_container->io_handle->block_size;
+
+			if( libfsapfs_container_reaper_initialize(
+			     &container_reaper,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create container reaper.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsapfs_container_reaper_read_file_io_handle(
+			     container_reaper,
+			     file_io_handle,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read container reaper at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( libfsapfs_container_reaper_free(
+			     &container_reaper,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free container reaper.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfsapfs_container_data_handle_initialize(
+	     &container_data_handle,
+	     internal_container->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     &( internal_container->data_block_vector ),
+	     (size64_t) internal_container->io_handle->block_size,
+	     (intptr_t *) container_data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block vector.",
+		 function );
+
+		goto on_error;
+	}
+	internal_container->container_data_handle = container_data_handle;
+	container_data_handle                     = NULL;
+
+	if( libfdata_vector_append_segment(
+	     internal_container->data_block_vector,
+	     &element_index,
+	     0,
+	     0,
+	     internal_container->io_handle->container_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to data block vector.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO refactor into function to read object map */
+	if( internal_container->superblock->object_map_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map block number.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading object map:\n" );
+	}
+#endif
+	file_offset = internal_container->superblock->object_map_block_number * internal_container->io_handle->block_size;
+
+	if( libfsapfs_object_map_initialize(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_read_file_io_handle(
+	     object_map,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( object_map->btree_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map B-tree block number.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading object map B-tree:\n" );
+	}
+#endif
+	if( libfsapfs_object_map_btree_initialize(
+	     &( internal_container->object_map_btree ),
+	     internal_container->io_handle,
+	     internal_container->data_block_vector,
+	     object_map->btree_block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_free(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_container->superblock->key_bag_block_number > 0 )
+	 && ( internal_container->superblock->key_bag_number_of_blocks > 0 ) )
+	{
+		if( libfsapfs_container_key_bag_initialize(
+		     &( internal_container->key_bag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create container key bag.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset = internal_container->superblock->key_bag_block_number * internal_container->io_handle->block_size;
+
+		result = libfsapfs_container_key_bag_read_file_io_handle(
+		          internal_container->key_bag,
+		          internal_container->io_handle,
+		          file_io_handle,
+		          file_offset,
+		          (size64_t) internal_container->superblock->key_bag_number_of_blocks * internal_container->io_handle->block_size,
+		          internal_container->superblock->container_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read container key bag at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			internal_container->key_bag->is_locked = 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( internal_container->key_bag != NULL )
+	{
+		libfsapfs_container_key_bag_free(
+		 &( internal_container->key_bag ),
+		 NULL );
+	}
+	if( internal_container->object_map_btree != NULL )
+	{
+		libfsapfs_object_map_btree_free(
+		 &( internal_container->object_map_btree ),
+		 NULL );
+	}
+	if( object_map != NULL )
+	{
+		libfsapfs_object_map_free(
+		 &object_map,
+		 NULL );
+	}
+	if( internal_container->data_block_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_container->data_block_vector ),
+		 NULL );
+	}
+	if( container_data_handle != NULL )
+	{
+		libfsapfs_container_data_handle_free(
+		 &container_data_handle,
+		 NULL );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( container_reaper != NULL )
+	{
+		libfsapfs_container_reaper_free(
+		 &container_reaper,
+		 NULL );
+	}
+	if( space_manager != NULL )
+	{
+		libfsapfs_space_manager_free(
+		 &space_manager,
+		 NULL );
+	}
+#endif
+	if( internal_container->checkpoint_map != NULL )
+	{
+		libfsapfs_checkpoint_map_free(
+		 &( internal_container->checkpoint_map ),
+		 NULL );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( checkpoint_map != NULL )
+	{
+		libfsapfs_checkpoint_map_free(
+		 &checkpoint_map,
+		 NULL );
+	}
+#endif
+	if( container_superblock != NULL )
+	{
+		libfsapfs_container_superblock_free(
+		 &container_superblock,
+		 NULL );
+	}
+	if( internal_container->fusion_middle_tree != NULL )
+	{
+		libfsapfs_fusion_middle_tree_free(
+		 &( internal_container->fusion_middle_tree ),
+		 NULL );
+	}
+	if( object != NULL )
+	{
+		libfsapfs_object_free(
+		 &object,
+		 NULL );
+	}
+	if( internal_container->checkpoints != NULL )
+	{
+		memory_free(
+		 internal_container->checkpoints );
+
+		internal_container->checkpoints           = NULL;
+		internal_container->number_of_checkpoints = 0;
+	}
+	if( checkpoints != NULL )
+	{
+		memory_free(
+		 checkpoints );
+	}
+	if( internal_container->superblock != NULL )
+	{
+		libfsapfs_container_superblock_free(
+		 &( internal_container->superblock ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_size(
+     libfsapfs_container_t *container,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_get_size";
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_container->io_handle->container_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the identifier
+ * The identifier is an UUID stored in big-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_identifier(
+     libfsapfs_container_t *container,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_get_identifier";
+	int result                                         = 1;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_container_superblock_get_container_identifier(
+	     internal_container->superblock,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve container identifier.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines if the container is locked
+ * Returns 1 if locked, 0 if not or -1 on error
+ */
+int libfsapfs_container_is_locked(
+     libfsapfs_container_t *container,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_is_locked";
+	uint8_t is_locked                                  = 0;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_container->key_bag != NULL )
+	{
+		is_locked = internal_container->key_bag->is_locked;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( is_locked );
+}
+
+/* Retrieves the number of volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_number_of_volumes(
+     libfsapfs_container_t *container,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_get_number_of_volumes";
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_volumes = internal_container->superblock->number_of_volumes;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific of volume
+ * The volume reference must be freed after use with libfsapfs_volume_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_volume_by_index(
+     libfsapfs_container_t *container,
+     int volume_index,
+     libfsapfs_volume_t **volume,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container       = NULL;
+	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
+	static char *function                                    = "libfsapfs_container_get_volume_by_index";
+	off64_t file_offset                                      = 0;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_index < 0 )
+	 || ( volume_index >= (int) internal_container->superblock->number_of_volumes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+	     internal_container->object_map_btree,
+	     internal_container->file_io_handle,
+	     internal_container->superblock->volume_object_identifiers[ volume_index ],
+	     &object_map_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object map descriptor for volume object identifier: %" PRIu64 ".",
+		 function,
+		 internal_container->superblock->volume_object_identifiers[ volume_index ] );
+
+		goto on_error;
+	}
+	if( object_map_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid object map descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_volume_initialize(
+	     volume,
+	     internal_container->io_handle,
+	     internal_container->file_io_handle,
+	     internal_container->key_bag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+	( (libfsapfs_internal_volume_t *) *volume )->file_io_pool = internal_container->file_io_pool;
+
+	file_offset = (off64_t) ( object_map_descriptor->physical_address * internal_container->io_handle->block_size );
+
+	if( libfsapfs_object_map_descriptor_free(
+	     &object_map_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_internal_volume_open_read(
+	     (libfsapfs_internal_volume_t *) *volume,
+	     internal_container->file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %d.",
+		 function,
+		 volume_index );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( object_map_descriptor != NULL )
+	{
+		libfsapfs_object_map_descriptor_free(
+		 &object_map_descriptor,
+		 NULL );
+	}
+	if( *volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 volume,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_container->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of checkpoints
+ * The checkpoints are the consistent points in time that are available
+ * in the checkpoint descriptor area of the container
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_number_of_checkpoints(
+     libfsapfs_container_t *container,
+     int *number_of_checkpoints,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_get_number_of_checkpoints";
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_checkpoints == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of checkpoints.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_checkpoints = internal_container->number_of_checkpoints;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the transaction identifier of a specific checkpoint
+ * The checkpoints are sorted from most to least recent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_get_checkpoint_transaction_identifier_by_index(
+     libfsapfs_container_t *container,
+     int checkpoint_index,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_get_checkpoint_transaction_identifier_by_index";
+	int result                                         = 1;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( transaction_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( checkpoint_index < 0 )
+	 || ( checkpoint_index >= internal_container->number_of_checkpoints ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid checkpoint index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*transaction_identifier = internal_container->checkpoints[ checkpoint_index ].transaction_identifier;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens the metadata of a specific checkpoint
+ * The object map B-tree of the checkpoint is a view that shares the caches
+ * of the source object map B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_container_open_read_checkpoint(
+     libfsapfs_internal_container_t *internal_container,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_container_checkpoint_t *checkpoint,
+     libfsapfs_object_map_btree_t *source_object_map_btree,
+     libcerror_error_t **error )
+{
+	libfsapfs_object_map_t *object_map = NULL;
+	static char *function              = "libfsapfs_internal_container_open_read_checkpoint";
+	off64_t file_offset                = 0;
+	int result                         = 0;
+
+	if( internal_container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - superblock map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->checkpoint_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - checkpoint map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->object_map_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - object map B-tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_container->key_bag != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - key bag value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading checkpoint: %" PRIu64 " container superblock:\n",
+		 checkpoint->transaction_identifier );
+	}
+#endif
+	if( libfsapfs_container_superblock_initialize(
+	     &( internal_container->superblock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container superblock.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) checkpoint->superblock_block_number * internal_container->io_handle->block_size;
+
+	if( libfsapfs_container_superblock_read_file_io_handle(
+	     internal_container->superblock,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read container superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( internal_container->superblock->object_transaction_identifier != checkpoint->transaction_identifier )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: mismatch in container superblock transaction identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_checkpoint_map_initialize(
+	     &( internal_container->checkpoint_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create checkpoint map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_checkpoint_map_read_descriptor_area(
+	     internal_container->checkpoint_map,
+	     internal_container->io_handle,
+	     file_io_handle,
+	     internal_container->superblock->checkpoint_descriptor_area_block_number,
+	     internal_container->superblock->checkpoint_descriptor_area_number_of_blocks,
+	     internal_container->superblock->checkpoint_descriptor_index,
+	     internal_container->superblock->checkpoint_descriptor_number_of_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint map from checkpoint descriptor area.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_container->superblock->object_map_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map block number.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = internal_container->superblock->object_map_block_number * internal_container->io_handle->block_size;
+
+	if( libfsapfs_object_map_initialize(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_read_file_io_handle(
+	     object_map,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( object_map->btree_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map B-tree block number.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_btree_initialize_view(
+	     &( internal_container->object_map_btree ),
+	     source_object_map_btree,
+	     object_map->btree_block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_free(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_container->superblock->key_bag_block_number > 0 )
+	 && ( internal_container->superblock->key_bag_number_of_blocks > 0 ) )
+	{
+		if( libfsapfs_container_key_bag_initialize(
+		     &( internal_container->key_bag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create container key bag.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset = internal_container->superblock->key_bag_block_number * internal_container->io_handle->block_size;
+
+		result = libfsapfs_container_key_bag_read_file_io_handle(
+		          internal_container->key_bag,
+		          internal_container->io_handle,
+		          file_io_handle,
+		          file_offset,
+		          (size64_t) internal_container->superblock->key_bag_number_of_blocks * internal_container->io_handle->block_size,
+		          internal_container->superblock->container_identifier,
+		          error );
+
+		if( result == -1 )
+		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read object at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to read container key bag at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
 			 file_offset,
 			 file_offset );
 
 			goto on_error;
 		}
-		switch( object->type )
+		else if( result == 0 )
 		{
-			case 0x4000000c:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading checkpoint map:\n" );
+			internal_container->key_bag->is_locked = 1;
+		}
+	}
+	return( 1 );
 
-					if( libfsapfs_checkpoint_map_initialize(
-					     &checkpoint_map,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create backup checkpoint map.",
-						 function );
+on_error:
+	if( internal_container->key_bag != NULL )
+	{
+		libfsapfs_container_key_bag_free(
+		 &( internal_container->key_bag ),
+		 NULL );
+	}
+	if( internal_container->object_map_btree != NULL )
+	{
+		libfsapfs_object_map_btree_free(
+		 &( internal_container->object_map_btree ),
+		 NULL );
+	}
+	if( object_map != NULL )
+	{
+		libfsapfs_object_map_free(
+		 &object_map,
+		 NULL );
+	}
+	if( internal_container->checkpoint_map != NULL )
+	{
+		libfsapfs_checkpoint_map_free(
+		 &( internal_container->checkpoint_map ),
+		 NULL );
+	}
+	if( internal_container->superblock != NULL )
+	{
+		libfsapfs_container_superblock_free(
+		 &( internal_container->superblock ),
+		 NULL );
+	}
+	return( -1 );
+}
 
-						goto on_error;
-					}
-					if( libfsapfs_checkpoint_map_read_file_io_handle(
-					     checkpoint_map,
-					     file_io_handle,
-					     file_offset,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_READ_FAILED,
-						 "%s: unable to read backup checkpoint map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-						 function,
-						 file_offset,
-						 file_offset );
+/* Opens a view of the container as of a specific checkpoint
+ * The checkpoint container uses its own file IO handle and reads the container superblock,
+ * checkpoint map, object map and key bag of the checkpoint. It shares the data block vector
+ * and object map B-tree caches of the source container, which must remain open while
+ * the checkpoint container is used. The volumes of the checkpoint container are retrieved
+ * with libfsapfs_container_get_volume_by_index
+ * Returns 1 if successful, 0 if no such checkpoint or -1 on error
+ */
+int libfsapfs_container_open_checkpoint(
+     libfsapfs_container_t *container,
+     uint64_t transaction_identifier,
+     libfsapfs_container_t **checkpoint_container,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_checkpoint_t checkpoint;
 
-						goto on_error;
-					}
-					if( libfsapfs_checkpoint_map_free(
-					     &checkpoint_map,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free backup checkpoint map.",
-						 function );
+	libfsapfs_internal_container_t *internal_checkpoint_container = NULL;
+	libfsapfs_internal_container_t *internal_container            = NULL;
+	static char *function                                         = "libfsapfs_container_open_checkpoint";
+	int checkpoint_index                                          = 0;
+	int result                                                    = 0;
 
-						goto on_error;
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-				if( object->transaction_identifier > checkpoint_map_transaction_identifier )
-				{
-					checkpoint_map_block_number           = internal_container->superblock->checkpoint_descriptor_area_block_number + metadata_block_index;
-					checkpoint_map_transaction_identifier = object->transaction_identifier;
-				}
-				break;
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
 
-			case 0x80000001:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading container superblock:\n" );
-				}
-#endif
-				if( libfsapfs_container_superblock_initialize(
-				     &container_superblock,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create backup container superblock.",
-					 function );
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
 
-					goto on_error;
-				}
-				if( libfsapfs_container_superblock_read_file_io_handle(
-				     container_superblock,
-				     file_io_handle,
-				     file_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read backup container superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-					 function,
-					 file_offset,
-					 file_offset );
+	if( internal_container->object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing object map B-tree.",
+		 function );
 
-					goto on_error;
-				}
-				if( container_superblock->object_transaction_identifier > internal_container->superblock->object_transaction_identifier )
-				{
-					container_superblock_swap      = internal_container->superblock;
-					internal_container->superblock = container_superblock;
-					container_superblock           = container_superblock_swap;
-				}
-				if( libfsapfs_container_superblock_free(
-				     &container_superblock,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free backup container superblock.",
-					 function );
+		return( -1 );
+	}
+	if( checkpoint_container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint container.",
+		 function );
 
-					goto on_error;
-				}
-				break;
+		return( -1 );
+	}
+	if( *checkpoint_container != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint container value already set.",
+		 function );
 
-			default:
-				break;
-		}
-		file_offset += internal_container->io_handle->block_size;
+		return( -1 );
 	}
-	if( libfsapfs_object_free(
-	     &object,
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free object.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( checkpoint_map_block_number == 0 )
+#endif
+	for( checkpoint_index = 0;
+	     checkpoint_index < internal_container->number_of_checkpoints;
+	     checkpoint_index++ )
+	{
+		if( internal_container->checkpoints[ checkpoint_index ].transaction_identifier == transaction_identifier )
+		{
+			checkpoint = internal_container->checkpoints[ checkpoint_index ];
+
+			result = 1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing checkpoint map block number.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#endif
+	if( result == 0 )
 	{
-		libcnotify_printf(
-		 "Reading checkpoint map:\n" );
+		return( 0 );
 	}
-#endif
-	if( libfsapfs_checkpoint_map_initialize(
-	     &( internal_container->checkpoint_map ),
+	if( libfsapfs_container_clone(
+	     checkpoint_container,
+	     container,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create checkpoint map.",
+		 "%s: unable to create checkpoint container.",
 		 function );
 
 		goto on_error;
 	}
-	file_offset = checkpoint_map_block_number * internal_container->io_handle->block_size;
-
-	if( libfsapfs_checkpoint_map_read_file_io_handle(
-	     internal_container->checkpoint_map,
-	     file_io_handle,
-	     file_offset,
+	internal_checkpoint_container = (libfsapfs_internal_container_t *) *checkpoint_container;
+
+	/* The checkpoint specific metadata replaces the metadata referenced from the source container,
+	 * the object map B-tree of the checkpoint shares the caches of the object map B-tree
+	 * owned by the shared state so that it remains valid when the source container is freed
+	 */
+	internal_checkpoint_container->superblock       = NULL;
+	internal_checkpoint_container->checkpoint_map   = NULL;
+	internal_checkpoint_container->object_map_btree = NULL;
+	internal_checkpoint_container->key_bag          = NULL;
+
+	if( libfsapfs_internal_container_open_read_checkpoint(
+	     internal_checkpoint_container,
+	     internal_checkpoint_container->file_io_handle,
+	     &checkpoint,
+	     internal_checkpoint_container->shared_state->object_map_btree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read checkpoint map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open checkpoint: %" PRIu64 ".",
 		 function,
-		 file_offset,
-		 file_offset );
+		 transaction_identifier );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( 1 );
+
+on_error:
+	if( *checkpoint_container != NULL )
 	{
-		if( internal_container->superblock->fusion_middle_tree_block_number != 0 )
-		{
-			libcnotify_printf(
-			 "Reading Fusion middle tree:\n" );
+		libfsapfs_container_free(
+		 checkpoint_container,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			file_offset = internal_container->superblock->fusion_middle_tree_block_number * internal_container->io_handle->block_size;
+/* Opens the volumes of a partition
+ * This function is used as a thread entry point
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_volume_partition_open_read(
+     libfsapfs_container_volume_partition_t *partition )
+{
+	static char *function = "libfsapfs_container_volume_partition_open_read";
+	int volume_index      = 0;
 
-			if( libfsapfs_fusion_middle_tree_initialize(
-			     &( internal_container->fusion_middle_tree ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create Fusion middle tree.",
-				 function );
+	if( partition == NULL )
+	{
+		return( -1 );
+	}
+	partition->result = 1;
 
-				goto on_error;
-			}
-			if( libfsapfs_fusion_middle_tree_read_file_io_handle(
-			     internal_container->fusion_middle_tree,
-			     file_io_handle,
-			     file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read Fusion middle tree at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 file_offset,
-				 file_offset );
+	for( volume_index = 0;
+	     volume_index < partition->number_of_volumes;
+	     volume_index++ )
+	{
+		if( libfsapfs_internal_volume_open_read(
+		     (libfsapfs_internal_volume_t *) partition->volumes[ volume_index ],
+		     partition->file_io_handle,
+		     partition->volume_file_offsets[ volume_index ],
+		     &( partition->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open volume at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 partition->volume_file_offsets[ volume_index ],
+			 partition->volume_file_offsets[ volume_index ] );
 
-				goto on_error;
-			}
+			partition->result = -1;
+
+			break;
 		}
-		if( internal_container->superblock->space_manager_object_identifier > 0 )
-		{
-			libcnotify_printf(
-			 "Reading space manager:\n" );
+	}
+	return( partition->result );
+}
 
-			if( libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
-			     internal_container->checkpoint_map,
-			     internal_container->superblock->space_manager_object_identifier,
-			     &space_manager_block_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine space manager block number from object identifier: 0x08%" PRIx64 ".",
-				 function,
-				 internal_container->superblock->space_manager_object_identifier );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 
-				goto on_error;
-			}
-			file_offset = space_manager_block_number * internal_container->io_handle->block_size;
+/* Frees volume partitions
+ * Joins threads that are still running, the volumes themselves are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_volume_partitions_free(
+     libfsapfs_container_volume_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_volume_partition_t *partition = NULL;
+	static char *function                             = "libfsapfs_container_volume_partitions_free";
+	int partition_index                               = 0;
+	int result                                        = 1;
 
-			if( libfsapfs_space_manager_initialize(
-			     &space_manager,
-			     error ) != 1 )
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( ( *partitions )[ partition_index ] );
+
+			if( partition->thread != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create space manager.",
-				 function );
+				if( libcthreads_thread_join(
+				     &( partition->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join partition: %d thread.",
+					 function,
+					 partition_index );
 
-				goto on_error;
+					result = -1;
+				}
 			}
-			if( libfsapfs_space_manager_read_file_io_handle(
-			     space_manager,
-			     file_io_handle,
-			     file_offset,
-			     error ) != 1 )
+			if( partition->file_io_handle != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read space manager at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 file_offset,
-				 file_offset );
+				if( partition->file_io_handle_opened != 0 )
+				{
+					if( libbfio_handle_close(
+					     partition->file_io_handle,
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close partition: %d file IO handle.",
+						 function,
+						 partition_index );
 
-				goto on_error;
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( partition->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
 			}
-			if( libfsapfs_space_manager_free(
-			     &space_manager,
-			     error ) != 1 )
+			if( partition->error != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free space manager.",
-				 function );
-
-				goto on_error;
+				libcerror_error_free(
+				 &( partition->error ) );
 			}
 		}
-		if( internal_container->superblock->reaper_object_identifier > 0 )
-		{
-			libcnotify_printf(
-			 "Reading reaper:\n" );
+		memory_free(
+		 *partitions );
 
-			if( libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
-			     internal_container->checkpoint_map,
-			     internal_container->superblock->reaper_object_identifier,
-			     &reaper_block_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine reaper block number from object identifier: 0x08%" PRIx64 ".",
-				 function,
-				 internal_container->superblock->reaper_object_identifier );
+		*partitions = NULL;
+	}
+	return( result );
+}
 
-				goto on_error;
-			}
-			file_offset = reaper_block_number * internal_container->io_handle->block_size;
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
 
-			if( libfsapfs_container_reaper_initialize(
-			     &container_reaper,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create container reaper.",
-				 function );
+/* Opens all volumes of the container concurrently
+ * The volumes array must contain number of volumes entries that are set to NULL
+ * The object map look ups are done up front, after which the volumes are divided
+ * over number of threads, each reading with its own clone of the file IO handle
+ * The volumes share the IO handle, container key bag and file IO pool of the container
+ * The volume references must be freed after use with libfsapfs_volume_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_open_all_volumes(
+     libfsapfs_container_t *container,
+     libfsapfs_volume_t **volumes,
+     int number_of_volumes,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_volume_partition_t serial_partition;
 
-				goto on_error;
-			}
-			if( libfsapfs_container_reaper_read_file_io_handle(
-			     container_reaper,
-			     file_io_handle,
-			     file_offset,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read container reaper at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 file_offset,
-				 file_offset );
+	libfsapfs_internal_container_t *internal_container       = NULL;
+	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
+	off64_t *volume_file_offsets                             = NULL;
+	static char *function                                    = "libfsapfs_container_open_all_volumes";
+	int volume_index                                         = 0;
 
-				goto on_error;
-			}
-			if( libfsapfs_container_reaper_free(
-			     &container_reaper,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free container reaper.",
-				 function );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libfsapfs_container_volume_partition_t *partition        = NULL;
+	libfsapfs_container_volume_partition_t *partitions       = NULL;
+	size_t partitions_size                                   = 0;
+	int first_volume_index                                   = 0;
+	int number_of_partitions                                 = 0;
+	int partition_index                                      = 0;
+	int result                                               = 0;
+#endif
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		return( -1 );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	internal_container = (libfsapfs_internal_container_t *) container;
 
-	if( libfsapfs_container_data_handle_initialize(
-	     &container_data_handle,
-	     internal_container->io_handle,
-	     error ) != 1 )
+	if( internal_container->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing superblock.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_initialize(
-	     &( internal_container->data_block_vector ),
-	     (size64_t) internal_container->io_handle->block_size,
-	     (intptr_t *) container_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
+	if( internal_container->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block vector.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_container->container_data_handle = container_data_handle;
-	container_data_handle                     = NULL;
-
-	if( libfdata_vector_append_segment(
-	     internal_container->data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_container->io_handle->container_size,
-	     0,
-	     error ) != 1 )
+	if( volumes == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to data block vector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volumes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO refactor into function to read object map */
-	if( internal_container->superblock->object_map_block_number == 0 )
+	if( number_of_volumes != (int) internal_container->superblock->number_of_volumes )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing object map block number.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of volumes value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( number_of_threads <= 0 )
 	{
-		libcnotify_printf(
-		 "Reading object map:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	file_offset = internal_container->superblock->object_map_block_number * internal_container->io_handle->block_size;
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( volumes[ volume_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid volume: %d value already set.",
+			 function,
+			 volume_index );
 
-	if( libfsapfs_object_map_initialize(
-	     &object_map,
-	     error ) != 1 )
+			return( -1 );
+		}
+	}
+	if( number_of_volumes == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &serial_partition,
+	     0,
+	     sizeof( libfsapfs_container_volume_partition_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create object map.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear serial partition.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsapfs_object_map_read_file_io_handle(
-	     object_map,
-	     file_io_handle,
-	     file_offset,
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read object map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( object_map->btree_block_number == 0 )
+#endif
+	volume_file_offsets = (off64_t *) memory_allocate(
+	                                   sizeof( off64_t ) * number_of_volumes );
+
+	if( volume_file_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing object map B-tree block number.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volume file offsets.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading object map B-tree:\n" );
-	}
-#endif
-	if( libfsapfs_object_map_btree_initialize(
-	     &( internal_container->object_map_btree ),
-	     internal_container->io_handle,
-	     internal_container->data_block_vector,
-	     object_map->btree_block_number,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create object map B-tree.",
-		 function );
+		goto on_error;
+	}
+	/* The object map B-tree caches its nodes and is not safe for concurrent use
+	 * hence the volume file offsets are determined before the threads are started
+	 */
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+		     internal_container->object_map_btree,
+		     internal_container->file_io_handle,
+		     internal_container->superblock->volume_object_identifiers[ volume_index ],
+		     &object_map_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object map descriptor for volume object identifier: %" PRIu64 ".",
+			 function,
+			 internal_container->superblock->volume_object_identifiers[ volume_index ] );
+
+			goto on_error;
+		}
+		if( object_map_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid object map descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		volume_file_offsets[ volume_index ] = (off64_t) ( object_map_descriptor->physical_address * internal_container->io_handle->block_size );
+
+		if( libfsapfs_object_map_descriptor_free(
+		     &object_map_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free object map descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_volume_initialize(
+		     &( volumes[ volume_index ] ),
+		     internal_container->io_handle,
+		     internal_container->file_io_handle,
+		     internal_container->key_bag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		( (libfsapfs_internal_volume_t *) volumes[ volume_index ] )->file_io_pool = internal_container->file_io_pool;
+	}
+#if !defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the volumes are opened one after the other
+	 */
+	number_of_threads = 1;
+#endif
+	if( number_of_threads > number_of_volumes )
+	{
+		number_of_threads = number_of_volumes;
+	}
+	if( number_of_threads == 1 )
+	{
+		serial_partition.file_io_handle      = internal_container->file_io_handle;
+		serial_partition.volumes             = volumes;
+		serial_partition.volume_file_offsets = volume_file_offsets;
+		serial_partition.number_of_volumes   = number_of_volumes;
+
+		if( libfsapfs_container_volume_partition_open_read(
+		     &serial_partition ) != 1 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error                 = serial_partition.error;
+				serial_partition.error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open volumes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	else
+	{
+		partitions_size = sizeof( libfsapfs_container_volume_partition_t ) * number_of_threads;
+
+		partitions = (libfsapfs_container_volume_partition_t *) memory_allocate(
+		                                                         partitions_size );
+
+		if( partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     partitions,
+		     0,
+		     partitions_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partitions.",
+			 function );
+
+			memory_free(
+			 partitions );
+
+			partitions = NULL;
+
+			goto on_error;
+		}
+		number_of_partitions = number_of_threads;
+
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			first_volume_index = (int) ( ( (int64_t) partition_index * number_of_volumes ) / number_of_partitions );
+
+			partition->volumes             = &( volumes[ first_volume_index ] );
+			partition->volume_file_offsets = &( volume_file_offsets[ first_volume_index ] );
+			partition->number_of_volumes   = (int) ( ( ( (int64_t) partition_index + 1 ) * number_of_volumes ) / number_of_partitions ) - first_volume_index;
+
+			if( libbfio_handle_clone(
+			     &( partition->file_io_handle ),
+			     internal_container->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d file IO handle.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          partition->file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if partition: %d file IO handle is open.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     partition->file_io_handle,
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				partition->file_io_handle_opened = 1;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_create(
+			     &( partition->thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsapfs_container_volume_partition_open_read,
+			     (void *) partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_join(
+			     &( partition->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
 
-		goto on_error;
-	}
-	if( libfsapfs_object_map_free(
-	     &object_map,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free object map.",
-		 function );
+			if( partition->result != 1 )
+			{
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error           = partition->error;
+					partition->error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open partition: %d volumes.",
+				 function,
+				 partition_index );
 
-		goto on_error;
-	}
-	if( ( internal_container->superblock->key_bag_block_number > 0 )
-	 && ( internal_container->superblock->key_bag_number_of_blocks > 0 ) )
-	{
-		if( libfsapfs_container_key_bag_initialize(
-		     &( internal_container->key_bag ),
+				goto on_error;
+			}
+		}
+		if( libfsapfs_container_volume_partitions_free(
+		     &partitions,
+		     number_of_partitions,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create container key bag.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partitions.",
 			 function );
 
 			goto on_error;
 		}
-		file_offset = internal_container->superblock->key_bag_block_number * internal_container->io_handle->block_size;
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
 
-		result = libfsapfs_container_key_bag_read_file_io_handle(
-		          internal_container->key_bag,
-		          internal_container->io_handle,
-		          file_io_handle,
-		          file_offset,
-		          (size64_t) internal_container->superblock->key_bag_number_of_blocks * internal_container->io_handle->block_size,
-		          internal_container->superblock->container_identifier,
-		          error );
+	memory_free(
+	 volume_file_offsets );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read container key bag at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			internal_container->key_bag->is_locked = 1;
-		}
+		return( -1 );
 	}
+#endif
 	return( 1 );
 
 on_error:
-	if( internal_container->key_bag != NULL )
-	{
-		libfsapfs_container_key_bag_free(
-		 &( internal_container->key_bag ),
-		 NULL );
-	}
-	if( internal_container->object_map_btree != NULL )
-	{
-		libfsapfs_object_map_btree_free(
-		 &( internal_container->object_map_btree ),
-		 NULL );
-	}
-	if( object_map != NULL )
-	{
-		libfsapfs_object_map_free(
-		 &object_map,
-		 NULL );
-	}
-	if( internal_container->data_block_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &( internal_container->data_block_vector ),
-		 NULL );
-	}
-	if( container_data_handle != NULL )
-	{
-		libfsapfs_container_data_handle_free(
-		 &container_data_handle,
-		 NULL );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( container_reaper != NULL )
-	{
-		libfsapfs_container_reaper_free(
-		 &container_reaper,
-		 NULL );
-	}
-	if( space_manager != NULL )
-	{
-		libfsapfs_space_manager_free(
-		 &space_manager,
-		 NULL );
-	}
-#endif
-	if( internal_container->checkpoint_map != NULL )
-	{
-		libfsapfs_checkpoint_map_free(
-		 &( internal_container->checkpoint_map ),
-		 NULL );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( checkpoint_map != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( partitions != NULL )
 	{
-		libfsapfs_checkpoint_map_free(
-		 &checkpoint_map,
+		libfsapfs_container_volume_partitions_free(
+		 &partitions,
+		 number_of_partitions,
 		 NULL );
 	}
 #endif
-	if( container_superblock != NULL )
+	if( serial_partition.error != NULL )
 	{
-		libfsapfs_container_superblock_free(
-		 &container_superblock,
-		 NULL );
+		libcerror_error_free(
+		 &( serial_partition.error ) );
 	}
-	if( internal_container->fusion_middle_tree != NULL )
+	if( object_map_descriptor != NULL )
 	{
-		libfsapfs_fusion_middle_tree_free(
-		 &( internal_container->fusion_middle_tree ),
+		libfsapfs_object_map_descriptor_free(
+		 &object_map_descriptor,
 		 NULL );
 	}
-	if( object != NULL )
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
 	{
-		libfsapfs_object_free(
-		 &object,
-		 NULL );
+		if( volumes[ volume_index ] != NULL )
+		{
+			libfsapfs_volume_free(
+			 &( volumes[ volume_index ] ),
+			 NULL );
+		}
 	}
-	if( internal_container->superblock != NULL )
+	if( volume_file_offsets != NULL )
 	{
-		libfsapfs_container_superblock_free(
-		 &( internal_container->superblock ),
-		 NULL );
+		memory_free(
+		 volume_file_offsets );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_container->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves the size
+/* Carves file system B-tree leaf nodes from a range of container blocks
+ * This can be used to recover records of nodes that are no longer referenced
+ * If number_of_blocks is 0 the blocks up to the end of the container are scanned
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_get_size(
+int libfsapfs_container_carve_file_system_btree_nodes(
      libfsapfs_container_t *container,
-     size64_t *size,
+     uint64_t first_block_number,
+     uint64_t number_of_blocks,
+     int number_of_threads,
+     libfsapfs_node_carver_t **node_carver,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_get_size";
+	libfsapfs_node_carver_t *safe_node_carver          = NULL;
+	static char *function                              = "libfsapfs_container_carve_file_system_btree_nodes";
+	uint64_t container_number_of_blocks                = 0;
 
 	if( container == NULL )
 	{
@@ -1925,36 +5091,41 @@ int libfsapfs_container_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_carver == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid node carver.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_container->read_write_lock,
-	     error ) != 1 )
+	if( *node_carver != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node carver value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*size = internal_container->io_handle->container_size;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1962,71 +5133,60 @@ int libfsapfs_container_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
-}
-
-/* Retrieves the identifier
- * The identifier is an UUID stored in big-endian and is 16 bytes of size
- * Returns 1 if successful or -1 on error
- */
-int libfsapfs_container_get_identifier(
-     libfsapfs_container_t *container,
-     uint8_t *uuid_data,
-     size_t uuid_data_size,
-     libcerror_error_t **error )
-{
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_get_identifier";
-	int result                                         = 1;
+	container_number_of_blocks = internal_container->superblock->number_of_blocks;
 
-	if( container == NULL )
+	if( first_block_number >= container_number_of_blocks )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid container.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first block number value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_container = (libfsapfs_internal_container_t *) container;
-
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_container->read_write_lock,
+	if( ( number_of_blocks == 0 )
+	 || ( number_of_blocks > ( container_number_of_blocks - first_block_number ) ) )
+	{
+		number_of_blocks = container_number_of_blocks - first_block_number;
+	}
+	if( libfsapfs_node_carver_initialize(
+	     &safe_node_carver,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node carver.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libfsapfs_container_superblock_get_container_identifier(
-	     internal_container->superblock,
-	     uuid_data,
-	     uuid_data_size,
+	if( libfsapfs_internal_node_carver_read_file_io_handle(
+	     (libfsapfs_internal_node_carver_t *) safe_node_carver,
+	     internal_container->io_handle,
+	     internal_container->file_io_handle,
+	     first_block_number,
+	     number_of_blocks,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve container identifier.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to carve file system B-tree nodes.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -2040,24 +5200,48 @@ int libfsapfs_container_get_identifier(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libfsapfs_node_carver_free(
+		 &safe_node_carver,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( result );
+	*node_carver = safe_node_carver;
+
+	return( 1 );
+
+on_error:
+	if( safe_node_carver != NULL )
+	{
+		libfsapfs_node_carver_free(
+		 &safe_node_carver,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_container->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Determines if the container is locked
- * Returns 1 if locked, 0 if not or -1 on error
+/* Retrieves the amount of memory used by the caches of the container
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_is_locked(
-     libfsapfs_container_t *container,
+int libfsapfs_internal_container_get_memory_usage(
+     libfsapfs_internal_container_t *internal_container,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_is_locked";
-	uint8_t is_locked                                  = 0;
+	static char *function                       = "libfsapfs_internal_container_get_memory_usage";
+	size64_t safe_data_block_cache_memory_usage = 0;
+	size64_t safe_node_cache_memory_usage       = 0;
+	size64_t tree_data_block_cache_memory_usage = 0;
+	size64_t tree_node_cache_memory_usage       = 0;
 
-	if( container == NULL )
+	if( internal_container == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2068,55 +5252,70 @@ int libfsapfs_container_is_locked(
 
 		return( -1 );
 	}
-	internal_container = (libfsapfs_internal_container_t *) container;
-
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_container->read_write_lock,
-	     error ) != 1 )
+	if( node_cache_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache memory usage.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_container->key_bag != NULL )
-	{
-		is_locked = internal_container->key_bag->is_locked;
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_container->read_write_lock,
-	     error ) != 1 )
+	if( data_block_cache_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block cache memory usage.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( is_locked );
+	if( internal_container->object_map_btree != NULL )
+	{
+		if( libfsapfs_object_map_btree_get_memory_usage(
+		     internal_container->object_map_btree,
+		     &tree_node_cache_memory_usage,
+		     &tree_data_block_cache_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object map B-tree memory usage.",
+			 function );
+
+			return( -1 );
+		}
+		safe_node_cache_memory_usage       += tree_node_cache_memory_usage;
+		safe_data_block_cache_memory_usage += tree_data_block_cache_memory_usage;
+	}
+	*node_cache_memory_usage       = safe_node_cache_memory_usage;
+	*data_block_cache_memory_usage = safe_data_block_cache_memory_usage;
+
+	return( 1 );
 }
 
-/* Retrieves the number of volumes
+/* Retrieves the amount of memory used by the container
+ * The memory usage type specifies the subsystem, where LIBFSAPFS_MEMORY_USAGE_TYPE_ALL
+ * retrieves the sum of all subsystems
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_get_number_of_volumes(
+int libfsapfs_container_get_memory_usage(
      libfsapfs_container_t *container,
-     int *number_of_volumes,
+     int memory_usage_type,
+     size64_t *memory_usage,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_container_t *internal_container = NULL;
-	static char *function                              = "libfsapfs_container_get_number_of_volumes";
+	static char *function                              = "libfsapfs_container_get_memory_usage";
+	size64_t data_block_cache_memory_usage             = 0;
+	size64_t node_cache_memory_usage                   = 0;
+	int result                                         = 1;
 
 	if( container == NULL )
 	{
@@ -2131,24 +5330,26 @@ int libfsapfs_container_get_number_of_volumes(
 	}
 	internal_container = (libfsapfs_internal_container_t *) container;
 
-	if( internal_container->superblock == NULL )
+	if( ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_ALL )
+	 && ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_BTREE_NODES )
+	 && ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_DATA_BLOCKS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid container - missing superblock.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory usage type.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_volumes == NULL )
+	if( memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of volumes.",
+		 "%s: invalid memory usage.",
 		 function );
 
 		return( -1 );
@@ -2168,8 +5369,21 @@ int libfsapfs_container_get_number_of_volumes(
 		return( -1 );
 	}
 #endif
-	*number_of_volumes = internal_container->superblock->number_of_volumes;
+	if( libfsapfs_internal_container_get_memory_usage(
+	     internal_container,
+	     &node_cache_memory_usage,
+	     &data_block_cache_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_container->read_write_lock,
@@ -2185,23 +5399,44 @@ int libfsapfs_container_get_number_of_volumes(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	if( result == 1 )
+	{
+		switch( memory_usage_type )
+		{
+			case LIBFSAPFS_MEMORY_USAGE_TYPE_BTREE_NODES:
+				*memory_usage = node_cache_memory_usage;
+				break;
+
+			case LIBFSAPFS_MEMORY_USAGE_TYPE_DATA_BLOCKS:
+				*memory_usage = data_block_cache_memory_usage;
+				break;
+
+			default:
+				*memory_usage = node_cache_memory_usage + data_block_cache_memory_usage;
+				break;
+		}
+	}
+	return( result );
 }
 
-/* Retrieves a specific of volume
- * The volume reference must be freed after use with libfsapfs_volume_free
+/* Trims the caches of the container until the memory used is less than or equal to the target memory usage
+ * The caches are trimmed progressively, first the data block caches, then the B-tree leaf nodes,
+ * then the B-tree branch nodes and finally the B-tree root nodes
+ * Volumes retrieved from the container have their own caches, use libfsapfs_volume_trim_caches
+ * to trim these
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_container_get_volume_by_index(
+int libfsapfs_container_trim_caches(
      libfsapfs_container_t *container,
-     int volume_index,
-     libfsapfs_volume_t **volume,
+     size64_t target_memory_usage,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_container_t *internal_container       = NULL;
-	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
-	static char *function                                    = "libfsapfs_container_get_volume_by_index";
-	off64_t file_offset                                      = 0;
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_trim_caches";
+	size64_t data_block_cache_memory_usage             = 0;
+	size64_t memory_usage                              = 0;
+	size64_t node_cache_memory_usage                   = 0;
+	int trim_level                                     = 0;
 
 	if( container == NULL )
 	{
@@ -2216,53 +5451,8 @@ int libfsapfs_container_get_volume_by_index(
 	}
 	internal_container = (libfsapfs_internal_container_t *) container;
 
-	if( internal_container->superblock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid container - missing superblock.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( volume_index < 0 )
-	 || ( volume_index >= (int) internal_container->superblock->number_of_volumes ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume index value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( volume == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
-
-		return( -1 );
-	}
-	if( *volume != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2270,89 +5460,59 @@ int libfsapfs_container_get_volume_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
-	     internal_container->object_map_btree,
-	     internal_container->file_io_handle,
-	     internal_container->superblock->volume_object_identifiers[ volume_index ],
-	     &object_map_descriptor,
+	if( libfsapfs_internal_container_get_memory_usage(
+	     internal_container,
+	     &node_cache_memory_usage,
+	     &data_block_cache_memory_usage,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve object map descriptor for volume object identifier: %" PRIu64 ".",
-		 function,
-		 internal_container->superblock->volume_object_identifiers[ volume_index ] );
-
-		goto on_error;
-	}
-	if( object_map_descriptor == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid object map descriptor.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfsapfs_volume_initialize(
-	     volume,
-	     internal_container->io_handle,
-	     internal_container->file_io_handle,
-	     internal_container->key_bag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create volume.",
+		 "%s: unable to retrieve memory usage.",
 		 function );
 
 		goto on_error;
 	}
-	file_offset = (off64_t) ( object_map_descriptor->physical_address * internal_container->io_handle->block_size );
-
-	if( libfsapfs_object_map_descriptor_free(
-	     &object_map_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free object map descriptor.",
-		 function );
+	memory_usage = node_cache_memory_usage + data_block_cache_memory_usage;
 
-		goto on_error;
-	}
-	if( libfsapfs_internal_volume_open_read(
-	     (libfsapfs_internal_volume_t *) *volume,
-	     internal_container->file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	for( trim_level = LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS;
+	     trim_level < LIBFSAPFS_NUMBER_OF_CACHE_TRIM_LEVELS;
+	     trim_level++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %d.",
-		 function,
-		 volume_index );
+		if( memory_usage <= target_memory_usage )
+		{
+			break;
+		}
+		if( internal_container->object_map_btree != NULL )
+		{
+			if( libfsapfs_object_map_btree_trim_caches(
+			     internal_container->object_map_btree,
+			     trim_level,
+			     target_memory_usage,
+			     &memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to trim object map B-tree caches.",
+				 function );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_container->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2360,7 +5520,7 @@ int libfsapfs_container_get_volume_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -2369,20 +5529,8 @@ int libfsapfs_container_get_volume_by_index(
 	return( 1 );
 
 on_error:
-	if( object_map_descriptor != NULL )
-	{
-		libfsapfs_object_map_descriptor_free(
-		 &object_map_descriptor,
-		 NULL );
-	}
-	if( *volume != NULL )
-	{
-		libfsapfs_volume_free(
-		 volume,
-		 NULL );
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
+	libcthreads_read_write_lock_release_for_write(
 	 internal_container->read_write_lock,
 	 NULL );
 #endif
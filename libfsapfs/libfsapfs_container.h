@@ -43,6 +43,83 @@
 extern "C" {
 #endif
 
+typedef struct libfsapfs_container_checkpoint libfsapfs_container_checkpoint_t;
+
+struct libfsapfs_container_checkpoint
+{
+	/* The transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The block number of the container superblock
+	 */
+	uint64_t superblock_block_number;
+
+	/* The block number of the checkpoint map
+	 */
+	uint64_t checkpoint_map_block_number;
+};
+
+/* The data handle, data block vector and checkpoints are not modified after
+ * the container is opened. The data block vector is only read through the
+ * object map B-tree, which uses its own caches and read/write lock, so the
+ * read/write lock of the shared state only needs to protect the reference count
+ */
+typedef struct libfsapfs_container_shared_state libfsapfs_container_shared_state_t;
+
+struct libfsapfs_container_shared_state
+{
+	/* The IO handle referenced by the shared container data handle and object map B-tree
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The container superblock
+	 */
+	libfsapfs_container_superblock_t *superblock;
+
+	/* The Fusion middle tree
+	 */
+	libfsapfs_fusion_middle_tree_t *fusion_middle_tree;
+
+	/* The checkpoint map
+	 */
+	libfsapfs_checkpoint_map_t *checkpoint_map;
+
+	/* The container data handle
+	 */
+	libfsapfs_container_data_handle_t *container_data_handle;
+
+	/* The data block vector
+	 */
+	libfdata_vector_t *data_block_vector;
+
+	/* The object map B-tree
+	 */
+	libfsapfs_object_map_btree_t *object_map_btree;
+
+	/* The container key bag
+	 */
+	libfsapfs_container_key_bag_t *key_bag;
+
+	/* The checkpoints in the checkpoint descriptor area
+	 */
+	libfsapfs_container_checkpoint_t *checkpoints;
+
+	/* The number of checkpoints
+	 */
+	int number_of_checkpoints;
+
+	/* The number of containers referencing the shared state
+	 */
+	int reference_count;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
 typedef struct libfsapfs_internal_container libfsapfs_internal_container_t;
 
 struct libfsapfs_internal_container
@@ -75,6 +152,15 @@ struct libfsapfs_internal_container
 	 */
 	libfsapfs_container_key_bag_t *key_bag;
 
+	/* The checkpoints in the checkpoint descriptor area
+	 * sorted from most to least recent
+	 */
+	libfsapfs_container_checkpoint_t *checkpoints;
+
+	/* The number of checkpoints
+	 */
+	int number_of_checkpoints;
+
 	/* The IO handle
 	 */
 	libfsapfs_io_handle_t *io_handle;
@@ -91,6 +177,18 @@ struct libfsapfs_internal_container
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* Value to indicate if the file IO pool was opened inside the library
+	 */
+	uint8_t file_io_pool_opened_in_library;
+
+	/* The metadata shared with clones and checkpoint views of the container
+	 */
+	libfsapfs_container_shared_state_t *shared_state;
+
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -98,6 +196,45 @@ struct libfsapfs_internal_container
 #endif
 };
 
+typedef struct libfsapfs_container_volume_partition libfsapfs_container_volume_partition_t;
+
+struct libfsapfs_container_volume_partition
+{
+	/* The (partition specific) file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened
+	 */
+	uint8_t file_io_handle_opened;
+
+	/* The volumes
+	 */
+	libfsapfs_volume_t **volumes;
+
+	/* The volume file offsets
+	 */
+	off64_t *volume_file_offsets;
+
+	/* The number of volumes
+	 */
+	int number_of_volumes;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_container_initialize(
      libfsapfs_container_t **container,
@@ -108,6 +245,28 @@ int libfsapfs_container_free(
      libfsapfs_container_t **container,
      libcerror_error_t **error );
 
+int libfsapfs_container_shared_state_initialize(
+     libfsapfs_container_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_container_shared_state_free(
+     libfsapfs_container_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_container_shared_state_grab_reference(
+     libfsapfs_container_shared_state_t *shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_container_shared_state_release_reference(
+     libfsapfs_container_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_clone(
+     libfsapfs_container_t **destination_container,
+     libfsapfs_container_t *source_container,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_container_signal_abort(
      libfsapfs_container_t *container,
@@ -138,11 +297,31 @@ int libfsapfs_container_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_open_file_io_pool(
+     libfsapfs_container_t *container,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_container_close(
      libfsapfs_container_t *container,
      libcerror_error_t **error );
 
+int libfsapfs_container_checkpoints_set_block_number(
+     libfsapfs_container_checkpoint_t *checkpoints,
+     int *number_of_checkpoints,
+     int maximum_number_of_checkpoints,
+     uint64_t transaction_identifier,
+     uint64_t block_number,
+     uint32_t object_type,
+     libcerror_error_t **error );
+
+int libfsapfs_container_checkpoint_compare(
+     const void *first_checkpoint,
+     const void *second_checkpoint );
+
 int libfsapfs_internal_container_open_read(
      libfsapfs_internal_container_t *internal_container,
      libbfio_handle_t *file_io_handle,
@@ -180,6 +359,81 @@ int libfsapfs_container_get_volume_by_index(
      libfsapfs_volume_t **volume,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_get_number_of_checkpoints(
+     libfsapfs_container_t *container,
+     int *number_of_checkpoints,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_get_checkpoint_transaction_identifier_by_index(
+     libfsapfs_container_t *container,
+     int checkpoint_index,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_container_open_read_checkpoint(
+     libfsapfs_internal_container_t *internal_container,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_container_checkpoint_t *checkpoint,
+     libfsapfs_object_map_btree_t *source_object_map_btree,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_open_checkpoint(
+     libfsapfs_container_t *container,
+     uint64_t transaction_identifier,
+     libfsapfs_container_t **checkpoint_container,
+     libcerror_error_t **error );
+
+int libfsapfs_container_volume_partition_open_read(
+     libfsapfs_container_volume_partition_t *partition );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+int libfsapfs_container_volume_partitions_free(
+     libfsapfs_container_volume_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_open_all_volumes(
+     libfsapfs_container_t *container,
+     libfsapfs_volume_t **volumes,
+     int number_of_volumes,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_carve_file_system_btree_nodes(
+     libfsapfs_container_t *container,
+     uint64_t first_block_number,
+     uint64_t number_of_blocks,
+     int number_of_threads,
+     libfsapfs_node_carver_t **node_carver,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_container_get_memory_usage(
+     libfsapfs_internal_container_t *internal_container,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_get_memory_usage(
+     libfsapfs_container_t *container,
+     int memory_usage_type,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_trim_caches(
+     libfsapfs_container_t *container,
+     size64_t target_memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
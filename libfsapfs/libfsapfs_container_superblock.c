@@ -442,6 +442,14 @@ int libfsapfs_container_superblock_read_data(
 	 ( (fsapfs_container_superblock_t *) data )->checkpoint_descriptor_area_block_number,
 	 container_superblock->checkpoint_descriptor_area_block_number );
 
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_container_superblock_t *) data )->checkpoint_descriptor_index,
+	 container_superblock->checkpoint_descriptor_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_container_superblock_t *) data )->checkpoint_descriptor_number_of_blocks,
+	 container_superblock->checkpoint_descriptor_number_of_blocks );
+
 	byte_stream_copy_to_uint64_little_endian(
 	 ( (fsapfs_container_superblock_t *) data )->fusion_middle_tree_block_number,
 	 container_superblock->fusion_middle_tree_block_number );
@@ -604,21 +612,15 @@ int libfsapfs_container_superblock_read_data(
 		 function,
 		 value_32bit );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsapfs_container_superblock_t *) data )->unknown10,
-		 value_32bit );
 		libcnotify_printf(
-		 "%s: unknown10\t\t\t\t\t: %" PRIu32 "\n",
+		 "%s: checkpoint descriptor index\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 container_superblock->checkpoint_descriptor_index );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (fsapfs_container_superblock_t *) data )->unknown11,
-		 value_32bit );
 		libcnotify_printf(
-		 "%s: unknown11\t\t\t\t\t: 0x%08" PRIx32 "\n",
+		 "%s: checkpoint descriptor number of blocks\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 container_superblock->checkpoint_descriptor_number_of_blocks );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (fsapfs_container_superblock_t *) data )->unknown12,
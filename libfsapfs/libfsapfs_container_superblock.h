@@ -64,6 +64,14 @@ struct libfsapfs_container_superblock
 	 */
 	uint32_t checkpoint_descriptor_area_block_number;
 
+	/* The index of the first block of the checkpoint in the checkpoint descriptor area
+	 */
+	uint32_t checkpoint_descriptor_index;
+
+	/* The number of blocks of the checkpoint in the checkpoint descriptor area
+	 */
+	uint32_t checkpoint_descriptor_number_of_blocks;
+
 	/* The space manager object identifier
 	 */
 	uint64_t space_manager_object_identifier;
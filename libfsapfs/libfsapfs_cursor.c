@@ -0,0 +1,2863 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_cursor.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_directory_record.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_file_entry.h"
+#include "libfsapfs_file_reference.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcdata.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_types.h"
+
+#include "fsapfs_cursor.h"
+#include "fsapfs_file_system.h"
+
+const uint8_t fsapfs_cursor_signature[ 8 ] = { 'f', 's', 'a', 'p', 'f', 's', 'c', 'r' };
+
+/* Creates a cursor
+ * Make sure the value cursor is referencing, is set to NULL
+ * The cursor is positioned at the end until it is seeked
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cursor_initialize(
+     libfsapfs_cursor_t **cursor,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_initialize";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = memory_allocate_structure(
+	                   libfsapfs_internal_cursor_t );
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cursor,
+	     0,
+	     sizeof( libfsapfs_internal_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cursor.",
+		 function );
+
+		memory_free(
+		 internal_cursor );
+
+		return( -1 );
+	}
+	internal_cursor->io_handle              = io_handle;
+	internal_cursor->file_io_handle         = file_io_handle;
+	internal_cursor->encryption_context     = encryption_context;
+	internal_cursor->file_system_btree      = file_system_btree;
+	internal_cursor->transaction_identifier = file_system_btree->transaction_identifier;
+	internal_cursor->flags                  = LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBFSAPFS )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_cursor->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*cursor = (libfsapfs_cursor_t *) internal_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_cursor != NULL )
+	{
+		memory_free(
+		 internal_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cursor_free(
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_free";
+	int result                                   = 1;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
+	{
+		internal_cursor = (libfsapfs_internal_cursor_t *) *cursor;
+		*cursor         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBFSAPFS )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_cursor->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The io_handle, file_io_handle, encryption_context and file_system_btree references are freed elsewhere
+		 */
+		memory_free(
+		 internal_cursor );
+	}
+	return( result );
+}
+
+/* Retrieves the B-tree node of a specific level on the path of the cursor
+ * The node is owned by the node cache and should not be freed
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_get_node(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     int level,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_cursor_get_node";
+	int result            = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( level < 0 )
+	 || ( level >= internal_cursor->number_of_levels ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( level == 0 )
+	{
+		result = libfsapfs_file_system_btree_get_root_node(
+		          internal_cursor->file_system_btree,
+		          internal_cursor->file_io_handle,
+		          internal_cursor->block_numbers[ 0 ],
+		          node,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_file_system_btree_get_sub_node(
+		          internal_cursor->file_system_btree,
+		          internal_cursor->file_io_handle,
+		          internal_cursor->block_numbers[ level ],
+		          node,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree node: %" PRIu64 " of level: %d.",
+		 function,
+		 internal_cursor->block_numbers[ level ],
+		 level );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the B-tree entry the cursor is positioned at
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_get_btree_entry(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libfsapfs_btree_entry_t **btree_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *node = NULL;
+	static char *function        = "libfsapfs_internal_cursor_get_btree_entry";
+	int level                    = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	level = internal_cursor->number_of_levels - 1;
+
+	if( libfsapfs_internal_cursor_get_node(
+	     internal_cursor,
+	     level,
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree node of level: %d.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_entry_by_index(
+	     node,
+	     internal_cursor->entry_indexes[ level ],
+	     btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d of level: %d.",
+		 function,
+		 internal_cursor->entry_indexes[ level ],
+		 level );
+
+		return( -1 );
+	}
+	if( *btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid entry: %d of level: %d.",
+		 function,
+		 internal_cursor->entry_indexes[ level ],
+		 level );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares the key of a B-tree entry with an identifier and record type
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_compare_btree_entry(
+     libfsapfs_btree_entry_t *btree_entry,
+     uint64_t identifier,
+     uint8_t record_type,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsapfs_internal_cursor_compare_btree_entry";
+	uint64_t entry_identifier       = 0;
+	uint64_t file_system_identifier = 0;
+	uint8_t entry_record_type       = 0;
+
+	if( btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry->key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree entry - missing key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+	 file_system_identifier );
+
+	entry_identifier  = file_system_identifier & 0x0fffffffffffffffUL;
+	entry_record_type = (uint8_t) ( file_system_identifier >> 60 );
+
+	if( entry_identifier < identifier )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( entry_identifier > identifier )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( entry_record_type < record_type )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( entry_record_type > record_type )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Sets the key of the current record
+ * A directory cursor is positioned at the end once it moves past the directory records of its directory
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_set_current_record(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	static char *function                = "libfsapfs_internal_cursor_set_current_record";
+	int compare_result                   = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->key_data_size = 0;
+
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsapfs_internal_cursor_get_btree_entry(
+	     internal_cursor,
+	     &btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current B-tree entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_DIRECTORY_CURSOR ) != 0 )
+	{
+		compare_result = libfsapfs_internal_cursor_compare_btree_entry(
+		                  btree_entry,
+		                  internal_cursor->directory_identifier,
+		                  LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare current B-tree entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( compare_result != LIBCDATA_COMPARE_EQUAL )
+		{
+			internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+
+			return( 1 );
+		}
+	}
+	if( ( btree_entry->key_data == NULL )
+	 || ( btree_entry->key_data_size > (size_t) LIBFSAPFS_CURSOR_MAXIMUM_KEY_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current B-tree entry - key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     internal_cursor->key_data,
+	     btree_entry->key_data,
+	     btree_entry->key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->key_data_size = btree_entry->key_data_size;
+
+	return( 1 );
+}
+
+/* Descends from the last level on the path of the cursor to the first record of the leaf node
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful, 0 if the leaf node contains no records or -1 on error
+ */
+int libfsapfs_internal_cursor_descend_to_first_record(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_internal_cursor_descend_to_first_record";
+	uint64_t sub_node_block_number       = 0;
+	int is_leaf_node                     = 0;
+	int level                            = 0;
+	int number_of_entries                = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		level = internal_cursor->number_of_levels - 1;
+
+		if( libfsapfs_internal_cursor_get_node(
+		     internal_cursor,
+		     level,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree node of level: %d.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                node,
+		                error );
+
+		if( is_leaf_node == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node of level: %d is a leaf node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( is_leaf_node != 0 )
+		{
+			break;
+		}
+		if( level >= ( LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid level value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     internal_cursor->entry_indexes[ level ],
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d of level: %d.",
+			 function,
+			 internal_cursor->entry_indexes[ level ],
+			 level );
+
+			return( -1 );
+		}
+		if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		     internal_cursor->file_system_btree,
+		     internal_cursor->file_io_handle,
+		     btree_entry,
+		     &sub_node_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number of entry: %d of level: %d.",
+			 function,
+			 internal_cursor->entry_indexes[ level ],
+			 level );
+
+			return( -1 );
+		}
+		internal_cursor->block_numbers[ level + 1 ] = sub_node_block_number;
+		internal_cursor->entry_indexes[ level + 1 ] = 0;
+		internal_cursor->number_of_levels          += 1;
+	}
+	while( is_leaf_node == 0 );
+
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries of level: %d.",
+		 function,
+		 level );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Moves the cursor to the next entry in the leaf nodes
+ * When the leaf node is exhausted the cursor ascends to the first parent node
+ * with remaining entries and descends to the first entry of the next leaf node
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful, 0 if no more entries are available or -1 on error
+ */
+int libfsapfs_internal_cursor_move_to_next_leaf_entry(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *node = NULL;
+	static char *function        = "libfsapfs_internal_cursor_move_to_next_leaf_entry";
+	int level                    = 0;
+	int number_of_entries        = 0;
+	int result                   = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->number_of_levels <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - number of levels value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	level = internal_cursor->number_of_levels - 1;
+
+	internal_cursor->entry_indexes[ level ] += 1;
+
+	do
+	{
+		internal_cursor->number_of_levels = level + 1;
+
+		if( libfsapfs_internal_cursor_get_node(
+		     internal_cursor,
+		     level,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree node of level: %d.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( libfsapfs_btree_node_get_number_of_entries(
+		     node,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of level: %d.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( internal_cursor->entry_indexes[ level ] < number_of_entries )
+		{
+			break;
+		}
+		if( level == 0 )
+		{
+			internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+
+			return( 0 );
+		}
+		level -= 1;
+
+		internal_cursor->entry_indexes[ level ] += 1;
+	}
+	while( level >= 0 );
+
+	result = libfsapfs_internal_cursor_descend_to_first_record(
+	          internal_cursor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to descend to first record.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+	}
+	return( result );
+}
+
+/* Positions the cursor at the first record with a key greater than or equal to the identifier and record type
+ * In a branch node the cursor descends into the last entry with a key less than the identifier and record type,
+ * since records with the same identifier and record type can span multiple sub nodes
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_seek(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     uint64_t identifier,
+     uint8_t record_type,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_internal_cursor_seek";
+	uint64_t sub_node_block_number       = 0;
+	int compare_result                   = 0;
+	int entry_index                      = 0;
+	int is_leaf_node                     = 0;
+	int level                            = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->block_numbers[ 0 ] = internal_cursor->file_system_btree->root_node_block_number;
+	internal_cursor->entry_indexes[ 0 ] = 0;
+	internal_cursor->number_of_levels   = 1;
+	internal_cursor->flags             &= ~( LIBFSAPFS_CURSOR_FLAG_IS_AT_END );
+
+	for( level = 0;
+	     level < LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH;
+	     level++ )
+	{
+		if( libfsapfs_internal_cursor_get_node(
+		     internal_cursor,
+		     level,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree node of level: %d.",
+			 function,
+			 level );
+
+			goto on_error;
+		}
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                node,
+		                error );
+
+		if( is_leaf_node == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node of level: %d is a leaf node.",
+			 function,
+			 level );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_get_number_of_entries(
+		     node,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of level: %d.",
+			 function,
+			 level );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libfsapfs_btree_node_get_entry_by_index(
+			     node,
+			     entry_index,
+			     &btree_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d of level: %d.",
+				 function,
+				 entry_index,
+				 level );
+
+				goto on_error;
+			}
+			compare_result = libfsapfs_internal_cursor_compare_btree_entry(
+			                  btree_entry,
+			                  identifier,
+			                  record_type,
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare entry: %d of level: %d.",
+				 function,
+				 entry_index,
+				 level );
+
+				goto on_error;
+			}
+			if( compare_result != LIBCDATA_COMPARE_LESS )
+			{
+				break;
+			}
+		}
+		if( is_leaf_node != 0 )
+		{
+			internal_cursor->entry_indexes[ level ] = entry_index;
+
+			if( number_of_entries == 0 )
+			{
+				internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+			}
+			else if( entry_index >= number_of_entries )
+			{
+				internal_cursor->entry_indexes[ level ] = number_of_entries - 1;
+
+				result = libfsapfs_internal_cursor_move_to_next_leaf_entry(
+				          internal_cursor,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to move to next leaf entry.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			break;
+		}
+		if( number_of_entries == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid branch node of level: %d - missing entries.",
+			 function,
+			 level );
+
+			goto on_error;
+		}
+		if( entry_index > 0 )
+		{
+			entry_index -= 1;
+		}
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d of level: %d.",
+			 function,
+			 entry_index,
+			 level );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		     internal_cursor->file_system_btree,
+		     internal_cursor->file_io_handle,
+		     btree_entry,
+		     &sub_node_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number of entry: %d of level: %d.",
+			 function,
+			 entry_index,
+			 level );
+
+			goto on_error;
+		}
+		if( ( level + 1 ) >= LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid level value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		internal_cursor->entry_indexes[ level ]     = entry_index;
+		internal_cursor->block_numbers[ level + 1 ] = sub_node_block_number;
+		internal_cursor->entry_indexes[ level + 1 ] = 0;
+		internal_cursor->number_of_levels           = level + 2;
+	}
+	if( libfsapfs_internal_cursor_set_current_record(
+	     internal_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set current record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+
+	return( -1 );
+}
+
+/* Positions the cursor at the first directory record of a directory and limits the cursor to the directory records of the directory
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_seek_directory(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     uint64_t directory_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_cursor_seek_directory";
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor->directory_identifier = directory_identifier;
+	internal_cursor->flags               |= LIBFSAPFS_CURSOR_FLAG_IS_DIRECTORY_CURSOR;
+
+	if( libfsapfs_internal_cursor_seek(
+	     internal_cursor,
+	     directory_identifier,
+	     LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek directory records of: %" PRIu64 ".",
+		 function,
+		 directory_identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the cursor from a byte stream
+ * Only the format of the byte stream is checked, use libfsapfs_internal_cursor_validate_path
+ * to check the path against the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_cursor_read_byte_stream(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsapfs_internal_cursor_read_byte_stream";
+	size_t byte_stream_offset       = 0;
+	uint64_t transaction_identifier = 0;
+	uint32_t format_version         = 0;
+	uint32_t key_data_size          = 0;
+	uint32_t number_of_levels       = 0;
+	uint32_t value_32bit            = 0;
+	int level                       = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size < sizeof( fsapfs_cursor_header_t ) )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (fsapfs_cursor_header_t *) byte_stream )->signature,
+	     fsapfs_cursor_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->format_version,
+	 format_version );
+
+	if( format_version != LIBFSAPFS_CURSOR_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->transaction_identifier,
+	 transaction_identifier );
+
+	if( transaction_identifier != internal_cursor->transaction_identifier )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: mismatch in transaction identifier ( stored: %" PRIu64 ", volume: %" PRIu64 " ).",
+		 function,
+		 transaction_identifier,
+		 internal_cursor->transaction_identifier );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->number_of_levels,
+	 number_of_levels );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->key_data_size,
+	 key_data_size );
+
+	if( ( number_of_levels == 0 )
+	 || ( number_of_levels > (uint32_t) LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of levels value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size > (uint32_t) LIBFSAPFS_CURSOR_MAXIMUM_KEY_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size != ( sizeof( fsapfs_cursor_header_t ) + ( number_of_levels * sizeof( fsapfs_cursor_level_t ) ) + key_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->flags,
+	 internal_cursor->flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->directory_identifier,
+	 internal_cursor->directory_identifier );
+
+	byte_stream_offset = sizeof( fsapfs_cursor_header_t );
+
+	for( level = 0;
+	     level < (int) number_of_levels;
+	     level++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_cursor_level_t *) &( byte_stream[ byte_stream_offset ] ) )->block_number,
+		 internal_cursor->block_numbers[ level ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_cursor_level_t *) &( byte_stream[ byte_stream_offset ] ) )->entry_index,
+		 value_32bit );
+
+		if( value_32bit > (uint32_t) INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry index of level: %d value out of bounds.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		internal_cursor->entry_indexes[ level ] = (int) value_32bit;
+
+		byte_stream_offset += sizeof( fsapfs_cursor_level_t );
+	}
+	internal_cursor->number_of_levels = (int) number_of_levels;
+
+	if( key_data_size > 0 )
+	{
+		if( memory_copy(
+		     internal_cursor->key_data,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     (size_t) key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_cursor->key_data_size = (size_t) key_data_size;
+
+	return( 1 );
+}
+
+/* Validates the path of the cursor against the file system B-tree
+ * Every node on the path must be the sub node of the entry of its parent
+ * and the key of the current record must match the stored key
+ * This function expects the file system B-tree read/write lock to be held
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libfsapfs_internal_cursor_validate_path(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_internal_cursor_validate_path";
+	uint64_t sub_node_block_number       = 0;
+	int is_leaf_node                     = 0;
+	int level                            = 0;
+	int number_of_entries                = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->block_numbers[ 0 ] != internal_cursor->file_system_btree->root_node_block_number )
+	{
+		return( 0 );
+	}
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+	{
+		return( 1 );
+	}
+	for( level = 0;
+	     level < internal_cursor->number_of_levels;
+	     level++ )
+	{
+		if( libfsapfs_internal_cursor_get_node(
+		     internal_cursor,
+		     level,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree node of level: %d.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                node,
+		                error );
+
+		if( is_leaf_node == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node of level: %d is a leaf node.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( ( is_leaf_node != 0 ) != ( level == ( internal_cursor->number_of_levels - 1 ) ) )
+		{
+			return( 0 );
+		}
+		if( libfsapfs_btree_node_get_number_of_entries(
+		     node,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries of level: %d.",
+			 function,
+			 level );
+
+			return( -1 );
+		}
+		if( internal_cursor->entry_indexes[ level ] >= number_of_entries )
+		{
+			return( 0 );
+		}
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     internal_cursor->entry_indexes[ level ],
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d of level: %d.",
+			 function,
+			 internal_cursor->entry_indexes[ level ],
+			 level );
+
+			return( -1 );
+		}
+		if( is_leaf_node != 0 )
+		{
+			break;
+		}
+		if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		     internal_cursor->file_system_btree,
+		     internal_cursor->file_io_handle,
+		     btree_entry,
+		     &sub_node_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number of entry: %d of level: %d.",
+			 function,
+			 internal_cursor->entry_indexes[ level ],
+			 level );
+
+			return( -1 );
+		}
+		if( sub_node_block_number != internal_cursor->block_numbers[ level + 1 ] )
+		{
+			return( 0 );
+		}
+	}
+	if( ( btree_entry == NULL )
+	 || ( btree_entry->key_data == NULL )
+	 || ( btree_entry->key_data_size != internal_cursor->key_data_size ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     btree_entry->key_data,
+	     internal_cursor->key_data,
+	     internal_cursor->key_data_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the byte stream of the cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cursor_get_byte_stream_size(
+     libfsapfs_cursor_t *cursor,
+     size_t *byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_get_byte_stream_size";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( byte_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*byte_stream_size = sizeof( fsapfs_cursor_header_t )
+	                  + ( internal_cursor->number_of_levels * sizeof( fsapfs_cursor_level_t ) )
+	                  + internal_cursor->key_data_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Copies the cursor to a byte stream
+ * The byte stream can be used to resume the cursor with libfsapfs_volume_get_cursor_from_byte_stream
+ * as long as the volume has not been modified
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cursor_copy_to_byte_stream(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_copy_to_byte_stream";
+	size_t byte_stream_offset                    = 0;
+	size_t required_byte_stream_size             = 0;
+	int level                                    = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	required_byte_stream_size = sizeof( fsapfs_cursor_header_t )
+	                          + ( internal_cursor->number_of_levels * sizeof( fsapfs_cursor_level_t ) )
+	                          + internal_cursor->key_data_size;
+
+	if( byte_stream_size < required_byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (fsapfs_cursor_header_t *) byte_stream )->signature,
+	     fsapfs_cursor_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->format_version,
+	 LIBFSAPFS_CURSOR_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->flags,
+	 internal_cursor->flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->transaction_identifier,
+	 internal_cursor->transaction_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->directory_identifier,
+	 internal_cursor->directory_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->number_of_levels,
+	 (uint32_t) internal_cursor->number_of_levels );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fsapfs_cursor_header_t *) byte_stream )->key_data_size,
+	 (uint32_t) internal_cursor->key_data_size );
+
+	byte_stream_offset = sizeof( fsapfs_cursor_header_t );
+
+	for( level = 0;
+	     level < internal_cursor->number_of_levels;
+	     level++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 ( (fsapfs_cursor_level_t *) &( byte_stream[ byte_stream_offset ] ) )->block_number,
+		 internal_cursor->block_numbers[ level ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (fsapfs_cursor_level_t *) &( byte_stream[ byte_stream_offset ] ) )->entry_index,
+		 (uint32_t) internal_cursor->entry_indexes[ level ] );
+
+		byte_stream_offset += sizeof( fsapfs_cursor_level_t );
+	}
+	if( internal_cursor->key_data_size > 0 )
+	{
+		if( memory_copy(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     internal_cursor->key_data,
+		     internal_cursor->key_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file system identifier, record type and data sizes of the current record
+ * Returns 1 if successful, 0 if the cursor is positioned at the end or -1 on error
+ */
+int libfsapfs_cursor_get_record(
+     libfsapfs_cursor_t *cursor,
+     uint64_t *identifier,
+     uint8_t *record_type,
+     size_t *key_data_size,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry         = NULL;
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_get_record";
+	uint64_t file_system_identifier              = 0;
+	int result                                   = 1;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record type.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		if( libfsapfs_internal_cursor_get_btree_entry(
+		     internal_cursor,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current B-tree entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current B-tree entry - key data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		*identifier      = file_system_identifier & 0x0fffffffffffffffUL;
+		*record_type     = (uint8_t) ( file_system_identifier >> 60 );
+		*key_data_size   = btree_entry->key_data_size;
+		*value_data_size = btree_entry->value_data_size;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_cursor->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->file_system_btree->read_write_lock,
+	 NULL );
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the key and value data of the current record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cursor_get_record_data(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry         = NULL;
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_get_record_data";
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cursor - positioned at end.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_internal_cursor_get_btree_entry(
+	     internal_cursor,
+	     &btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current B-tree entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( key_data_size < btree_entry->key_data_size )
+	 || ( value_data_size < btree_entry->value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key or value data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     key_data,
+	     btree_entry->key_data,
+	     btree_entry->key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( btree_entry->value_data != NULL )
+	 && ( btree_entry->value_data_size > 0 ) )
+	{
+		if( memory_copy(
+		     value_data,
+		     btree_entry->value_data,
+		     btree_entry->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_read(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_cursor->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->file_system_btree->read_write_lock,
+	 NULL );
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the inode and directory record of the current directory record
+ * This function needs to be called with the cursor read/write lock held
+ * Returns 1 if successful, 0 if the cursor is positioned at the end or -1 on error
+ */
+int libfsapfs_internal_cursor_get_sub_inode(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libfsapfs_inode_t **inode,
+     libfsapfs_directory_record_t **directory_record,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry                = NULL;
+	libfsapfs_directory_record_t *safe_directory_record = NULL;
+	static char *function                               = "libfsapfs_internal_cursor_get_sub_inode";
+	uint64_t file_system_identifier                     = 0;
+
+	if( internal_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_internal_cursor_get_btree_entry(
+	     internal_cursor,
+	     &btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current B-tree entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current B-tree entry - key data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+	 file_system_identifier );
+
+	if( ( file_system_identifier >> 60 ) != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported current record - not a directory record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_directory_record_initialize(
+	     &safe_directory_record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_directory_record_read_key_data(
+	     safe_directory_record,
+	     btree_entry->key_data,
+	     (size_t) btree_entry->key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory record key data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_directory_record_read_value_data(
+	     safe_directory_record,
+	     btree_entry->value_data,
+	     (size_t) btree_entry->value_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory record value data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		goto on_error_unlocked;
+	}
+#endif
+	if( libfsapfs_directory_record_get_identifier(
+	     safe_directory_record,
+	     &file_system_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file system identifier from directory record.",
+		 function );
+
+		goto on_error_unlocked;
+	}
+	/* The file system B-tree read/write lock is grabbed by libfsapfs_file_system_btree_get_inode_by_identifier
+	 */
+	if( libfsapfs_file_system_btree_get_inode_by_identifier(
+	     internal_cursor->file_system_btree,
+	     internal_cursor->file_io_handle,
+	     file_system_identifier,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from file system B-tree.",
+		 function,
+		 file_system_identifier );
+
+		goto on_error_unlocked;
+	}
+	*directory_record = safe_directory_record;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->file_system_btree->read_write_lock,
+	 NULL );
+#endif
+on_error_unlocked:
+	if( safe_directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &safe_directory_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the sub file entry of the current directory record
+ * Returns 1 if successful, 0 if the cursor is positioned at the end or -1 on error
+ */
+int libfsapfs_cursor_get_sub_file_entry(
+     libfsapfs_cursor_t *cursor,
+     libfsapfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_directory_record_t *directory_record = NULL;
+	libfsapfs_inode_t *inode                       = NULL;
+	libfsapfs_internal_cursor_t *internal_cursor   = NULL;
+	static char *function                          = "libfsapfs_cursor_get_sub_file_entry";
+	int result                                     = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsapfs_internal_cursor_get_sub_inode(
+	          internal_cursor,
+	          &inode,
+	          &directory_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode of current directory record.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsapfs_file_entry_initialize(
+		     sub_file_entry,
+		     internal_cursor->io_handle,
+		     internal_cursor->file_io_handle,
+		     internal_cursor->encryption_context,
+		     internal_cursor->file_system_btree,
+		     inode,
+		     directory_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			goto on_error;
+		}
+		inode            = NULL;
+		directory_record = NULL;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsapfs_file_entry_free(
+		 sub_file_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file reference of the sub file entry of the current directory record
+ * Unlike libfsapfs_cursor_get_sub_file_entry no file entry is created
+ * Returns 1 if successful, 0 if the cursor is positioned at the end or -1 on error
+ */
+int libfsapfs_cursor_get_sub_file_reference(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_directory_record_t *directory_record = NULL;
+	libfsapfs_inode_t *inode                       = NULL;
+	libfsapfs_internal_cursor_t *internal_cursor   = NULL;
+	static char *function                          = "libfsapfs_cursor_get_sub_file_reference";
+	int result                                     = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsapfs_internal_cursor_get_sub_inode(
+	          internal_cursor,
+	          &inode,
+	          &directory_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode of current directory record.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsapfs_file_reference_set_from_inode(
+		     file_reference,
+		     file_reference_size,
+		     internal_cursor->transaction_identifier,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file reference.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_directory_record_free(
+		     &directory_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Moves the cursor to the next record
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libfsapfs_cursor_move_to_next_record(
+     libfsapfs_cursor_t *cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_cursor_t *internal_cursor = NULL;
+	static char *function                        = "libfsapfs_cursor_move_to_next_record";
+	int result                                   = 0;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cursor = (libfsapfs_internal_cursor_t *) cursor;
+
+	if( internal_cursor->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cursor - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_write(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) == 0 )
+	{
+		result = libfsapfs_internal_cursor_move_to_next_leaf_entry(
+		          internal_cursor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to move to next leaf entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_internal_cursor_set_current_record(
+		     internal_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set current record.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( internal_cursor->flags & LIBFSAPFS_CURSOR_FLAG_IS_AT_END ) != 0 )
+		{
+			result = 0;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cursor->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_write(
+		 internal_cursor->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cursor->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_cursor->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	internal_cursor->flags |= LIBFSAPFS_CURSOR_FLAG_IS_AT_END;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_cursor->file_system_btree->read_write_lock,
+	 NULL );
+	libcthreads_read_write_lock_release_for_write(
+	 internal_cursor->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,228 @@
+/*
+ * Cursor functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_CURSOR_H )
+#define _LIBFSAPFS_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_directory_record.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_internal_cursor libfsapfs_internal_cursor_t;
+
+struct libfsapfs_internal_cursor
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The encryption context
+	 */
+	libfsapfs_encryption_context_t *encryption_context;
+
+	/* The file system B-tree
+	 */
+	libfsapfs_file_system_btree_t *file_system_btree;
+
+	/* The volume transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
+	/* The identifier of the directory the cursor is limited to
+	 */
+	uint64_t directory_identifier;
+
+	/* The block numbers of the nodes on the path from the root node to the leaf node
+	 */
+	uint64_t block_numbers[ LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ];
+
+	/* The entry indexes in the nodes on the path from the root node to the leaf node
+	 */
+	int entry_indexes[ LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ];
+
+	/* The number of levels on the path
+	 */
+	int number_of_levels;
+
+	/* The key data of the current record
+	 */
+	uint8_t key_data[ LIBFSAPFS_CURSOR_MAXIMUM_KEY_DATA_SIZE ];
+
+	/* The key data size of the current record
+	 */
+	size_t key_data_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_cursor_initialize(
+     libfsapfs_cursor_t **cursor,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_free(
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_get_node(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     int level,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_get_btree_entry(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libfsapfs_btree_entry_t **btree_entry,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_compare_btree_entry(
+     libfsapfs_btree_entry_t *btree_entry,
+     uint64_t identifier,
+     uint8_t record_type,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_set_current_record(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_descend_to_first_record(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_move_to_next_leaf_entry(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_seek(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     uint64_t identifier,
+     uint8_t record_type,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_seek_directory(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     uint64_t directory_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_read_byte_stream(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_validate_path(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_get_byte_stream_size(
+     libfsapfs_cursor_t *cursor,
+     size_t *byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_copy_to_byte_stream(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_get_record(
+     libfsapfs_cursor_t *cursor,
+     uint64_t *identifier,
+     uint8_t *record_type,
+     size_t *key_data_size,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_get_record_data(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_cursor_get_sub_inode(
+     libfsapfs_internal_cursor_t *internal_cursor,
+     libfsapfs_inode_t **inode,
+     libfsapfs_directory_record_t **directory_record,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_get_sub_file_entry(
+     libfsapfs_cursor_t *cursor,
+     libfsapfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_get_sub_file_reference(
+     libfsapfs_cursor_t *cursor,
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_cursor_move_to_next_record(
+     libfsapfs_cursor_t *cursor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_CURSOR_H ) */
+
@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_block_buffer_pool.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_io_handle.h"
@@ -43,6 +44,37 @@ int libfsapfs_data_block_initialize(
 {
 	static char *function = "libfsapfs_data_block_initialize";
 
+	if( libfsapfs_data_block_initialize_from_pool(
+	     data_block,
+	     NULL,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates data block with data retrieved from a block buffer pool
+ * The data is returned to the block buffer pool when the data block is freed
+ * Make sure the value data_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_data_block_initialize_from_pool(
+     libfsapfs_data_block_t **data_block,
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_data_block_initialize_from_pool";
+
 	if( data_block == NULL )
 	{
 		libcerror_error_set(
@@ -111,19 +143,41 @@ int libfsapfs_data_block_initialize(
 	}
 	if( data_size > 0 )
 	{
-		( *data_block )->data = (uint8_t *) memory_allocate(
-		                                      sizeof( uint8_t ) * data_size );
+		if( block_buffer_pool != NULL )
+		{
+			if( libfsapfs_block_buffer_pool_get_buffer(
+			     block_buffer_pool,
+			     data_size,
+			     &( ( *data_block )->data ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data from block buffer pool.",
+				 function );
 
-		if( ( *data_block )->data == NULL )
+				goto on_error;
+			}
+			( *data_block )->block_buffer_pool = block_buffer_pool;
+		}
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data.",
-			 function );
+			( *data_block )->data = (uint8_t *) memory_allocate(
+			                                      sizeof( uint8_t ) * data_size );
 
-			goto on_error;
+			if( ( *data_block )->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		( *data_block )->data_size = data_size;
 	}
@@ -163,7 +217,27 @@ int libfsapfs_data_block_free(
 	}
 	if( *data_block != NULL )
 	{
-		if( ( *data_block )->data != NULL )
+		if( ( *data_block )->block_buffer_pool != NULL )
+		{
+			/* The block buffer pool clears the data before it is reused
+			 */
+			if( libfsapfs_block_buffer_pool_release_buffer(
+			     ( *data_block )->block_buffer_pool,
+			     &( ( *data_block )->data ),
+			     ( *data_block )->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release data to block buffer pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( ( *data_block )->data != NULL )
 		{
 			if( memory_set(
 			     ( *data_block )->data,
@@ -261,8 +335,109 @@ int libfsapfs_data_block_read(
      uint64_t encryption_identifier,
      libcerror_error_t **error )
 {
-	uint8_t *read_buffer  = NULL;
 	static char *function = "libfsapfs_data_block_read";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_data_block_read_data(
+	     data_block,
+	     io_handle,
+	     encryption_context,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     file_offset,
+	     encryption_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data block using a specific handle of a file IO pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_data_block_read_file_io_pool(
+     libfsapfs_data_block_t *data_block,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_data_block_read_file_io_pool";
+
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_data_block_read_data(
+	     data_block,
+	     io_handle,
+	     encryption_context,
+	     NULL,
+	     file_io_pool,
+	     file_io_pool_entry,
+	     file_offset,
+	     encryption_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block from file IO pool entry: %d.",
+		 function,
+		 file_io_pool_entry );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data block from either a file IO handle or a specific handle of a file IO pool
+ * The file IO pool is used when set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_data_block_read_data(
+     libfsapfs_data_block_t *data_block,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_handle_t *file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t *read_buffer  = NULL;
+	static char *function = "libfsapfs_data_block_read_data";
 	ssize_t read_count    = 0;
 
 	if( data_block == NULL )
@@ -320,6 +495,18 @@ int libfsapfs_data_block_read(
 
 		return( -1 );
 	}
+	if( ( file_io_handle == NULL )
+	 && ( file_io_pool == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle and file IO pool.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -330,26 +517,28 @@ int libfsapfs_data_block_read(
 		 file_offset );
 	}
 #endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     file_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek data block offset: %" PRIi64 ".",
-		 function,
-		 file_offset );
-
-		goto on_error;
-	}
 	if( encryption_context == NULL )
 	{
 		read_buffer = data_block->data;
 	}
+	else if( io_handle->block_buffer_pool != NULL )
+	{
+		if( libfsapfs_block_buffer_pool_get_buffer(
+		     io_handle->block_buffer_pool,
+		     data_block->data_size,
+		     &read_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read buffer from block buffer pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	else
 	{
 		read_buffer = (uint8_t *) memory_allocate(
@@ -367,11 +556,25 @@ int libfsapfs_data_block_read(
 			goto on_error;
 		}
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              read_buffer,
-	              data_block->data_size,
-	              error );
+	if( file_io_pool != NULL )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              file_io_pool,
+		              file_io_pool_entry,
+		              read_buffer,
+		              data_block->data_size,
+		              file_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              read_buffer,
+		              data_block->data_size,
+		              file_offset,
+		              error );
+	}
 
 	if( read_count != (ssize_t) data_block->data_size )
 	{
@@ -379,8 +582,10 @@ int libfsapfs_data_block_read(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data block.",
-		 function );
+		 "%s: unable to read data block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
 		goto on_error;
 	}
@@ -421,10 +626,31 @@ int libfsapfs_data_block_read(
 
 			goto on_error;
 		}
-		memory_free(
-		 read_buffer );
+		if( io_handle->block_buffer_pool != NULL )
+		{
+			if( libfsapfs_block_buffer_pool_release_buffer(
+			     io_handle->block_buffer_pool,
+			     &read_buffer,
+			     data_block->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read buffer to block buffer pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			memory_free(
+			 read_buffer );
 
-		read_buffer = NULL;
+			read_buffer = NULL;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -444,8 +670,19 @@ on_error:
 	if( ( read_buffer != NULL )
 	 && ( read_buffer != data_block->data ) )
 	{
-		memory_free(
-		 read_buffer );
+		if( io_handle->block_buffer_pool != NULL )
+		{
+			libfsapfs_block_buffer_pool_release_buffer(
+			 io_handle->block_buffer_pool,
+			 &read_buffer,
+			 data_block->data_size,
+			 NULL );
+		}
+		else
+		{
+			memory_free(
+			 read_buffer );
+		}
 	}
 	return( -1 );
 }
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_block_buffer_pool.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
@@ -45,6 +46,10 @@ struct libfsapfs_data_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The block buffer pool the data was retrieved from
+	 */
+	libfsapfs_block_buffer_pool_t *block_buffer_pool;
 };
 
 int libfsapfs_data_block_initialize(
@@ -52,6 +57,12 @@ int libfsapfs_data_block_initialize(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_data_block_initialize_from_pool(
+     libfsapfs_data_block_t **data_block,
+     libfsapfs_block_buffer_pool_t *block_buffer_pool,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_data_block_free(
      libfsapfs_data_block_t **data_block,
      libcerror_error_t **error );
@@ -69,6 +80,27 @@ int libfsapfs_data_block_read(
      uint64_t encryption_identifier,
      libcerror_error_t **error );
 
+int libfsapfs_data_block_read_file_io_pool(
+     libfsapfs_data_block_t *data_block,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_data_block_read_data(
+     libfsapfs_data_block_t *data_block,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_handle_t *file_io_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
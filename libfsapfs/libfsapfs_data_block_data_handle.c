@@ -28,7 +28,9 @@
 #include "libfsapfs_data_block_vector.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_encryption_context.h"
+#include "libfsapfs_file_extent.h"
 #include "libfsapfs_file_system_data_handle.h"
+#include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
@@ -272,6 +274,291 @@ int libfsapfs_data_block_data_handle_free(
 	return( result );
 }
 
+/* Sets the file IO pool
+ * When set the data is read from the file IO pool entry instead of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_data_block_data_handle_set_file_io_pool(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_data_block_data_handle_set_file_io_pool";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_system_data_handle_set_file_io_pool(
+	     data_handle->file_system_data_handle,
+	     file_io_pool,
+	     file_io_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO pool of file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data from the current offset into a buffer directly from the file extents
+ * Used for uncached access, where the data of consecutive blocks of a file extent
+ * is read with a single read and the data block cache is bypassed
+ * Only supported for unencrypted data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_data_block_data_handle_read_extent_data(
+         libfsapfs_data_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_data_block_data_handle_read_extent_data";
+	size64_t extent_remaining_size       = 0;
+	size_t read_size                     = 0;
+	size_t segment_data_offset           = 0;
+	ssize_t read_count                   = 0;
+	off64_t extent_data_offset           = 0;
+	off64_t file_offset                  = 0;
+	uint32_t block_size                  = 0;
+	int number_of_extents                = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->file_system_data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - invalid file system data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->file_system_data_handle->encryption_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid data handle - unsupported encrypted data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid segment data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = data_handle->file_system_data_handle->io_handle->block_size;
+
+	if( libcdata_array_get_number_of_entries(
+	     data_handle->file_system_data_handle->file_extents,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file extents.",
+		 function );
+
+		return( -1 );
+	}
+	/* The current extent is retained between reads since the data is typically read sequentially
+	 */
+	if( ( data_handle->current_extent_index < 0 )
+	 || ( data_handle->current_extent_index >= number_of_extents )
+	 || ( data_handle->current_offset < data_handle->current_extent_offset ) )
+	{
+		data_handle->current_extent_index  = 0;
+		data_handle->current_extent_offset = 0;
+	}
+	while( ( segment_data_size > 0 )
+	    && ( (size64_t) data_handle->current_offset < data_handle->data_size ) )
+	{
+		if( data_handle->current_extent_index >= number_of_extents )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: missing file extent for offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			return( -1 );
+		}
+		if( libcdata_array_get_entry_by_index(
+		     data_handle->file_system_data_handle->file_extents,
+		     data_handle->current_extent_index,
+		     (intptr_t **) &file_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extent: %d.",
+			 function,
+			 data_handle->current_extent_index );
+
+			return( -1 );
+		}
+		if( file_extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file extent: %d.",
+			 function,
+			 data_handle->current_extent_index );
+
+			return( -1 );
+		}
+		extent_data_offset = data_handle->current_offset - data_handle->current_extent_offset;
+
+		if( (size64_t) extent_data_offset >= file_extent->data_size )
+		{
+			data_handle->current_extent_offset += (off64_t) file_extent->data_size;
+			data_handle->current_extent_index  += 1;
+
+			continue;
+		}
+		extent_remaining_size = file_extent->data_size - extent_data_offset;
+
+		if( extent_remaining_size > ( data_handle->data_size - data_handle->current_offset ) )
+		{
+			extent_remaining_size = data_handle->data_size - data_handle->current_offset;
+		}
+		read_size = segment_data_size;
+
+		if( (size64_t) read_size > extent_remaining_size )
+		{
+			read_size = (size_t) extent_remaining_size;
+		}
+		/* A file extent without a physical block number is sparse
+		 */
+		if( file_extent->physical_block_number == 0 )
+		{
+			if( memory_set(
+			     &( segment_data[ segment_data_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear segment data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			file_offset = (off64_t) ( file_extent->physical_block_number * block_size ) + extent_data_offset;
+
+			if( data_handle->file_system_data_handle->file_io_pool != NULL )
+			{
+				read_count = libbfio_pool_read_buffer_at_offset(
+				              data_handle->file_system_data_handle->file_io_pool,
+				              data_handle->file_system_data_handle->file_io_pool_entry,
+				              &( segment_data[ segment_data_offset ] ),
+				              read_size,
+				              file_offset,
+				              error );
+			}
+			else
+			{
+				read_count = libbfio_handle_read_buffer_at_offset(
+				              file_io_handle,
+				              &( segment_data[ segment_data_offset ] ),
+				              read_size,
+				              file_offset,
+				              error );
+			}
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file extent data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+		}
+		segment_data_offset += read_size;
+		segment_data_size   -= read_size;
+
+		data_handle->current_offset += read_size;
+	}
+	return( (ssize_t) segment_data_offset );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -291,6 +578,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 	static char *function              = "libfsapfs_data_block_data_handle_read_segment_data";
 	size_t read_size                   = 0;
 	size_t segment_data_offset         = 0;
+	ssize_t read_count                 = 0;
 	off64_t data_block_offset          = 0;
 
 	LIBFSAPFS_UNREFERENCED_PARAMETER( segment_file_index )
@@ -356,6 +644,32 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 	{
 		return( 0 );
 	}
+	if( ( data_handle->file_system_data_handle != NULL )
+	 && ( data_handle->file_system_data_handle->io_handle != NULL )
+	 && ( data_handle->file_system_data_handle->io_handle->uncached_access != 0 )
+	 && ( data_handle->file_system_data_handle->encryption_context == NULL )
+	 && ( data_handle->file_system_data_handle->file_extents != NULL ) )
+	{
+		read_count = libfsapfs_data_block_data_handle_read_extent_data(
+		              data_handle,
+		              file_io_handle,
+		              segment_data,
+		              segment_data_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file extent data.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
 	while( segment_data_size > 0 )
 	{
 		if( libfdata_vector_get_element_value_at_offset(
@@ -61,6 +61,14 @@ struct libfsapfs_data_block_data_handle
 	/* The data block cache
 	 */
 	libfcache_cache_t *data_block_cache;
+
+	/* The index of the file extent that contains the current offset
+	 */
+	int current_extent_index;
+
+	/* The logical offset of the file extent that contains the current offset
+	 */
+	off64_t current_extent_offset;
 };
 
 int libfsapfs_data_block_data_handle_initialize(
@@ -75,6 +83,19 @@ int libfsapfs_data_block_data_handle_free(
      libfsapfs_data_block_data_handle_t **data_handle,
      libcerror_error_t **error );
 
+int libfsapfs_data_block_data_handle_set_file_io_pool(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     libcerror_error_t **error );
+
+ssize_t libfsapfs_data_block_data_handle_read_extent_data(
+         libfsapfs_data_block_data_handle_t *data_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *segment_data,
+         size_t segment_data_size,
+         libcerror_error_t **error );
+
 ssize_t libfsapfs_data_block_data_handle_read_segment_data(
          libfsapfs_data_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
@@ -29,6 +29,7 @@
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_file_extent.h"
 #include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libfdata.h"
 
@@ -135,6 +136,7 @@ on_error:
 }
 
 /* Creates data stream from file extents
+ * If file_io_pool is set the data is read from the file IO pool entry
  * Make sure the value data_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -145,6 +147,8 @@ int libfsapfs_data_stream_initialize_from_file_extents(
      libcdata_array_t *file_extents,
      size64_t data_stream_size,
      uint8_t is_sparse,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
      libcerror_error_t **error )
 {
 	libfdata_stream_t *safe_data_stream             = NULL;
@@ -191,6 +195,24 @@ int libfsapfs_data_stream_initialize_from_file_extents(
 
 		goto on_error;
 	}
+	if( file_io_pool != NULL )
+	{
+		if( libfsapfs_data_block_data_handle_set_file_io_pool(
+		     data_handle,
+		     file_io_pool,
+		     file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO pool of data handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
 	     (intptr_t *) data_handle,
@@ -27,6 +27,7 @@
 
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libfdata.h"
 
@@ -47,6 +48,8 @@ int libfsapfs_data_stream_initialize_from_file_extents(
      libcdata_array_t *file_extents,
      size64_t data_stream_size,
      uint8_t is_sparse,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
      libcerror_error_t **error );
 
 int libfsapfs_data_stream_initialize_from_compressed_data_stream(
@@ -96,6 +96,16 @@ void libfsapfs_debug_print_btree_node_flags(
 		libcnotify_printf(
 		 "\tHas fixed-size entry (BTNODE_FIXED_KV_SIZE)\n" );
 	}
+	if( ( btree_node_flags & 0x0008 ) != 0 )
+	{
+		libcnotify_printf(
+		 "\tIs hashed (BTNODE_HASHED)\n" );
+	}
+	if( ( btree_node_flags & 0x0010 ) != 0 )
+	{
+		libcnotify_printf(
+		 "\tHas no object header (BTNODE_NOHEADER)\n" );
+	}
 
 	if( ( btree_node_flags & 0x8000 ) != 0 )
 	{
@@ -481,6 +491,16 @@ void libfsapfs_debug_print_volume_incompatible_features_flags(
 		libcnotify_printf(
 		 "\t(APFS_INCOMPAT_NORMALIZATION_INSENSITIVE)\n" );
 	}
+	if( ( incompatible_features_flags & 0x0000000000000010 ) != 0 )
+	{
+		libcnotify_printf(
+		 "\t(APFS_INCOMPAT_INCOMPLETE_RESTORE)\n" );
+	}
+	if( ( incompatible_features_flags & 0x0000000000000020 ) != 0 )
+	{
+		libcnotify_printf(
+		 "\t(APFS_INCOMPAT_SEALED_VOLUME)\n" );
+	}
 }
 
 /* Prints the volume read-only compatible feature flags
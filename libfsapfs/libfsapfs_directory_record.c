@@ -908,6 +908,71 @@ int libfsapfs_directory_record_get_utf8_name(
 	return( 1 );
 }
 
+/* Retrieves a view of the UTF-8 encoded name
+ * The view points into the directory record name storage and is valid for
+ * the lifetime of the directory record, the length excludes the end of string character
+ * The name is returned as stored and is not validated
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_directory_record_get_utf8_name_view(
+     libfsapfs_directory_record_t *directory_record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_directory_record_get_utf8_name_view";
+	size_t name_length    = 0;
+
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_record->name == NULL )
+	{
+		return( 0 );
+	}
+	name_length = (size_t) directory_record->name_size;
+
+	if( ( name_length > 0 )
+	 && ( directory_record->name[ name_length - 1 ] == 0 ) )
+	{
+		name_length -= 1;
+	}
+	*utf8_string        = directory_record->name;
+	*utf8_string_length = name_length;
+
+	return( 1 );
+}
+
 /* Compares an UTF-8 string with a directory record name
  * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
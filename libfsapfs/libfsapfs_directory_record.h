@@ -97,6 +97,12 @@ int libfsapfs_directory_record_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libfsapfs_directory_record_get_utf8_name_view(
+     libfsapfs_directory_record_t *directory_record,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
 int libfsapfs_directory_record_compare_name_with_utf8_string(
      libfsapfs_directory_record_t *directory_record,
      const uint8_t *utf8_string,
@@ -0,0 +1,1908 @@
+/*
+ * Disk usage functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_disk_usage.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#include "fsapfs_file_system.h"
+
+/* Creates disk usage
+ * Make sure the value disk_usage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_initialize(
+     libfsapfs_disk_usage_t **disk_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                = "libfsapfs_disk_usage_initialize";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *disk_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid disk usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = memory_allocate_structure(
+	                       libfsapfs_internal_disk_usage_t );
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create disk usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_disk_usage,
+	     0,
+	     sizeof( libfsapfs_internal_disk_usage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear disk usage.",
+		 function );
+
+		goto on_error;
+	}
+	*disk_usage = (libfsapfs_disk_usage_t *) internal_disk_usage;
+
+	return( 1 );
+
+on_error:
+	if( internal_disk_usage != NULL )
+	{
+		memory_free(
+		 internal_disk_usage );
+	}
+	return( -1 );
+}
+
+/* Frees disk usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_free(
+     libfsapfs_disk_usage_t **disk_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                = "libfsapfs_disk_usage_free";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *disk_usage != NULL )
+	{
+		internal_disk_usage = (libfsapfs_internal_disk_usage_t *) *disk_usage;
+		*disk_usage         = NULL;
+
+		if( internal_disk_usage->entries != NULL )
+		{
+			memory_free(
+			 internal_disk_usage->entries );
+		}
+		memory_free(
+		 internal_disk_usage );
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_append_entry(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     uint64_t logical_size,
+     uint64_t allocated_size,
+     uint8_t entry_type,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *entries = NULL;
+	libfsapfs_disk_usage_entry_t *entry   = NULL;
+	static char *function                 = "libfsapfs_internal_disk_usage_append_entry";
+	size_t entries_size                   = 0;
+	int number_of_allocated_entries       = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_disk_usage->number_of_entries >= internal_disk_usage->number_of_allocated_entries )
+	{
+		if( internal_disk_usage->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		else if( internal_disk_usage->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = internal_disk_usage->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid disk usage - number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_disk_usage_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfsapfs_disk_usage_entry_t ) * number_of_allocated_entries;
+
+		entries = (libfsapfs_disk_usage_entry_t *) memory_reallocate(
+		                                            internal_disk_usage->entries,
+		                                            entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_disk_usage->entries                     = entries;
+		internal_disk_usage->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( internal_disk_usage->entries[ internal_disk_usage->number_of_entries ] );
+
+	entry->identifier           = identifier;
+	entry->parent_identifier    = parent_identifier;
+	entry->logical_size         = logical_size;
+	entry->allocated_size       = allocated_size;
+	entry->total_logical_size   = 0;
+	entry->total_allocated_size = 0;
+	entry->number_of_files      = 0;
+	entry->entry_type           = entry_type;
+
+	internal_disk_usage->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Appends the entries of another disk usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_append_entries(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_internal_disk_usage_t *source_internal_disk_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *source_entry = NULL;
+	static char *function                      = "libfsapfs_internal_disk_usage_append_entries";
+	int entry_index                            = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < source_internal_disk_usage->number_of_entries;
+	     entry_index++ )
+	{
+		source_entry = &( source_internal_disk_usage->entries[ entry_index ] );
+
+		if( libfsapfs_internal_disk_usage_append_entry(
+		     internal_disk_usage,
+		     source_entry->identifier,
+		     source_entry->parent_identifier,
+		     source_entry->logical_size,
+		     source_entry->allocated_size,
+		     source_entry->entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the sizes of an extended attribute B-tree entry
+ * The data of decmpfs-compressed files is stored in the com.apple.decmpfs and
+ * com.apple.ResourceFork extended attributes instead of the data stream of the inode.
+ * An inline compression header provides the uncompressed (logical) size and
+ * an extended attribute data stream adds its allocated size. The sizes are
+ * stored as entries that are merged into their inode entry after reading.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_read_extended_attribute(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_btree_entry_t *btree_entry,
+     uint64_t identifier,
+     libcerror_error_t **error )
+{
+	const uint8_t *value_data         = NULL;
+	static char *function             = "libfsapfs_internal_disk_usage_read_extended_attribute";
+	uint64_t allocated_size           = 0;
+	uint64_t uncompressed_data_size   = 0;
+	uint16_t extended_attribute_flags = 0;
+	uint16_t name_size                = 0;
+	uint16_t value_data_size          = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( btree_entry->key_data == NULL )
+	 || ( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_file_system_btree_key_extended_attribute_t *) btree_entry->key_data )->name_size,
+	 name_size );
+
+	if( (size_t) name_size > ( btree_entry->key_data_size - sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( btree_entry->value_data == NULL )
+	 || ( btree_entry->value_data_size < sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_file_system_btree_value_extended_attribute_t *) btree_entry->value_data )->flags,
+	 extended_attribute_flags );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_file_system_btree_value_extended_attribute_t *) btree_entry->value_data )->data_size,
+	 value_data_size );
+
+	if( (size_t) value_data_size > ( btree_entry->value_data_size - sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - extended attribute data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	value_data = &( btree_entry->value_data[ sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ] );
+
+	if( ( extended_attribute_flags & 0x0001 ) != 0 )
+	{
+		if( (size_t) value_data_size != sizeof( fsapfs_file_system_extended_attribute_data_stream_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported extended attribute data size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_extended_attribute_data_stream_t *) value_data )->allocated_size,
+		 allocated_size );
+
+		if( allocated_size == 0 )
+		{
+			return( 1 );
+		}
+		if( libfsapfs_internal_disk_usage_append_entry(
+		     internal_disk_usage,
+		     identifier,
+		     0,
+		     0,
+		     allocated_size,
+		     LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_EXTENDED_ATTRIBUTE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extended attribute entry: %" PRIu64 ".",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* A compression header stored in a data stream is not read, in which case
+	 * the logical size remains the size of the data stream of the inode
+	 */
+	if( ( ( extended_attribute_flags & 0x0002 ) == 0 )
+	 || ( name_size != 18 )
+	 || ( memory_compare(
+	       &( btree_entry->key_data[ sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) ] ),
+	       "com.apple.decmpfs",
+	       18 ) != 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( (size_t) value_data_size < sizeof( fsapfs_file_system_extended_attribute_compression_header_t ) )
+	 || ( memory_compare(
+	       ( (fsapfs_file_system_extended_attribute_compression_header_t *) value_data )->signature,
+	       "fpmc",
+	       4 ) != 0 ) )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_system_extended_attribute_compression_header_t *) value_data )->uncompressed_data_size,
+	 uncompressed_data_size );
+
+	if( libfsapfs_internal_disk_usage_append_entry(
+	     internal_disk_usage,
+	     identifier,
+	     0,
+	     uncompressed_data_size,
+	     0,
+	     LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_COMPRESSION_HEADER,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append compression header entry: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inodes of a file system B-tree leaf node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_read_leaf_node(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_inode_t *inode             = NULL;
+	static char *function                = "libfsapfs_internal_disk_usage_read_leaf_node";
+	uint64_t allocated_size              = 0;
+	uint64_t file_system_identifier      = 0;
+	uint64_t identifier                  = 0;
+	uint64_t logical_size                = 0;
+	uint64_t parent_identifier           = 0;
+	uint16_t file_mode                   = 0;
+	int btree_entry_index                = 0;
+	int number_of_entries                = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry->key_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d - missing key data.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		if( (uint8_t) ( file_system_identifier >> 60 ) == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE )
+		{
+			if( libfsapfs_internal_disk_usage_read_extended_attribute(
+			     internal_disk_usage,
+			     btree_entry,
+			     file_system_identifier & 0x0fffffffffffffffUL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extended attribute of B-tree entry: %d.",
+				 function,
+				 btree_entry_index );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( (uint8_t) ( file_system_identifier >> 60 ) != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE )
+		{
+			continue;
+		}
+		if( libfsapfs_inode_initialize(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_key_data(
+		     inode,
+		     btree_entry->key_data,
+		     (size_t) btree_entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_value_data(
+		     inode,
+		     btree_entry->value_data,
+		     (size_t) btree_entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode value data.",
+			 function );
+
+			goto on_error;
+		}
+		identifier        = inode->identifier;
+		parent_identifier = inode->parent_identifier;
+		file_mode         = inode->file_mode;
+		logical_size      = inode->data_stream_size;
+		allocated_size    = inode->data_stream_allocated_size;
+
+		if( libfsapfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_internal_disk_usage_append_entry(
+		     internal_disk_usage,
+		     identifier,
+		     parent_identifier,
+		     logical_size,
+		     allocated_size,
+		     ( ( file_mode & 0xf000 ) == 0x4000 ) ? LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_DIRECTORY : LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_FILE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %" PRIu64 ".",
+			 function,
+			 identifier );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inodes of the sub nodes of a partition
+ * This function is used as a thread callback
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_partition_read(
+     libfsapfs_disk_usage_partition_t *partition )
+{
+	int sub_node_index = 0;
+
+	if( partition == NULL )
+	{
+		return( -1 );
+	}
+	partition->result = 1;
+
+	for( sub_node_index = 0;
+	     sub_node_index < partition->number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libfsapfs_file_system_btree_read_leaf_nodes(
+		     partition->file_system_btree,
+		     partition->file_io_handle,
+		     partition->sub_node_block_numbers[ sub_node_index ],
+		     (int (*)(intptr_t *, libfsapfs_btree_node_t *, libcerror_error_t **)) &libfsapfs_internal_disk_usage_read_leaf_node,
+		     (intptr_t *) partition->internal_disk_usage,
+		     1,
+		     &( partition->error ) ) != 1 )
+		{
+			partition->result = -1;
+
+			break;
+		}
+	}
+	return( partition->result );
+}
+
+/* Reads the inodes of the file system B-tree
+ * The sub nodes of the root node are divided into partitions of consecutive key ranges
+ * that are read by separate threads, each using its own clone of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_read_file_system_btree(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *root_node    = NULL;
+	uint64_t *sub_node_block_numbers     = NULL;
+	static char *function                = "libfsapfs_internal_disk_usage_read_file_system_btree";
+	int btree_entry_index                = 0;
+	int is_leaf_node                     = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libfsapfs_disk_usage_partition_t *partition  = NULL;
+	libfsapfs_disk_usage_partition_t *partitions = NULL;
+	char error_string[ LIBFSAPFS_DISK_USAGE_ERROR_STRING_SIZE ];
+	size_t partitions_size                       = 0;
+	int first_sub_node_index                     = 0;
+	int number_of_partitions                     = 0;
+	int partition_index                          = 0;
+#endif
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_system_btree_read_node(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                root_node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_leaf_node != 0 )
+	{
+		if( libfsapfs_internal_disk_usage_read_leaf_node(
+		     internal_disk_usage,
+		     root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B-tree root node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_free(
+		     &root_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B-tree root node.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     root_node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree root node - missing entries.",
+		 function );
+
+		goto on_error;
+	}
+	sub_node_block_numbers = (uint64_t *) memory_allocate(
+	                                       sizeof( uint64_t ) * number_of_entries );
+
+	if( sub_node_block_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub node block numbers.",
+		 function );
+
+		goto on_error;
+	}
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     root_node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		result = libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		          file_system_btree,
+		          file_io_handle,
+		          btree_entry,
+		          &( sub_node_block_numbers[ btree_entry_index ] ),
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number of B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_btree_node_free(
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+#if !defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	number_of_threads = 1;
+#endif
+	if( number_of_threads > number_of_entries )
+	{
+		number_of_threads = number_of_entries;
+	}
+	if( number_of_threads <= 1 )
+	{
+		for( btree_entry_index = 0;
+		     btree_entry_index < number_of_entries;
+		     btree_entry_index++ )
+		{
+			if( libfsapfs_file_system_btree_read_leaf_nodes(
+			     file_system_btree,
+			     file_io_handle,
+			     sub_node_block_numbers[ btree_entry_index ],
+			     (int (*)(intptr_t *, libfsapfs_btree_node_t *, libcerror_error_t **)) &libfsapfs_internal_disk_usage_read_leaf_node,
+			     (intptr_t *) internal_disk_usage,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub node: %" PRIu64 ".",
+				 function,
+				 sub_node_block_numbers[ btree_entry_index ] );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	else
+	{
+		partitions_size = sizeof( libfsapfs_disk_usage_partition_t ) * number_of_threads;
+
+		partitions = (libfsapfs_disk_usage_partition_t *) memory_allocate(
+		                                                   partitions_size );
+
+		if( partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     partitions,
+		     0,
+		     partitions_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partitions.",
+			 function );
+
+			memory_free(
+			 partitions );
+
+			partitions = NULL;
+
+			goto on_error;
+		}
+		number_of_partitions = number_of_threads;
+
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			first_sub_node_index = (int) ( ( (int64_t) partition_index * number_of_entries ) / number_of_partitions );
+
+			partition->file_system_btree      = file_system_btree;
+			partition->sub_node_block_numbers = &( sub_node_block_numbers[ first_sub_node_index ] );
+			partition->number_of_sub_nodes    = (int) ( ( ( (int64_t) partition_index + 1 ) * number_of_entries ) / number_of_partitions ) - first_sub_node_index;
+
+			if( libfsapfs_disk_usage_initialize(
+			     (libfsapfs_disk_usage_t **) &( partition->internal_disk_usage ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d disk usage.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libbfio_handle_clone(
+			     &( partition->file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d file IO handle.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          partition->file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if partition: %d file IO handle is open.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     partition->file_io_handle,
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				partition->file_io_handle_opened = 1;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_create(
+			     &( partition->thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsapfs_disk_usage_partition_read,
+			     (void *) partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_join(
+			     &( partition->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		/* The error of the first failing partition is propagated as is and
+		 * the errors of the other failing partitions are appended to it
+		 */
+		result = 1;
+
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( partition->result == 1 )
+			{
+				continue;
+			}
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error           = partition->error;
+				partition->error = NULL;
+			}
+			else if( ( partition->error != NULL )
+			      && ( libcerror_error_sprint(
+			            partition->error,
+			            error_string,
+			            LIBFSAPFS_DISK_USAGE_ERROR_STRING_SIZE ) > 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: %s",
+				 function,
+				 error_string );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition: %d.",
+			 function,
+			 partition_index );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		/* The partitions are appended in key order so that the entries remain in leaf order
+		 */
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libfsapfs_internal_disk_usage_append_entries(
+			     internal_disk_usage,
+			     partition->internal_disk_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append partition: %d entries.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		if( libfsapfs_disk_usage_partitions_free(
+		     &partitions,
+		     number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partitions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+	memory_free(
+	 sub_node_block_numbers );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( partitions != NULL )
+	{
+		libfsapfs_disk_usage_partitions_free(
+		 &partitions,
+		 number_of_partitions,
+		 NULL );
+	}
+#endif
+	if( sub_node_block_numbers != NULL )
+	{
+		memory_free(
+		 sub_node_block_numbers );
+	}
+	if( root_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &root_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Frees partitions
+ * Joins threads that are still running
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_partitions_free(
+     libfsapfs_disk_usage_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_partition_t *partition = NULL;
+	static char *function                       = "libfsapfs_disk_usage_partitions_free";
+	int partition_index                         = 0;
+	int result                                  = 1;
+
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( ( *partitions )[ partition_index ] );
+
+			if( partition->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( partition->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join partition: %d thread.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->file_io_handle != NULL )
+			{
+				if( partition->file_io_handle_opened != 0 )
+				{
+					if( libbfio_handle_close(
+					     partition->file_io_handle,
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close partition: %d file IO handle.",
+						 function,
+						 partition_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( partition->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->internal_disk_usage != NULL )
+			{
+				if( libfsapfs_disk_usage_free(
+				     (libfsapfs_disk_usage_t **) &( partition->internal_disk_usage ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d disk usage.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->error != NULL )
+			{
+				libcerror_error_free(
+				 &( partition->error ) );
+			}
+		}
+		memory_free(
+		 *partitions );
+
+		*partitions = NULL;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+/* Compares two disk usage entries by identifier
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_disk_usage_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfsapfs_disk_usage_entry_t *first  = (const libfsapfs_disk_usage_entry_t *) first_entry;
+	const libfsapfs_disk_usage_entry_t *second = (const libfsapfs_disk_usage_entry_t *) second_entry;
+
+	if( first->identifier != second->identifier )
+	{
+		return( ( first->identifier < second->identifier ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the index of the entry with a specific identifier
+ * The entries must be sorted by identifier
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_internal_disk_usage_get_entry_index_by_identifier(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     uint64_t identifier,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_disk_usage_get_entry_index_by_identifier";
+	int lower_index       = 0;
+	int middle_index      = 0;
+	int upper_index       = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = internal_disk_usage->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( internal_disk_usage->entries[ middle_index ].identifier == identifier )
+		{
+			*entry_index = middle_index;
+
+			return( 1 );
+		}
+		if( internal_disk_usage->entries[ middle_index ].identifier < identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	return( 0 );
+}
+
+/* Merges the extended attribute entries into the entry of their inode
+ * The entries must be in leaf order, where the extended attribute records
+ * of an inode follow its inode record, hence before sorting by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_merge_extended_attribute_entries(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *entry       = NULL;
+	libfsapfs_disk_usage_entry_t *inode_entry = NULL;
+	static char *function                     = "libfsapfs_internal_disk_usage_merge_extended_attribute_entries";
+	int entry_index                           = 0;
+	int inode_entry_index                     = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_disk_usage->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_disk_usage->entries[ entry_index ] );
+
+		if( ( entry->entry_type == LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_FILE )
+		 || ( entry->entry_type == LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_DIRECTORY ) )
+		{
+			if( inode_entry_index != entry_index )
+			{
+				internal_disk_usage->entries[ inode_entry_index ] = *entry;
+			}
+			inode_entry = &( internal_disk_usage->entries[ inode_entry_index ] );
+
+			inode_entry_index++;
+
+			continue;
+		}
+		/* Extended attribute entries without a preceding inode entry are ignored
+		 */
+		if( ( inode_entry == NULL )
+		 || ( inode_entry->identifier != entry->identifier ) )
+		{
+			continue;
+		}
+		if( entry->entry_type == LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_COMPRESSION_HEADER )
+		{
+			inode_entry->logical_size = entry->logical_size;
+		}
+		inode_entry->allocated_size += entry->allocated_size;
+	}
+	internal_disk_usage->number_of_entries = inode_entry_index;
+
+	return( 1 );
+}
+
+/* Calculates the totals of the directories
+ * The sizes of every entry are added to the totals of its ancestor directories
+ * after which only the directory entries are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_disk_usage_calculate_totals(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *ancestor_entry = NULL;
+	libfsapfs_disk_usage_entry_t *entry          = NULL;
+	static char *function                        = "libfsapfs_internal_disk_usage_calculate_totals";
+	uint64_t ancestor_identifier                 = 0;
+	uint64_t number_of_files                     = 0;
+	int ancestor_index                           = 0;
+	int directory_index                          = 0;
+	int entry_index                              = 0;
+	int recursion_depth                          = 0;
+	int result                                   = 0;
+
+	if( internal_disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_disk_usage_merge_extended_attribute_entries(
+	     internal_disk_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to merge extended attribute entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_disk_usage->number_of_entries > 1 )
+	{
+		qsort(
+		 internal_disk_usage->entries,
+		 (size_t) internal_disk_usage->number_of_entries,
+		 sizeof( libfsapfs_disk_usage_entry_t ),
+		 &libfsapfs_disk_usage_entry_compare );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_disk_usage->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_disk_usage->entries[ entry_index ] );
+
+		number_of_files = ( entry->entry_type == LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_FILE ) ? 1 : 0;
+
+		entry->total_logical_size   += entry->logical_size;
+		entry->total_allocated_size += entry->allocated_size;
+		entry->number_of_files      += number_of_files;
+
+		ancestor_identifier = entry->parent_identifier;
+
+		for( recursion_depth = 0;
+		     recursion_depth < LIBFSAPFS_MAXIMUM_DIRECTORY_RECURSION_DEPTH;
+		     recursion_depth++ )
+		{
+			result = libfsapfs_internal_disk_usage_get_entry_index_by_identifier(
+			          internal_disk_usage,
+			          ancestor_identifier,
+			          &ancestor_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %" PRIu64 ".",
+				 function,
+				 ancestor_identifier );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			/* Stop at an entry that is its own parent to prevent a loop
+			 */
+			if( ancestor_index == entry_index )
+			{
+				break;
+			}
+			ancestor_entry = &( internal_disk_usage->entries[ ancestor_index ] );
+
+			ancestor_entry->total_logical_size   += entry->logical_size;
+			ancestor_entry->total_allocated_size += entry->allocated_size;
+			ancestor_entry->number_of_files      += number_of_files;
+
+			if( ancestor_entry->parent_identifier == ancestor_identifier )
+			{
+				break;
+			}
+			ancestor_identifier = ancestor_entry->parent_identifier;
+		}
+	}
+	/* Retain only the directory entries, which remain sorted by identifier
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_disk_usage->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_disk_usage->entries[ entry_index ] );
+
+		if( entry->entry_type != LIBFSAPFS_DISK_USAGE_ENTRY_TYPE_DIRECTORY )
+		{
+			continue;
+		}
+		if( directory_index != entry_index )
+		{
+			internal_disk_usage->entries[ directory_index ] = *entry;
+		}
+		directory_index++;
+	}
+	internal_disk_usage->number_of_entries = directory_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directories
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_get_number_of_directories(
+     libfsapfs_disk_usage_t *disk_usage,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                = "libfsapfs_disk_usage_get_number_of_directories";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libfsapfs_internal_disk_usage_t *) disk_usage;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_disk_usage->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the totals of a specific directory
+ * The directories are sorted by identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_disk_usage_get_directory_by_index(
+     libfsapfs_disk_usage_t *disk_usage,
+     int directory_index,
+     uint64_t *identifier,
+     uint64_t *logical_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *entry                  = NULL;
+	libfsapfs_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                = "libfsapfs_disk_usage_get_directory_by_index";
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libfsapfs_internal_disk_usage_t *) disk_usage;
+
+	if( ( directory_index < 0 )
+	 || ( directory_index >= internal_disk_usage->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical size.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_disk_usage->entries[ directory_index ] );
+
+	*identifier      = entry->identifier;
+	*logical_size    = entry->total_logical_size;
+	*allocated_size  = entry->total_allocated_size;
+	*number_of_files = entry->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the totals of a directory with a specific identifier
+ * Returns 1 if successful, 0 if no such directory or -1 on error
+ */
+int libfsapfs_disk_usage_get_directory_by_identifier(
+     libfsapfs_disk_usage_t *disk_usage,
+     uint64_t identifier,
+     uint64_t *logical_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     libcerror_error_t **error )
+{
+	libfsapfs_disk_usage_entry_t *entry                  = NULL;
+	libfsapfs_internal_disk_usage_t *internal_disk_usage = NULL;
+	static char *function                                = "libfsapfs_disk_usage_get_directory_by_identifier";
+	int entry_index                                      = 0;
+	int result                                           = 0;
+
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_disk_usage = (libfsapfs_internal_disk_usage_t *) disk_usage;
+
+	if( logical_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical size.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_internal_disk_usage_get_entry_index_by_identifier(
+	          internal_disk_usage,
+	          identifier,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		entry = &( internal_disk_usage->entries[ entry_index ] );
+
+		*logical_size    = entry->total_logical_size;
+		*allocated_size  = entry->total_allocated_size;
+		*number_of_files = entry->number_of_files;
+	}
+	return( result );
+}
+
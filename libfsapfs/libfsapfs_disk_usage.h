@@ -0,0 +1,239 @@
+/*
+ * Disk usage functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_DISK_USAGE_H )
+#define _LIBFSAPFS_DISK_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_disk_usage_entry libfsapfs_disk_usage_entry_t;
+
+struct libfsapfs_disk_usage_entry
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The parent identifier
+	 */
+	uint64_t parent_identifier;
+
+	/* The (data stream) logical size
+	 */
+	uint64_t logical_size;
+
+	/* The (data stream) allocated size
+	 */
+	uint64_t allocated_size;
+
+	/* The total logical size of the entry and its descendants
+	 */
+	uint64_t total_logical_size;
+
+	/* The total allocated size of the entry and its descendants
+	 */
+	uint64_t total_allocated_size;
+
+	/* The number of files of the entry and its descendants
+	 */
+	uint64_t number_of_files;
+
+	/* The entry type
+	 */
+	uint8_t entry_type;
+};
+
+typedef struct libfsapfs_internal_disk_usage libfsapfs_internal_disk_usage_t;
+
+struct libfsapfs_internal_disk_usage
+{
+	/* The entries
+	 */
+	libfsapfs_disk_usage_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+typedef struct libfsapfs_disk_usage_partition libfsapfs_disk_usage_partition_t;
+
+struct libfsapfs_disk_usage_partition
+{
+	/* The file system B-tree
+	 */
+	libfsapfs_file_system_btree_t *file_system_btree;
+
+	/* The (partition specific) file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened
+	 */
+	uint8_t file_io_handle_opened;
+
+	/* The sub node block numbers
+	 */
+	uint64_t *sub_node_block_numbers;
+
+	/* The number of sub nodes
+	 */
+	int number_of_sub_nodes;
+
+	/* The (partition specific) disk usage
+	 */
+	libfsapfs_internal_disk_usage_t *internal_disk_usage;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libfsapfs_disk_usage_initialize(
+     libfsapfs_disk_usage_t **disk_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_disk_usage_free(
+     libfsapfs_disk_usage_t **disk_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_append_entry(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     uint64_t logical_size,
+     uint64_t allocated_size,
+     uint8_t entry_type,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_append_entries(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_internal_disk_usage_t *source_internal_disk_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_read_extended_attribute(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_btree_entry_t *btree_entry,
+     uint64_t identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_read_leaf_node(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error );
+
+int libfsapfs_disk_usage_partition_read(
+     libfsapfs_disk_usage_partition_t *partition );
+
+int libfsapfs_internal_disk_usage_read_file_system_btree(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+int libfsapfs_disk_usage_partitions_free(
+     libfsapfs_disk_usage_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+#endif
+
+int libfsapfs_disk_usage_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfsapfs_internal_disk_usage_get_entry_index_by_identifier(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     uint64_t identifier,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_merge_extended_attribute_entries(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_disk_usage_calculate_totals(
+     libfsapfs_internal_disk_usage_t *internal_disk_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_disk_usage_get_number_of_directories(
+     libfsapfs_disk_usage_t *disk_usage,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_disk_usage_get_directory_by_index(
+     libfsapfs_disk_usage_t *disk_usage,
+     int directory_index,
+     uint64_t *identifier,
+     uint64_t *logical_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_disk_usage_get_directory_by_identifier(
+     libfsapfs_disk_usage_t *disk_usage,
+     uint64_t identifier,
+     uint64_t *logical_size,
+     uint64_t *allocated_size,
+     uint64_t *number_of_files,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_DISK_USAGE_H ) */
+
@@ -959,6 +959,106 @@ int libfsapfs_extended_attribute_get_utf8_name(
 	return( result );
 }
 
+/* Retrieves a view of the UTF-8 encoded name
+ * The view points into the name storage of the extended attribute and is valid for
+ * the lifetime of the extended attribute, the length excludes the end of string character
+ * The name is returned as stored and is not validated, use
+ * libfsapfs_extended_attribute_get_utf8_name to retrieve a validated copy
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_extended_attribute_get_utf8_name_view(
+     libfsapfs_extended_attribute_t *extended_attribute,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
+	static char *function                                                = "libfsapfs_extended_attribute_get_utf8_name_view";
+	size_t name_length                                                   = 0;
+	int result                                                           = 0;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute = (libfsapfs_internal_extended_attribute_t *) extended_attribute;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_extended_attribute->name != NULL )
+	{
+		name_length = (size_t) internal_extended_attribute->name_size;
+
+		if( ( name_length > 0 )
+		 && ( internal_extended_attribute->name[ name_length - 1 ] == 0 ) )
+		{
+			name_length -= 1;
+		}
+		*utf8_string        = internal_extended_attribute->name;
+		*utf8_string_length = name_length;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Compares an UTF-8 string with an extended attribute name
  * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
  */
@@ -1371,6 +1471,8 @@ int libfsapfs_internal_extended_attribute_get_data_stream(
 		     internal_extended_attribute->file_extents,
 		     internal_extended_attribute->data_stream_size,
 		     0,
+		     NULL,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
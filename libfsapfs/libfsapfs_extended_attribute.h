@@ -152,6 +152,13 @@ int libfsapfs_extended_attribute_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_get_utf8_name_view(
+     libfsapfs_extended_attribute_t *extended_attribute,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
 int libfsapfs_extended_attribute_compare_name_with_utf8_string(
      libfsapfs_extended_attribute_t *extended_attribute,
      const uint8_t *utf8_string,
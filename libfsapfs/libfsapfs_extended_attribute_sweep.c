@@ -0,0 +1,1877 @@
+/*
+ * Extended attribute sweep functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_data_block_data_handle.h"
+#include "libfsapfs_data_stream.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_extended_attribute_sweep.h"
+#include "libfsapfs_file_extent.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcdata.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libfdata.h"
+
+#include "fsapfs_file_system.h"
+
+/* Creates an extended attribute sweep
+ * Make sure the value extended_attribute_sweep is referencing, is set to NULL
+ * A directory identifier of 0 represents the whole volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_initialize(
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint64_t directory_identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_initialize";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extended_attribute_sweep != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extended attribute sweep value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = memory_allocate_structure(
+	                                     libfsapfs_internal_extended_attribute_sweep_t );
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extended attribute sweep.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_extended_attribute_sweep,
+	     0,
+	     sizeof( libfsapfs_internal_extended_attribute_sweep_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extended attribute sweep.",
+		 function );
+
+		memory_free(
+		 internal_extended_attribute_sweep );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_extended_attribute_sweep->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_extended_attribute_sweep->io_handle            = io_handle;
+	internal_extended_attribute_sweep->file_io_handle       = file_io_handle;
+	internal_extended_attribute_sweep->encryption_context   = encryption_context;
+	internal_extended_attribute_sweep->file_system_btree    = file_system_btree;
+	internal_extended_attribute_sweep->directory_identifier = directory_identifier;
+
+	*extended_attribute_sweep = (libfsapfs_extended_attribute_sweep_t *) internal_extended_attribute_sweep;
+
+	return( 1 );
+
+on_error:
+	if( internal_extended_attribute_sweep != NULL )
+	{
+		memory_free(
+		 internal_extended_attribute_sweep );
+	}
+	return( -1 );
+}
+
+/* Frees an extended attribute sweep
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_free(
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_free";
+	int result                                                                       = 1;
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extended_attribute_sweep != NULL )
+	{
+		internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) *extended_attribute_sweep;
+		*extended_attribute_sweep         = NULL;
+
+		/* The io_handle, file_io_handle, encryption_context and file_system_btree references are freed elsewhere
+		 */
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_extended_attribute_sweep->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_extended_attribute_sweep->values_data != NULL )
+		{
+			memory_free(
+			 internal_extended_attribute_sweep->values_data );
+		}
+		if( internal_extended_attribute_sweep->names_data != NULL )
+		{
+			memory_free(
+			 internal_extended_attribute_sweep->names_data );
+		}
+		if( internal_extended_attribute_sweep->inodes != NULL )
+		{
+			memory_free(
+			 internal_extended_attribute_sweep->inodes );
+		}
+		if( internal_extended_attribute_sweep->results != NULL )
+		{
+			memory_free(
+			 internal_extended_attribute_sweep->results );
+		}
+		memory_free(
+		 internal_extended_attribute_sweep );
+	}
+	return( result );
+}
+
+/* Appends data to a data buffer that grows as needed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_append_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t *allocated_data_size,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocated_data      = NULL;
+	static char *function          = "libfsapfs_internal_extended_attribute_sweep_append_data";
+	size_t new_allocated_data_size = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_size > *allocated_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_data == NULL )
+	 && ( source_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( source_data_size > ( *allocated_data_size - *data_size ) )
+	{
+		new_allocated_data_size = *allocated_data_size;
+
+		if( new_allocated_data_size == 0 )
+		{
+			new_allocated_data_size = 64 * 1024;
+		}
+		while( source_data_size > ( new_allocated_data_size - *data_size ) )
+		{
+			if( new_allocated_data_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid data size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			new_allocated_data_size *= 2;
+		}
+		reallocated_data = (uint8_t *) memory_reallocate(
+		                                *data,
+		                                sizeof( uint8_t ) * new_allocated_data_size );
+
+		if( reallocated_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		*data                = reallocated_data;
+		*allocated_data_size = new_allocated_data_size;
+	}
+	if( memory_copy(
+	     &( ( *data )[ *data_size ] ),
+	     source_data,
+	     source_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size += source_data_size;
+
+	return( 1 );
+}
+
+/* Appends a result
+ * The value data is only stored if the value is stored inline, in which case the data stream identifier is 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_append_result(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     const uint8_t *name,
+     uint16_t name_size,
+     uint64_t data_stream_identifier,
+     const uint8_t *value_data,
+     size64_t value_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_extended_attribute_sweep_result_t *results = NULL;
+	libfsapfs_extended_attribute_sweep_result_t *result  = NULL;
+	static char *function                                = "libfsapfs_internal_extended_attribute_sweep_append_result";
+	size_t name_offset                                   = 0;
+	size_t value_offset                                  = 0;
+	int new_number_of_allocated_results                  = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_stream_identifier == 0 )
+	 && ( value_size > (size64_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->number_of_results >= internal_extended_attribute_sweep->number_of_allocated_results )
+	{
+		if( internal_extended_attribute_sweep->number_of_allocated_results == 0 )
+		{
+			new_number_of_allocated_results = 1024;
+		}
+		else if( internal_extended_attribute_sweep->number_of_allocated_results <= ( INT_MAX / 2 ) )
+		{
+			new_number_of_allocated_results = internal_extended_attribute_sweep->number_of_allocated_results * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extended attribute sweep - number of allocated results value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) new_number_of_allocated_results > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_extended_attribute_sweep_result_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid results size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		results = (libfsapfs_extended_attribute_sweep_result_t *) memory_reallocate(
+		                                                           internal_extended_attribute_sweep->results,
+		                                                           sizeof( libfsapfs_extended_attribute_sweep_result_t ) * new_number_of_allocated_results );
+
+		if( results == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize results.",
+			 function );
+
+			return( -1 );
+		}
+		internal_extended_attribute_sweep->results                     = results;
+		internal_extended_attribute_sweep->number_of_allocated_results = new_number_of_allocated_results;
+	}
+	/* Names are stored without the end-of-string character
+	 */
+	if( ( name != NULL )
+	 && ( name_size > 0 )
+	 && ( name[ name_size - 1 ] == 0 ) )
+	{
+		name_size -= 1;
+	}
+	name_offset = internal_extended_attribute_sweep->names_data_size;
+
+	if( libfsapfs_internal_extended_attribute_sweep_append_data(
+	     &( internal_extended_attribute_sweep->names_data ),
+	     &( internal_extended_attribute_sweep->names_data_size ),
+	     &( internal_extended_attribute_sweep->allocated_names_data_size ),
+	     name,
+	     (size_t) name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name.",
+		 function );
+
+		return( -1 );
+	}
+	value_offset = internal_extended_attribute_sweep->values_data_size;
+
+	if( data_stream_identifier == 0 )
+	{
+		if( libfsapfs_internal_extended_attribute_sweep_append_data(
+		     &( internal_extended_attribute_sweep->values_data ),
+		     &( internal_extended_attribute_sweep->values_data_size ),
+		     &( internal_extended_attribute_sweep->allocated_values_data_size ),
+		     value_data,
+		     (size_t) value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = &( internal_extended_attribute_sweep->results[ internal_extended_attribute_sweep->number_of_results ] );
+
+	result->identifier             = identifier;
+	result->name_offset            = name_offset;
+	result->name_size              = name_size;
+	result->data_stream_identifier = data_stream_identifier;
+	result->value_offset           = value_offset;
+	result->value_size             = value_size;
+
+	internal_extended_attribute_sweep->number_of_results += 1;
+
+	return( 1 );
+}
+
+/* Appends an inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_append_inode(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_extended_attribute_sweep_inode_t *inodes = NULL;
+	libfsapfs_extended_attribute_sweep_inode_t *inode  = NULL;
+	static char *function                              = "libfsapfs_internal_extended_attribute_sweep_append_inode";
+	int new_number_of_allocated_inodes                 = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->number_of_inodes >= internal_extended_attribute_sweep->number_of_allocated_inodes )
+	{
+		if( internal_extended_attribute_sweep->number_of_allocated_inodes == 0 )
+		{
+			new_number_of_allocated_inodes = 1024;
+		}
+		else if( internal_extended_attribute_sweep->number_of_allocated_inodes <= ( INT_MAX / 2 ) )
+		{
+			new_number_of_allocated_inodes = internal_extended_attribute_sweep->number_of_allocated_inodes * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid extended attribute sweep - number of allocated inodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) new_number_of_allocated_inodes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_extended_attribute_sweep_inode_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid inodes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		inodes = (libfsapfs_extended_attribute_sweep_inode_t *) memory_reallocate(
+		                                                         internal_extended_attribute_sweep->inodes,
+		                                                         sizeof( libfsapfs_extended_attribute_sweep_inode_t ) * new_number_of_allocated_inodes );
+
+		if( inodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize inodes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_extended_attribute_sweep->inodes                     = inodes;
+		internal_extended_attribute_sweep->number_of_allocated_inodes = new_number_of_allocated_inodes;
+	}
+	/* The inodes are read in leaf order and therefore sorted by identifier
+	 */
+	if( internal_extended_attribute_sweep->number_of_inodes > 0 )
+	{
+		inode = &( internal_extended_attribute_sweep->inodes[ internal_extended_attribute_sweep->number_of_inodes - 1 ] );
+
+		if( identifier <= inode->identifier )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid identifier: %" PRIu64 " value out of bounds.",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+	}
+	inode = &( internal_extended_attribute_sweep->inodes[ internal_extended_attribute_sweep->number_of_inodes ] );
+
+	inode->identifier        = identifier;
+	inode->parent_identifier = parent_identifier;
+	inode->in_subtree        = 0;
+
+	internal_extended_attribute_sweep->number_of_inodes += 1;
+
+	return( 1 );
+}
+
+/* Reads the extended attribute records of a file system B-tree leaf node
+ * The names and inline values are copied from the B-tree entries, without creating extended attributes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_read_leaf_node(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	const uint8_t *value_data            = NULL;
+	static char *function                = "libfsapfs_internal_extended_attribute_sweep_read_leaf_node";
+	size64_t value_size                  = 0;
+	uint64_t data_stream_identifier      = 0;
+	uint64_t file_system_identifier      = 0;
+	uint64_t parent_identifier           = 0;
+	uint16_t extended_attribute_flags    = 0;
+	uint16_t name_size                   = 0;
+	uint16_t value_data_size             = 0;
+	uint8_t data_type                    = 0;
+	int btree_entry_index                = 0;
+	int number_of_entries                = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		if( ( btree_entry == NULL )
+		 || ( btree_entry->key_data == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		data_type = (uint8_t) ( file_system_identifier >> 60 );
+
+		file_system_identifier &= 0x0fffffffffffffffUL;
+
+		if( data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE )
+		{
+			/* The inodes are only needed to determine if an extended attribute is in the subtree
+			 */
+			if( internal_extended_attribute_sweep->directory_identifier == 0 )
+			{
+				continue;
+			}
+			if( ( btree_entry->value_data == NULL )
+			 || ( btree_entry->value_data_size < sizeof( fsapfs_file_system_btree_value_inode_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid B-tree entry: %d - value data size value out of bounds.",
+				 function,
+				 btree_entry_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (fsapfs_file_system_btree_value_inode_t *) btree_entry->value_data )->parent_identifier,
+			 parent_identifier );
+
+			if( libfsapfs_internal_extended_attribute_sweep_append_inode(
+			     internal_extended_attribute_sweep,
+			     file_system_identifier,
+			     parent_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append inode: %" PRIu64 ".",
+				 function,
+				 file_system_identifier );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( data_type != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE )
+		{
+			continue;
+		}
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsapfs_file_system_btree_key_extended_attribute_t *) btree_entry->key_data )->name_size,
+		 name_size );
+
+		if( ( name_size == 0 )
+		 || ( (size_t) name_size > ( btree_entry->key_data_size - sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - name size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		if( ( btree_entry->value_data == NULL )
+		 || ( btree_entry->value_data_size < sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - value data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsapfs_file_system_btree_value_extended_attribute_t *) btree_entry->value_data )->flags,
+		 extended_attribute_flags );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsapfs_file_system_btree_value_extended_attribute_t *) btree_entry->value_data )->data_size,
+		 value_data_size );
+
+		if( (size_t) value_data_size > ( btree_entry->value_data_size - sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - extended attribute data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		value_data = &( btree_entry->value_data[ sizeof( fsapfs_file_system_btree_value_extended_attribute_t ) ] );
+
+		if( ( extended_attribute_flags & 0x0001 ) != 0 )
+		{
+			if( (size_t) value_data_size != sizeof( fsapfs_file_system_extended_attribute_data_stream_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid B-tree entry: %d - unsupported extended attribute data size.",
+				 function,
+				 btree_entry_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (fsapfs_file_system_extended_attribute_data_stream_t *) value_data )->data_stream_identifier,
+			 data_stream_identifier );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (fsapfs_file_system_extended_attribute_data_stream_t *) value_data )->used_size,
+			 value_size );
+
+			value_data = NULL;
+		}
+		else if( ( extended_attribute_flags & 0x0002 ) != 0 )
+		{
+			data_stream_identifier = 0;
+			value_size             = (size64_t) value_data_size;
+		}
+		else
+		{
+			continue;
+		}
+		if( libfsapfs_internal_extended_attribute_sweep_append_result(
+		     internal_extended_attribute_sweep,
+		     file_system_identifier,
+		     &( btree_entry->key_data[ sizeof( fsapfs_file_system_btree_key_extended_attribute_t ) ] ),
+		     name_size,
+		     data_stream_identifier,
+		     value_data,
+		     value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append result.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if a file entry is in the subtree of the directory the sweep is limited to
+ * The outcome is stored for every inode on the path to the directory, so that
+ * every inode is only walked once
+ * Returns 1 if in the subtree, 0 if not or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_is_in_subtree(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_extended_attribute_sweep_inode_t *inode = NULL;
+	static char *function                             = "libfsapfs_internal_extended_attribute_sweep_is_in_subtree";
+	uint64_t current_identifier                       = 0;
+	uint8_t in_subtree                                = 0;
+	int inode_index                                   = 0;
+	int maximum_inode_index                           = 0;
+	int minimum_inode_index                           = 0;
+	int number_of_iterations                          = 0;
+	int walk_index                                    = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->directory_identifier == 0 )
+	{
+		return( 1 );
+	}
+	/* The first walk determines the outcome, the second walk stores it
+	 */
+	for( walk_index = 0;
+	     walk_index < 2;
+	     walk_index++ )
+	{
+		current_identifier   = identifier;
+		number_of_iterations = 0;
+
+		while( current_identifier != internal_extended_attribute_sweep->directory_identifier )
+		{
+			/* A loop in the parent identifiers is treated as not in the subtree
+			 */
+			if( number_of_iterations > internal_extended_attribute_sweep->number_of_inodes )
+			{
+				break;
+			}
+			number_of_iterations++;
+
+			inode               = NULL;
+			minimum_inode_index = 0;
+			maximum_inode_index = internal_extended_attribute_sweep->number_of_inodes - 1;
+
+			while( minimum_inode_index <= maximum_inode_index )
+			{
+				inode_index = minimum_inode_index + ( ( maximum_inode_index - minimum_inode_index ) / 2 );
+
+				if( internal_extended_attribute_sweep->inodes[ inode_index ].identifier == current_identifier )
+				{
+					inode = &( internal_extended_attribute_sweep->inodes[ inode_index ] );
+
+					break;
+				}
+				else if( internal_extended_attribute_sweep->inodes[ inode_index ].identifier < current_identifier )
+				{
+					minimum_inode_index = inode_index + 1;
+				}
+				else
+				{
+					maximum_inode_index = inode_index - 1;
+				}
+			}
+			if( inode == NULL )
+			{
+				break;
+			}
+			if( inode->in_subtree != 0 )
+			{
+				break;
+			}
+			if( walk_index == 1 )
+			{
+				inode->in_subtree = in_subtree;
+			}
+			if( inode->parent_identifier == current_identifier )
+			{
+				break;
+			}
+			current_identifier = inode->parent_identifier;
+		}
+		if( walk_index == 0 )
+		{
+			if( current_identifier == internal_extended_attribute_sweep->directory_identifier )
+			{
+				in_subtree = 1;
+			}
+			else if( ( inode != NULL )
+			      && ( inode->in_subtree != 0 ) )
+			{
+				in_subtree = inode->in_subtree;
+			}
+			else
+			{
+				in_subtree = 2;
+			}
+		}
+	}
+	if( in_subtree == 1 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Removes the results that are not in the subtree of the directory the sweep is limited to
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_filter_results(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_extended_attribute_sweep_filter_results";
+	int number_of_results = 0;
+	int result            = 0;
+	int result_index      = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->directory_identifier == 0 )
+	{
+		return( 1 );
+	}
+	/* The names and values data is not compacted, the offsets of the remaining results stay valid
+	 */
+	for( result_index = 0;
+	     result_index < internal_extended_attribute_sweep->number_of_results;
+	     result_index++ )
+	{
+		result = libfsapfs_internal_extended_attribute_sweep_is_in_subtree(
+		          internal_extended_attribute_sweep,
+		          internal_extended_attribute_sweep->results[ result_index ].identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to determine if result: %d is in subtree.",
+			 function,
+			 result_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( number_of_results != result_index )
+		{
+			internal_extended_attribute_sweep->results[ number_of_results ] = internal_extended_attribute_sweep->results[ result_index ];
+		}
+		number_of_results++;
+	}
+	internal_extended_attribute_sweep->number_of_results = number_of_results;
+
+	/* The inodes are no longer needed
+	 */
+	if( internal_extended_attribute_sweep->inodes != NULL )
+	{
+		memory_free(
+		 internal_extended_attribute_sweep->inodes );
+
+		internal_extended_attribute_sweep->inodes = NULL;
+	}
+	internal_extended_attribute_sweep->number_of_inodes           = 0;
+	internal_extended_attribute_sweep->number_of_allocated_inodes = 0;
+
+	return( 1 );
+}
+
+/* Reads the extended attribute records of the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_sweep_read_file_system_btree(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_extended_attribute_sweep_read_file_system_btree";
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid extended attribute sweep - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_system_btree_read_leaf_nodes(
+	     internal_extended_attribute_sweep->file_system_btree,
+	     internal_extended_attribute_sweep->file_io_handle,
+	     internal_extended_attribute_sweep->file_system_btree->root_node_block_number,
+	     (int (*)(intptr_t *, libfsapfs_btree_node_t *, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_sweep_read_leaf_node,
+	     (intptr_t *) internal_extended_attribute_sweep,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree leaf nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_extended_attribute_sweep_filter_results(
+	     internal_extended_attribute_sweep,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to filter results.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of results
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_number_of_results(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_number_of_results";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_results = internal_extended_attribute_sweep->number_of_results;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier of the file entry of a specific result
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_result_identifier(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_result_identifier";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = internal_extended_attribute_sweep->results[ result_index ].identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of a specific result
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_utf8_result_name_size(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_utf8_result_name_size";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = (size_t) internal_extended_attribute_sweep->results[ result_index ].name_size + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name of a specific result
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_utf8_result_name(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	libfsapfs_extended_attribute_sweep_result_t *result                              = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_utf8_result_name";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( internal_extended_attribute_sweep->results[ result_index ] );
+
+	if( ( utf8_string_size < ( (size_t) result->name_size + 1 ) )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( result->name_size > 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     &( internal_extended_attribute_sweep->names_data[ result->name_offset ] ),
+		     (size_t) result->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	utf8_string[ result->name_size ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the value size of a specific result
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_result_value_size(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     size64_t *value_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_result_value_size";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	*value_size = internal_extended_attribute_sweep->results[ result_index ].value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data stream identifier of a specific result
+ * Returns 1 if successful, 0 if the value is stored inline or -1 on error
+ */
+int libfsapfs_extended_attribute_sweep_get_result_data_stream_identifier(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint64_t *data_stream_identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_get_result_data_stream_identifier";
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_extended_attribute_sweep->results[ result_index ].data_stream_identifier == 0 )
+	{
+		return( 0 );
+	}
+	*data_stream_identifier = internal_extended_attribute_sweep->results[ result_index ].data_stream_identifier;
+
+	return( 1 );
+}
+
+/* Reads data of the data stream of a specific result
+ * Unencrypted data is read with a single read per file extent, bypassing the data block cache
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_internal_extended_attribute_sweep_read_data_stream(
+         libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+         libfsapfs_extended_attribute_sweep_result_t *result,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libcdata_array_t *file_extents                             = NULL;
+	libfdata_stream_t *data_stream                             = NULL;
+	libfsapfs_data_block_data_handle_t *data_block_data_handle = NULL;
+	static char *function                                      = "libfsapfs_internal_extended_attribute_sweep_read_data_stream";
+	ssize_t read_count                                         = 0;
+
+	if( internal_extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &file_extents,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file extents array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_file_system_btree_get_file_extents(
+	     internal_extended_attribute_sweep->file_system_btree,
+	     internal_extended_attribute_sweep->file_io_handle,
+	     result->data_stream_identifier,
+	     file_extents,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file extents of data stream: %" PRIu64 " from file system B-tree.",
+		 function,
+		 result->data_stream_identifier );
+
+		goto on_error;
+	}
+	if( internal_extended_attribute_sweep->encryption_context == NULL )
+	{
+		if( libfsapfs_data_block_data_handle_initialize(
+		     &data_block_data_handle,
+		     internal_extended_attribute_sweep->io_handle,
+		     NULL,
+		     file_extents,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block data handle.",
+			 function );
+
+			goto on_error;
+		}
+		data_block_data_handle->current_offset = offset;
+
+		read_count = libfsapfs_data_block_data_handle_read_extent_data(
+		              data_block_data_handle,
+		              internal_extended_attribute_sweep->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file extent data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_data_block_data_handle_free(
+		     &data_block_data_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block data handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* Encrypted data is decrypted per block by the data stream
+		 */
+		if( libfsapfs_data_stream_initialize_from_file_extents(
+		     &data_stream,
+		     internal_extended_attribute_sweep->io_handle,
+		     internal_extended_attribute_sweep->encryption_context,
+		     file_extents,
+		     result->value_size,
+		     0,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data stream from file extents.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              data_stream,
+		              (intptr_t *) internal_extended_attribute_sweep->file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              0,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from data stream.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdata_stream_free(
+		     &data_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &file_extents,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file extents array.",
+		 function );
+
+		goto on_error;
+	}
+	return( read_count );
+
+on_error:
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( data_block_data_handle != NULL )
+	{
+		libfsapfs_data_block_data_handle_free(
+		 &data_block_data_handle,
+		 NULL );
+	}
+	if( file_extents != NULL )
+	{
+		libcdata_array_free(
+		 &file_extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the value of a specific result at a specific offset into a buffer
+ * Inline values are copied from the data retained by the sweep, values stored in a data stream are read from the volume
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_extended_attribute_sweep_read_result_value_at_offset(
+         libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+         int result_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep = NULL;
+	libfsapfs_extended_attribute_sweep_result_t *result                              = NULL;
+	static char *function                                                            = "libfsapfs_extended_attribute_sweep_read_result_value_at_offset";
+	size_t read_size                                                                 = 0;
+	ssize_t read_count                                                               = 0;
+
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute_sweep = (libfsapfs_internal_extended_attribute_sweep_t *) extended_attribute_sweep;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_extended_attribute_sweep->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( internal_extended_attribute_sweep->results[ result_index ] );
+
+	if( (size64_t) offset >= result->value_size )
+	{
+		return( 0 );
+	}
+	read_size = buffer_size;
+
+	if( (size64_t) read_size > ( result->value_size - offset ) )
+	{
+		read_size = (size_t) ( result->value_size - offset );
+	}
+	if( result->data_stream_identifier == 0 )
+	{
+		if( memory_copy(
+		     buffer,
+		     &( internal_extended_attribute_sweep->values_data[ result->value_offset + (size_t) offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_extended_attribute_sweep->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfsapfs_internal_extended_attribute_sweep_read_data_stream(
+	              internal_extended_attribute_sweep,
+	              result,
+	              (uint8_t *) buffer,
+	              read_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value of result: %d.",
+		 function,
+		 result_index );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_extended_attribute_sweep->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
@@ -0,0 +1,288 @@
+/*
+ * Extended attribute sweep functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_EXTENDED_ATTRIBUTE_SWEEP_H )
+#define _LIBFSAPFS_EXTENDED_ATTRIBUTE_SWEEP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_extended_attribute_sweep_result libfsapfs_extended_attribute_sweep_result_t;
+
+struct libfsapfs_extended_attribute_sweep_result
+{
+	/* The identifier of the file entry
+	 */
+	uint64_t identifier;
+
+	/* The offset of the name in the names data
+	 */
+	size_t name_offset;
+
+	/* The name size without end-of-string character
+	 */
+	uint16_t name_size;
+
+	/* The data stream identifier, 0 if the value is stored inline
+	 */
+	uint64_t data_stream_identifier;
+
+	/* The offset of the inline value in the values data
+	 */
+	size_t value_offset;
+
+	/* The value size
+	 */
+	size64_t value_size;
+};
+
+typedef struct libfsapfs_extended_attribute_sweep_inode libfsapfs_extended_attribute_sweep_inode_t;
+
+struct libfsapfs_extended_attribute_sweep_inode
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The parent identifier
+	 */
+	uint64_t parent_identifier;
+
+	/* Value to indicate the inode is in the subtree
+	 * 0 if not determined, 1 if in the subtree or 2 if not
+	 */
+	uint8_t in_subtree;
+};
+
+typedef struct libfsapfs_internal_extended_attribute_sweep libfsapfs_internal_extended_attribute_sweep_t;
+
+struct libfsapfs_internal_extended_attribute_sweep
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The encryption context
+	 */
+	libfsapfs_encryption_context_t *encryption_context;
+
+	/* The file system B-tree
+	 */
+	libfsapfs_file_system_btree_t *file_system_btree;
+
+	/* The identifier of the directory the sweep is limited to, 0 represents the whole volume
+	 */
+	uint64_t directory_identifier;
+
+	/* The results
+	 */
+	libfsapfs_extended_attribute_sweep_result_t *results;
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+
+	/* The inodes sorted by identifier, only used when the sweep is limited to a directory
+	 */
+	libfsapfs_extended_attribute_sweep_inode_t *inodes;
+
+	/* The number of inodes
+	 */
+	int number_of_inodes;
+
+	/* The number of allocated inodes
+	 */
+	int number_of_allocated_inodes;
+
+	/* The names data
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The inline values data
+	 */
+	uint8_t *values_data;
+
+	/* The values data size
+	 */
+	size_t values_data_size;
+
+	/* The allocated values data size
+	 */
+	size_t allocated_values_data_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_extended_attribute_sweep_initialize(
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint64_t directory_identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_free(
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_append_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t *allocated_data_size,
+     const uint8_t *source_data,
+     size_t source_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_append_result(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     const uint8_t *name,
+     uint16_t name_size,
+     uint64_t data_stream_identifier,
+     const uint8_t *value_data,
+     size64_t value_size,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_append_inode(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_read_leaf_node(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_is_in_subtree(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     uint64_t identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_filter_results(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_sweep_read_file_system_btree(
+     libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_number_of_results(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_result_identifier(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_utf8_result_name_size(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_utf8_result_name(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_result_value_size(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     size64_t *value_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_extended_attribute_sweep_get_result_data_stream_identifier(
+     libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+     int result_index,
+     uint64_t *data_stream_identifier,
+     libcerror_error_t **error );
+
+ssize_t libfsapfs_internal_extended_attribute_sweep_read_data_stream(
+         libfsapfs_internal_extended_attribute_sweep_t *internal_extended_attribute_sweep,
+         libfsapfs_extended_attribute_sweep_result_t *result,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+ssize_t libfsapfs_extended_attribute_sweep_read_result_value_at_offset(
+         libfsapfs_extended_attribute_sweep_t *extended_attribute_sweep,
+         int result_index,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_EXTENDED_ATTRIBUTE_SWEEP_H ) */
+
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_cursor.h"
 #include "libfsapfs_data_stream.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_directory_record.h"
@@ -30,6 +31,7 @@
 #include "libfsapfs_extended_attribute.h"
 #include "libfsapfs_file_entry.h"
 #include "libfsapfs_file_extent.h"
+#include "libfsapfs_file_reference.h"
 #include "libfsapfs_file_system_btree.h"
 #include "libfsapfs_inode.h"
 #include "libfsapfs_io_handle.h"
@@ -304,6 +306,101 @@ int libfsapfs_file_entry_free(
 	return( result );
 }
 
+/* Retrieves the file IO handle to be used by a new parent or sub file entry
+ * If the file entry has a file IO pool the handles of the pool are used in turn
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsapfs_internal_file_entry_get_file_entry_file_io_handle";
+	int number_of_file_io_handles = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->file_io_pool == NULL )
+	{
+		*file_io_handle     = internal_file_entry->file_io_handle;
+		*file_io_pool_entry = 0;
+
+		return( 1 );
+	}
+	if( libbfio_pool_get_number_of_handles(
+	     internal_file_entry->file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->next_file_io_pool_entry < 0 )
+	 || ( internal_file_entry->next_file_io_pool_entry >= number_of_file_io_handles ) )
+	{
+		internal_file_entry->next_file_io_pool_entry = 0;
+	}
+	if( libbfio_pool_get_handle(
+	     internal_file_entry->file_io_pool,
+	     internal_file_entry->next_file_io_pool_entry,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 internal_file_entry->next_file_io_pool_entry );
+
+		return( -1 );
+	}
+	*file_io_pool_entry = internal_file_entry->next_file_io_pool_entry;
+
+	internal_file_entry->next_file_io_pool_entry += 1;
+
+	return( 1 );
+}
+
 /* Retrieves the identifier
  * This value is retrieved from the inode
  * Returns 1 if successful or -1 on error
@@ -377,6 +474,94 @@ int libfsapfs_file_entry_get_identifier(
 	return( result );
 }
 
+/* Retrieves the file reference
+ * The file reference is a compact value of LIBFSAPFS_FILE_REFERENCE_SIZE bytes
+ * that can be used to retrieve the file entry with libfsapfs_volume_get_file_entry_by_file_reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_entry_get_file_reference(
+     libfsapfs_file_entry_t *file_entry,
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_get_file_reference";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_reference_set_from_inode(
+	     file_reference,
+	     file_reference_size,
+	     internal_file_entry->file_system_btree->transaction_identifier,
+	     internal_file_entry->inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file reference.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the parent identifier
  * This value is retrieved from the inode
  * Returns 1 if successful or -1 on error
@@ -458,11 +643,13 @@ int libfsapfs_file_entry_get_parent_file_entry(
      libfsapfs_file_entry_t **parent_file_entry,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle                     = NULL;
 	libfsapfs_inode_t *inode                             = NULL;
 	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                                = "libfsapfs_file_entry_get_parent_file_entry";
 	int result                                           = 0;
 	uint64_t file_system_identifier                      = 0;
+	int file_io_pool_entry                               = 0;
 
 	if( file_entry == NULL )
 	{
@@ -561,10 +748,25 @@ int libfsapfs_file_entry_get_parent_file_entry(
 
 			 goto on_error;
 		}
+		if( libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+		     internal_file_entry,
+		     &file_io_handle,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfsapfs_file_entry_initialize(
 		     parent_file_entry,
 		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
+		     file_io_handle,
 		     internal_file_entry->encryption_context,
 		     internal_file_entry->file_system_btree,
 		     inode,
@@ -580,6 +782,10 @@ int libfsapfs_file_entry_get_parent_file_entry(
 
 			goto on_error;
 		}
+		( (libfsapfs_internal_file_entry_t *) *parent_file_entry )->file_io_pool            = internal_file_entry->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *parent_file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *parent_file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
+
 		inode  = NULL;
 		result = 1;
 	}
@@ -911,6 +1117,121 @@ int libfsapfs_file_entry_get_access_time(
 	return( result );
 }
 
+/* Retrieves the creation, modification, access, inode change and added dates and times
+ * The timestamps are signed 64-bit POSIX date and time values in number of nano seconds
+ * The added time is retrieved from the directory record, the other values from the inode
+ * The added time is set to 0 if the file entry has no directory record
+ * Returns 1 if successful, 0 if the added time is not available or -1 on error
+ */
+int libfsapfs_file_entry_get_timestamps(
+     libfsapfs_file_entry_t *file_entry,
+     int64_t *creation_time,
+     int64_t *modification_time,
+     int64_t *access_time,
+     int64_t *inode_change_time,
+     int64_t *added_time,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_get_timestamps";
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( added_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid added time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_inode_get_timestamps(
+	     internal_file_entry->inode,
+	     creation_time,
+	     modification_time,
+	     access_time,
+	     inode_change_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve timestamps.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_file_entry->directory_record == NULL )
+	{
+		*added_time = 0;
+	}
+	else if( libfsapfs_directory_record_get_added_time(
+	          internal_file_entry->directory_record,
+	          added_time,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve added time.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the owner identifier
  * This value is retrieved from the inode
  * Returns 1 if successful or -1 on error
@@ -1321,19 +1642,22 @@ int libfsapfs_file_entry_get_utf8_name(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-16 encoded name
- * The returned size includes the end of string character
- * This value is retrieved from the inode
- * Returns 1 if successful or -1 on error
+/* Retrieves a view of the UTF-8 encoded name
+ * The view points into the name storage of the file entry and is valid for
+ * the lifetime of the file entry, the length excludes the end of string character
+ * The name is returned as stored and is not validated, use
+ * libfsapfs_file_entry_get_utf8_name to retrieve a validated copy
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsapfs_file_entry_get_utf16_name_size(
+int libfsapfs_file_entry_get_utf8_name_view(
      libfsapfs_file_entry_t *file_entry,
-     size_t *utf16_string_size,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsapfs_file_entry_get_utf16_name_size";
-	int result                                           = 1;
+	static char *function                                = "libfsapfs_file_entry_get_utf8_name_view";
+	int result                                           = 0;
 
 	if( file_entry == NULL )
 	{
@@ -1365,12 +1689,108 @@ int libfsapfs_file_entry_get_utf16_name_size(
 #endif
 	if( internal_file_entry->directory_record != NULL )
 	{
-		if( libfsapfs_directory_record_get_utf16_name_size(
-		     internal_file_entry->directory_record,
-		     utf16_string_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
+		result = libfsapfs_directory_record_get_utf8_name_view(
+		          internal_file_entry->directory_record,
+		          utf8_string,
+		          utf8_string_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string view from directory entry.",
+			 function );
+		}
+	}
+	else
+	{
+		result = libfsapfs_inode_get_utf8_name_view(
+		          internal_file_entry->inode,
+		          utf8_string,
+		          utf8_string_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string view from inode.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * This value is retrieved from the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_entry_get_utf16_name_size(
+     libfsapfs_file_entry_t *file_entry,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_get_utf16_name_size";
+	int result                                           = 1;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->directory_record != NULL )
+	{
+		if( libfsapfs_directory_record_get_utf16_name_size(
+		     internal_file_entry->directory_record,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
@@ -3289,12 +3709,14 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
      libfsapfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle                     = NULL;
 	libfsapfs_directory_record_t *directory_record       = NULL;
 	libfsapfs_directory_record_t *directory_record_copy  = NULL;
 	libfsapfs_inode_t *inode                             = NULL;
 	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                                = "libfsapfs_file_entry_get_sub_file_entry_by_index";
 	uint64_t file_system_identifier                      = 0;
+	int file_io_pool_entry                               = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3424,10 +3846,25 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 
 		goto on_error;
 	}
+	if( libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+	     internal_file_entry,
+	     &file_io_handle,
+	     &file_io_pool_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for file entry.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfsapfs_file_entry_initialize(
 	     sub_file_entry,
 	     internal_file_entry->io_handle,
-	     internal_file_entry->file_io_handle,
+	     file_io_handle,
 	     internal_file_entry->encryption_context,
 	     internal_file_entry->file_system_btree,
 	     inode,
@@ -3443,6 +3880,10 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 
 		goto on_error;
 	}
+	( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool            = internal_file_entry->file_io_pool;
+	( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool_entry      = file_io_pool_entry;
+	( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
+
 	inode                 = NULL;
 	directory_record_copy = NULL;
 
@@ -3484,22 +3925,20 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the sub file entry for an UTF-8 encoded name
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves a cursor positioned at the first sub file entry
+ * The cursor iterates the directory records of the file entry in the order of the file system B-tree
+ * without reading all directory entries up front. This is the same order as the sub file entry index.
+ * The cursor must be freed after use with libfsapfs_cursor_free
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
+int libfsapfs_file_entry_get_directory_cursor(
      libfsapfs_file_entry_t *file_entry,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsapfs_file_entry_t **sub_file_entry,
+     libfsapfs_cursor_t **cursor,
      libcerror_error_t **error )
 {
-	libfsapfs_directory_record_t *directory_record       = NULL;
-	libfsapfs_inode_t *inode                             = NULL;
 	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsapfs_file_entry_get_sub_file_entry_by_utf8_name";
-	uint64_t file_system_identifier                      = 0;
-	int result                                           = 0;
+	static char *function                                = "libfsapfs_file_entry_get_directory_cursor";
+	uint64_t identifier                                  = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3514,30 +3953,41 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
-	if( sub_file_entry == NULL )
+	if( internal_file_entry->file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( cursor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub file entry.",
+		 "%s: invalid cursor.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sub_file_entry != NULL )
+	if( *cursor != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sub file entry value already set.",
+		 "%s: invalid cursor value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3545,7 +3995,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3553,63 +4003,84 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 #endif
 	if( libfsapfs_inode_get_identifier(
 	     internal_file_entry->inode,
-	     &file_system_identifier,
+	     &identifier,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 "%s: unable to retrieve identifier from inode.",
 		 function );
 
 		goto on_error;
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_utf8_path(
-	          internal_file_entry->file_system_btree,
-	          internal_file_entry->file_io_handle,
-	          file_system_identifier,
-	          utf8_string,
-	          utf8_string_length,
-	          &inode,
-	          &directory_record,
-	          error );
+	if( libfsapfs_cursor_initialize(
+	     cursor,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
+	     internal_file_entry->encryption_context,
+	     internal_file_entry->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
 
-	if( result == -1 )
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->file_system_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode from file system B-tree.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+#endif
+	if( libfsapfs_internal_cursor_seek_directory(
+	     (libfsapfs_internal_cursor_t *) *cursor,
+	     identifier,
+	     error ) != 1 )
 	{
-		if( libfsapfs_file_entry_initialize(
-		     sub_file_entry,
-		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
-		     internal_file_entry->encryption_context,
-		     internal_file_entry->file_system_btree,
-		     inode,
-		     directory_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create sub file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek directory records.",
+		 function );
 
-			goto on_error;
-		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_read(
+		 internal_file_entry->file_system_btree->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3617,51 +4088,68 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libfsapfs_cursor_free(
+		 cursor,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( result );
-
-on_error:
-	if( directory_record != NULL )
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_file_entry->file_system_btree,
+	     error ) != 1 )
 	{
-		libfsapfs_directory_record_free(
-		 &directory_record,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
+		 function );
+
+		libfsapfs_cursor_free(
+		 cursor,
 		 NULL );
+
+		return( -1 );
 	}
-	if( inode != NULL )
+	return( 1 );
+
+on_error:
+	if( *cursor != NULL )
 	{
-		libfsapfs_inode_free(
-		 &inode,
+		libfsapfs_cursor_free(
+		 cursor,
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Retrieves the sub file entry for an UTF-16 encoded name
+/* Retrieves the sub file entry for an UTF-8 encoded name
  * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
+int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
      libfsapfs_file_entry_t *file_entry,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      libfsapfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle                     = NULL;
 	libfsapfs_directory_record_t *directory_record       = NULL;
 	libfsapfs_inode_t *inode                             = NULL;
 	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsapfs_file_entry_get_sub_file_entry_by_utf16_name";
+	static char *function                                = "libfsapfs_file_entry_get_sub_file_entry_by_utf8_name";
 	uint64_t file_system_identifier                      = 0;
 	int result                                           = 0;
+	int file_io_pool_entry                               = 0;
 
 	if( file_entry == NULL )
 	{
@@ -3727,13 +4215,13 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 
 		goto on_error;
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_utf16_path(
+	result = libfsapfs_file_system_btree_get_inode_by_utf8_path(
 	          internal_file_entry->file_system_btree,
 	          internal_file_entry->file_io_handle,
 	          file_system_identifier,
-	          utf16_string,
-	          utf16_string_length,
-	          &inode,
+	          utf8_string,
+	          utf8_string_length,
+	          &inode,
 	          &directory_record,
 	          error );
 
@@ -3750,10 +4238,207 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 	}
 	else if( result != 0 )
 	{
+		if( libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+		     internal_file_entry,
+		     &file_io_handle,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfsapfs_file_entry_initialize(
 		     sub_file_entry,
 		     internal_file_entry->io_handle,
-		     internal_file_entry->file_io_handle,
+		     file_io_handle,
+		     internal_file_entry->encryption_context,
+		     internal_file_entry->file_system_btree,
+		     inode,
+		     directory_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create sub file entry.",
+			 function );
+
+			goto on_error;
+		}
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool            = internal_file_entry->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file_entry->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the sub file entry for an UTF-16 encoded name
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
+     libfsapfs_file_entry_t *file_entry,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsapfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libfsapfs_directory_record_t *directory_record       = NULL;
+	libfsapfs_inode_t *inode                             = NULL;
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_get_sub_file_entry_by_utf16_name";
+	uint64_t file_system_identifier                      = 0;
+	int result                                           = 0;
+	int file_io_pool_entry                               = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_inode_get_identifier(
+	     internal_file_entry->inode,
+	     &file_system_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsapfs_file_system_btree_get_inode_by_utf16_path(
+	          internal_file_entry->file_system_btree,
+	          internal_file_entry->file_io_handle,
+	          file_system_identifier,
+	          utf16_string,
+	          utf16_string_length,
+	          &inode,
+	          &directory_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode from file system B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+		     internal_file_entry,
+		     &file_io_handle,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_entry_initialize(
+		     sub_file_entry,
+		     internal_file_entry->io_handle,
+		     file_io_handle,
 		     internal_file_entry->encryption_context,
 		     internal_file_entry->file_system_btree,
 		     inode,
@@ -3769,6 +4454,9 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 
 			goto on_error;
 		}
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool            = internal_file_entry->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *sub_file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -4044,6 +4732,8 @@ int libfsapfs_internal_file_entry_get_data_stream(
 		     internal_file_entry->file_extents,
 		     (size64_t) data_stream_size,
 		     is_sparse,
+		     internal_file_entry->file_io_pool,
+		     internal_file_entry->file_io_pool_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -4328,6 +5018,593 @@ on_error:
 	return( -1 );
 }
 
+/* Reads data from multiple ranges
+ * The ranges are sorted by offset and overlapping, adjacent or nearby ranges,
+ * that are less than a block apart, are coalesced into a single read of
+ * at most LIBFSAPFS_READ_VECTOR_MAXIMUM_COALESCED_SIZE bytes. For uncompressed
+ * data a coalesced read does not cross a file extent, hence it maps to
+ * a single contiguous physical read
+ * At most LIBFSAPFS_READ_VECTOR_MAXIMUM_NUMBER_OF_RANGES ranges can be read
+ * per call. The current offset of the file entry is not changed
+ * The number of bytes read per range are stored in read_counts
+ * Returns the total number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_file_entry_read_vector(
+         libfsapfs_file_entry_t *file_entry,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         ssize_t *read_counts,
+         int number_of_ranges,
+         libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsapfs_file_extent_t *file_extent                 = NULL;
+	uint8_t *group_data                                  = NULL;
+	int *range_indexes                                   = NULL;
+	static char *function                                = "libfsapfs_file_entry_read_vector";
+	size_t group_data_size                               = 0;
+	size_t group_size                                    = 0;
+	size_t range_data_offset                             = 0;
+	size_t range_read_size                               = 0;
+	ssize_t read_count                                   = 0;
+	ssize_t total_read_count                             = 0;
+	off64_t current_offset                               = -1;
+	off64_t extent_end_offset                            = 0;
+	off64_t group_end_offset                             = 0;
+	off64_t group_start_offset                           = 0;
+	off64_t maximum_gap_size                             = 0;
+	off64_t range_end_offset                             = 0;
+	int extent_index                                     = 0;
+	int group_end_index                                  = 0;
+	int number_of_extents                                = 0;
+	int range_index                                      = 0;
+	int sorted_index                                     = 0;
+	int swap_index                                       = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffers.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_counts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read counts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_ranges < 0 )
+	 || ( number_of_ranges > LIBFSAPFS_READ_VECTOR_MAXIMUM_NUMBER_OF_RANGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of ranges value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 0 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( ( buffers[ range_index ] == NULL )
+		 && ( buffer_sizes[ range_index ] > 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( buffer_sizes[ range_index ] > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid buffer: %d size value exceeds maximum.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( offsets[ range_index ] < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid offset: %d value less than zero.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( offsets[ range_index ] > ( INT64_MAX - (off64_t) buffer_sizes[ range_index ] ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset: %d value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		read_counts[ range_index ] = 0;
+	}
+	range_indexes = (int *) memory_allocate(
+	                         sizeof( int ) * number_of_ranges );
+
+	if( range_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range indexes.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sort the ranges by offset, an insertion sort suffices since the number
+	 * of ranges is bounded by LIBFSAPFS_READ_VECTOR_MAXIMUM_NUMBER_OF_RANGES
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		for( sorted_index = range_index;
+		     sorted_index > 0;
+		     sorted_index-- )
+		{
+			swap_index = range_indexes[ sorted_index - 1 ];
+
+			if( offsets[ swap_index ] <= offsets[ range_index ] )
+			{
+				break;
+			}
+			range_indexes[ sorted_index ] = swap_index;
+		}
+		range_indexes[ sorted_index ] = range_index;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 range_indexes );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->data_stream == NULL )
+	{
+		if( libfsapfs_internal_file_entry_get_data_stream(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine data stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The ranges are read using the data stream, hence its current offset
+	 * is restored after reading
+	 */
+	if( libfdata_stream_get_offset(
+	     internal_file_entry->data_stream,
+	     &current_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset from data stream.",
+		 function );
+
+		current_offset = -1;
+
+		goto on_error;
+	}
+	if( internal_file_entry->file_extents != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->file_extents,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file_entry->io_handle != NULL )
+	{
+		maximum_gap_size = (off64_t) internal_file_entry->io_handle->block_size;
+	}
+	sorted_index = 0;
+
+	while( sorted_index < number_of_ranges )
+	{
+		range_index = range_indexes[ sorted_index ];
+
+		if( buffer_sizes[ range_index ] == 0 )
+		{
+			sorted_index++;
+
+			continue;
+		}
+		group_start_offset = offsets[ range_index ];
+		group_end_offset   = group_start_offset + (off64_t) buffer_sizes[ range_index ];
+
+		/* Determine the end of the file extent that contains the start of the group,
+		 * the file extents are sorted by logical offset and since the groups are
+		 * processed in order of increasing offset the extent index only advances
+		 */
+		if( internal_file_entry->file_extents == NULL )
+		{
+			extent_end_offset = INT64_MAX;
+		}
+		else
+		{
+			extent_end_offset = group_end_offset;
+
+			while( extent_index < number_of_extents )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     internal_file_entry->file_extents,
+				     extent_index,
+				     (intptr_t **) &file_extent,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve file extent: %d.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
+				if( file_extent == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing file extent: %d.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
+				if( group_start_offset < (off64_t) file_extent->logical_offset )
+				{
+					break;
+				}
+				if( group_start_offset < (off64_t) ( file_extent->logical_offset + file_extent->data_size ) )
+				{
+					extent_end_offset = (off64_t) ( file_extent->logical_offset + file_extent->data_size );
+
+					break;
+				}
+				extent_index++;
+			}
+			if( extent_end_offset < group_end_offset )
+			{
+				extent_end_offset = group_end_offset;
+			}
+		}
+		/* Add the ranges that overlap, are adjacent or are less than a block
+		 * after the end of the group
+		 */
+		for( group_end_index = sorted_index + 1;
+		     group_end_index < number_of_ranges;
+		     group_end_index++ )
+		{
+			range_index = range_indexes[ group_end_index ];
+
+			if( buffer_sizes[ range_index ] == 0 )
+			{
+				continue;
+			}
+			if( offsets[ range_index ] > ( group_end_offset + maximum_gap_size ) )
+			{
+				break;
+			}
+			range_end_offset = offsets[ range_index ] + (off64_t) buffer_sizes[ range_index ];
+
+			if( range_end_offset < group_end_offset )
+			{
+				range_end_offset = group_end_offset;
+			}
+			if( ( range_end_offset - group_start_offset ) > (off64_t) LIBFSAPFS_READ_VECTOR_MAXIMUM_COALESCED_SIZE )
+			{
+				break;
+			}
+			if( range_end_offset > extent_end_offset )
+			{
+				break;
+			}
+			group_end_offset = range_end_offset;
+		}
+		if( group_end_index == ( sorted_index + 1 ) )
+		{
+			range_index = range_indexes[ sorted_index ];
+
+			read_count = libfdata_stream_read_buffer_at_offset(
+			              internal_file_entry->data_stream,
+			              (intptr_t *) internal_file_entry->file_io_handle,
+			              buffers[ range_index ],
+			              buffer_sizes[ range_index ],
+			              offsets[ range_index ],
+			              0,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range: %d from data stream.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			read_counts[ range_index ] = read_count;
+			total_read_count          += read_count;
+
+			sorted_index = group_end_index;
+
+			continue;
+		}
+		group_size = (size_t) ( group_end_offset - group_start_offset );
+
+		if( group_size > group_data_size )
+		{
+			if( group_data != NULL )
+			{
+				memory_free(
+				 group_data );
+			}
+			group_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * group_size );
+
+			if( group_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create group data.",
+				 function );
+
+				group_data_size = 0;
+
+				goto on_error;
+			}
+			group_data_size = group_size;
+		}
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              internal_file_entry->data_stream,
+		              (intptr_t *) internal_file_entry->file_io_handle,
+		              group_data,
+		              group_size,
+		              group_start_offset,
+		              0,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ") from data stream.",
+			 function,
+			 group_start_offset,
+			 group_start_offset );
+
+			goto on_error;
+		}
+		/* Copy the data of the individual ranges from the group data
+		 */
+		while( sorted_index < group_end_index )
+		{
+			range_index = range_indexes[ sorted_index ];
+
+			sorted_index++;
+
+			if( buffer_sizes[ range_index ] == 0 )
+			{
+				continue;
+			}
+			range_data_offset = (size_t) ( offsets[ range_index ] - group_start_offset );
+
+			if( range_data_offset >= (size_t) read_count )
+			{
+				continue;
+			}
+			range_read_size = (size_t) read_count - range_data_offset;
+
+			if( range_read_size > buffer_sizes[ range_index ] )
+			{
+				range_read_size = buffer_sizes[ range_index ];
+			}
+			if( memory_copy(
+			     buffers[ range_index ],
+			     &( group_data[ range_data_offset ] ),
+			     range_read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data of range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			read_counts[ range_index ] = (ssize_t) range_read_size;
+			total_read_count          += (ssize_t) range_read_size;
+		}
+	}
+	if( libfdata_stream_seek_offset(
+	     internal_file_entry->data_stream,
+	     current_offset,
+	     SEEK_SET,
+	     error ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to restore offset in data stream.",
+		 function );
+
+		current_offset = -1;
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( group_data != NULL )
+		{
+			memory_free(
+			 group_data );
+		}
+		memory_free(
+		 range_indexes );
+
+		return( -1 );
+	}
+#endif
+	if( group_data != NULL )
+	{
+		memory_free(
+		 group_data );
+	}
+	memory_free(
+	 range_indexes );
+
+	return( total_read_count );
+
+on_error:
+	if( current_offset >= 0 )
+	{
+		libfdata_stream_seek_offset(
+		 internal_file_entry->data_stream,
+		 current_offset,
+		 SEEK_SET,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file_entry->read_write_lock,
+	 NULL );
+#endif
+	if( group_data != NULL )
+	{
+		memory_free(
+		 group_data );
+	}
+	memory_free(
+	 range_indexes );
+
+	return( -1 );
+}
+
 /* Seeks a certain offset
  * Returns the offset if seek is successful or -1 on error
  */
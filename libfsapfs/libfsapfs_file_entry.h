@@ -53,6 +53,18 @@ struct libfsapfs_internal_file_entry
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
+
+	/* The file IO pool entry of the next related file entry
+	 */
+	int next_file_io_pool_entry;
+
 	/* The encryption context
 	 */
 	libfsapfs_encryption_context_t *encryption_context;
@@ -135,12 +147,25 @@ int libfsapfs_file_entry_free(
      libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsapfs_internal_file_entry_get_file_entry_file_io_handle(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_pool_entry,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_identifier(
      libfsapfs_file_entry_t *file_entry,
      uint64_t *identifier,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_entry_get_file_reference(
+     libfsapfs_file_entry_t *file_entry,
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_parent_identifier(
      libfsapfs_file_entry_t *file_entry,
@@ -177,6 +202,16 @@ int libfsapfs_file_entry_get_inode_change_time(
      int64_t *posix_time,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_entry_get_timestamps(
+     libfsapfs_file_entry_t *file_entry,
+     int64_t *creation_time,
+     int64_t *modification_time,
+     int64_t *access_time,
+     int64_t *inode_change_time,
+     int64_t *added_time,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_owner_identifier(
      libfsapfs_file_entry_t *file_entry,
@@ -208,6 +243,13 @@ int libfsapfs_file_entry_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_entry_get_utf8_name_view(
+     libfsapfs_file_entry_t *file_entry,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_utf16_name_size(
      libfsapfs_file_entry_t *file_entry,
@@ -315,6 +357,12 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
      libfsapfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_entry_get_directory_cursor(
+     libfsapfs_file_entry_t *file_entry,
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
      libfsapfs_file_entry_t *file_entry,
@@ -354,6 +402,16 @@ ssize_t libfsapfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+ssize_t libfsapfs_file_entry_read_vector(
+         libfsapfs_file_entry_t *file_entry,
+         uint8_t **buffers,
+         size_t *buffer_sizes,
+         off64_t *offsets,
+         ssize_t *read_counts,
+         int number_of_ranges,
+         libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 off64_t libfsapfs_file_entry_seek_offset(
          libfsapfs_file_entry_t *file_entry,
@@ -31,6 +31,7 @@
 #include "libfsapfs_libfdatetime.h"
 #include "libfsapfs_libuna.h"
 
+#include "fsapfs_file_extent_tree.h"
 #include "fsapfs_file_system.h"
 
 /* Creates a file_extent
@@ -331,3 +332,103 @@ int libfsapfs_file_extent_read_value_data(
 	return( 1 );
 }
 
+/* Reads the file extent tree value data
+ * The file extent tree value, used by sealed volumes, does not contain an encryption identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_read_file_extent_tree_value_data(
+     libfsapfs_file_extent_t *file_extent,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_read_file_extent_tree_value_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit  = 0;
+#endif
+
+	if( file_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsapfs_file_extent_tree_value_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: file extent tree value data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_extent_tree_value_t *) data )->data_size_and_flags,
+	 file_extent->data_size );
+
+	file_extent->data_size &= 0x00ffffffffffffffUL;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_extent_tree_value_t *) data )->physical_block_number,
+	 file_extent->physical_block_number );
+
+	file_extent->encryption_identifier = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_extent_tree_value_t *) data )->data_size_and_flags,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: data size and flags\t\t: 0x%08" PRIx64 " (data size: %" PRIu64 ", flags: 0x%02" PRIx64 ")\n",
+		 function,
+		 value_64bit,
+		 file_extent->data_size,
+		 value_64bit >> 56 );
+
+		libcnotify_printf(
+		 "%s: physical block number\t\t: %" PRIu64 "\n",
+		 function,
+		 file_extent->physical_block_number );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
@@ -72,6 +72,12 @@ int libfsapfs_file_extent_read_value_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_file_extent_read_file_extent_tree_value_data(
+     libfsapfs_file_extent_t *file_extent,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1852 @@
+/*
+ * The file extent tree functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_usage.h"
+#include "libfsapfs_data_block.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_extent.h"
+#include "libfsapfs_file_extent_tree.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcdata.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libfcache.h"
+#include "libfsapfs_libfdata.h"
+
+#include "fsapfs_file_extent_tree.h"
+#include "fsapfs_object.h"
+
+/* Creates a file extent tree
+ * Make sure the value file_extent_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_initialize(
+     libfsapfs_file_extent_tree_t **file_extent_tree,
+     libfsapfs_io_handle_t *io_handle,
+     libfdata_vector_t *data_block_vector,
+     uint64_t root_node_block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_tree_initialize";
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_extent_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file extent tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_extent_tree = memory_allocate_structure(
+	                     libfsapfs_file_extent_tree_t );
+
+	if( *file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file extent tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_extent_tree,
+	     0,
+	     sizeof( libfsapfs_file_extent_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file extent tree.",
+		 function );
+
+		memory_free(
+		 *file_extent_tree );
+
+		*file_extent_tree = NULL;
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *file_extent_tree )->data_block_cache ),
+	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *file_extent_tree )->node_cache ),
+	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create node cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *file_extent_tree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *file_extent_tree )->io_handle              = io_handle;
+	( *file_extent_tree )->data_block_vector      = data_block_vector;
+	( *file_extent_tree )->root_node_block_number = root_node_block_number;
+
+	return( 1 );
+
+on_error:
+	if( *file_extent_tree != NULL )
+	{
+		memory_free(
+		 *file_extent_tree );
+
+		*file_extent_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file extent tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_free(
+     libfsapfs_file_extent_tree_t **file_extent_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_tree_free";
+	int result            = 1;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_extent_tree != NULL )
+	{
+		/* The data_block_vector is referenced and freed elsewhere
+		 */
+		if( libfcache_cache_free(
+		     &( ( *file_extent_tree )->node_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free node cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libfcache_cache_free(
+		     &( ( *file_extent_tree )->data_block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data block cache.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *file_extent_tree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *file_extent_tree );
+
+		*file_extent_tree = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the file extent tree root node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_root_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t root_node_block_number,
+     libfsapfs_btree_node_t **root_node,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	static char *function                = "libfsapfs_file_extent_tree_get_root_node";
+	int result                           = 0;
+
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp     = 0;
+#endif
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_node_block_number > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root node block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PROFILER )
+	if( file_extent_tree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_extent_tree->io_handle->profiler,
+		     &profiler_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	result = libfcache_cache_get_value_by_identifier(
+	          file_extent_tree->node_cache,
+	          0,
+	          (off64_t) root_node_block_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfdata_vector_get_element_value_by_index(
+		     file_extent_tree->data_block_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) file_extent_tree->data_block_cache,
+		     (int) root_node_block_number,
+		     (intptr_t **) &data_block,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %" PRIu64 ".",
+			 function,
+			 root_node_block_number );
+
+			goto on_error;
+		}
+		if( data_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid data block: %" PRIu64 ".",
+			 function,
+			 root_node_block_number );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_initialize(
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_read_data(
+		     node,
+		     data_block->data,
+		     data_block->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( node->object_type != 0x40000002UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object type: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_type );
+
+			goto on_error;
+		}
+		if( node->object_subtype != 0x0000001fUL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object subtype: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_subtype );
+
+			goto on_error;
+		}
+		if( ( ( node->node_header->flags & 0x0001 ) == 0 )
+		 || ( ( node->node_header->flags & 0x0004 ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported flags: 0x%04" PRIx16 ".",
+			 function,
+			 node->node_header->flags );
+
+			goto on_error;
+		}
+		if( node->footer->node_size != 4096 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( node->footer->key_size != sizeof( fsapfs_file_extent_tree_key_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( node->footer->value_size != sizeof( fsapfs_file_extent_tree_value_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     file_extent_tree->node_cache,
+		     0,
+		     (off64_t) root_node_block_number,
+		     0,
+		     (intptr_t *) node,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value in cache.",
+			 function );
+
+			goto on_error;
+		}
+		node = NULL;
+
+		if( libfcache_cache_get_value_by_identifier(
+		     file_extent_tree->node_cache,
+		     0,
+		     (off64_t) root_node_block_number,
+		     0,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_PROFILER )
+	if( file_extent_tree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     file_extent_tree->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     root_node_block_number * file_extent_tree->io_handle->block_size,
+		     file_extent_tree->io_handle->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a file extent tree sub node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_sub_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t sub_node_block_number,
+     libfsapfs_btree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	static char *function                = "libfsapfs_file_extent_tree_get_sub_node";
+	int result                           = 0;
+
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp     = 0;
+#endif
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node_block_number > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PROFILER )
+	if( file_extent_tree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_extent_tree->io_handle->profiler,
+		     &profiler_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	result = libfcache_cache_get_value_by_identifier(
+	          file_extent_tree->node_cache,
+	          0,
+	          (off64_t) sub_node_block_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfdata_vector_get_element_value_by_index(
+		     file_extent_tree->data_block_vector,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) file_extent_tree->data_block_cache,
+		     (int) sub_node_block_number,
+		     (intptr_t **) &data_block,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data block: %" PRIu64 ".",
+			 function,
+			 sub_node_block_number );
+
+			goto on_error;
+		}
+		if( data_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid data block: %" PRIu64 ".",
+			 function,
+			 sub_node_block_number );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_initialize(
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_read_data(
+		     node,
+		     data_block->data,
+		     data_block->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( node->object_type != 0x40000003UL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object type: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_type );
+
+			goto on_error;
+		}
+		if( node->object_subtype != 0x0000001fUL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object subtype: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_subtype );
+
+			goto on_error;
+		}
+		if( ( ( node->node_header->flags & 0x0001 ) != 0 )
+		 || ( ( node->node_header->flags & 0x0004 ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported flags: 0x%04" PRIx16 ".",
+			 function,
+			 node->node_header->flags );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     file_extent_tree->node_cache,
+		     0,
+		     (off64_t) sub_node_block_number,
+		     0,
+		     (intptr_t *) node,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value in cache.",
+			 function );
+
+			goto on_error;
+		}
+		node = NULL;
+
+		if( libfcache_cache_get_value_by_identifier(
+		     file_extent_tree->node_cache,
+		     0,
+		     (off64_t) sub_node_block_number,
+		     0,
+		     &cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_PROFILER )
+	if( file_extent_tree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     file_extent_tree->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     sub_node_block_number * file_extent_tree->io_handle->block_size,
+		     file_extent_tree->io_handle->block_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	if( libfcache_cache_value_get_value(
+	     cache_value,
+	     (intptr_t **) sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the key values from a file extent tree entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_key_from_entry(
+     libfsapfs_btree_entry_t *entry,
+     uint64_t *identifier,
+     uint64_t *logical_address,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_tree_get_key_from_entry";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree entry - missing key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->key_data_size < sizeof( fsapfs_file_extent_tree_key_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid B-tree entry - key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical address.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_extent_tree_key_t *) entry->key_data )->file_system_identifier,
+	 *identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_extent_tree_key_t *) entry->key_data )->logical_address,
+	 *logical_address );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the first entry with an identifier greater than or equal
+ * to the identifier from a file extent tree node
+ * The entries of a node are sorted by identifier and logical address hence
+ * a binary search is used. The entry index is set to the number of entries
+ * if all entries have a smaller identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_first_entry_index_from_node_by_identifier(
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *entry = NULL;
+	static char *function          = "libfsapfs_file_extent_tree_get_first_entry_index_from_node_by_identifier";
+	uint64_t entry_identifier      = 0;
+	uint64_t logical_address       = 0;
+	int lower_entry_index          = 0;
+	int middle_entry_index         = 0;
+	int number_of_entries          = 0;
+	int upper_entry_index          = 0;
+
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	lower_entry_index = 0;
+	upper_entry_index = number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     middle_entry_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( libfsapfs_file_extent_tree_get_key_from_entry(
+		     entry,
+		     &entry_identifier,
+		     &logical_address,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key from B-tree entry: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( entry_identifier < identifier )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+		}
+	}
+	*entry_index = lower_entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves file extents for a specific identifier from the file extent tree leaf node
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_file_extents_from_leaf_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *entry       = NULL;
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_file_extent_tree_get_file_extents_from_leaf_node";
+	uint64_t entry_identifier            = 0;
+	uint64_t logical_address             = 0;
+	int array_entry_index                = 0;
+	int entry_index                      = 0;
+	int found_file_extent                = 0;
+	int is_leaf_node                     = 0;
+	int number_of_entries                = 0;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_leaf_node == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_file_extent_tree_get_first_entry_index_from_node_by_identifier(
+	     node,
+	     identifier,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first entry index of: %" PRIu64 " from B-tree node.",
+		 function,
+		 identifier );
+
+		goto on_error;
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_extent_tree_get_key_from_entry(
+		     entry,
+		     &entry_identifier,
+		     &logical_address,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key from B-tree entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", logical address: 0x%08" PRIx64 "\n",
+			 function,
+			 entry_index,
+			 entry_identifier,
+			 logical_address );
+		}
+#endif
+		if( entry_identifier != identifier )
+		{
+			break;
+		}
+		if( libfsapfs_file_extent_initialize(
+		     &file_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file extent.",
+			 function );
+
+			goto on_error;
+		}
+		/* The file extent tree key has the same layout as the file system B-tree file extent key
+		 */
+		if( libfsapfs_file_extent_read_key_data(
+		     file_extent,
+		     entry->key_data,
+		     (size_t) entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file extent key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_extent_read_file_extent_tree_value_data(
+		     file_extent,
+		     entry->value_data,
+		     (size_t) entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file extent value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     file_extents,
+		     &array_entry_index,
+		     (intptr_t *) file_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file extent to array.",
+			 function );
+
+			goto on_error;
+		}
+		file_extent = NULL;
+
+		found_file_extent = 1;
+
+		entry_index++;
+	}
+	return( found_file_extent );
+
+on_error:
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 file_extents,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves file extents for a specific identifier from the file extent tree branch node
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_file_extents_from_branch_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *entry   = NULL;
+	libfsapfs_btree_node_t *sub_node = NULL;
+	static char *function            = "libfsapfs_file_extent_tree_get_file_extents_from_branch_node";
+	uint64_t entry_identifier        = 0;
+	uint64_t logical_address         = 0;
+	uint64_t sub_node_block_number   = 0;
+	int entry_index                  = 0;
+	int found_file_extent            = 0;
+	int is_leaf_node                 = 0;
+	int number_of_entries            = 0;
+	int result                       = 0;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	else if( is_leaf_node != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a branch node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_file_extent_tree_get_first_entry_index_from_node_by_identifier(
+	     node,
+	     identifier,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first entry index of: %" PRIu64 " from B-tree node.",
+		 function,
+		 identifier );
+
+		goto on_error;
+	}
+	/* The first file extent of the identifier is stored in the sub node of
+	 * the preceding entry, unless the entry starts at logical address 0
+	 */
+	if( entry_index > 0 )
+	{
+		if( entry_index < number_of_entries )
+		{
+			if( libfsapfs_btree_node_get_entry_by_index(
+			     node,
+			     entry_index,
+			     &entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( libfsapfs_file_extent_tree_get_key_from_entry(
+			     entry,
+			     &entry_identifier,
+			     &logical_address,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key from B-tree entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( ( entry_index >= number_of_entries )
+		 || ( entry_identifier != identifier )
+		 || ( logical_address != 0 ) )
+		{
+			entry_index--;
+		}
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_extent_tree_get_key_from_entry(
+		     entry,
+		     &entry_identifier,
+		     &logical_address,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key from B-tree entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", logical address: 0x%08" PRIx64 "\n",
+			 function,
+			 entry_index,
+			 entry_identifier,
+			 logical_address );
+		}
+#endif
+		if( entry_identifier > identifier )
+		{
+			break;
+		}
+		if( entry->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d - missing value data.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( entry->value_data_size < 8 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - value data size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 entry->value_data,
+		 sub_node_block_number );
+
+		if( libfsapfs_file_extent_tree_get_sub_node(
+		     file_extent_tree,
+		     file_io_handle,
+		     sub_node_block_number,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
+			 function,
+			 sub_node_block_number );
+
+			goto on_error;
+		}
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                sub_node,
+		                error );
+
+		if( is_leaf_node == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree sub node is a leaf node.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_leaf_node != 0 )
+		{
+			result = libfsapfs_file_extent_tree_get_file_extents_from_leaf_node(
+			          file_extent_tree,
+			          sub_node,
+			          identifier,
+			          file_extents,
+			          error );
+		}
+		else
+		{
+			result = libfsapfs_file_extent_tree_get_file_extents_from_branch_node(
+			          file_extent_tree,
+			          file_io_handle,
+			          sub_node,
+			          identifier,
+			          file_extents,
+			          recursion_depth + 1,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extents: %" PRIu64 " from file extent tree sub node.",
+			 function,
+			 identifier );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			found_file_extent = 1;
+		}
+		sub_node = NULL;
+
+		entry_index++;
+	}
+	return( found_file_extent );
+
+on_error:
+	libcdata_array_empty(
+	 file_extents,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves file extents for a specific identifier from the file extent tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_file_extents(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *root_node = NULL;
+	static char *function             = "libfsapfs_file_extent_tree_get_file_extents";
+	int is_leaf_node                  = 0;
+	int result                        = 0;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 function,
+		 identifier );
+	}
+#endif
+	if( libfsapfs_file_extent_tree_get_root_node(
+	     file_extent_tree,
+	     file_io_handle,
+	     file_extent_tree->root_node_block_number,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                root_node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_leaf_node != 0 )
+	{
+		result = libfsapfs_file_extent_tree_get_file_extents_from_leaf_node(
+		          file_extent_tree,
+		          root_node,
+		          identifier,
+		          file_extents,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_file_extent_tree_get_file_extents_from_branch_node(
+		          file_extent_tree,
+		          file_io_handle,
+		          root_node,
+		          identifier,
+		          file_extents,
+		          0,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file extents: %" PRIu64 " from file extent tree root node.",
+		 function,
+		 identifier );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 file_extent_tree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the amount of memory used by the caches of the file extent tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_get_memory_usage(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_tree_get_memory_usage";
+	int result            = 1;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_cache_usage_get_node_cache_memory_usage(
+	     file_extent_tree->node_cache,
+	     node_cache_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          file_extent_tree->data_block_cache,
+	          data_block_cache_memory_usage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Trims the caches of the file extent tree for a specific trim level
+ * Values are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_extent_tree_trim_caches(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_extent_tree_trim_caches";
+	int result            = 1;
+
+	if( file_extent_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( trim_level == LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS )
+	{
+		result = libfsapfs_cache_usage_trim_data_block_cache(
+		          file_extent_tree->data_block_cache,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_cache_usage_trim_node_cache(
+		          file_extent_tree->node_cache,
+		          trim_level,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to trim caches.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_extent_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
@@ -0,0 +1,151 @@
+/*
+ * The file extent tree functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_FILE_EXTENT_TREE_H )
+#define _LIBFSAPFS_FILE_EXTENT_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcdata.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libfcache.h"
+#include "libfsapfs_libfdata.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_file_extent_tree libfsapfs_file_extent_tree_t;
+
+struct libfsapfs_file_extent_tree
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* Data block vector
+	 */
+	libfdata_vector_t *data_block_vector;
+
+	/* Data block cache
+	 */
+	libfcache_cache_t *data_block_cache;
+
+	/* The node cache
+	 */
+	libfcache_cache_t *node_cache;
+
+	/* Block number of B-tree root node
+	 */
+	uint64_t root_node_block_number;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_file_extent_tree_initialize(
+     libfsapfs_file_extent_tree_t **file_extent_tree,
+     libfsapfs_io_handle_t *io_handle,
+     libfdata_vector_t *data_block_vector,
+     uint64_t root_node_block_number,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_free(
+     libfsapfs_file_extent_tree_t **file_extent_tree,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_root_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t root_node_block_number,
+     libfsapfs_btree_node_t **root_node,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_sub_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t sub_node_block_number,
+     libfsapfs_btree_node_t **sub_node,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_key_from_entry(
+     libfsapfs_btree_entry_t *entry,
+     uint64_t *identifier,
+     uint64_t *logical_address,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_first_entry_index_from_node_by_identifier(
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_file_extents_from_leaf_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_file_extents_from_branch_node(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_file_extents(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_get_memory_usage(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_file_extent_tree_trim_caches(
+     libfsapfs_file_extent_tree_t *file_extent_tree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_FILE_EXTENT_TREE_H ) */
+
@@ -0,0 +1,436 @@
+/*
+ * File reference functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_reference.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_libcerror.h"
+
+#include "fsapfs_file_reference.h"
+
+/* Sets a file reference from an inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_set_from_inode(
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t transaction_identifier,
+     libfsapfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_set_from_inode";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     file_reference,
+	     0,
+	     (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file reference.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->transaction_identifier,
+	 transaction_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->identifier,
+	 inode->identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->parent_identifier,
+	 inode->parent_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->data_stream_size,
+	 inode->data_stream_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->modification_time,
+	 inode->modification_time );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->file_mode,
+	 inode->file_mode );
+
+	return( 1 );
+}
+
+/* Retrieves the volume transaction identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_transaction_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_transaction_identifier";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( transaction_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume transaction identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->transaction_identifier,
+	 *transaction_identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_identifier";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->identifier,
+	 *identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the parent identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_parent_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *parent_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_parent_identifier";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent identifier.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->parent_identifier,
+	 *parent_identifier );
+
+	return( 1 );
+}
+
+/* Retrieves the data stream size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_data_stream_size(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *data_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_data_stream_size";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream size.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->data_stream_size,
+	 *data_stream_size );
+
+	return( 1 );
+}
+
+/* Retrieves the modification date and time
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_modification_time(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_modification_time";
+	uint64_t value_64bit  = 0;
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( posix_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid POSIX time.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->modification_time,
+	 value_64bit );
+
+	*posix_time = (int64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the file mode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_reference_get_file_mode(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint16_t *file_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_reference_get_file_mode";
+
+	if( file_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_reference_size < (size_t) LIBFSAPFS_FILE_REFERENCE_SIZE )
+	 || ( file_reference_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file reference size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mode.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_file_reference_t *) file_reference )->file_mode,
+	 *file_mode );
+
+	return( 1 );
+}
+
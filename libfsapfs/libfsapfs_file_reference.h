@@ -0,0 +1,90 @@
+/*
+ * File reference functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_FILE_REFERENCE_H )
+#define _LIBFSAPFS_FILE_REFERENCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_extern.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libfsapfs_file_reference_set_from_inode(
+     uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t transaction_identifier,
+     libfsapfs_inode_t *inode,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_transaction_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_parent_identifier(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *parent_identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_data_stream_size(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint64_t *data_stream_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_modification_time(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_reference_get_file_mode(
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     uint16_t *file_mode,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_FILE_REFERENCE_H ) */
+
@@ -26,6 +26,7 @@
 
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_usage.h"
 #include "libfsapfs_data_block.h"
 #include "libfsapfs_debug.h"
 #include "libfsapfs_definitions.h"
@@ -33,6 +34,7 @@
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_extended_attribute.h"
 #include "libfsapfs_file_extent.h"
+#include "libfsapfs_file_extent_tree.h"
 #include "libfsapfs_file_system_btree.h"
 #include "libfsapfs_inode.h"
 #include "libfsapfs_io_handle.h"
@@ -40,6 +42,7 @@
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_libuna.h"
@@ -60,6 +63,7 @@ int libfsapfs_file_system_btree_initialize(
      libfsapfs_encryption_context_t *encryption_context,
      libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
+     libfsapfs_file_extent_tree_t *file_extent_tree,
      uint64_t root_node_block_number,
      uint8_t use_case_folding,
      libcerror_error_t **error )
@@ -122,37 +126,66 @@ int libfsapfs_file_system_btree_initialize(
 		return( -1 );
 	}
 	if( libfcache_cache_initialize(
-	     &( ( *file_system_btree )->data_block_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	     &( ( *file_system_btree )->node_cache ),
+	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block cache.",
+		 "%s: unable to create node cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *file_system_btree )->node_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
+	if( libcdata_array_initialize(
+	     &( ( *file_system_btree )->pending_nodes_array ),
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create node cache.",
+		 "%s: unable to create pending nodes array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *file_system_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *file_system_btree )->node_cache_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize node cache read/write lock.",
 		 function );
 
 		goto on_error;
 	}
+#endif
 	( *file_system_btree )->io_handle              = io_handle;
 	( *file_system_btree )->encryption_context     = encryption_context;
 	( *file_system_btree )->data_block_vector      = data_block_vector;
 	( *file_system_btree )->object_map_btree       = object_map_btree;
+	( *file_system_btree )->file_extent_tree       = file_extent_tree;
 	( *file_system_btree )->root_node_block_number = root_node_block_number;
 	( *file_system_btree )->use_case_folding       = use_case_folding;
 
@@ -161,6 +194,27 @@ int libfsapfs_file_system_btree_initialize(
 on_error:
 	if( *file_system_btree != NULL )
 	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *file_system_btree )->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *file_system_btree )->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( ( *file_system_btree )->pending_nodes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *file_system_btree )->pending_nodes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *file_system_btree )->node_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *file_system_btree )->node_cache ),
+			 NULL );
+		}
 		memory_free(
 		 *file_system_btree );
 
@@ -207,19 +261,48 @@ int libfsapfs_file_system_btree_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( ( *file_system_btree )->data_block_cache ),
+		if( libcdata_array_free(
+		     &( ( *file_system_btree )->pending_nodes_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_system_btree_pending_node_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pending nodes array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *file_system_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_read_write_lock_free(
+		     &( ( *file_system_btree )->node_cache_read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data block cache.",
+			 "%s: unable to free node cache read/write lock.",
 			 function );
 
 			result = -1;
 		}
+#endif
 		memory_free(
 		 *file_system_btree );
 
@@ -228,6 +311,79 @@ int libfsapfs_file_system_btree_free(
 	return( result );
 }
 
+/* Frees a pending node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_pending_node_free(
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *node = NULL;
+	static char *function        = "libfsapfs_file_system_btree_pending_node_free";
+	int result                   = 1;
+
+	if( cache_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_value != NULL )
+	{
+		/* The pending node is not managed by the cache value
+		 */
+		if( libfcache_cache_value_get_value(
+		     *cache_value,
+		     (intptr_t **) &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pending node.",
+			 function );
+
+			result = -1;
+		}
+		else if( node != NULL )
+		{
+			if( libfsapfs_btree_node_free(
+			     &node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free pending node.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libfcache_cache_value_free(
+		     cache_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache value.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
 /* Retrieves the sub node block number from a B-tree entry
  * Returns 1 if successful, 0 if not found or -1 on error
  */
@@ -276,7 +432,11 @@ int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 
 		return( -1 );
 	}
-	if( entry->value_data_size != 8 )
+	/* The branch node value of a hashed B-tree, used by sealed volumes,
+	 * contains the child object identifier followed by a 64-byte hash
+	 */
+	if( ( entry->value_data_size != 8 )
+	 && ( entry->value_data_size != ( 8 + 64 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -380,26 +540,31 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the file system B-tree root node
+/* Retrieves a file system B-tree node from the node cache or reads it
+ * A node that is read is added to the pending nodes instead of the node cache,
+ * since adding it to the node cache could free a node that is still used by
+ * a concurrent lookup. The pending nodes are added to the node cache by
+ * libfsapfs_file_system_btree_flush_pending_nodes
+ * The node is owned by the file system B-tree and the caller must hold the B-tree lock
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_system_btree_get_root_node(
+int libfsapfs_file_system_btree_get_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     uint64_t root_node_block_number,
-     libfsapfs_btree_node_t **root_node,
+     uint64_t node_block_number,
+     libfsapfs_btree_node_t **node,
      libcerror_error_t **error )
 {
 	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_root_node";
+	libfsapfs_btree_node_t *safe_node    = NULL;
+	static char *function                = "libfsapfs_file_system_btree_get_node";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_value_file_index           = 0;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
 	int result                           = 0;
 
-#if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
-#endif
-
 	if( file_system_btree == NULL )
 	{
 		libcerror_error_set(
@@ -411,63 +576,36 @@ int libfsapfs_file_system_btree_get_root_node(
 
 		return( -1 );
 	}
-	if( file_system_btree->io_handle == NULL )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file system B-tree entry - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( root_node_block_number > (uint64_t) INT_MAX )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system_btree->node_cache_read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid root node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( root_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid root node.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab node cache read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_start_timing(
-		     file_system_btree->io_handle->profiler,
-		     &profiler_start_timestamp,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to start timing.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#endif /* defined( HAVE_PROFILER ) */
-
+#endif
 	result = libfcache_cache_get_value_by_identifier(
 	          file_system_btree->node_cache,
 	          0,
-	          (off64_t) root_node_block_number,
+	          (off64_t) node_block_number,
 	          0,
 	          &cache_value,
 	          error );
@@ -485,140 +623,411 @@ int libfsapfs_file_system_btree_get_root_node(
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     file_system_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) file_system_btree->data_block_cache,
-		     (int) root_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
+		if( libcdata_array_get_number_of_entries(
+		     file_system_btree->pending_nodes_array,
+		     &number_of_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
+			 "%s: unable to retrieve number of pending nodes.",
+			 function );
 
 			goto on_error;
 		}
-		if( data_block == NULL )
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
+			if( libcdata_array_get_entry_by_index(
+			     file_system_btree->pending_nodes_array,
+			     entry_index,
+			     (intptr_t **) &cache_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve pending node: %d.",
+				 function,
+				 entry_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libfcache_cache_value_get_identifier(
+			     cache_value,
+			     &cache_value_file_index,
+			     &cache_value_offset,
+			     &cache_value_timestamp,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve pending node: %d identifier.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			if( cache_value_offset == (off64_t) node_block_number )
+			{
+				result = 1;
+
+				break;
+			}
 		}
-		if( libfsapfs_btree_node_initialize(
-		     &node,
+	}
+	if( result != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create B-tree node.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
-		     node,
-		     data_block->data,
-		     data_block->data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read B-tree node.",
-			 function );
+	}
+	cache_value = NULL;
 
-			goto on_error;
-		}
-		if( ( node->object_type != 0x00000002UL )
-		 && ( node->object_type != 0x10000002UL ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid object type: 0x%08" PRIx32 ".",
-			 function,
-			 node->object_type );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system_btree->node_cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release node cache read/write lock for writing.",
+		 function );
 
-			goto on_error;
-		}
-		if( node->object_subtype != 0x0000000eUL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid object subtype: 0x%08" PRIx32 ".",
-			 function,
-			 node->object_subtype );
+		return( -1 );
+	}
+#endif
+	if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* The node is read without holding the node cache lock
+	 */
+	if( libfsapfs_file_system_btree_read_node(
+	     file_system_btree,
+	     file_io_handle,
+	     node_block_number,
+	     &safe_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read node: %" PRIu64 ".",
+		 function,
+		 node_block_number );
 
-			goto on_error;
-		}
-		if( ( ( node->node_header->flags & 0x0001 ) == 0 )
-		 || ( ( node->node_header->flags & 0x0004 ) != 0 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported flags: 0x%04" PRIx16 ".",
-			 function,
-			 ( *root_node )->node_header->flags );
+		return( -1 );
+	}
+	if( libfcache_cache_value_initialize(
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache value.",
+		 function );
 
-			goto on_error;
-		}
-		if( node->footer->node_size != 4096 )
+		libfsapfs_btree_node_free(
+		 &safe_node,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libfcache_cache_value_set_identifier(
+	     cache_value,
+	     0,
+	     (off64_t) node_block_number,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value identifier.",
+		 function );
+
+		goto on_read_error;
+	}
+	if( libfcache_cache_value_set_value(
+	     cache_value,
+	     (intptr_t *) safe_node,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_NONE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cache value.",
+		 function );
+
+		goto on_read_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system_btree->node_cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab node cache read/write lock for writing.",
+		 function );
+
+		goto on_read_error;
+	}
+#endif
+	if( libcdata_array_append_entry(
+	     file_system_btree->pending_nodes_array,
+	     &entry_index,
+	     (intptr_t *) cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append pending node.",
+		 function );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_write(
+		 file_system_btree->node_cache_read_write_lock,
+		 NULL );
+#endif
+		goto on_read_error;
+	}
+	/* The node is now owned by the pending nodes array
+	 */
+	*node = safe_node;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system_btree->node_cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release node cache read/write lock for writing.",
+		 function );
+
+		*node = NULL;
+
+		return( -1 );
+	}
+#endif
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 file_system_btree->node_cache_read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+
+on_read_error:
+	if( cache_value != NULL )
+	{
+		libfcache_cache_value_free(
+		 &cache_value,
+		 NULL );
+	}
+	libfsapfs_btree_node_free(
+	 &safe_node,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Adds the pending nodes to the node cache
+ * The B-tree is locked for writing so that no lookup uses nodes that are freed by the node cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_flush_pending_nodes(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_file_system_btree_flush_pending_nodes";
+	off64_t cache_value_offset           = 0;
+	int64_t cache_value_timestamp        = 0;
+	int cache_value_file_index           = 0;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
+	int result                           = 1;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->node_cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab node cache read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_array_get_number_of_entries(
+	          file_system_btree->pending_nodes_array,
+	          &number_of_entries,
+	          error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->node_cache_read_write_lock,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pending nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another lookup could have flushed the pending nodes in the meantime
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     file_system_btree->pending_nodes_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pending nodes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system_btree->pending_nodes_array,
+		     entry_index,
+		     (intptr_t **) &cache_value,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid node size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pending node: %d.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		if( node->footer->key_size != 0 )
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid key size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pending node: %d identifier.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		if( node->footer->value_size != 0 )
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) &node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid value size value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve pending node: %d.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
 		if( libfcache_cache_set_value_by_identifier(
 		     file_system_btree->node_cache,
 		     0,
-		     (off64_t) root_node_block_number,
+		     cache_value_offset,
 		     0,
 		     (intptr_t *) node,
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
@@ -634,93 +1043,92 @@ int libfsapfs_file_system_btree_get_root_node(
 
 			goto on_error;
 		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     &cache_value,
+		/* The node is now managed by the node cache
+		 */
+		if( libcdata_array_set_entry_by_index(
+		     file_system_btree->pending_nodes_array,
+		     entry_index,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set pending node: %d.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_stop_timing(
-		     file_system_btree->io_handle->profiler,
-		     profiler_start_timestamp,
-		     function,
-		     root_node_block_number * file_system_btree->io_handle->block_size,
-		     file_system_btree->io_handle->block_size,
+		if( libfcache_cache_value_free(
+		     &cache_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to stop timing.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache value.",
 			 function );
 
 			goto on_error;
 		}
 	}
-#endif /* defined( HAVE_PROFILER ) */
-
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) root_node,
+	if( libcdata_array_empty(
+	     file_system_btree->pending_nodes_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_system_btree_pending_node_free,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root node.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty pending nodes array.",
 		 function );
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
-	if( node != NULL )
-	{
-		libfsapfs_btree_node_free(
-		 &node,
-		 NULL );
-	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves a file system B-tree sub node
+/* Retrieves the file system B-tree root node
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_system_btree_get_sub_node(
+int libfsapfs_file_system_btree_get_root_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     uint64_t sub_node_block_number,
-     libfsapfs_btree_node_t **sub_node,
+     uint64_t root_node_block_number,
+     libfsapfs_btree_node_t **root_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_sub_node";
-	int result                           = 0;
+	static char *function            = "libfsapfs_file_system_btree_get_root_node";
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -745,24 +1153,24 @@ int libfsapfs_file_system_btree_get_sub_node(
 
 		return( -1 );
 	}
-	if( sub_node_block_number > (uint64_t) INT_MAX )
+	if( root_node_block_number > (uint64_t) INT_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sub node block number value out of bounds.",
+		 "%s: invalid root node block number value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( sub_node == NULL )
+	if( root_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sub node.",
+		 "%s: invalid root node.",
 		 function );
 
 		return( -1 );
@@ -782,167 +1190,150 @@ int libfsapfs_file_system_btree_get_sub_node(
 			 "%s: unable to start timing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
-	          file_system_btree->node_cache,
-	          0,
-	          (off64_t) sub_node_block_number,
-	          0,
-	          &cache_value,
-	          error );
-
-	if( result == -1 )
+	if( libfsapfs_file_system_btree_get_node(
+	     file_system_btree,
+	     file_io_handle,
+	     root_node_block_number,
+	     root_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
-		 function );
+		 "%s: unable to retrieve root node: %" PRIu64 ".",
+		 function,
+		 root_node_block_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result == 0 )
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     file_system_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) file_system_btree->data_block_cache,
-		     (int) sub_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
+		if( libfsapfs_profiler_stop_timing(
+		     file_system_btree->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     root_node_block_number * file_system_btree->io_handle->block_size,
+		     file_system_btree->io_handle->block_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
+	}
+#endif /* defined( HAVE_PROFILER ) */
 
-			goto on_error;
-		}
-		if( libfsapfs_btree_node_initialize(
-		     &node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create B-tree node.",
-			 function );
+	return( 1 );
+}
 
-			goto on_error;
-		}
-		if( libfsapfs_btree_node_read_data(
-		     node,
-		     data_block->data,
-		     data_block->data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read B-tree node.",
-			 function );
+/* Retrieves a file system B-tree sub node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_get_sub_node(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t sub_node_block_number,
+     libfsapfs_btree_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsapfs_file_system_btree_get_sub_node";
 
-			goto on_error;
-		}
-		if( ( node->object_type != 0x00000003UL )
-		 && ( node->object_type != 0x10000003UL ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid object type: 0x%08" PRIx32 ".",
-			 function,
-			 node->object_type );
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp = 0;
+#endif
 
-			goto on_error;
-		}
-		if( node->object_subtype != 0x0000000eUL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid object subtype: 0x%08" PRIx32 ".",
-			 function,
-			 node->object_subtype );
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
 
-			goto on_error;
-		}
-		if( ( ( node->node_header->flags & 0x0001 ) != 0 )
-		 || ( ( node->node_header->flags & 0x0004 ) != 0 ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported flags: 0x%04" PRIx16 ".",
-			 function,
-			 node->node_header->flags );
+		return( -1 );
+	}
+	if( file_system_btree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system B-tree entry - missing IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfcache_cache_set_value_by_identifier(
-		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		return( -1 );
+	}
+	if( sub_node_block_number > (uint64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sub node block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_system_btree->io_handle->profiler,
+		     &profiler_start_timestamp,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
+			 "%s: unable to start timing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		node = NULL;
+	}
+#endif /* defined( HAVE_PROFILER ) */
 
-		if( libfcache_cache_get_value_by_identifier(
-		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
-			 function );
+	if( libfsapfs_file_system_btree_get_node(
+	     file_system_btree,
+	     file_io_handle,
+	     sub_node_block_number,
+	     sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub node: %" PRIu64 ".",
+		 function,
+		 sub_node_block_number );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
@@ -962,57 +1353,31 @@ int libfsapfs_file_system_btree_get_sub_node(
 			 "%s: unable to stop timing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) sub_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
-
-on_error:
-	if( node != NULL )
-	{
-		libfsapfs_btree_node_free(
-		 &node,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Retrieves an entry for a specific identifier from the file system B-tree node
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Reads a file system B-tree node without using the data block or node cache
+ * The node is owned by the caller and, since no shared cache is accessed, the node
+ * can be read and used concurrently without holding the B-tree lock
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
+int libfsapfs_file_system_btree_read_node(
      libfsapfs_file_system_btree_t *file_system_btree,
-     libfsapfs_btree_node_t *node,
-     uint64_t identifier,
-     uint8_t data_type,
-     libfsapfs_btree_entry_t **btree_entry,
+     libbfio_handle_t *file_io_handle,
+     uint64_t node_block_number,
+     libfsapfs_btree_node_t **node,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry          = NULL;
-	libfsapfs_btree_entry_t *previous_entry = NULL;
-	static char *function                   = "libfsapfs_file_system_btree_get_entry_from_node_by_identifier";
-	uint64_t file_system_identifier         = 0;
-	uint64_t lookup_identifier              = 0;
-	uint8_t file_system_data_type           = 0;
-	int btree_entry_index                   = 0;
-	int is_leaf_node                        = 0;
-	int number_of_entries                   = 0;
+	libfsapfs_btree_node_t *safe_node  = NULL;
+	libfsapfs_data_block_t *data_block = NULL;
+	static char *function              = "libfsapfs_file_system_btree_read_node";
+	uint8_t is_root_node               = 0;
+	int result                         = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -1025,378 +1390,492 @@ int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( file_system_btree->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system B-tree - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( btree_entry == NULL )
+	if( ( file_system_btree->io_handle->block_size == 0 )
+	 || ( (size_t) file_system_btree->io_handle->block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file system B-tree - block size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( node_block_number > ( (uint64_t) INT64_MAX / file_system_btree->io_handle->block_size ) )
 	{
-		libcnotify_printf(
-		 "%s: retrieving B-tree entry identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-		 function,
-		 identifier,
-		 data_type,
-		 libfsapfs_debug_print_file_system_data_type(
-		  data_type ) );
-	}
-#endif
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                node,
-	                error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node block number value out of bounds.",
+		 function );
 
-	if( is_leaf_node == -1 )
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a leaf node.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsapfs_btree_node_get_number_of_entries(
-	     node,
-	     &number_of_entries,
+	is_root_node = (uint8_t) ( node_block_number == file_system_btree->root_node_block_number );
+
+	/* The data is retrieved from and returned to the block buffer pool
+	 * of the IO handle so that repeated node reads reuse the same buffers
+	 */
+	if( libfsapfs_data_block_initialize_from_pool(
+	     &data_block,
+	     file_system_btree->io_handle->block_buffer_pool,
+	     (size_t) file_system_btree->io_handle->block_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from B-tree node.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) data_type << 60 ) | identifier;
+	/* The file system data block vector maps block numbers directly onto the container
+	 * where the block number is also used as the encryption identifier
+	 */
+	if( libfsapfs_data_block_read(
+	     data_block,
+	     file_system_btree->io_handle,
+	     file_system_btree->encryption_context,
+	     file_io_handle,
+	     (off64_t) ( node_block_number * file_system_btree->io_handle->block_size ),
+	     node_block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block: %" PRIu64 ".",
+		 function,
+		 node_block_number );
 
-	for( btree_entry_index = 0;
-	     btree_entry_index < number_of_entries;
-	     btree_entry_index++ )
+		goto on_error;
+	}
+	if( libfsapfs_btree_node_initialize(
+	     &safe_node,
+	     error ) != 1 )
 	{
-		if( libfsapfs_btree_node_get_entry_by_index(
-		     node,
-		     btree_entry_index,
-		     &entry,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	/* The B-tree node entries contain a copy of the key and value data
+	 * hence the data block is no longer needed after reading
+	 */
+	if( libfsapfs_btree_node_read_data(
+	     safe_node,
+	     data_block->data,
+	     data_block->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_data_block_free(
+	     &data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data block.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_root_node != 0 )
+	{
+		if( ( safe_node->object_type != 0x00000002UL )
+		 && ( safe_node->object_type != 0x10000002UL ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object type: 0x%08" PRIx32 ".",
+			 function,
+			 safe_node->object_type );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry == NULL )
+	}
+	else
+	{
+		if( ( safe_node->object_type != 0x00000003UL )
+		 && ( safe_node->object_type != 0x10000003UL ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object type: 0x%08" PRIx32 ".",
 			 function,
-			 btree_entry_index );
+			 safe_node->object_type );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry->key_data == NULL )
+	}
+	if( safe_node->object_subtype != 0x0000000eUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid object subtype: 0x%08" PRIx32 ".",
+		 function,
+		 safe_node->object_subtype );
+
+		goto on_error;
+	}
+	/* Only the root node has the root flag set
+	 */
+	if( is_root_node != 0 )
+	{
+		result = (int) ( ( safe_node->node_header->flags & 0x0001 ) == 0 );
+	}
+	else
+	{
+		result = (int) ( ( safe_node->node_header->flags & 0x0001 ) != 0 );
+	}
+	if( ( result != 0 )
+	 || ( ( safe_node->node_header->flags & 0x0004 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%04" PRIx16 ".",
+		 function,
+		 safe_node->node_header->flags );
+
+		goto on_error;
+	}
+	if( is_root_node != 0 )
+	{
+		if( safe_node->footer->node_size != 4096 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
-			 function,
-			 btree_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node size value out of bounds.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry->key_data_size < 8 )
+		if( safe_node->footer->key_size != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 btree_entry_index );
-
-			return( -1 );
-		}
-		byte_stream_copy_to_uint64_little_endian(
-		 entry->key_data,
-		 file_system_identifier );
-
-		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+			 "%s: invalid key size value out of bounds.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 btree_entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
+			goto on_error;
 		}
-#endif
-		if( is_leaf_node != 0 )
+		if( safe_node->footer->value_size != 0 )
 		{
-			if( file_system_identifier == lookup_identifier )
-			{
-				*btree_entry = entry;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value size value out of bounds.",
+			 function );
 
-				return( 1 );
-			}
+			goto on_error;
 		}
-		else
-		{
-			file_system_identifier &= 0x0fffffffffffffffUL;
+	}
+	*node = safe_node;
 
-			if( file_system_identifier >= identifier )
-			{
-				if( ( previous_entry == NULL )
-				 || ( ( file_system_identifier == identifier )
-				  &&  ( file_system_data_type <= data_type ) ) )
-				{
-					previous_entry = entry;
-				}
-				*btree_entry = previous_entry;
+	return( 1 );
 
-				return( 1 );
-			}
-			previous_entry = entry;
-		}
+on_error:
+	if( safe_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &safe_node,
+		 NULL );
 	}
-	if( is_leaf_node == 0 )
+	if( data_block != NULL )
 	{
-		*btree_entry = previous_entry;
-
-		return( 1 );
+		libfsapfs_data_block_free(
+		 &data_block,
+		 NULL );
 	}
-	return( 0 );
+	return( -1 );
 }
 
-/* Retrieves an entry for a specific identifier from the file system B-tree
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Reads the leaf nodes of a file system B-tree node and its sub nodes in key order
+ * The nodes are read without using the node cache and the callback function
+ * is called for every leaf node
+ * The callback function should return 1 if successful or -1 on error
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_system_btree_get_entry_by_identifier(
+int libfsapfs_file_system_btree_read_leaf_nodes(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     uint64_t identifier,
-     uint8_t data_type,
-     libfsapfs_btree_node_t **btree_node,
-     libfsapfs_btree_entry_t **btree_entry,
+     uint64_t node_block_number,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            libfsapfs_btree_node_t *node,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry = NULL;
-	libfsapfs_btree_node_t *node   = NULL;
-	static char *function          = "libfsapfs_file_system_btree_get_entry_by_identifier";
-	uint64_t sub_node_block_number = 0;
-	int is_leaf_node               = 0;
-	int recursion_depth            = 0;
-	int result                     = 0;
-
-	if( file_system_btree == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system B-tree.",
-		 function );
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	static char *function                = "libfsapfs_file_system_btree_read_leaf_nodes";
+	uint64_t sub_node_block_number       = 0;
+	int btree_entry_index                = 0;
+	int is_leaf_node                     = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
 
-		return( -1 );
-	}
-	if( btree_node == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree node.",
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
 	}
-	if( btree_entry == NULL )
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsapfs_file_system_btree_get_root_node(
+	if( libfsapfs_file_system_btree_read_node(
 	     file_system_btree,
 	     file_io_handle,
-	     file_system_btree->root_node_block_number,
+	     node_block_number,
 	     &node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read B-tree node: %" PRIu64 ".",
+		 function,
+		 node_block_number );
 
-		return( -1 );
+		goto on_error;
 	}
-	do
-	{
-		if( ( recursion_depth < 0 )
-		 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid recursion depth value out of bounds.",
-			 function );
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
 
-			return( -1 );
-		}
-		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-		                node,
-		                error );
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
+		 function );
 
-		if( is_leaf_node == -1 )
+		goto on_error;
+	}
+	else if( is_leaf_node != 0 )
+	{
+		if( callback_function(
+		     callback_data,
+		     node,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if B-tree node is a leaf node.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process leaf node: %" PRIu64 ".",
+			 function,
+			 node_block_number );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
-		          file_system_btree,
-		          node,
-		          identifier,
-		          data_type,
-		          &entry,
-		          error );
-
-		if( result == -1 )
+	}
+	else
+	{
+		if( libfsapfs_btree_node_get_number_of_entries(
+		     node,
+		     &number_of_entries,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry from B-tree node.",
+			 "%s: unable to retrieve number of entries from B-tree node.",
 			 function );
 
-			return( -1 );
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( is_leaf_node != 0 )
-		{
-			*btree_node  = node;
-			*btree_entry = entry;
-
-			return( 1 );
+			goto on_error;
 		}
-		if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
-		     file_system_btree,
-		     file_io_handle,
-		     entry,
-		     &sub_node_block_number,
-		     error ) != 1 )
+		for( btree_entry_index = 0;
+		     btree_entry_index < number_of_entries;
+		     btree_entry_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sub node block number.",
-			 function );
+			if( libfsapfs_btree_node_get_entry_by_index(
+			     node,
+			     btree_entry_index,
+			     &btree_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree entry: %d.",
+				 function,
+				 btree_entry_index );
 
-			return( -1 );
-		}
-		node = NULL;
+				goto on_error;
+			}
+			result = libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+			          file_system_btree,
+			          file_io_handle,
+			          btree_entry,
+			          &sub_node_block_number,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine sub node block number of B-tree entry: %d.",
+				 function,
+				 btree_entry_index );
 
-		if( libfsapfs_file_system_btree_get_sub_node(
-		     file_system_btree,
-		     file_io_handle,
-		     sub_node_block_number,
-		     &node,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
+				goto on_error;
+			}
+			if( libfsapfs_file_system_btree_read_leaf_nodes(
+			     file_system_btree,
+			     file_io_handle,
+			     sub_node_block_number,
+			     callback_function,
+			     callback_data,
+			     recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub node: %" PRIu64 ".",
+				 function,
+				 sub_node_block_number );
 
-			return( -1 );
+				goto on_error;
+			}
 		}
-		recursion_depth++;
 	}
-	while( is_leaf_node == 0 );
+	if( libfsapfs_btree_node_free(
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free B-tree node.",
+		 function );
 
-	return( 0 );
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a directory record for an UTF-8 encoded name from the file system B-tree leaf node
+/* Retrieves an entry for a specific identifier from the file system B-tree node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
+int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
      libfsapfs_file_system_btree_t *file_system_btree,
      libfsapfs_btree_node_t *node,
-     uint64_t parent_identifier,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     uint32_t name_hash,
-     libfsapfs_directory_record_t **directory_record,
+     uint64_t identifier,
+     uint8_t data_type,
+     libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry                      = NULL;
-	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t lookup_identifier                          = 0;
-	int compare_result                                  = 0;
-	int entry_index                                     = 0;
-	int is_leaf_node                                    = 0;
-	int number_of_entries                               = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type                       = 0;
-#endif
+	libfsapfs_btree_entry_t *entry          = NULL;
+	libfsapfs_btree_entry_t *previous_entry = NULL;
+	static char *function                   = "libfsapfs_file_system_btree_get_entry_from_node_by_identifier";
+	uint64_t file_system_identifier         = 0;
+	uint64_t lookup_identifier              = 0;
+	uint8_t file_system_data_type           = 0;
+	int btree_entry_index                   = 0;
+	int is_leaf_node                        = 0;
+	int number_of_entries                   = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -1409,13 +1888,24 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 
 		return( -1 );
 	}
-	if( directory_record == NULL )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory record.",
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
 		 function );
 
 		return( -1 );
@@ -1424,9 +1914,12 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving directory record: %" PRIu64 "\n",
+		 "%s: retrieving B-tree entry identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
 		 function,
-		 parent_identifier );
+		 identifier,
+		 data_type,
+		 libfsapfs_debug_print_file_system_data_type(
+		  data_type ) );
 	}
 #endif
 	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
@@ -1442,18 +1935,7 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 		 "%s: unable to determine if B-tree node is a leaf node.",
 		 function );
 
-		goto on_error;
-	}
-	else if( is_leaf_node == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a leaf node.",
-		 function );
-
-		goto on_error;
+		return( -1 );
 	}
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
@@ -1467,17 +1949,17 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 		 "%s: unable to retrieve number of entries from B-tree node.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | parent_identifier;
+	lookup_identifier = ( (uint64_t) data_type << 60 ) | identifier;
 
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
-		     entry_index,
+		     btree_entry_index,
 		     &entry,
 		     error ) != 1 )
 		{
@@ -1488,7 +1970,7 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 			 "%s: unable to retrieve number of entries from B-tree node.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( entry == NULL )
 		{
@@ -1498,9 +1980,9 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid B-tree entry: %d.",
 			 function,
-			 entry_index );
+			 btree_entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
 		if( entry->key_data == NULL )
 		{
@@ -1510,11 +1992,11 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid B-tree entry: %d - missing key data.",
 			 function,
-			 entry_index );
+			 btree_entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		if( entry->key_data_size < 8 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1522,154 +2004,85 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
 			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
 			 function,
-			 entry_index );
+			 btree_entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
 		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
+		 entry->key_data,
 		 file_system_identifier );
 
+		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
 			libcnotify_printf(
 			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
 			 function,
-			 entry_index,
+			 btree_entry_index,
 			 file_system_identifier & 0x0fffffffffffffffUL,
 			 file_system_data_type,
 			 libfsapfs_debug_print_file_system_data_type(
 			  file_system_data_type ) );
 		}
 #endif
-		if( file_system_identifier == lookup_identifier )
+		if( is_leaf_node != 0 )
 		{
-			if( libfsapfs_directory_record_initialize(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_read_key_data(
-			     safe_directory_record,
-			     entry->key_data,
-			     (size_t) entry->key_data_size,
-			     error ) != 1 )
+			if( file_system_identifier == lookup_identifier )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory record key data.",
-				 function );
+				*btree_entry = entry;
 
-				goto on_error;
+				return( 1 );
 			}
-			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
-			                  safe_directory_record,
-			                  utf8_string,
-			                  utf8_string_length,
-			                  name_hash,
-			                  file_system_btree->use_case_folding,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-8 string with name of directory record.",
-				 function );
+		}
+		else
+		{
+			file_system_identifier &= 0x0fffffffffffffffUL;
 
-				goto on_error;
-			}
-			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			if( file_system_identifier >= identifier )
 			{
-				if( libfsapfs_directory_record_read_value_data(
-				     safe_directory_record,
-				     entry->value_data,
-				     (size_t) entry->value_data_size,
-				     error ) != 1 )
+				if( ( previous_entry == NULL )
+				 || ( ( file_system_identifier == identifier )
+				  &&  ( file_system_data_type <= data_type ) ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read directory record value data.",
-					 function );
-
-					goto on_error;
+					previous_entry = entry;
 				}
-				*directory_record = safe_directory_record;
+				*btree_entry = previous_entry;
 
 				return( 1 );
 			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
-				 function );
-
-				goto on_error;
-			}
+			previous_entry = entry;
 		}
 	}
-	return( 0 );
-
-on_error:
-	if( safe_directory_record != NULL )
+	if( is_leaf_node == 0 )
 	{
-		libfsapfs_directory_record_free(
-		 &safe_directory_record,
-		 NULL );
+		*btree_entry = previous_entry;
+
+		return( 1 );
 	}
-	return( -1 );
+	return( 0 );
 }
 
-/* Retrieves a directory record for an UTF-8 encoded name from the file system B-tree branch node
+/* Retrieves an entry for a specific identifier from the file system B-tree
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
+int libfsapfs_file_system_btree_get_entry_by_identifier(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     libfsapfs_btree_node_t *node,
-     uint64_t parent_identifier,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     uint32_t name_hash,
-     libfsapfs_directory_record_t **directory_record,
-     int recursion_depth,
+     uint64_t identifier,
+     uint8_t data_type,
+     libfsapfs_btree_node_t **btree_node,
+     libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry                      = NULL;
-	libfsapfs_btree_entry_t *previous_entry             = NULL;
-	libfsapfs_btree_node_t *sub_node                    = NULL;
-	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t sub_node_block_number                      = 0;
-	uint8_t file_system_data_type                       = 0;
-	int compare_result                                  = 0;
-	int entry_index                                     = 0;
-	int is_leaf_node                                    = 0;
-	int number_of_entries                               = 0;
-	int result                                          = 0;
+	libfsapfs_btree_entry_t *entry = NULL;
+	libfsapfs_btree_node_t *node   = NULL;
+	static char *function          = "libfsapfs_file_system_btree_get_entry_by_identifier";
+	uint64_t sub_node_block_number = 0;
+	int is_leaf_node               = 0;
+	int recursion_depth            = 0;
+	int result                     = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -1682,364 +2095,161 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_na
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( btree_node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 "%s: invalid B-tree node.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_record == NULL )
+	if( btree_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory record.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 "%s: invalid B-tree entry.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: retrieving directory record: %" PRIu64 "\n",
-		 function,
-		 parent_identifier );
-	}
-#endif
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                node,
-	                error );
-
-	if( is_leaf_node == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a leaf node.",
-		 function );
-
-		goto on_error;
-	}
-	else if( is_leaf_node != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid node - not a branch node.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfsapfs_btree_node_get_number_of_entries(
-	     node,
-	     &number_of_entries,
+	if( libfsapfs_file_system_btree_get_root_node(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     &node,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from B-tree node.",
+		 "%s: unable to retrieve B-tree root node.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	do
 	{
-		if( libfsapfs_btree_node_get_entry_by_index(
-		     node,
-		     entry_index,
-		     &entry,
-		     error ) != 1 )
+		if( ( recursion_depth < 0 )
+		 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( entry == NULL )
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                node,
+		                error );
+
+		if( is_leaf_node == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node is a leaf node.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( entry->key_data == NULL )
+		result = libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
+		          file_system_btree,
+		          node,
+		          identifier,
+		          data_type,
+		          &entry,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
-			 function,
-			 entry_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from B-tree node.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		else if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 entry_index );
-
-			goto on_error;
+			break;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
-		 file_system_identifier );
-
-		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( is_leaf_node != 0 )
 		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
-		}
-#endif
-		file_system_identifier &= 0x0fffffffffffffffUL;
+			*btree_node  = node;
+			*btree_entry = entry;
 
-		if( ( file_system_identifier > parent_identifier )
-		 || ( ( file_system_identifier == parent_identifier )
-		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) ) )
-		{
-			break;
+			return( 1 );
 		}
-		if( ( file_system_identifier == parent_identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) )
+		if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		     file_system_btree,
+		     file_io_handle,
+		     entry,
+		     &sub_node_block_number,
+		     error ) != 1 )
 		{
-			if( libfsapfs_directory_record_initialize(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_read_key_data(
-			     safe_directory_record,
-			     entry->key_data,
-			     (size_t) entry->key_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory record key data.",
-				 function );
-
-				goto on_error;
-			}
-			/* The directory records are sorted by case-sensitive name
-			 */
-			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
-			                  safe_directory_record,
-			                  utf8_string,
-			                  utf8_string_length,
-			                  name_hash,
-			                  0,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-8 string with name of directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number.",
+			 function );
 
-				goto on_error;
-			}
-			if( compare_result == LIBUNA_COMPARE_LESS )
-			{
-				break;
-			}
+			return( -1 );
 		}
-		previous_entry = entry;
-	}
-	if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
-	     file_system_btree,
-	     file_io_handle,
-	     previous_entry,
-	     &sub_node_block_number,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine sub node block number.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfsapfs_file_system_btree_get_sub_node(
-	     file_system_btree,
-	     file_io_handle,
-	     sub_node_block_number,
-	     &sub_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
-		 function,
-		 sub_node_block_number );
-
-		goto on_error;
-	}
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                sub_node,
-	                error );
-
-	if( is_leaf_node == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree sub node is a leaf node.",
-		 function );
+		node = NULL;
 
-		goto on_error;
-	}
-	if( is_leaf_node != 0 )
-	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
-			  file_system_btree,
-			  sub_node,
-			  parent_identifier,
-			  utf8_string,
-			  utf8_string_length,
-			  name_hash,
-			  directory_record,
-			  error );
-	}
-	else
-	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
-			  file_system_btree,
-			  file_io_handle,
-			  sub_node,
-			  parent_identifier,
-			  utf8_string,
-			  utf8_string_length,
-			  name_hash,
-			  directory_record,
-			  recursion_depth + 1,
-			  error );
-	}
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by name.",
-		 function );
+		if( libfsapfs_file_system_btree_get_sub_node(
+		     file_system_btree,
+		     file_io_handle,
+		     sub_node_block_number,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
+			 function,
+			 sub_node_block_number );
 
-		goto on_error;
+			return( -1 );
+		}
+		recursion_depth++;
 	}
-	sub_node = NULL;
-
-	return( result );
+	while( is_leaf_node == 0 );
 
-on_error:
-	if( *directory_record != NULL )
-	{
-		libfsapfs_directory_record_free(
-		 directory_record,
-		 NULL );
-	}
-	if( safe_directory_record != NULL )
-	{
-		libfsapfs_directory_record_free(
-		 &safe_directory_record,
-		 NULL );
-	}
-	return( -1 );
+	return( 0 );
 }
 
-/* Retrieves a directory record for an UTF-16 encoded name from the file system B-tree leaf node
+/* Retrieves a directory record for an UTF-8 encoded name from the file system B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
      libfsapfs_file_system_btree_t *file_system_btree,
      libfsapfs_btree_node_t *node,
      uint64_t parent_identifier,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      uint32_t name_hash,
      libfsapfs_directory_record_t **directory_record,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_entry_t *entry                      = NULL;
 	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name";
+	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name";
 	uint64_t file_system_identifier                     = 0;
 	uint64_t lookup_identifier                          = 0;
 	int compare_result                                  = 0;
@@ -2228,10 +2438,10 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 
 				goto on_error;
 			}
-			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
+			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
 			                  safe_directory_record,
-			                  utf16_string,
-			                  utf16_string_length,
+			                  utf8_string,
+			                  utf8_string_length,
 			                  name_hash,
 			                  file_system_btree->use_case_folding,
 			                  error );
@@ -2242,7 +2452,7 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-16 string with name of directory record.",
+				 "%s: unable to compare UTF-8 string with name of directory record.",
 				 function );
 
 				goto on_error;
@@ -2295,16 +2505,16 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a directory record for an UTF-16 encoded name from the file system B-tree branch node
+/* Retrieves a directory record for an UTF-8 encoded name from the file system B-tree branch node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
      uint64_t parent_identifier,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      uint32_t name_hash,
      libfsapfs_directory_record_t **directory_record,
      int recursion_depth,
@@ -2314,7 +2524,7 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 	libfsapfs_btree_entry_t *previous_entry             = NULL;
 	libfsapfs_btree_node_t *sub_node                    = NULL;
 	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name";
+	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name";
 	uint64_t file_system_identifier                     = 0;
 	uint64_t sub_node_block_number                      = 0;
 	uint8_t file_system_data_type                       = 0;
@@ -2533,10 +2743,10 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 			}
 			/* The directory records are sorted by case-sensitive name
 			 */
-			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
+			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
 			                  safe_directory_record,
-			                  utf16_string,
-			                  utf16_string_length,
+			                  utf8_string,
+			                  utf8_string_length,
 			                  name_hash,
 			                  0,
 			                  error );
@@ -2547,7 +2757,7 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-16 string with name of directory record.",
+				 "%s: unable to compare UTF-8 string with name of directory record.",
 				 function );
 
 				goto on_error;
@@ -2622,25 +2832,25 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
 			  file_system_btree,
 			  sub_node,
 			  parent_identifier,
-			  utf16_string,
-			  utf16_string_length,
+			  utf8_string,
+			  utf8_string_length,
 			  name_hash,
 			  directory_record,
 			  error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
 			  file_system_btree,
 			  file_io_handle,
 			  sub_node,
 			  parent_identifier,
-			  utf16_string,
-			  utf16_string_length,
+			  utf8_string,
+			  utf8_string_length,
 			  name_hash,
 			  directory_record,
 			  recursion_depth + 1,
@@ -2677,29 +2887,31 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the file system B-tree leaf node
+/* Retrieves a directory record for an UTF-16 encoded name from the file system B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
+int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
      libfsapfs_file_system_btree_t *file_system_btree,
      libfsapfs_btree_node_t *node,
      uint64_t parent_identifier,
-     libcdata_array_t *directory_entries,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t name_hash,
+     libfsapfs_directory_record_t **directory_record,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *btree_entry           = NULL;
-	libfsapfs_directory_record_t *directory_record = NULL;
-	static char *function                          = "libfsapfs_file_system_btree_get_directory_entries_from_leaf_node";
-	uint64_t file_system_identifier                = 0;
-	uint64_t lookup_identifier                     = 0;
-	int btree_entry_index                          = 0;
-	int entry_index                                = 0;
-	int found_directory_entry                      = 0;
-	int is_leaf_node                               = 0;
-	int number_of_entries                          = 0;
+	libfsapfs_btree_entry_t *entry                      = NULL;
+	libfsapfs_directory_record_t *safe_directory_record = NULL;
+	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name";
+	uint64_t file_system_identifier                     = 0;
+	uint64_t lookup_identifier                          = 0;
+	int compare_result                                  = 0;
+	int entry_index                                     = 0;
+	int is_leaf_node                                    = 0;
+	int number_of_entries                               = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type                  = 0;
+	uint8_t file_system_data_type                       = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -2713,17 +2925,26 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( directory_record == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 "%s: invalid directory record.",
 		 function );
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving directory record: %" PRIu64 "\n",
+		 function,
+		 parent_identifier );
+	}
+#endif
 	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 	                node,
 	                error );
@@ -2750,15 +2971,6 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: retrieving directory entries of: %" PRIu64 "\n",
-		 function,
-		 parent_identifier );
-	}
-#endif
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
 	     &number_of_entries,
@@ -2775,14 +2987,14 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 	}
 	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | parent_identifier;
 
-	for( btree_entry_index = 0;
-	     btree_entry_index < number_of_entries;
-	     btree_entry_index++ )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
-		     btree_entry_index,
-		     &btree_entry,
+		     entry_index,
+		     &entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2794,7 +3006,7 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 
 			goto on_error;
 		}
-		if( btree_entry == NULL )
+		if( entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -2802,11 +3014,11 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid B-tree entry: %d.",
 			 function,
-			 btree_entry_index );
+			 entry_index );
 
 			goto on_error;
 		}
-		if( btree_entry->key_data == NULL )
+		if( entry->key_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -2814,11 +3026,11 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid B-tree entry: %d - missing key data.",
 			 function,
-			 btree_entry_index );
+			 entry_index );
 
 			goto on_error;
 		}
-		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -2826,12 +3038,12 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
 			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
 			 function,
-			 btree_entry_index );
+			 entry_index );
 
 			goto on_error;
 		}
 		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
 		 file_system_identifier );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -2842,124 +3054,138 @@ int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 			libcnotify_printf(
 			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
 			 function,
-			 btree_entry_index,
+			 entry_index,
 			 file_system_identifier & 0x0fffffffffffffffUL,
 			 file_system_data_type,
 			 libfsapfs_debug_print_file_system_data_type(
 			  file_system_data_type ) );
 		}
 #endif
-		if( ( file_system_identifier & 0x0fffffffffffffffUL ) > parent_identifier )
-		{
-			break;
-		}
-		if( file_system_identifier != lookup_identifier )
-		{
-			continue;
-		}
-		if( libfsapfs_directory_record_initialize(
-		     &directory_record,
-		     error ) != 1 )
+		if( file_system_identifier == lookup_identifier )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory record.",
-			 function );
+			if( libfsapfs_directory_record_initialize(
+			     &safe_directory_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory record.",
+				 function );
 
-			goto on_error;
-		}
-		if( libfsapfs_directory_record_read_key_data(
-		     directory_record,
-		     btree_entry->key_data,
-		     (size_t) btree_entry->key_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory record key data.",
-			 function );
+				goto on_error;
+			}
+			if( libfsapfs_directory_record_read_key_data(
+			     safe_directory_record,
+			     entry->key_data,
+			     (size_t) entry->key_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory record key data.",
+				 function );
 
-			goto on_error;
-		}
-		if( libfsapfs_directory_record_read_value_data(
-		     directory_record,
-		     btree_entry->value_data,
-		     (size_t) btree_entry->value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory record value data.",
-			 function );
+				goto on_error;
+			}
+			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
+			                  safe_directory_record,
+			                  utf16_string,
+			                  utf16_string_length,
+			                  name_hash,
+			                  file_system_btree->use_case_folding,
+			                  error );
 
-			goto on_error;
-		}
-		if( libcdata_array_append_entry(
-		     directory_entries,
-		     &entry_index,
-		     (intptr_t *) directory_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append directory record to array.",
-			 function );
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 string with name of directory record.",
+				 function );
 
-			goto on_error;
-		}
-		directory_record = NULL;
+				goto on_error;
+			}
+			else if( compare_result == LIBUNA_COMPARE_EQUAL )
+			{
+				if( libfsapfs_directory_record_read_value_data(
+				     safe_directory_record,
+				     entry->value_data,
+				     (size_t) entry->value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read directory record value data.",
+					 function );
 
-		found_directory_entry = 1;
+					goto on_error;
+				}
+				*directory_record = safe_directory_record;
+
+				return( 1 );
+			}
+			if( libfsapfs_directory_record_free(
+			     &safe_directory_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory record.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
-	return( found_directory_entry );
+	return( 0 );
 
 on_error:
-	if( directory_record != NULL )
+	if( safe_directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
-		 &directory_record,
+		 &safe_directory_record,
 		 NULL );
 	}
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
-	 NULL );
-
 	return( -1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the file system B-tree branch node
+/* Retrieves a directory record for an UTF-16 encoded name from the file system B-tree branch node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
+int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
      uint64_t parent_identifier,
-     libcdata_array_t *directory_entries,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t name_hash,
+     libfsapfs_directory_record_t **directory_record,
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry          = NULL;
-	libfsapfs_btree_entry_t *previous_entry = NULL;
-	libfsapfs_btree_node_t *sub_node        = NULL;
-	static char *function                   = "libfsapfs_file_system_btree_get_directory_entries_from_branch_node";
-	uint64_t file_system_identifier         = 0;
-	uint64_t sub_node_block_number          = 0;
-	uint8_t file_system_data_type           = 0;
-	int entry_index                         = 0;
-	int found_directory_entry               = 0;
-	int is_leaf_node                        = 0;
-	int number_of_entries                   = 0;
-	int result                              = 0;
+	libfsapfs_btree_entry_t *entry                      = NULL;
+	libfsapfs_btree_entry_t *previous_entry             = NULL;
+	libfsapfs_btree_node_t *sub_node                    = NULL;
+	libfsapfs_directory_record_t *safe_directory_record = NULL;
+	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name";
+	uint64_t file_system_identifier                     = 0;
+	uint64_t sub_node_block_number                      = 0;
+	uint8_t file_system_data_type                       = 0;
+	int compare_result                                  = 0;
+	int entry_index                                     = 0;
+	int is_leaf_node                                    = 0;
+	int number_of_entries                               = 0;
+	int result                                          = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -2983,6 +3209,17 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 
 		return( -1 );
 	}
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( recursion_depth < 0 )
 	 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
 	{
@@ -2995,6 +3232,15 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving directory record: %" PRIu64 "\n",
+		 function,
+		 parent_identifier );
+	}
+#endif
 	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 	                node,
 	                error );
@@ -3021,15 +3267,6 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: retrieving directory entries of: %" PRIu64 "\n",
-		 function,
-		 parent_identifier );
-	}
-#endif
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
 	     &number_of_entries,
@@ -3127,94 +3364,74 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 			break;
 		}
 		if( ( file_system_identifier == parent_identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD )
-		 && ( previous_entry != NULL ) )
+		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) )
 		{
-			if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
-			     file_system_btree,
-			     file_io_handle,
-			     previous_entry,
-			     &sub_node_block_number,
+			if( libfsapfs_directory_record_initialize(
+			     &safe_directory_record,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine sub node block number.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory record.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfsapfs_file_system_btree_get_sub_node(
-			     file_system_btree,
-			     file_io_handle,
-			     sub_node_block_number,
-			     &sub_node,
+			if( libfsapfs_directory_record_read_key_data(
+			     safe_directory_record,
+			     entry->key_data,
+			     (size_t) entry->key_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
-				 function,
-				 sub_node_block_number );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory record key data.",
+				 function );
 
 				goto on_error;
 			}
-			is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-			                sub_node,
-			                error );
+			/* The directory records are sorted by case-sensitive name
+			 */
+			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
+			                  safe_directory_record,
+			                  utf16_string,
+			                  utf16_string_length,
+			                  name_hash,
+			                  0,
+			                  error );
 
-			if( is_leaf_node == -1 )
+			if( compare_result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine if B-tree sub node is a leaf node.",
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare UTF-16 string with name of directory record.",
 				 function );
 
 				goto on_error;
 			}
-			if( is_leaf_node != 0 )
-			{
-				result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
-				          file_system_btree,
-				          sub_node,
-				          parent_identifier,
-				          directory_entries,
-				          error );
-			}
-			else
-			{
-				result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
-				          file_system_btree,
-				          file_io_handle,
-				          sub_node,
-				          parent_identifier,
-				          directory_entries,
-				          recursion_depth + 1,
-				          error );
-			}
-			if( result == -1 )
+			if( libfsapfs_directory_record_free(
+			     &safe_directory_record,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree sub node.",
-				 function,
-				 parent_identifier );
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory record.",
+				 function );
 
 				goto on_error;
 			}
-			else if( result != 0 )
+			if( compare_result == LIBUNA_COMPARE_LESS )
 			{
-				found_directory_entry = 1;
+				break;
 			}
-			sub_node = NULL;
 		}
 		previous_entry = entry;
 	}
@@ -3268,23 +3485,29 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
-		          file_system_btree,
-		          sub_node,
-		          parent_identifier,
-		          directory_entries,
-		          error );
+		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+			  file_system_btree,
+			  sub_node,
+			  parent_identifier,
+			  utf16_string,
+			  utf16_string_length,
+			  name_hash,
+			  directory_record,
+			  error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
-		          file_system_btree,
-		          file_io_handle,
-		          sub_node,
-		          parent_identifier,
-		          directory_entries,
-		          recursion_depth + 1,
-		          error );
+		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+			  file_system_btree,
+			  file_io_handle,
+			  sub_node,
+			  parent_identifier,
+			  utf16_string,
+			  utf16_string_length,
+			  name_hash,
+			  directory_record,
+			  recursion_depth + 1,
+			  error );
 	}
 	if( result == -1 )
 	{
@@ -3292,44 +3515,54 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree sub node.",
-		 function,
-		 parent_identifier );
+		 "%s: unable to retrieve directory entry by name.",
+		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
-	{
-		found_directory_entry = 1;
-	}
-	return( found_directory_entry );
+	sub_node = NULL;
 
-on_error:
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
-	 NULL );
+	return( result );
 
+on_error:
+	if( *directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 directory_record,
+		 NULL );
+	}
+	if( safe_directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &safe_directory_record,
+		 NULL );
+	}
 	return( -1 );
 }
 
-/* Retrieves directory entries for a specific parent identifier from the file system B-tree
+/* Retrieves directory entries for a specific parent identifier from the file system B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_directory_entries(
+int libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
      libfsapfs_file_system_btree_t *file_system_btree,
-     libbfio_handle_t *file_io_handle,
+     libfsapfs_btree_node_t *node,
      uint64_t parent_identifier,
      libcdata_array_t *directory_entries,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_node_t *root_node = NULL;
-	static char *function             = "libfsapfs_file_system_btree_get_directory_entries";
-	int is_leaf_node                  = 0;
-	int result                        = 0;
+	libfsapfs_btree_entry_t *btree_entry           = NULL;
+	libfsapfs_directory_record_t *directory_record = NULL;
+	static char *function                          = "libfsapfs_file_system_btree_get_directory_entries_from_leaf_node";
+	uint64_t file_system_identifier                = 0;
+	uint64_t lookup_identifier                     = 0;
+	int btree_entry_index                          = 0;
+	int entry_index                                = 0;
+	int found_directory_entry                      = 0;
+	int is_leaf_node                               = 0;
+	int number_of_entries                          = 0;
 
-#if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp  = 0;
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t file_system_data_type                  = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -3343,181 +3576,7 @@ int libfsapfs_file_system_btree_get_directory_entries(
 
 		return( -1 );
 	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_start_timing(
-		     file_system_btree->io_handle->profiler,
-		     &profiler_start_timestamp,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to start timing.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#endif /* defined( HAVE_PROFILER ) */
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: retrieving directory entries of: %" PRIu64 "\n",
-		 function,
-		 parent_identifier );
-	}
-#endif
-	if( libfsapfs_file_system_btree_get_root_node(
-	     file_system_btree,
-	     file_io_handle,
-	     file_system_btree->root_node_block_number,
-	     &root_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
-		 function );
-
-		goto on_error;
-	}
-	if( root_node == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid B-tree root node.",
-		 function );
-
-		goto on_error;
-	}
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                root_node,
-	                error );
-
-	if( is_leaf_node == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree root node is a leaf node.",
-		 function );
-
-		goto on_error;
-	}
-	if( is_leaf_node != 0 )
-	{
-		result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
-		          file_system_btree,
-		          root_node,
-		          parent_identifier,
-		          directory_entries,
-		          error );
-	}
-	else
-	{
-		result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
-		          file_system_btree,
-		          file_io_handle,
-		          root_node,
-		          parent_identifier,
-		          directory_entries,
-		          0,
-		          error );
-	}
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree root node.",
-		 function,
-		 parent_identifier );
-
-		goto on_error;
-	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_stop_timing(
-		     file_system_btree->io_handle->profiler,
-		     profiler_start_timestamp,
-		     function,
-		     0,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to stop timing.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#endif /* defined( HAVE_PROFILER ) */
-
-	return( result );
-
-on_error:
-	libcdata_array_empty(
-	 directory_entries,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
-	 NULL );
-
-	return( -1 );
-}
-
-/* Retrieves extended attributes for a specific identifier from the file system B-tree leaf node
- * Returns 1 if successful, 0 if not found or -1 on error
- */
-int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
-     libfsapfs_file_system_btree_t *file_system_btree,
-     libbfio_handle_t *file_io_handle,
-     libfsapfs_btree_node_t *node,
-     uint64_t identifier,
-     libcdata_array_t *extended_attributes,
-     libcerror_error_t **error )
-{
-	libfsapfs_btree_entry_t *btree_entry               = NULL;
-	libfsapfs_extended_attribute_t *extended_attribute = NULL;
-	static char *function                              = "libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node";
-	uint64_t file_system_identifier                    = 0;
-	uint64_t lookup_identifier                         = 0;
-	int btree_entry_index                              = 0;
-	int entry_index                                    = 0;
-	int found_extended_attribute                       = 0;
-	int is_leaf_node                                   = 0;
-	int number_of_entries                              = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type                      = 0;
-#endif
-
-	if( file_system_btree == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system B-tree.",
-		 function );
-
-		return( -1 );
-	}
-	if( node == NULL )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3558,9 +3617,9 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
+		 "%s: retrieving directory entries of: %" PRIu64 "\n",
 		 function,
-		 identifier );
+		 parent_identifier );
 	}
 #endif
 	if( libfsapfs_btree_node_get_number_of_entries(
@@ -3577,7 +3636,7 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 
 		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE << 60 ) | identifier;
+	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | parent_identifier;
 
 	for( btree_entry_index = 0;
 	     btree_entry_index < number_of_entries;
@@ -3653,7 +3712,7 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 			  file_system_data_type ) );
 		}
 #endif
-		if( ( file_system_identifier & 0x0fffffffffffffffUL ) > identifier )
+		if( ( file_system_identifier & 0x0fffffffffffffffUL ) > parent_identifier )
 		{
 			break;
 		}
@@ -3661,25 +3720,21 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 		{
 			continue;
 		}
-		if( libfsapfs_extended_attribute_initialize(
-		     &extended_attribute,
-		     file_system_btree->io_handle,
-		     file_io_handle,
-		     file_system_btree->encryption_context,
-		     file_system_btree,
+		if( libfsapfs_directory_record_initialize(
+		     &directory_record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extended attribute.",
+			 "%s: unable to create directory record.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_extended_attribute_read_key_data(
-		     extended_attribute,
+		if( libfsapfs_directory_record_read_key_data(
+		     directory_record,
 		     btree_entry->key_data,
 		     (size_t) btree_entry->key_data_size,
 		     error ) != 1 )
@@ -3688,13 +3743,13 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read extended attribute key data.",
+			 "%s: unable to read directory record key data.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_extended_attribute_read_value_data(
-		     extended_attribute,
+		if( libfsapfs_directory_record_read_value_data(
+		     directory_record,
 		     btree_entry->value_data,
 		     (size_t) btree_entry->value_data_size,
 		     error ) != 1 )
@@ -3703,68 +3758,68 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read extended attribute value data.",
+			 "%s: unable to read directory record value data.",
 			 function );
 
 			goto on_error;
 		}
 		if( libcdata_array_append_entry(
-		     extended_attributes,
+		     directory_entries,
 		     &entry_index,
-		     (intptr_t *) extended_attribute,
+		     (intptr_t *) directory_record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append extended attribute to array.",
+			 "%s: unable to append directory record to array.",
 			 function );
 
 			goto on_error;
 		}
-		extended_attribute = NULL;
+		directory_record = NULL;
 
-		found_extended_attribute = 1;
+		found_directory_entry = 1;
 	}
-	return( found_extended_attribute );
+	return( found_directory_entry );
 
 on_error:
-	if( extended_attribute != NULL )
+	if( directory_record != NULL )
 	{
-		libfsapfs_internal_extended_attribute_free(
-		 (libfsapfs_internal_extended_attribute_t **) &extended_attribute,
+		libfsapfs_directory_record_free(
+		 &directory_record,
 		 NULL );
 	}
 	libcdata_array_empty(
-	 extended_attributes,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
 	 NULL );
 
 	return( -1 );
 }
 
-/* Retrieves extended attributes for a specific identifier from the file system B-tree branch node
+/* Retrieves directory entries for a specific parent identifier from the file system B-tree branch node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
+int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
-     uint64_t identifier,
-     libcdata_array_t *extended_attributes,
+     uint64_t parent_identifier,
+     libcdata_array_t *directory_entries,
      int recursion_depth,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_entry_t *entry          = NULL;
 	libfsapfs_btree_entry_t *previous_entry = NULL;
 	libfsapfs_btree_node_t *sub_node        = NULL;
-	static char *function                   = "libfsapfs_file_system_btree_get_extended_attributes_from_branch_node";
+	static char *function                   = "libfsapfs_file_system_btree_get_directory_entries_from_branch_node";
 	uint64_t file_system_identifier         = 0;
 	uint64_t sub_node_block_number          = 0;
 	uint8_t file_system_data_type           = 0;
 	int entry_index                         = 0;
-	int found_extended_attribute            = 0;
+	int found_directory_entry               = 0;
 	int is_leaf_node                        = 0;
 	int number_of_entries                   = 0;
 	int result                              = 0;
@@ -3833,9 +3888,9 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
+		 "%s: retrieving directory entries of: %" PRIu64 "\n",
 		 function,
-		 identifier );
+		 parent_identifier );
 	}
 #endif
 	if( libfsapfs_btree_node_get_number_of_entries(
@@ -3928,14 +3983,14 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 #endif
 		file_system_identifier &= 0x0fffffffffffffffUL;
 
-		if( ( file_system_identifier > identifier )
-		 || ( ( file_system_identifier == identifier )
-		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE ) ) )
+		if( ( file_system_identifier > parent_identifier )
+		 || ( ( file_system_identifier == parent_identifier )
+		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) ) )
 		{
 			break;
 		}
-		if( ( file_system_identifier == identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE )
+		if( ( file_system_identifier == parent_identifier )
+		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD )
 		 && ( previous_entry != NULL ) )
 		{
 			if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
@@ -3988,22 +4043,21 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 			}
 			if( is_leaf_node != 0 )
 			{
-				result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
+				result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 				          file_system_btree,
-				          file_io_handle,
 				          sub_node,
-				          identifier,
-				          extended_attributes,
+				          parent_identifier,
+				          directory_entries,
 				          error );
 			}
 			else
 			{
-				result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
+				result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 				          file_system_btree,
 				          file_io_handle,
 				          sub_node,
-				          identifier,
-				          extended_attributes,
+				          parent_identifier,
+				          directory_entries,
 				          recursion_depth + 1,
 				          error );
 			}
@@ -4013,15 +4067,15 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree sub node.",
+				 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree sub node.",
 				 function,
-				 identifier );
+				 parent_identifier );
 
 				goto on_error;
 			}
 			else if( result != 0 )
 			{
-				found_extended_attribute = 1;
+				found_directory_entry = 1;
 			}
 			sub_node = NULL;
 		}
@@ -4077,22 +4131,21 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
+		result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 		          file_system_btree,
-		          file_io_handle,
 		          sub_node,
-		          identifier,
-		          extended_attributes,
+		          parent_identifier,
+		          directory_entries,
 		          error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
+		result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 		          file_system_btree,
 		          file_io_handle,
 		          sub_node,
-		          identifier,
-		          extended_attributes,
+		          parent_identifier,
+		          directory_entries,
 		          recursion_depth + 1,
 		          error );
 	}
@@ -4102,39 +4155,39 @@ int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree sub node.",
+		 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree sub node.",
 		 function,
-		 identifier );
+		 parent_identifier );
 
 		goto on_error;
 	}
 	else if( result != 0 )
 	{
-		found_extended_attribute = 1;
+		found_directory_entry = 1;
 	}
-	return( found_extended_attribute );
+	return( found_directory_entry );
 
 on_error:
 	libcdata_array_empty(
-	 extended_attributes,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
 	 NULL );
 
 	return( -1 );
 }
 
-/* Retrieves extended attributes for a specific identifier from the file system B-tree
+/* Retrieves directory entries for a specific parent identifier from the file system B-tree
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_extended_attributes(
+int libfsapfs_file_system_btree_get_directory_entries(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     uint64_t identifier,
-     libcdata_array_t *extended_attributes,
+     uint64_t parent_identifier,
+     libcdata_array_t *directory_entries,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_node_t *root_node = NULL;
-	static char *function             = "libfsapfs_file_system_btree_get_extended_attributes";
+	static char *function             = "libfsapfs_file_system_btree_get_directory_entries";
 	int is_leaf_node                  = 0;
 	int result                        = 0;
 
@@ -4153,6 +4206,21 @@ int libfsapfs_file_system_btree_get_extended_attributes(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
 	{
@@ -4177,9 +4245,9 @@ int libfsapfs_file_system_btree_get_extended_attributes(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
+		 "%s: retrieving directory entries of: %" PRIu64 "\n",
 		 function,
-		 identifier );
+		 parent_identifier );
 	}
 #endif
 	if( libfsapfs_file_system_btree_get_root_node(
@@ -4226,22 +4294,21 @@ int libfsapfs_file_system_btree_get_extended_attributes(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
+		result = libfsapfs_file_system_btree_get_directory_entries_from_leaf_node(
 		          file_system_btree,
-		          file_io_handle,
 		          root_node,
-		          identifier,
-		          extended_attributes,
+		          parent_identifier,
+		          directory_entries,
 		          error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
+		result = libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 		          file_system_btree,
 		          file_io_handle,
 		          root_node,
-		          identifier,
-		          extended_attributes,
+		          parent_identifier,
+		          directory_entries,
 		          0,
 		          error );
 	}
@@ -4251,9 +4318,9 @@ int libfsapfs_file_system_btree_get_extended_attributes(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree root node.",
+		 "%s: unable to retrieve directory entries: %" PRIu64 " from file system B-tree root node.",
 		 function,
-		 identifier );
+		 parent_identifier );
 
 		goto on_error;
 	}
@@ -4280,40 +4347,74 @@ int libfsapfs_file_system_btree_get_extended_attributes(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
 	return( result );
 
 on_error:
 	libcdata_array_empty(
-	 extended_attributes,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
+	 directory_entries,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
 	 NULL );
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves file extents for a specific identifier from the file system B-tree leaf node
+/* Retrieves extended attributes for a specific identifier from the file system B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+int libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
      libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
      uint64_t identifier,
-     libcdata_array_t *file_extents,
+     libcdata_array_t *extended_attributes,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *btree_entry = NULL;
-	libfsapfs_file_extent_t *file_extent = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_file_extents_from_leaf_node";
-	uint64_t file_system_identifier      = 0;
-	uint64_t lookup_identifier           = 0;
-	int btree_entry_index                = 0;
-	int entry_index                      = 0;
-	int found_file_extent                = 0;
-	int is_leaf_node                     = 0;
-	int number_of_entries                = 0;
+	libfsapfs_btree_entry_t *btree_entry               = NULL;
+	libfsapfs_extended_attribute_t *extended_attribute = NULL;
+	static char *function                              = "libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node";
+	uint64_t file_system_identifier                    = 0;
+	uint64_t lookup_identifier                         = 0;
+	int btree_entry_index                              = 0;
+	int entry_index                                    = 0;
+	int found_extended_attribute                       = 0;
+	int is_leaf_node                                   = 0;
+	int number_of_entries                              = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type        = 0;
+	uint8_t file_system_data_type                      = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -4327,6 +4428,17 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 
 		return( -1 );
 	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
 	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 	                node,
 	                error );
@@ -4357,7 +4469,7 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
 		 function,
 		 identifier );
 	}
@@ -4376,7 +4488,7 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 
 		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT << 60 ) | identifier;
+	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE << 60 ) | identifier;
 
 	for( btree_entry_index = 0;
 	     btree_entry_index < number_of_entries;
@@ -4460,21 +4572,25 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 		{
 			continue;
 		}
-		if( libfsapfs_file_extent_initialize(
-		     &file_extent,
+		if( libfsapfs_extended_attribute_initialize(
+		     &extended_attribute,
+		     file_system_btree->io_handle,
+		     file_io_handle,
+		     file_system_btree->encryption_context,
+		     file_system_btree,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file extent.",
+			 "%s: unable to create extended attribute.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_file_extent_read_key_data(
-		     file_extent,
+		if( libfsapfs_extended_attribute_read_key_data(
+		     extended_attribute,
 		     btree_entry->key_data,
 		     (size_t) btree_entry->key_data_size,
 		     error ) != 1 )
@@ -4483,13 +4599,13 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file extent key data.",
+			 "%s: unable to read extended attribute key data.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_file_extent_read_value_data(
-		     file_extent,
+		if( libfsapfs_extended_attribute_read_value_data(
+		     extended_attribute,
 		     btree_entry->value_data,
 		     (size_t) btree_entry->value_data_size,
 		     error ) != 1 )
@@ -4498,69 +4614,68 @@ int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read file extent value data.",
+			 "%s: unable to read extended attribute value data.",
 			 function );
 
 			goto on_error;
 		}
 		if( libcdata_array_append_entry(
-		     file_extents,
+		     extended_attributes,
 		     &entry_index,
-		     (intptr_t *) file_extent,
+		     (intptr_t *) extended_attribute,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append file extent to array.",
+			 "%s: unable to append extended attribute to array.",
 			 function );
 
 			goto on_error;
 		}
-		file_extent = NULL;
+		extended_attribute = NULL;
 
-		found_file_extent = 1;
+		found_extended_attribute = 1;
 	}
-	return( found_file_extent );
+	return( found_extended_attribute );
 
 on_error:
-	if( file_extent != NULL )
+	if( extended_attribute != NULL )
 	{
-		libfsapfs_file_extent_free(
-		 &file_extent,
+		libfsapfs_internal_extended_attribute_free(
+		 (libfsapfs_internal_extended_attribute_t **) &extended_attribute,
 		 NULL );
 	}
 	libcdata_array_empty(
-	 file_extents,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 extended_attributes,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
 	 NULL );
 
 	return( -1 );
 }
 
-/* Retrieves file extents for a specific identifier from the file system B-tree branch node
+/* Retrieves extended attributes for a specific identifier from the file system B-tree branch node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+int libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
      uint64_t identifier,
-     libcdata_array_t *file_extents,
+     libcdata_array_t *extended_attributes,
      int recursion_depth,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_entry_t *entry          = NULL;
 	libfsapfs_btree_entry_t *previous_entry = NULL;
 	libfsapfs_btree_node_t *sub_node        = NULL;
-	static char *function                   = "libfsapfs_file_system_btree_get_file_extents_from_branch_node";
-	uint64_t file_extent_logical_address    = 0;
+	static char *function                   = "libfsapfs_file_system_btree_get_extended_attributes_from_branch_node";
 	uint64_t file_system_identifier         = 0;
 	uint64_t sub_node_block_number          = 0;
 	uint8_t file_system_data_type           = 0;
 	int entry_index                         = 0;
-	int found_file_extent                   = 0;
+	int found_extended_attribute            = 0;
 	int is_leaf_node                        = 0;
 	int number_of_entries                   = 0;
 	int result                              = 0;
@@ -4629,7 +4744,7 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
 		 function,
 		 identifier );
 	}
@@ -4726,36 +4841,12 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 
 		if( ( file_system_identifier > identifier )
 		 || ( ( file_system_identifier == identifier )
-		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT ) ) )
+		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE ) ) )
 		{
 			break;
 		}
 		if( ( file_system_identifier == identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT ) )
-		{
-			if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_file_extent_t ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-				 function,
-				 entry_index );
-
-				goto on_error;
-			}
-			byte_stream_copy_to_uint64_little_endian(
-			 ( (fsapfs_file_system_btree_key_file_extent_t *) entry->key_data )->logical_address,
-			 file_extent_logical_address );
-		}
-		else
-		{
-			file_extent_logical_address = 0;
-		}
-		if( ( file_system_identifier == identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT )
-		 && ( file_extent_logical_address > 0 )
+		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE )
 		 && ( previous_entry != NULL ) )
 		{
 			if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
@@ -4808,21 +4899,22 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 			}
 			if( is_leaf_node != 0 )
 			{
-				result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+				result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 				          file_system_btree,
+				          file_io_handle,
 				          sub_node,
 				          identifier,
-				          file_extents,
+				          extended_attributes,
 				          error );
 			}
 			else
 			{
-				result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+				result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 				          file_system_btree,
 				          file_io_handle,
 				          sub_node,
 				          identifier,
-				          file_extents,
+				          extended_attributes,
 				          recursion_depth + 1,
 				          error );
 			}
@@ -4832,7 +4924,7 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree sub node.",
+				 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree sub node.",
 				 function,
 				 identifier );
 
@@ -4840,14 +4932,12 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 			}
 			else if( result != 0 )
 			{
-				found_file_extent = 1;
+				found_extended_attribute = 1;
 			}
 			sub_node = NULL;
 		}
 		previous_entry = entry;
 	}
-	/* Fall-through for the last B-Tree entry
-	 */
 	if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 	     file_system_btree,
 	     file_io_handle,
@@ -4898,21 +4988,22 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+		result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 		          file_system_btree,
+		          file_io_handle,
 		          sub_node,
 		          identifier,
-		          file_extents,
+		          extended_attributes,
 		          error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+		result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 		          file_system_btree,
 		          file_io_handle,
 		          sub_node,
 		          identifier,
-		          file_extents,
+		          extended_attributes,
 		          recursion_depth + 1,
 		          error );
 	}
@@ -4922,7 +5013,7 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree sub node.",
+		 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree sub node.",
 		 function,
 		 identifier );
 
@@ -4930,34 +5021,38 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 	}
 	else if( result != 0 )
 	{
-		found_file_extent = 1;
+		found_extended_attribute = 1;
 	}
-	return( found_file_extent );
+	return( found_extended_attribute );
 
 on_error:
 	libcdata_array_empty(
-	 file_extents,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
-	 NULL );
+	 extended_attributes,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
+	 NULL );
 
 	return( -1 );
 }
 
-/* Retrieves file extents for a specific identifier from the file system B-tree
+/* Retrieves extended attributes for a specific identifier from the file system B-tree
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_file_extents(
+int libfsapfs_file_system_btree_get_extended_attributes(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      uint64_t identifier,
-     libcdata_array_t *file_extents,
+     libcdata_array_t *extended_attributes,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_node_t *root_node = NULL;
-	static char *function             = "libfsapfs_file_system_btree_get_file_extents";
+	static char *function             = "libfsapfs_file_system_btree_get_extended_attributes";
 	int is_leaf_node                  = 0;
 	int result                        = 0;
 
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp  = 0;
+#endif
+
 	if( file_system_btree == NULL )
 	{
 		libcerror_error_set(
@@ -4969,11 +5064,46 @@ int libfsapfs_file_system_btree_get_file_extents(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_system_btree->io_handle->profiler,
+		     &profiler_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 "%s: retrieving extended attributes of: %" PRIu64 "\n",
 		 function,
 		 identifier );
 	}
@@ -4994,6 +5124,17 @@ int libfsapfs_file_system_btree_get_file_extents(
 
 		goto on_error;
 	}
+	if( root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
 	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 	                root_node,
 	                error );
@@ -5011,21 +5152,22 @@ int libfsapfs_file_system_btree_get_file_extents(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+		result = libfsapfs_file_system_btree_get_extended_attributes_from_leaf_node(
 		          file_system_btree,
+		          file_io_handle,
 		          root_node,
 		          identifier,
-		          file_extents,
+		          extended_attributes,
 		          error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+		result = libfsapfs_file_system_btree_get_extended_attributes_from_branch_node(
 		          file_system_btree,
 		          file_io_handle,
 		          root_node,
 		          identifier,
-		          file_extents,
+		          extended_attributes,
 		          0,
 		          error );
 	}
@@ -5035,40 +5177,102 @@ int libfsapfs_file_system_btree_get_file_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree root node.",
+		 "%s: unable to retrieve extended attributes: %" PRIu64 " from file system B-tree root node.",
 		 function,
 		 identifier );
 
 		goto on_error;
 	}
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     file_system_btree->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
 	return( result );
 
 on_error:
 	libcdata_array_empty(
-	 file_extents,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 extended_attributes,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_internal_extended_attribute_free,
 	 NULL );
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves an inode for a specific identifier from the file system B-tree
+/* Retrieves file extents for a specific identifier from the file system B-tree leaf node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_inode_by_identifier(
+int libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
      libfsapfs_file_system_btree_t *file_system_btree,
-     libbfio_handle_t *file_io_handle,
+     libfsapfs_btree_node_t *node,
      uint64_t identifier,
-     libfsapfs_inode_t **inode,
+     libcdata_array_t *file_extents,
      libcerror_error_t **error )
 {
 	libfsapfs_btree_entry_t *btree_entry = NULL;
-	libfsapfs_btree_node_t *btree_node   = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_inode_by_identifier";
-	int result                           = 0;
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_file_system_btree_get_file_extents_from_leaf_node";
+	uint64_t file_system_identifier      = 0;
+	uint64_t lookup_identifier           = 0;
+	int btree_entry_index                = 0;
+	int entry_index                      = 0;
+	int found_file_extent                = 0;
+	int is_leaf_node                     = 0;
+	int number_of_entries                = 0;
 
-#if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint8_t file_system_data_type        = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -5082,86 +5286,72 @@ int libfsapfs_file_system_btree_get_inode_by_identifier(
 
 		return( -1 );
 	}
-	if( inode == NULL )
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
+
+	if( is_leaf_node == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *inode != NULL )
+	else if( is_leaf_node == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid inode value already set.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a leaf node.",
 		 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_start_timing(
-		     file_system_btree->io_handle->profiler,
-		     &profiler_start_timestamp,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to start timing.",
-			 function );
-
-			goto on_error;
-		}
+		goto on_error;
 	}
-#endif /* defined( HAVE_PROFILER ) */
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: retrieving inode of: %" PRIu64 "\n",
+		 "%s: retrieving file extents of: %" PRIu64 "\n",
 		 function,
 		 identifier );
 	}
 #endif
-	result = libfsapfs_file_system_btree_get_entry_by_identifier(
-	          file_system_btree,
-	          file_io_handle,
-	          identifier,
-	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
-	          &btree_node,
-	          &btree_entry,
-	          error );
-
-	if( result == -1 )
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry from B-tree node.",
+		 "%s: unable to retrieve number of entries from B-tree node.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT << 60 ) | identifier;
+
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
 	{
-		if( btree_node == NULL )
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree node.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from B-tree node.",
 			 function );
 
 			goto on_error;
@@ -5172,112 +5362,167 @@ int libfsapfs_file_system_btree_get_inode_by_identifier(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry.",
-			 function );
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
 
 			goto on_error;
 		}
-		if( libfsapfs_inode_initialize(
-		     inode,
-		     error ) != 1 )
+		if( btree_entry->key_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d - missing key data.",
+			 function,
+			 btree_entry_index );
 
 			goto on_error;
 		}
-		if( libfsapfs_inode_read_key_data(
-		     *inode,
-		     btree_entry->key_data,
-		     (size_t) btree_entry->key_data_size,
-		     error ) != 1 )
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode key data.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 btree_entry_index );
 
 			goto on_error;
 		}
-		if( libfsapfs_inode_read_value_data(
-		     *inode,
-		     btree_entry->value_data,
-		     (size_t) btree_entry->value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+
+			libcnotify_printf(
+			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
+			 function,
+			 btree_entry_index,
+			 file_system_identifier & 0x0fffffffffffffffUL,
+			 file_system_data_type,
+			 libfsapfs_debug_print_file_system_data_type(
+			  file_system_data_type ) );
+		}
+#endif
+		if( ( file_system_identifier & 0x0fffffffffffffffUL ) > identifier )
+		{
+			break;
+		}
+		if( file_system_identifier != lookup_identifier )
+		{
+			continue;
+		}
+		if( libfsapfs_file_extent_initialize(
+		     &file_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file extent.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_extent_read_key_data(
+		     file_extent,
+		     btree_entry->key_data,
+		     (size_t) btree_entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode value data.",
+			 "%s: unable to read file extent key data.",
 			 function );
 
 			goto on_error;
 		}
-		btree_node = NULL;
-	}
-#if defined( HAVE_PROFILER )
-	if( file_system_btree->io_handle->profiler != NULL )
-	{
-		if( libfsapfs_profiler_stop_timing(
-		     file_system_btree->io_handle->profiler,
-		     profiler_start_timestamp,
-		     function,
-		     0,
-		     0,
+		if( libfsapfs_file_extent_read_value_data(
+		     file_extent,
+		     btree_entry->value_data,
+		     (size_t) btree_entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file extent value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     file_extents,
+		     &entry_index,
+		     (intptr_t *) file_extent,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to stop timing.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file extent to array.",
 			 function );
 
 			goto on_error;
 		}
-	}
-#endif /* defined( HAVE_PROFILER ) */
+		file_extent = NULL;
 
-	return( result );
+		found_file_extent = 1;
+	}
+	return( found_file_extent );
 
 on_error:
-	if( *inode != NULL )
+	if( file_extent != NULL )
 	{
-		libfsapfs_inode_free(
-		 inode,
+		libfsapfs_file_extent_free(
+		 &file_extent,
 		 NULL );
 	}
+	libcdata_array_empty(
+	 file_extents,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 NULL );
+
 	return( -1 );
 }
 
-/* Retrieves an inode for an UTF-8 encoded name from the file system B-tree
+/* Retrieves file extents for a specific identifier from the file system B-tree branch node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_inode_by_utf8_name(
+int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
-     uint64_t parent_identifier,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsapfs_inode_t **inode,
-     libfsapfs_directory_record_t **directory_record,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *btree_entry = NULL;
-	libfsapfs_btree_node_t *btree_node   = NULL;
-	libfsapfs_btree_node_t *root_node    = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_inode_by_utf8_name";
-	uint64_t lookup_identifier           = 0;
-	uint32_t name_hash                   = 0;
-	int is_leaf_node                     = 0;
-	int result                           = 0;
+	libfsapfs_btree_entry_t *entry          = NULL;
+	libfsapfs_btree_entry_t *previous_entry = NULL;
+	libfsapfs_btree_node_t *sub_node        = NULL;
+	static char *function                   = "libfsapfs_file_system_btree_get_file_extents_from_branch_node";
+	uint64_t file_extent_logical_address    = 0;
+	uint64_t file_system_identifier         = 0;
+	uint64_t sub_node_block_number          = 0;
+	uint8_t file_system_data_type           = 0;
+	int entry_index                         = 0;
+	int found_file_extent                   = 0;
+	int is_leaf_node                        = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -5290,386 +5535,448 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_name(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( inode == NULL )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode.",
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
-	if( *inode != NULL )
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid inode value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( directory_record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory record.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( *directory_record != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid directory record value already set.",
-		 function );
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
 
-		return( -1 );
-	}
-	if( libfsapfs_file_system_btree_get_root_node(
-	     file_system_btree,
-	     file_io_handle,
-	     file_system_btree->root_node_block_number,
-	     &root_node,
-	     error ) != 1 )
+	if( is_leaf_node == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve B-tree root node.",
+		 "%s: unable to determine if B-tree node is a leaf node.",
 		 function );
 
 		goto on_error;
 	}
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                root_node,
-	                error );
-
-	if( is_leaf_node == -1 )
+	else if( is_leaf_node != 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree root node is a leaf node.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - not a branch node.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsapfs_name_hash_calculate_from_utf8_string(
-	     &name_hash,
-	     utf8_string,
-	     utf8_string_length,
-	     file_system_btree->use_case_folding,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 function,
+		 identifier );
+	}
+#endif
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine name hash.",
+		 "%s: unable to retrieve number of entries from B-tree node.",
 		 function );
 
 		goto on_error;
 	}
-	if( is_leaf_node != 0 )
-	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
-			  file_system_btree,
-			  root_node,
-			  parent_identifier,
-			  utf8_string,
-			  utf8_string_length,
-			  name_hash,
-			  directory_record,
-			  error );
-	}
-	else
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
-			  file_system_btree,
-			  file_io_handle,
-			  root_node,
-			  parent_identifier,
-			  utf8_string,
-			  utf8_string_length,
-			  name_hash,
-			  directory_record,
-			  0,
-			  error );
-	}
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve directory entry by name.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		if( libfsapfs_directory_record_get_identifier(
-		     *directory_record,
-		     &lookup_identifier,
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry identifier.",
+			 "%s: unable to retrieve number of entries from B-tree node.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	root_node = NULL;
-
-	if( result != 0 )
-	{
-		result = libfsapfs_file_system_btree_get_entry_by_identifier(
-		          file_system_btree,
-		          file_io_handle,
-		          lookup_identifier,
-		          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
-		          &btree_node,
-		          &btree_entry,
-		          error );
-
-		if( result != 0 )
+		if( entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry from B-tree node.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		if( btree_node == NULL )
+		if( entry->key_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree node.",
-			 function );
+			 "%s: invalid B-tree entry: %d - missing key data.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		if( btree_entry == NULL )
+		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 entry_index );
 
 			goto on_error;
 		}
-		if( libfsapfs_inode_initialize(
-		     inode,
-		     error ) != 1 )
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+			libcnotify_printf(
+			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
+			 function,
+			 entry_index,
+			 file_system_identifier & 0x0fffffffffffffffUL,
+			 file_system_data_type,
+			 libfsapfs_debug_print_file_system_data_type(
+			  file_system_data_type ) );
+		}
+#endif
+		file_system_identifier &= 0x0fffffffffffffffUL;
 
-			goto on_error;
+		if( ( file_system_identifier > identifier )
+		 || ( ( file_system_identifier == identifier )
+		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT ) ) )
+		{
+			break;
 		}
-		if( libfsapfs_inode_read_key_data(
-		     *inode,
-		     btree_entry->key_data,
-		     (size_t) btree_entry->key_data_size,
-		     error ) != 1 )
+		if( ( file_system_identifier == identifier )
+		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode key data.",
-			 function );
+			if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_file_extent_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+				 function,
+				 entry_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (fsapfs_file_system_btree_key_file_extent_t *) entry->key_data )->logical_address,
+			 file_extent_logical_address );
 		}
-		if( libfsapfs_inode_read_value_data(
-		     *inode,
-		     btree_entry->value_data,
-		     (size_t) btree_entry->value_data_size,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode value data.",
-			 function );
-
-			goto on_error;
+			file_extent_logical_address = 0;
 		}
-		btree_node = NULL;
-	}
-	return( result );
-
-on_error:
-	if( *directory_record != NULL )
-	{
-		libfsapfs_directory_record_free(
-		 directory_record,
-		 NULL );
-	}
-	if( *inode != NULL )
-	{
-		libfsapfs_inode_free(
-		 inode,
-		 NULL );
-	}
-	return( -1 );
-}
+		if( ( file_system_identifier == identifier )
+		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT )
+		 && ( file_extent_logical_address > 0 )
+		 && ( previous_entry != NULL ) )
+		{
+			if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+			     file_system_btree,
+			     file_io_handle,
+			     previous_entry,
+			     &sub_node_block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine sub node block number.",
+				 function );
 
-/* Retrieves an inode for an UTF-8 encoded path from the file system B-tree
- * Returns 1 if successful, 0 if not found or -1 on error
- */
-int libfsapfs_file_system_btree_get_inode_by_utf8_path(
-     libfsapfs_file_system_btree_t *file_system_btree,
-     libbfio_handle_t *file_io_handle,
-     uint64_t parent_identifier,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsapfs_inode_t **inode,
-     libfsapfs_directory_record_t **directory_record,
-     libcerror_error_t **error )
-{
-	libfsapfs_btree_entry_t *btree_entry                = NULL;
-	libfsapfs_btree_node_t *btree_node                  = NULL;
-	libfsapfs_btree_node_t *root_node                   = NULL;
-	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	const uint8_t *utf8_string_segment                  = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_inode_by_utf8_path";
-	libuna_unicode_character_t unicode_character        = 0;
-	size_t utf8_string_index                            = 0;
-	size_t utf8_string_segment_length                   = 0;
-	uint64_t lookup_identifier                          = 0;
-	uint32_t name_hash                                  = 0;
-	int is_leaf_node                                    = 0;
-	int result                                          = 0;
+				goto on_error;
+			}
+			if( libfsapfs_file_system_btree_get_sub_node(
+			     file_system_btree,
+			     file_io_handle,
+			     sub_node_block_number,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
+				 function,
+				 sub_node_block_number );
 
-	if( file_system_btree == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file system B-tree.",
-		 function );
+				goto on_error;
+			}
+			is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+			                sub_node,
+			                error );
 
-		return( -1 );
-	}
-	if( utf8_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
-		 function );
+			if( is_leaf_node == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if B-tree sub node is a leaf node.",
+				 function );
 
-		return( -1 );
-	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
+				goto on_error;
+			}
+			if( is_leaf_node != 0 )
+			{
+				result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+				          file_system_btree,
+				          sub_node,
+				          identifier,
+				          file_extents,
+				          error );
+			}
+			else
+			{
+				result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+				          file_system_btree,
+				          file_io_handle,
+				          sub_node,
+				          identifier,
+				          file_extents,
+				          recursion_depth + 1,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree sub node.",
+				 function,
+				 identifier );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				found_file_extent = 1;
+			}
+			sub_node = NULL;
+		}
+		previous_entry = entry;
+	}
+	/* Fall-through for the last B-Tree entry
+	 */
+	if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+	     file_system_btree,
+	     file_io_handle,
+	     previous_entry,
+	     &sub_node_block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sub node block number.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( inode == NULL )
+	if( libfsapfs_file_system_btree_get_sub_node(
+	     file_system_btree,
+	     file_io_handle,
+	     sub_node_block_number,
+	     &sub_node,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid inode.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree sub node from block: %" PRIu64 ".",
+		 function,
+		 sub_node_block_number );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *inode != NULL )
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                sub_node,
+	                error );
+
+	if( is_leaf_node == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid inode value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree sub node is a leaf node.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( directory_record == NULL )
+	if( is_leaf_node != 0 )
+	{
+		result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+		          file_system_btree,
+		          sub_node,
+		          identifier,
+		          file_extents,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+		          file_system_btree,
+		          file_io_handle,
+		          sub_node,
+		          identifier,
+		          file_extents,
+		          recursion_depth + 1,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree sub node.",
+		 function,
+		 identifier );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		found_file_extent = 1;
+	}
+	return( found_file_extent );
+
+on_error:
+	libcdata_array_empty(
+	 file_extents,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves file extents for a specific identifier from the file system B-tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_system_btree_get_file_extents(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libcdata_array_t *file_extents,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *root_node = NULL;
+	static char *function             = "libfsapfs_file_system_btree_get_file_extents";
+	int is_leaf_node                  = 0;
+	int result                        = 0;
+
+	if( file_system_btree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory record.",
+		 "%s: invalid file system B-tree.",
 		 function );
 
 		return( -1 );
 	}
-	if( *directory_record != NULL )
+	/* A sealed volume stores the file extents in a separate file extent tree
+	 */
+	if( file_system_btree->file_extent_tree != NULL )
+	{
+		result = libfsapfs_file_extent_tree_get_file_extents(
+		          file_system_btree->file_extent_tree,
+		          file_io_handle,
+		          identifier,
+		          file_extents,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extents: %" PRIu64 " from file extent tree.",
+			 function,
+			 identifier );
+
+			return( -1 );
+		}
+		return( result );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid directory record value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving file extents of: %" PRIu64 "\n",
+		 function,
+		 identifier );
+	}
+#endif
 	if( libfsapfs_file_system_btree_get_root_node(
 	     file_system_btree,
 	     file_io_handle,
@@ -5701,174 +6008,200 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_path(
 
 		goto on_error;
 	}
-	lookup_identifier = parent_identifier;
-
-	if( utf8_string_length > 0 )
+	if( is_leaf_node != 0 )
 	{
-		/* Ignore a leading separator
-		 */
-		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSAPFS_SEPARATOR )
-		{
-			utf8_string_index++;
-		}
+		result = libfsapfs_file_system_btree_get_file_extents_from_leaf_node(
+		          file_system_btree,
+		          root_node,
+		          identifier,
+		          file_extents,
+		          error );
 	}
-	if( ( utf8_string_length == 0 )
-	 || ( utf8_string_length == 1 ) )
+	else
 	{
-		result = 1;
+		result = libfsapfs_file_system_btree_get_file_extents_from_branch_node(
+		          file_system_btree,
+		          file_io_handle,
+		          root_node,
+		          identifier,
+		          file_extents,
+		          0,
+		          error );
 	}
-	else while( utf8_string_index < utf8_string_length )
+	if( result == -1 )
 	{
-		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
-		utf8_string_segment_length = utf8_string_index;
-
-		while( utf8_string_index < utf8_string_length )
-		{
-			if( libuna_unicode_character_copy_from_utf8(
-			     &unicode_character,
-			     utf8_string,
-			     utf8_string_length,
-			     &utf8_string_index,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-8 string to Unicode character.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file extents: %" PRIu64 " from file system B-tree root node.",
+		 function,
+		 identifier );
 
-				goto on_error;
-			}
-			if( ( unicode_character == (libuna_unicode_character_t) LIBFSAPFS_SEPARATOR )
-			 || ( unicode_character == 0 ) )
-			{
-				utf8_string_segment_length += 1;
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-				break;
-			}
-		}
-		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
 
-		if( utf8_string_segment_length == 0 )
-		{
-			result = 0;
-		}
-		else
-		{
-			if( libfsapfs_name_hash_calculate_from_utf8_string(
-			     &name_hash,
-			     utf8_string_segment,
-			     utf8_string_segment_length,
-			     file_system_btree->use_case_folding,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine name hash.",
-				 function );
+		return( -1 );
+	}
+	return( result );
 
-				goto on_error;
-			}
-			if( safe_directory_record != NULL )
-			{
-				if( libfsapfs_directory_record_free(
-				     &safe_directory_record,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free directory record.",
-					 function );
+on_error:
+	libcdata_array_empty(
+	 file_extents,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	 NULL );
 
-					goto on_error;
-				}
-			}
-			if( is_leaf_node != 0 )
-			{
-				result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
-					  file_system_btree,
-					  root_node,
-					  lookup_identifier,
-					  utf8_string_segment,
-					  utf8_string_segment_length,
-				          name_hash,
-					  &safe_directory_record,
-					  error );
-			}
-			else
-			{
-				result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
-					  file_system_btree,
-					  file_io_handle,
-					  root_node,
-					  lookup_identifier,
-					  utf8_string_segment,
-					  utf8_string_segment_length,
-				          name_hash,
-					  &safe_directory_record,
-					  0,
-					  error );
-			}
-		}
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry by name.",
-			 function );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			break;
-		}
-		if( libfsapfs_directory_record_get_identifier(
-		     safe_directory_record,
-		     &lookup_identifier,
+/* Retrieves an inode for a specific identifier from the file system B-tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_system_btree_get_inode_by_identifier(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t identifier,
+     libfsapfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *btree_node   = NULL;
+	static char *function                = "libfsapfs_file_system_btree_get_inode_by_identifier";
+	int result                           = 0;
+
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp     = 0;
+#endif
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_system_btree->io_handle->profiler,
+		     &profiler_start_timestamp,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve directory entry identifier.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	root_node = NULL;
+#endif /* defined( HAVE_PROFILER ) */
 
-	if( result != 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_entry_by_identifier(
-		          file_system_btree,
-		          file_io_handle,
-		          lookup_identifier,
-		          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
-		          &btree_node,
-		          &btree_entry,
-		          error );
+		libcnotify_printf(
+		 "%s: retrieving inode of: %" PRIu64 "\n",
+		 function,
+		 identifier );
+	}
+#endif
+	result = libfsapfs_file_system_btree_get_entry_by_identifier(
+	          file_system_btree,
+	          file_io_handle,
+	          identifier,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
+	          &btree_node,
+	          &btree_entry,
+	          error );
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry from B-tree node.",
-			 function );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from B-tree node.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
 		if( btree_node == NULL )
 		{
 			libcerror_error_set(
@@ -5935,36 +6268,84 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_path(
 			goto on_error;
 		}
 		btree_node = NULL;
+	}
+#if defined( HAVE_PROFILER )
+	if( file_system_btree->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     file_system_btree->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
 
-		*directory_record = safe_directory_record;
+			goto on_error;
+		}
 	}
-	return( result );
+#endif /* defined( HAVE_PROFILER ) */
 
-on_error:
-	if( safe_directory_record != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
 	{
-		libfsapfs_directory_record_free(
-		 &safe_directory_record,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
 	}
+	return( result );
+
+on_error:
 	if( *inode != NULL )
 	{
 		libfsapfs_inode_free(
 		 inode,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves an inode for an UTF-16 encoded name from the file system B-tree
+/* Retrieves an inode for an UTF-8 encoded name from the file system B-tree
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_inode_by_utf16_name(
+int libfsapfs_file_system_btree_get_inode_by_utf8_name(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      uint64_t parent_identifier,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      libfsapfs_inode_t **inode,
      libfsapfs_directory_record_t **directory_record,
      libcerror_error_t **error )
@@ -5972,7 +6353,7 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 	libfsapfs_btree_entry_t *btree_entry = NULL;
 	libfsapfs_btree_node_t *btree_node   = NULL;
 	libfsapfs_btree_node_t *root_node    = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_inode_by_utf16_name";
+	static char *function                = "libfsapfs_file_system_btree_get_inode_by_utf8_name";
 	uint64_t lookup_identifier           = 0;
 	uint32_t name_hash                   = 0;
 	int is_leaf_node                     = 0;
@@ -5989,24 +6370,24 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -6055,6 +6436,21 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfsapfs_file_system_btree_get_root_node(
 	     file_system_btree,
 	     file_io_handle,
@@ -6086,10 +6482,10 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 
 		goto on_error;
 	}
-	if( libfsapfs_name_hash_calculate_from_utf16_string(
+	if( libfsapfs_name_hash_calculate_from_utf8_string(
 	     &name_hash,
-	     utf16_string,
-	     utf16_string_length,
+	     utf8_string,
+	     utf8_string_length,
 	     file_system_btree->use_case_folding,
 	     error ) != 1 )
 	{
@@ -6104,25 +6500,25 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 	}
 	if( is_leaf_node != 0 )
 	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
 			  file_system_btree,
 			  root_node,
 			  parent_identifier,
-			  utf16_string,
-			  utf16_string_length,
+			  utf8_string,
+			  utf8_string_length,
 			  name_hash,
 			  directory_record,
 			  error );
 	}
 	else
 	{
-		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
 			  file_system_btree,
 			  file_io_handle,
 			  root_node,
 			  parent_identifier,
-			  utf16_string,
-			  utf16_string_length,
+			  utf8_string,
+			  utf8_string_length,
 			  name_hash,
 			  directory_record,
 			  0,
@@ -6247,6 +6643,34 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 		}
 		btree_node = NULL;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
 	return( result );
 
 on_error:
@@ -6262,18 +6686,23 @@ on_error:
 		 inode,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves an inode for an UTF-16 encoded path from the file system B-tree
+/* Retrieves an inode for an UTF-8 encoded path from the file system B-tree
  * Returns 1 if successful, 0 if not found or -1 on error
  */
-int libfsapfs_file_system_btree_get_inode_by_utf16_path(
+int libfsapfs_file_system_btree_get_inode_by_utf8_path(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
      uint64_t parent_identifier,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      libfsapfs_inode_t **inode,
      libfsapfs_directory_record_t **directory_record,
      libcerror_error_t **error )
@@ -6282,11 +6711,11 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 	libfsapfs_btree_node_t *btree_node                  = NULL;
 	libfsapfs_btree_node_t *root_node                   = NULL;
 	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	const uint16_t *utf16_string_segment                = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_inode_by_utf16_path";
+	const uint8_t *utf8_string_segment                  = NULL;
+	static char *function                               = "libfsapfs_file_system_btree_get_inode_by_utf8_path";
 	libuna_unicode_character_t unicode_character        = 0;
-	size_t utf16_string_index                           = 0;
-	size_t utf16_string_segment_length                  = 0;
+	size_t utf8_string_index                            = 0;
+	size_t utf8_string_segment_length                   = 0;
 	uint64_t lookup_identifier                          = 0;
 	uint32_t name_hash                                  = 0;
 	int is_leaf_node                                    = 0;
@@ -6303,24 +6732,24 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 
 		return( -1 );
 	}
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_length > (size_t) SSIZE_MAX )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
 		 function );
 
 		return( -1 );
@@ -6369,6 +6798,21 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfsapfs_file_system_btree_get_root_node(
 	     file_system_btree,
 	     file_io_handle,
@@ -6402,39 +6846,39 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 	}
 	lookup_identifier = parent_identifier;
 
-	if( utf16_string_length > 0 )
+	if( utf8_string_length > 0 )
 	{
 		/* Ignore a leading separator
 		 */
-		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSAPFS_SEPARATOR )
+		if( utf8_string[ utf8_string_index ] == (uint8_t) LIBFSAPFS_SEPARATOR )
 		{
-			utf16_string_index++;
+			utf8_string_index++;
 		}
 	}
-	if( ( utf16_string_length == 0 )
-	 || ( utf16_string_length == 1 ) )
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length == 1 ) )
 	{
 		result = 1;
 	}
-	else while( utf16_string_index < utf16_string_length )
+	else while( utf8_string_index < utf8_string_length )
 	{
-		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
+		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_length = utf8_string_index;
 
-		while( utf16_string_index < utf16_string_length )
+		while( utf8_string_index < utf8_string_length )
 		{
-			if( libuna_unicode_character_copy_from_utf16(
+			if( libuna_unicode_character_copy_from_utf8(
 			     &unicode_character,
-			     utf16_string,
-			     utf16_string_length,
-			     &utf16_string_index,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 "%s: unable to copy UTF-8 string to Unicode character.",
 				 function );
 
 				goto on_error;
@@ -6442,23 +6886,23 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 			if( ( unicode_character == (libuna_unicode_character_t) LIBFSAPFS_SEPARATOR )
 			 || ( unicode_character == 0 ) )
 			{
-				utf16_string_segment_length += 1;
+				utf8_string_segment_length += 1;
 
 				break;
 			}
 		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_length;
 
-		if( utf16_string_segment_length == 0 )
+		if( utf8_string_segment_length == 0 )
 		{
 			result = 0;
 		}
 		else
 		{
-			if( libfsapfs_name_hash_calculate_from_utf16_string(
+			if( libfsapfs_name_hash_calculate_from_utf8_string(
 			     &name_hash,
-			     utf16_string_segment,
-			     utf16_string_segment_length,
+			     utf8_string_segment,
+			     utf8_string_segment_length,
 			     file_system_btree->use_case_folding,
 			     error ) != 1 )
 			{
@@ -6489,25 +6933,25 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 			}
 			if( is_leaf_node != 0 )
 			{
-				result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+				result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name(
 					  file_system_btree,
 					  root_node,
 					  lookup_identifier,
-					  utf16_string_segment,
-					  utf16_string_segment_length,
+					  utf8_string_segment,
+					  utf8_string_segment_length,
 				          name_hash,
 					  &safe_directory_record,
 					  error );
 			}
 			else
 			{
-				result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+				result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name(
 					  file_system_btree,
 					  file_io_handle,
 					  root_node,
 					  lookup_identifier,
-					  utf16_string_segment,
-					  utf16_string_segment_length,
+					  utf8_string_segment,
+					  utf8_string_segment_length,
 				          name_hash,
 					  &safe_directory_record,
 					  0,
@@ -6637,6 +7081,34 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 
 		*directory_record = safe_directory_record;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
 	return( result );
 
 on_error:
@@ -6652,6 +7124,1427 @@ on_error:
 		 inode,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
+/* Retrieves an inode for an UTF-16 encoded name from the file system B-tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_system_btree_get_inode_by_utf16_name(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsapfs_inode_t **inode,
+     libfsapfs_directory_record_t **directory_record,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_btree_node_t *btree_node   = NULL;
+	libfsapfs_btree_node_t *root_node    = NULL;
+	static char *function                = "libfsapfs_file_system_btree_get_inode_by_utf16_name";
+	uint64_t lookup_identifier           = 0;
+	uint32_t name_hash                   = 0;
+	int is_leaf_node                     = 0;
+	int result                           = 0;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory record value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_get_root_node(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                root_node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_name_hash_calculate_from_utf16_string(
+	     &name_hash,
+	     utf16_string,
+	     utf16_string_length,
+	     file_system_btree->use_case_folding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine name hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_leaf_node != 0 )
+	{
+		result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+			  file_system_btree,
+			  root_node,
+			  parent_identifier,
+			  utf16_string,
+			  utf16_string_length,
+			  name_hash,
+			  directory_record,
+			  error );
+	}
+	else
+	{
+		result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+			  file_system_btree,
+			  file_io_handle,
+			  root_node,
+			  parent_identifier,
+			  utf16_string,
+			  utf16_string_length,
+			  name_hash,
+			  directory_record,
+			  0,
+			  error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsapfs_directory_record_get_identifier(
+		     *directory_record,
+		     &lookup_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	root_node = NULL;
+
+	if( result != 0 )
+	{
+		result = libfsapfs_file_system_btree_get_entry_by_identifier(
+		          file_system_btree,
+		          file_io_handle,
+		          lookup_identifier,
+		          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
+		          &btree_node,
+		          &btree_entry,
+		          error );
+
+		if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_initialize(
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_key_data(
+		     *inode,
+		     btree_entry->key_data,
+		     (size_t) btree_entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_value_data(
+		     *inode,
+		     btree_entry->value_data,
+		     (size_t) btree_entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode value data.",
+			 function );
+
+			goto on_error;
+		}
+		btree_node = NULL;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( *directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 directory_record,
+		 NULL );
+	}
+	if( *inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves an inode for an UTF-16 encoded path from the file system B-tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_system_btree_get_inode_by_utf16_path(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_identifier,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsapfs_inode_t **inode,
+     libfsapfs_directory_record_t **directory_record,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry                = NULL;
+	libfsapfs_btree_node_t *btree_node                  = NULL;
+	libfsapfs_btree_node_t *root_node                   = NULL;
+	libfsapfs_directory_record_t *safe_directory_record = NULL;
+	const uint16_t *utf16_string_segment                = NULL;
+	static char *function                               = "libfsapfs_file_system_btree_get_inode_by_utf16_path";
+	libuna_unicode_character_t unicode_character        = 0;
+	size_t utf16_string_index                           = 0;
+	size_t utf16_string_segment_length                  = 0;
+	uint64_t lookup_identifier                          = 0;
+	uint32_t name_hash                                  = 0;
+	int is_leaf_node                                    = 0;
+	int result                                          = 0;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory record value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_get_root_node(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve B-tree root node.",
+		 function );
+
+		goto on_error;
+	}
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                root_node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree root node is a leaf node.",
+		 function );
+
+		goto on_error;
+	}
+	lookup_identifier = parent_identifier;
+
+	if( utf16_string_length > 0 )
+	{
+		/* Ignore a leading separator
+		 */
+		if( utf16_string[ utf16_string_index ] == (uint16_t) LIBFSAPFS_SEPARATOR )
+		{
+			utf16_string_index++;
+		}
+	}
+	if( ( utf16_string_length == 0 )
+	 || ( utf16_string_length == 1 ) )
+	{
+		result = 1;
+	}
+	else while( utf16_string_index < utf16_string_length )
+	{
+		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_length = utf16_string_index;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBFSAPFS_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_length += 1;
+
+				break;
+			}
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+
+		if( utf16_string_segment_length == 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			if( libfsapfs_name_hash_calculate_from_utf16_string(
+			     &name_hash,
+			     utf16_string_segment,
+			     utf16_string_segment_length,
+			     file_system_btree->use_case_folding,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine name hash.",
+				 function );
+
+				goto on_error;
+			}
+			if( safe_directory_record != NULL )
+			{
+				if( libfsapfs_directory_record_free(
+				     &safe_directory_record,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory record.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( is_leaf_node != 0 )
+			{
+				result = libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name(
+					  file_system_btree,
+					  root_node,
+					  lookup_identifier,
+					  utf16_string_segment,
+					  utf16_string_segment_length,
+				          name_hash,
+					  &safe_directory_record,
+					  error );
+			}
+			else
+			{
+				result = libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name(
+					  file_system_btree,
+					  file_io_handle,
+					  root_node,
+					  lookup_identifier,
+					  utf16_string_segment,
+					  utf16_string_segment_length,
+				          name_hash,
+					  &safe_directory_record,
+					  0,
+					  error );
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry by name.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsapfs_directory_record_get_identifier(
+		     safe_directory_record,
+		     &lookup_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry identifier.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	root_node = NULL;
+
+	if( result != 0 )
+	{
+		result = libfsapfs_file_system_btree_get_entry_by_identifier(
+		          file_system_btree,
+		          file_io_handle,
+		          lookup_identifier,
+		          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
+		          &btree_node,
+		          &btree_entry,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry from B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_initialize(
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_key_data(
+		     *inode,
+		     btree_entry->key_data,
+		     (size_t) btree_entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_value_data(
+		     *inode,
+		     btree_entry->value_data,
+		     (size_t) btree_entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode value data.",
+			 function );
+
+			goto on_error;
+		}
+		btree_node = NULL;
+
+		*directory_record = safe_directory_record;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( safe_directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &safe_directory_record,
+		 NULL );
+	}
+	if( *inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Determines the identifiers that partition the file system B-tree into ranges of roughly equal numbers of leaf nodes
+ * The B-tree is descended level by level until there are enough branch entries to choose from
+ * or the branch entries refer to leaf nodes, entries of the same level are considered to span
+ * a comparable number of leaf nodes
+ * Partition N contains the records with an identifier from partition_identifiers[ N ] up to,
+ * but not including, partition_identifiers[ N + 1 ], the first partition identifier is always 0
+ * The records of one identifier are never split over multiple partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_get_partition_identifiers(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *partition_identifiers,
+     int maximum_number_of_partitions,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry   = NULL;
+	libfsapfs_btree_node_t *btree_node     = NULL;
+	static char *function                  = "libfsapfs_file_system_btree_get_partition_identifiers";
+	uint64_t *entry_identifiers            = NULL;
+	uint64_t *node_block_numbers           = NULL;
+	uint64_t *sub_node_block_numbers       = NULL;
+	uint64_t *sub_node_identifiers         = NULL;
+	uint64_t *reallocated_values           = NULL;
+	uint64_t file_system_identifier        = 0;
+	uint64_t identifier                    = 0;
+	size_t values_size                     = 0;
+	int entry_index                        = 0;
+	int is_leaf_node                       = 0;
+	int level                              = 0;
+	int node_index                         = 0;
+	int node_level                         = 0;
+	int number_of_allocated_sub_nodes      = 0;
+	int number_of_entries                  = 0;
+	int number_of_nodes                    = 0;
+	int number_of_sub_nodes                = 0;
+	int partition_index                    = 0;
+	int result                             = 0;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_partitions <= 0 )
+	 || ( maximum_number_of_partitions > LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	node_block_numbers = (uint64_t *) memory_allocate(
+	                                   sizeof( uint64_t ) );
+
+	if( node_block_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node block numbers.",
+		 function );
+
+		goto on_error;
+	}
+	entry_identifiers = (uint64_t *) memory_allocate(
+	                                  sizeof( uint64_t ) );
+
+	if( entry_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	node_block_numbers[ 0 ] = file_system_btree->root_node_block_number;
+	entry_identifiers[ 0 ]  = 0;
+	number_of_nodes         = 1;
+
+	for( level = 0;
+	     level < LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH;
+	     level++ )
+	{
+		if( number_of_nodes >= ( maximum_number_of_partitions * LIBFSAPFS_PARTITION_MINIMUM_NUMBER_OF_ENTRIES ) )
+		{
+			break;
+		}
+		number_of_sub_nodes = 0;
+
+		for( node_index = 0;
+		     node_index < number_of_nodes;
+		     node_index++ )
+		{
+			if( level == 0 )
+			{
+				result = libfsapfs_file_system_btree_get_root_node(
+				          file_system_btree,
+				          file_io_handle,
+				          node_block_numbers[ node_index ],
+				          &btree_node,
+				          error );
+			}
+			else
+			{
+				result = libfsapfs_file_system_btree_get_sub_node(
+				          file_system_btree,
+				          file_io_handle,
+				          node_block_numbers[ node_index ],
+				          &btree_node,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve B-tree node: %" PRIu64 ".",
+				 function,
+				 node_block_numbers[ node_index ] );
+
+				goto on_error;
+			}
+			is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+			                btree_node,
+			                error );
+
+			if( is_leaf_node == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if B-tree node: %" PRIu64 " is a leaf node.",
+				 function,
+				 node_block_numbers[ node_index ] );
+
+				goto on_error;
+			}
+			if( is_leaf_node != 0 )
+			{
+				if( level != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported leaf node: %" PRIu64 " at level: %d.",
+					 function,
+					 node_block_numbers[ node_index ],
+					 level );
+
+					goto on_error;
+				}
+				break;
+			}
+			node_level = (int) btree_node->node_header->level;
+
+			if( libfsapfs_btree_node_get_number_of_entries(
+			     btree_node,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries of B-tree node: %" PRIu64 ".",
+				 function,
+				 node_block_numbers[ node_index ] );
+
+				goto on_error;
+			}
+			if( number_of_entries > ( number_of_allocated_sub_nodes - number_of_sub_nodes ) )
+			{
+				number_of_allocated_sub_nodes = number_of_sub_nodes + number_of_entries;
+
+				if( number_of_allocated_sub_nodes < ( 2 * number_of_sub_nodes ) )
+				{
+					number_of_allocated_sub_nodes = 2 * number_of_sub_nodes;
+				}
+				if( number_of_allocated_sub_nodes > LIBFSAPFS_PARTITION_MAXIMUM_NUMBER_OF_ENTRIES )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid number of sub nodes value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				values_size = sizeof( uint64_t ) * number_of_allocated_sub_nodes;
+
+				reallocated_values = (uint64_t *) memory_reallocate(
+				                                   sub_node_block_numbers,
+				                                   values_size );
+
+				if( reallocated_values == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize sub node block numbers.",
+					 function );
+
+					goto on_error;
+				}
+				sub_node_block_numbers = reallocated_values;
+
+				reallocated_values = (uint64_t *) memory_reallocate(
+				                                   sub_node_identifiers,
+				                                   values_size );
+
+				if( reallocated_values == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize sub node identifiers.",
+					 function );
+
+					goto on_error;
+				}
+				sub_node_identifiers = reallocated_values;
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				if( libfsapfs_btree_node_get_entry_by_index(
+				     btree_node,
+				     entry_index,
+				     &btree_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve entry: %d of B-tree node: %" PRIu64 ".",
+					 function,
+					 entry_index,
+					 node_block_numbers[ node_index ] );
+
+					goto on_error;
+				}
+				if( ( btree_entry == NULL )
+				 || ( btree_entry->key_data == NULL )
+				 || ( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: invalid entry: %d of B-tree node: %" PRIu64 ".",
+					 function,
+					 entry_index,
+					 node_block_numbers[ node_index ] );
+
+					goto on_error;
+				}
+				byte_stream_copy_to_uint64_little_endian(
+				 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+				 file_system_identifier );
+
+				if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+				     file_system_btree,
+				     file_io_handle,
+				     btree_entry,
+				     &( sub_node_block_numbers[ number_of_sub_nodes ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine sub node block number of entry: %d of B-tree node: %" PRIu64 ".",
+					 function,
+					 entry_index,
+					 node_block_numbers[ node_index ] );
+
+					goto on_error;
+				}
+				sub_node_identifiers[ number_of_sub_nodes++ ] = file_system_identifier & 0x0fffffffffffffffUL;
+			}
+		}
+		if( is_leaf_node != 0 )
+		{
+			break;
+		}
+		memory_free(
+		 node_block_numbers );
+
+		memory_free(
+		 entry_identifiers );
+
+		node_block_numbers     = sub_node_block_numbers;
+		entry_identifiers      = sub_node_identifiers;
+		number_of_nodes        = number_of_sub_nodes;
+		sub_node_block_numbers = NULL;
+		sub_node_identifiers   = NULL;
+
+		number_of_allocated_sub_nodes = 0;
+
+		/* The entries of a level 1 branch node refer to leaf nodes
+		 */
+		if( node_level <= 1 )
+		{
+			break;
+		}
+	}
+	/* The first entry of the left-most node can contain an identifier larger than 0
+	 * hence the first partition always starts at identifier 0
+	 */
+	partition_identifiers[ 0 ] = 0;
+	*number_of_partitions      = 1;
+
+	for( partition_index = 1;
+	     partition_index < maximum_number_of_partitions;
+	     partition_index++ )
+	{
+		entry_index = (int) ( ( (int64_t) partition_index * number_of_nodes ) / maximum_number_of_partitions );
+
+		identifier = entry_identifiers[ entry_index ];
+
+		if( identifier > partition_identifiers[ *number_of_partitions - 1 ] )
+		{
+			partition_identifiers[ *number_of_partitions ] = identifier;
+
+			*number_of_partitions += 1;
+		}
+	}
+	memory_free(
+	 entry_identifiers );
+
+	memory_free(
+	 node_block_numbers );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( sub_node_identifiers != NULL )
+	{
+		memory_free(
+		 sub_node_identifiers );
+	}
+	if( sub_node_block_numbers != NULL )
+	{
+		memory_free(
+		 sub_node_block_numbers );
+	}
+	if( entry_identifiers != NULL )
+	{
+		memory_free(
+		 entry_identifiers );
+	}
+	if( node_block_numbers != NULL )
+	{
+		memory_free(
+		 node_block_numbers );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 file_system_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the amount of memory used by the caches of the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_get_memory_usage(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_system_btree_get_memory_usage";
+	int result            = 1;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_cache_memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block cache memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_cache_usage_get_node_cache_memory_usage(
+	     file_system_btree->node_cache,
+	     node_cache_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The file system B-tree nodes are read without a data block cache
+		 */
+		*data_block_cache_memory_usage = 0;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Trims the caches of the file system B-tree for a specific trim level
+ * Values are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_trim_caches(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_system_btree_trim_caches";
+	int result            = 1;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The file system B-tree nodes are read without a data block cache
+	 */
+	if( trim_level != LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS )
+	{
+		result = libfsapfs_cache_usage_trim_node_cache(
+		          file_system_btree->node_cache,
+		          trim_level,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to trim caches.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
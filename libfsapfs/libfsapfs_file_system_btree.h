@@ -28,11 +28,13 @@
 #include "libfsapfs_btree_node.h"
 #include "libfsapfs_directory_record.h"
 #include "libfsapfs_encryption_context.h"
+#include "libfsapfs_file_extent_tree.h"
 #include "libfsapfs_inode.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_btree.h"
@@ -57,25 +59,46 @@ struct libfsapfs_file_system_btree
 	 */
 	libfdata_vector_t *data_block_vector;
 
-	/* The data block cache
-	 */
-	libfcache_cache_t *data_block_cache;
-
 	/* The node cache
 	 */
 	libfcache_cache_t *node_cache;
 
+	/* The pending nodes array
+	 * contains the nodes read while the B-tree was locked for reading
+	 * which are added to the node cache once it is locked for writing
+	 */
+	libcdata_array_t *pending_nodes_array;
+
 	/* The volume object map B-tree
 	 */
 	libfsapfs_object_map_btree_t *object_map_btree;
 
+	/* The volume file extent tree
+	 */
+	libfsapfs_file_extent_tree_t *file_extent_tree;
+
 	/* The block number of B-tree root node
 	 */
 	uint64_t root_node_block_number;
 
+	/* The transaction identifier of the volume superblock
+	 */
+	uint64_t transaction_identifier;
+
 	/* Flag to indicate case folding should be used
 	 */
 	uint8_t use_case_folding;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The node cache read/write lock
+	 * serializes access to the node cache and pending nodes by concurrent lookups
+	 */
+	libcthreads_read_write_lock_t *node_cache_read_write_lock;
+#endif
 };
 
 int libfsapfs_file_system_btree_initialize(
@@ -84,6 +107,7 @@ int libfsapfs_file_system_btree_initialize(
      libfsapfs_encryption_context_t *encryption_context,
      libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
+     libfsapfs_file_extent_tree_t *file_extent_tree,
      uint64_t root_node_block_number,
      uint8_t use_case_folding,
      libcerror_error_t **error );
@@ -92,6 +116,10 @@ int libfsapfs_file_system_btree_free(
      libfsapfs_file_system_btree_t **file_system_btree,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_btree_pending_node_free(
+     libfcache_cache_value_t **cache_value,
+     libcerror_error_t **error );
+
 int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
@@ -99,6 +127,17 @@ int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
      uint64_t *sub_node_block_number,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_btree_get_node(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t node_block_number,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_flush_pending_nodes(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libcerror_error_t **error );
+
 int libfsapfs_file_system_btree_get_root_node(
      libfsapfs_file_system_btree_t *file_system_btree,
      libbfio_handle_t *file_io_handle,
@@ -113,6 +152,25 @@ int libfsapfs_file_system_btree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_btree_read_node(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t node_block_number,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_read_leaf_nodes(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t node_block_number,
+     int (*callback_function)(
+            intptr_t *callback_data,
+            libfsapfs_btree_node_t *node,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     int recursion_depth,
+     libcerror_error_t **error );
+
 int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
      libfsapfs_file_system_btree_t *file_system_btree,
      libfsapfs_btree_node_t *node,
@@ -291,6 +349,27 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
      libfsapfs_directory_record_t **directory_record,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_btree_get_partition_identifiers(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t *partition_identifiers,
+     int maximum_number_of_partitions,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_get_memory_usage(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_trim_caches(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -157,6 +157,45 @@ int libfsapfs_file_system_data_handle_free(
 	return( 1 );
 }
 
+/* Sets the file IO pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_file_system_data_handle_set_file_io_pool(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_file_system_data_handle_set_file_io_pool";
+
+	if( file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file IO pool entry value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	file_system_data_handle->file_io_pool       = file_io_pool;
+	file_system_data_handle->file_io_pool_entry = file_io_pool_entry;
+
+	return( 1 );
+}
+
 /* Reads a data block
  * Callback function for a data block vector
  * Returns 1 if successful or -1 on error
@@ -219,8 +258,9 @@ int libfsapfs_file_system_data_handle_read_data_block(
 
 		return( -1 );
 	}
-	if( libfsapfs_data_block_initialize(
+	if( libfsapfs_data_block_initialize_from_pool(
 	     &data_block,
+	     file_system_data_handle->io_handle->block_buffer_pool,
 	     (size_t) element_data_size,
 	     error ) != 1 )
 	{
@@ -306,11 +346,13 @@ int libfsapfs_file_system_data_handle_read_data_block(
 			file_extent_offset    = (int64_t) encryption_identifier - (int64_t) file_extent->physical_block_number;
 			encryption_identifier = file_extent->encryption_identifier + file_extent_offset;
 		}
-		if( libfsapfs_data_block_read(
+		if( libfsapfs_data_block_read_data(
 		     data_block,
 		     file_system_data_handle->io_handle,
 		     file_system_data_handle->encryption_context,
 		     file_io_handle,
+		     file_system_data_handle->file_io_pool,
+		     file_system_data_handle->file_io_pool_entry,
 		     element_data_offset,
 		     encryption_identifier,
 		     error ) != 1 )
@@ -52,6 +52,15 @@ struct libfsapfs_file_system_data_handle
 	/* The file extents
 	 */
 	libcdata_array_t *file_extents;
+
+	/* The file IO pool, when set the data is read from the pool instead
+	 * of the file IO handle passed to the read function
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The file IO pool entry
+	 */
+	int file_io_pool_entry;
 };
 
 int libfsapfs_file_system_data_handle_initialize(
@@ -65,6 +74,12 @@ int libfsapfs_file_system_data_handle_free(
      libfsapfs_file_system_data_handle_t **file_system_data_handle,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_data_handle_set_file_io_pool(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     libcerror_error_t **error );
+
 int libfsapfs_file_system_data_handle_read_data_block(
      libfsapfs_file_system_data_handle_t *file_system_data_handle,
      libbfio_handle_t *file_io_handle,
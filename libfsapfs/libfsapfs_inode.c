@@ -692,10 +692,25 @@ int libfsapfs_inode_read_value_data(
 					break;
 
 				case 8:
+					if( (size_t) value_data_size < sizeof( fsapfs_file_system_data_stream_attribute_t ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid data stream attribute value data size value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
 					byte_stream_copy_to_uint64_little_endian(
 					 ( (fsapfs_file_system_data_stream_attribute_t *) value_data )->used_size,
 					 inode->data_stream_size );
 
+					byte_stream_copy_to_uint64_little_endian(
+					 ( (fsapfs_file_system_data_stream_attribute_t *) value_data )->allocated_size,
+					 inode->data_stream_allocated_size );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 					if( libcnotify_verbose != 0 )
 					{
@@ -704,13 +719,10 @@ int libfsapfs_inode_read_value_data(
 						 function,
 						 inode->data_stream_size );
 
-						byte_stream_copy_to_uint64_little_endian(
-						 ( (fsapfs_file_system_data_stream_attribute_t *) value_data )->allocated_size,
-						 value_64bit );
 						libcnotify_printf(
 						 "%s: allocated size\t\t\t\t: %" PRIu64 "\n",
 						 function,
-						 value_64bit );
+						 inode->data_stream_allocated_size );
 
 						byte_stream_copy_to_uint64_little_endian(
 						 ( (fsapfs_file_system_data_stream_attribute_t *) value_data )->encryption_identifier,
@@ -1031,6 +1043,83 @@ int libfsapfs_inode_get_access_time(
 	return( 1 );
 }
 
+/* Retrieves the creation, modification, access and inode change times
+ * The timestamps are signed 64-bit POSIX date and time values in number of nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_inode_get_timestamps(
+     libfsapfs_inode_t *inode,
+     int64_t *creation_time,
+     int64_t *modification_time,
+     int64_t *access_time,
+     int64_t *inode_change_time,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_inode_get_timestamps";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( creation_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid creation time.",
+		 function );
+
+		return( -1 );
+	}
+	if( modification_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access time.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_change_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode change time.",
+		 function );
+
+		return( -1 );
+	}
+	*creation_time     = (int64_t) inode->creation_time;
+	*modification_time = (int64_t) inode->modification_time;
+	*access_time       = (int64_t) inode->access_time;
+	*inode_change_time = (int64_t) inode->inode_change_time;
+
+	return( 1 );
+}
+
 /* Retrieves the owner identifier
  * Returns 1 if successful or -1 on error
  */
@@ -1224,6 +1313,71 @@ int libfsapfs_inode_get_utf8_name(
 	return( 1 );
 }
 
+/* Retrieves a view of the UTF-8 encoded name
+ * The view points into the inode name storage and is valid for
+ * the lifetime of the inode, the length excludes the end of string character
+ * The name is returned as stored and is not validated
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_inode_get_utf8_name_view(
+     libfsapfs_inode_t *inode,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_inode_get_utf8_name_view";
+	size_t name_length    = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->name == NULL )
+	{
+		return( 0 );
+	}
+	name_length = (size_t) inode->name_size;
+
+	if( ( name_length > 0 )
+	 && ( inode->name[ name_length - 1 ] == 0 ) )
+	{
+		name_length -= 1;
+	}
+	*utf8_string        = inode->name;
+	*utf8_string_length = name_length;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-16 encoded name
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -1417,3 +1571,40 @@ int libfsapfs_inode_get_data_stream_size(
 	return( 1 );
 }
 
+/* Retrieves the data stream allocated size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_inode_get_data_stream_allocated_size(
+     libfsapfs_inode_t *inode,
+     uint64_t *data_stream_allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_inode_get_data_stream_allocated_size";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream_allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_stream_allocated_size = inode->data_stream_allocated_size;
+
+	return( 1 );
+}
+
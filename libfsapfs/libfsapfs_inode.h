@@ -90,6 +90,10 @@ struct libfsapfs_inode
 	/* The data stream size
 	 */
 	uint64_t data_stream_size;
+
+	/* The data stream allocated size
+	 */
+	uint64_t data_stream_allocated_size;
 };
 
 int libfsapfs_inode_initialize(
@@ -142,6 +146,14 @@ int libfsapfs_inode_get_access_time(
      int64_t *posix_time,
      libcerror_error_t **error );
 
+int libfsapfs_inode_get_timestamps(
+     libfsapfs_inode_t *inode,
+     int64_t *creation_time,
+     int64_t *modification_time,
+     int64_t *access_time,
+     int64_t *inode_change_time,
+     libcerror_error_t **error );
+
 int libfsapfs_inode_get_owner_identifier(
      libfsapfs_inode_t *inode,
      uint32_t *owner_identifier,
@@ -168,6 +180,12 @@ int libfsapfs_inode_get_utf8_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libfsapfs_inode_get_utf8_name_view(
+     libfsapfs_inode_t *inode,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
 int libfsapfs_inode_get_utf16_name_size(
      libfsapfs_inode_t *inode,
      size_t *utf16_string_size,
@@ -194,6 +212,11 @@ int libfsapfs_inode_get_data_stream_size(
      uint64_t *data_stream_size,
      libcerror_error_t **error );
 
+int libfsapfs_inode_get_data_stream_allocated_size(
+     libfsapfs_inode_t *inode,
+     uint64_t *data_stream_allocated_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
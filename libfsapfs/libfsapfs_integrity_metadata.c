@@ -0,0 +1,535 @@
+/*
+ * The integrity metadata functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_checksum.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_integrity_metadata.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+
+#include "fsapfs_integrity_metadata.h"
+
+/* Creates a integrity metadata
+ * Make sure the value integrity_metadata is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_integrity_metadata_initialize(
+     libfsapfs_integrity_metadata_t **integrity_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_integrity_metadata_initialize";
+
+	if( integrity_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( *integrity_metadata != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid integrity metadata value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*integrity_metadata = memory_allocate_structure(
+	                      libfsapfs_integrity_metadata_t );
+
+	if( *integrity_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create integrity metadata.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *integrity_metadata,
+	     0,
+	     sizeof( libfsapfs_integrity_metadata_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear integrity metadata.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *integrity_metadata != NULL )
+	{
+		memory_free(
+		 *integrity_metadata );
+
+		*integrity_metadata = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a integrity metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_integrity_metadata_free(
+     libfsapfs_integrity_metadata_t **integrity_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_integrity_metadata_free";
+
+	if( integrity_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( *integrity_metadata != NULL )
+	{
+		memory_free(
+		 *integrity_metadata );
+
+		*integrity_metadata = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the integrity metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_integrity_metadata_read_file_io_handle(
+     libfsapfs_integrity_metadata_t *integrity_metadata,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t integrity_metadata_data[ 4096 ];
+
+	static char *function = "libfsapfs_integrity_metadata_read_file_io_handle";
+	ssize_t read_count    = 0;
+
+	if( integrity_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading integrity metadata at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek integrity metadata offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              (uint8_t *) &integrity_metadata_data,
+	              4096,
+	              error );
+
+	if( read_count != (ssize_t) 4096 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read integrity metadata data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_integrity_metadata_read_data(
+	     integrity_metadata,
+	     (uint8_t *) &integrity_metadata_data,
+	     4096,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read integrity metadata data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the integrity metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_integrity_metadata_read_data(
+     libfsapfs_integrity_metadata_t *integrity_metadata,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsapfs_integrity_metadata_read_data";
+	size_t root_hash_size        = 0;
+	uint64_t calculated_checksum = 0;
+	uint64_t stored_checksum     = 0;
+	uint32_t object_type         = 0;
+	uint32_t root_hash_offset    = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t value_64bit         = 0;
+	uint32_t value_32bit         = 0;
+#endif
+
+	if( integrity_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid integrity metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsapfs_integrity_metadata_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: integrity metadata data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( fsapfs_integrity_metadata_t ),
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->object_checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->object_type,
+	 object_type );
+
+	if( ( object_type & 0x0000ffffUL ) != 0x0000001eUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid object type: 0x%08" PRIx32 ".",
+		 function,
+		 object_type );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->format_version,
+	 integrity_metadata->format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->flags,
+	 integrity_metadata->flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->hash_type,
+	 integrity_metadata->hash_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_integrity_metadata_t *) data )->root_hash_offset,
+	 root_hash_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: object checksum\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 stored_checksum );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_integrity_metadata_t *) data )->object_identifier,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: object identifier\t\t\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_integrity_metadata_t *) data )->object_transaction_identifier,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: object transaction identifier\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "%s: object type\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 object_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_integrity_metadata_t *) data )->object_subtype,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: object subtype\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 integrity_metadata->format_version );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 integrity_metadata->flags );
+
+		libcnotify_printf(
+		 "%s: hash type\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 integrity_metadata->hash_type );
+
+		libcnotify_printf(
+		 "%s: root hash offset\t\t\t: %" PRIu32 "\n",
+		 function,
+		 root_hash_offset );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_integrity_metadata_t *) data )->broken_transaction_identifier,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: broken transaction identifier\t: %" PRIu64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfsapfs_integrity_metadata_get_hash_size(
+	     integrity_metadata->hash_type,
+	     &root_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root hash size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) root_hash_offset < sizeof( fsapfs_integrity_metadata_t ) )
+	 || ( (size_t) root_hash_offset > data_size )
+	 || ( root_hash_size > ( data_size - root_hash_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root hash offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     integrity_metadata->root_hash,
+	     &( data[ root_hash_offset ] ),
+	     root_hash_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy root hash.",
+		 function );
+
+		return( -1 );
+	}
+	integrity_metadata->root_hash_size = root_hash_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: root hash:\n",
+		 function );
+		libcnotify_print_data(
+		 integrity_metadata->root_hash,
+		 root_hash_size,
+		 0 );
+	}
+#endif
+	if( libfsapfs_checksum_calculate_fletcher64(
+	     &calculated_checksum,
+	     &( data[ 8 ] ),
+	     data_size - 8,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate Fletcher-64 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx64 " != 0x%08" PRIx64 " ).\n",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a hash for a specific hash type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_integrity_metadata_get_hash_size(
+     uint32_t hash_type,
+     size_t *hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_integrity_metadata_get_hash_size";
+
+	if( hash_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_type )
+	{
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA256:
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA512_256:
+			*hash_size = 32;
+			break;
+
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA384:
+			*hash_size = 48;
+			break;
+
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA512:
+			*hash_size = 64;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type: %" PRIu32 ".",
+			 function,
+			 hash_type );
+
+			return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,90 @@
+/*
+ * The integrity metadata functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_INTEGRITY_METADATA_H )
+#define _LIBFSAPFS_INTEGRITY_METADATA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_integrity_metadata libfsapfs_integrity_metadata_t;
+
+struct libfsapfs_integrity_metadata
+{
+	/* The format version
+	 */
+	uint32_t format_version;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
+	/* The hash type
+	 */
+	uint32_t hash_type;
+
+	/* The root hash
+	 */
+	uint8_t root_hash[ 64 ];
+
+	/* The root hash size
+	 */
+	size_t root_hash_size;
+};
+
+int libfsapfs_integrity_metadata_initialize(
+     libfsapfs_integrity_metadata_t **integrity_metadata,
+     libcerror_error_t **error );
+
+int libfsapfs_integrity_metadata_free(
+     libfsapfs_integrity_metadata_t **integrity_metadata,
+     libcerror_error_t **error );
+
+int libfsapfs_integrity_metadata_read_file_io_handle(
+     libfsapfs_integrity_metadata_t *integrity_metadata,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libfsapfs_integrity_metadata_read_data(
+     libfsapfs_integrity_metadata_t *integrity_metadata,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_integrity_metadata_get_hash_size(
+     uint32_t hash_type,
+     size_t *hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_INTEGRITY_METADATA_H ) */
+
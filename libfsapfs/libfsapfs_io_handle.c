@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_block_buffer_pool.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_profiler.h"
@@ -95,6 +96,19 @@ int libfsapfs_io_handle_initialize(
 
 		return( -1 );
 	}
+	if( libfsapfs_block_buffer_pool_initialize(
+	     &( ( *io_handle )->block_buffer_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block buffer pool.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( libfsapfs_profiler_initialize(
 	     &( ( *io_handle )->profiler ),
@@ -141,6 +155,12 @@ on_error:
 			 NULL );
 		}
 #endif
+		if( ( *io_handle )->block_buffer_pool != NULL )
+		{
+			libfsapfs_block_buffer_pool_free(
+			 &( ( *io_handle )->block_buffer_pool ),
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -201,6 +221,19 @@ int libfsapfs_io_handle_free(
 		}
 #endif /* defined( HAVE_PROFILER ) */
 
+		if( libfsapfs_block_buffer_pool_free(
+		     &( ( *io_handle )->block_buffer_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block buffer pool.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -216,10 +249,11 @@ int libfsapfs_io_handle_clear(
      libfsapfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function          = "libfsapfs_io_handle_clear";
+	libfsapfs_block_buffer_pool_t *block_buffer_pool = NULL;
+	static char *function                            = "libfsapfs_io_handle_clear";
 
 #if defined( HAVE_PROFILER )
-	libfsapfs_profiler_t *profiler = NULL;
+	libfsapfs_profiler_t *profiler                   = NULL;
 #endif
 
 	if( io_handle == NULL )
@@ -233,6 +267,10 @@ int libfsapfs_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The block buffer pool is retained since its buffers are not specific to the container
+	 */
+	block_buffer_pool = io_handle->block_buffer_pool;
+
 #if defined( HAVE_PROFILER )
 	profiler = io_handle->profiler;
 #endif
@@ -250,8 +288,9 @@ int libfsapfs_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->bytes_per_sector = 512;
-	io_handle->block_size       = 4096;
+	io_handle->bytes_per_sector  = 512;
+	io_handle->block_size        = 4096;
+	io_handle->block_buffer_pool = block_buffer_pool;
 
 #if defined( HAVE_PROFILER )
 	io_handle->profiler = profiler;
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_block_buffer_pool.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_profiler.h"
 
@@ -51,6 +52,14 @@ struct libfsapfs_io_handle
 	 */
 	size64_t container_size;
 
+	/* The block buffer pool
+	 */
+	libfsapfs_block_buffer_pool_t *block_buffer_pool;
+
+	/* Value to indicate the container was opened for uncached access
+	 */
+	uint8_t uncached_access;
+
 #if defined( HAVE_PROFILER )
 	/* The profiler
 	 */
@@ -591,13 +591,14 @@ int libfsapfs_lzvn_decompress(
 		}
 		if( match_size > 0 )
 		{
-			if( (size_t) distance > uncompressed_data_offset )
+			if( ( distance == 0 )
+			 || ( (size_t) distance > uncompressed_data_offset ) )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: distance value exceeds uncompressed data offset.",
+				 "%s: invalid distance value out of bounds.",
 				 function );
 
 				return( -1 );
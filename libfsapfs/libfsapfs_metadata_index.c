@@ -0,0 +1,1280 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_metadata_index.h"
+
+#include "fsapfs_file_system.h"
+
+/* Flips the sign bit of a signed timestamp so that it sorts as an unsigned value
+ */
+#define libfsapfs_metadata_index_timestamp_to_key_value( timestamp ) \
+	( (uint64_t) ( timestamp ) ^ 0x8000000000000000ULL )
+
+/* Creates a metadata index
+ * Make sure the value metadata_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_metadata_index_initialize(
+     libfsapfs_metadata_index_t **metadata_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_metadata_index_t *internal_metadata_index = NULL;
+	static char *function                                        = "libfsapfs_metadata_index_initialize";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_metadata_index = memory_allocate_structure(
+	                       libfsapfs_internal_metadata_index_t );
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_metadata_index,
+	     0,
+	     sizeof( libfsapfs_internal_metadata_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	*metadata_index = (libfsapfs_metadata_index_t *) internal_metadata_index;
+
+	return( 1 );
+
+on_error:
+	if( internal_metadata_index != NULL )
+	{
+		memory_free(
+		 internal_metadata_index );
+	}
+	return( -1 );
+}
+
+/* Frees a metadata index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_metadata_index_free(
+     libfsapfs_metadata_index_t **metadata_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_metadata_index_t *internal_metadata_index = NULL;
+	static char *function                                        = "libfsapfs_metadata_index_free";
+	int key_type                                                 = 0;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_index != NULL )
+	{
+		internal_metadata_index = (libfsapfs_internal_metadata_index_t *) *metadata_index;
+		*metadata_index         = NULL;
+
+		for( key_type = 0;
+		     key_type < LIBFSAPFS_METADATA_INDEX_NUMBER_OF_KEY_TYPES;
+		     key_type++ )
+		{
+			if( internal_metadata_index->sorted_keys[ key_type ] != NULL )
+			{
+				memory_free(
+				 internal_metadata_index->sorted_keys[ key_type ] );
+			}
+		}
+		if( internal_metadata_index->entries != NULL )
+		{
+			memory_free(
+			 internal_metadata_index->entries );
+		}
+		memory_free(
+		 internal_metadata_index );
+	}
+	return( 1 );
+}
+
+/* Determines the key value of an extension
+ * The extension is stored in the key value as up to 8 bytes in big-endian order,
+ * where upper case ASCII characters are converted to lower case. This preserves
+ * the lexicographic order of the extensions.
+ * Returns 1 if successful, 0 if the extension is empty or too long or -1 on error
+ */
+int libfsapfs_metadata_index_get_extension_key(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *extension_key,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsapfs_metadata_index_get_extension_key";
+	size_t string_index         = 0;
+	uint64_t safe_extension_key = 0;
+	uint8_t byte_value          = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( extension_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extension key.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		byte_value = utf8_string[ string_index ];
+
+		if( byte_value == 0 )
+		{
+			break;
+		}
+		if( string_index >= 8 )
+		{
+			return( 0 );
+		}
+		if( ( byte_value >= (uint8_t) 'A' )
+		 && ( byte_value <= (uint8_t) 'Z' ) )
+		{
+			byte_value += (uint8_t) ( 'a' - 'A' );
+		}
+		safe_extension_key |= (uint64_t) byte_value << ( 56 - ( string_index * 8 ) );
+	}
+	if( string_index == 0 )
+	{
+		return( 0 );
+	}
+	*extension_key = safe_extension_key;
+
+	return( 1 );
+}
+
+/* Appends an entry for an inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_metadata_index_append_entry(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_inode_t *inode,
+     libcerror_error_t **error )
+{
+	libfsapfs_metadata_index_entry_t *entries = NULL;
+	libfsapfs_metadata_index_entry_t *entry   = NULL;
+	static char *function                     = "libfsapfs_internal_metadata_index_append_entry";
+	size_t entries_size                       = 0;
+	size_t extension_index                    = 0;
+	size_t name_index                         = 0;
+	uint64_t extension_key                    = 0;
+	int number_of_allocated_entries           = 0;
+	int result                                = 0;
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* The extension is the part of the name after the last dot, where a leading dot
+	 * does not start an extension
+	 */
+	if( inode->name != NULL )
+	{
+		for( name_index = 1;
+		     name_index < (size_t) inode->name_size;
+		     name_index++ )
+		{
+			if( inode->name[ name_index ] == 0 )
+			{
+				break;
+			}
+			if( inode->name[ name_index ] == (uint8_t) '.' )
+			{
+				extension_index = name_index + 1;
+			}
+		}
+		if( extension_index > 0 )
+		{
+			result = libfsapfs_metadata_index_get_extension_key(
+			          &( inode->name[ extension_index ] ),
+			          (size_t) inode->name_size - extension_index,
+			          &extension_key,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine extension key.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_metadata_index->number_of_entries >= internal_metadata_index->number_of_allocated_entries )
+	{
+		if( internal_metadata_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 1024;
+		}
+		else if( internal_metadata_index->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = internal_metadata_index->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid metadata index - number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_metadata_index_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfsapfs_metadata_index_entry_t ) * number_of_allocated_entries;
+
+		entries = (libfsapfs_metadata_index_entry_t *) memory_reallocate(
+		                                                internal_metadata_index->entries,
+		                                                entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_metadata_index->entries                     = entries;
+		internal_metadata_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	entry = &( internal_metadata_index->entries[ internal_metadata_index->number_of_entries ] );
+
+	entry->identifier = inode->identifier;
+
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_CREATION_TIME ]     = libfsapfs_metadata_index_timestamp_to_key_value( inode->creation_time );
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_MODIFICATION_TIME ] = libfsapfs_metadata_index_timestamp_to_key_value( inode->modification_time );
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_INODE_CHANGE_TIME ] = libfsapfs_metadata_index_timestamp_to_key_value( inode->inode_change_time );
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_ACCESS_TIME ]       = libfsapfs_metadata_index_timestamp_to_key_value( inode->access_time );
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_SIZE ]              = inode->data_stream_size;
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_OWNER_IDENTIFIER ]  = inode->owner_identifier;
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_GROUP_IDENTIFIER ]  = inode->group_identifier;
+	entry->values[ LIBFSAPFS_METADATA_INDEX_KEY_TYPE_EXTENSION ]         = extension_key;
+
+	internal_metadata_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the inodes of a file system B-tree leaf node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_metadata_index_read_leaf_node(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	libfsapfs_inode_t *inode             = NULL;
+	static char *function                = "libfsapfs_internal_metadata_index_read_leaf_node";
+	uint64_t file_system_identifier      = 0;
+	int btree_entry_index                = 0;
+	int number_of_entries                = 0;
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry->key_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d - missing key data.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		if( (uint8_t) ( file_system_identifier >> 60 ) != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE )
+		{
+			continue;
+		}
+		if( libfsapfs_inode_initialize(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_key_data(
+		     inode,
+		     btree_entry->key_data,
+		     (size_t) btree_entry->key_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode key data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_read_value_data(
+		     inode,
+		     btree_entry->value_data,
+		     (size_t) btree_entry->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_internal_metadata_index_append_entry(
+		     internal_metadata_index,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %" PRIu64 ".",
+			 function,
+			 inode->identifier );
+
+			goto on_error;
+		}
+		if( libfsapfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the inodes of the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_metadata_index_read_file_system_btree(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_metadata_index_read_file_system_btree";
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_system_btree_read_leaf_nodes(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     (int (*)(intptr_t *, libfsapfs_btree_node_t *, libcerror_error_t **)) &libfsapfs_internal_metadata_index_read_leaf_node,
+	     (intptr_t *) internal_metadata_index,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree leaf nodes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares two metadata index entries by identifier
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_metadata_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry )
+{
+	const libfsapfs_metadata_index_entry_t *first  = (const libfsapfs_metadata_index_entry_t *) first_entry;
+	const libfsapfs_metadata_index_entry_t *second = (const libfsapfs_metadata_index_entry_t *) second_entry;
+
+	if( first->identifier != second->identifier )
+	{
+		return( ( first->identifier < second->identifier ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two metadata index keys by value and entry index
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_metadata_index_key_compare(
+     const void *first_key,
+     const void *second_key )
+{
+	const libfsapfs_metadata_index_key_t *first  = (const libfsapfs_metadata_index_key_t *) first_key;
+	const libfsapfs_metadata_index_key_t *second = (const libfsapfs_metadata_index_key_t *) second_key;
+
+	if( first->value != second->value )
+	{
+		return( ( first->value < second->value ) ? -1 : 1 );
+	}
+	if( first->entry_index != second->entry_index )
+	{
+		return( ( first->entry_index < second->entry_index ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Compares two entry indexes
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_metadata_index_entry_index_compare(
+     const void *first_entry_index,
+     const void *second_entry_index )
+{
+	int first  = *( (const int *) first_entry_index );
+	int second = *( (const int *) second_entry_index );
+
+	if( first != second )
+	{
+		return( ( first < second ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Builds the sorted keys
+ * The entries are sorted by identifier after which a sorted array of keys
+ * is created for every key type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_metadata_index_build_sorted_keys(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_metadata_index_key_t *sorted_keys = NULL;
+	static char *function                       = "libfsapfs_internal_metadata_index_build_sorted_keys";
+	size_t sorted_keys_size                     = 0;
+	int entry_index                             = 0;
+	int key_type                                = 0;
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_metadata_index->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) internal_metadata_index->number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_metadata_index_key_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sorted keys size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	qsort(
+	 internal_metadata_index->entries,
+	 (size_t) internal_metadata_index->number_of_entries,
+	 sizeof( libfsapfs_metadata_index_entry_t ),
+	 &libfsapfs_metadata_index_entry_compare );
+
+	sorted_keys_size = sizeof( libfsapfs_metadata_index_key_t ) * internal_metadata_index->number_of_entries;
+
+	for( key_type = 0;
+	     key_type < LIBFSAPFS_METADATA_INDEX_NUMBER_OF_KEY_TYPES;
+	     key_type++ )
+	{
+		if( internal_metadata_index->sorted_keys[ key_type ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid metadata index - sorted keys: %d value already set.",
+			 function,
+			 key_type );
+
+			return( -1 );
+		}
+		sorted_keys = (libfsapfs_metadata_index_key_t *) memory_allocate(
+		                                                  sorted_keys_size );
+
+		if( sorted_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sorted keys: %d.",
+			 function,
+			 key_type );
+
+			return( -1 );
+		}
+		for( entry_index = 0;
+		     entry_index < internal_metadata_index->number_of_entries;
+		     entry_index++ )
+		{
+			sorted_keys[ entry_index ].value       = internal_metadata_index->entries[ entry_index ].values[ key_type ];
+			sorted_keys[ entry_index ].entry_index = entry_index;
+		}
+		qsort(
+		 sorted_keys,
+		 (size_t) internal_metadata_index->number_of_entries,
+		 sizeof( libfsapfs_metadata_index_key_t ),
+		 &libfsapfs_metadata_index_key_compare );
+
+		internal_metadata_index->sorted_keys[ key_type ] = sorted_keys;
+	}
+	return( 1 );
+}
+
+/* Retrieves the range of sorted keys of a specific key type with a value
+ * in the range [minimum_value, maximum_value]
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_metadata_index_get_key_range(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     int key_type,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     int *first_key_index,
+     int *number_of_keys,
+     libcerror_error_t **error )
+{
+	libfsapfs_metadata_index_key_t *sorted_keys = NULL;
+	static char *function                       = "libfsapfs_internal_metadata_index_get_key_range";
+	int lower_index                             = 0;
+	int middle_index                            = 0;
+	int safe_first_key_index                    = 0;
+	int upper_index                             = 0;
+
+	if( internal_metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_type < 0 )
+	 || ( key_type >= LIBFSAPFS_METADATA_INDEX_NUMBER_OF_KEY_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key type value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_key_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first key index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of keys.",
+		 function );
+
+		return( -1 );
+	}
+	sorted_keys = internal_metadata_index->sorted_keys[ key_type ];
+
+	if( ( sorted_keys == NULL )
+	 || ( minimum_value > maximum_value ) )
+	{
+		*first_key_index = 0;
+		*number_of_keys  = 0;
+
+		return( 1 );
+	}
+	/* Determine the first key with a value greater than or equal to the minimum value
+	 */
+	lower_index = 0;
+	upper_index = internal_metadata_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( sorted_keys[ middle_index ].value < minimum_value )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	safe_first_key_index = lower_index;
+
+	/* Determine the first key with a value greater than the maximum value
+	 */
+	upper_index = internal_metadata_index->number_of_entries;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( sorted_keys[ middle_index ].value <= maximum_value )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	*first_key_index = safe_first_key_index;
+	*number_of_keys  = lower_index - safe_first_key_index;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_metadata_index_get_number_of_entries(
+     libfsapfs_metadata_index_t *metadata_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_metadata_index_t *internal_metadata_index = NULL;
+	static char *function                                        = "libfsapfs_metadata_index_get_number_of_entries";
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_metadata_index = (libfsapfs_internal_metadata_index_t *) metadata_index;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_metadata_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Queries the metadata index
+ * The filter flags define which of the filters are applied; the time filter applies
+ * to the time value of time_value_type and the time, size and extension filters
+ * are inclusive ranges or exact matches
+ * The identifiers of the matching inodes are stored in identifiers in increasing order,
+ * up to maximum_number_of_identifiers. The total number of matching inodes is returned
+ * in number_of_identifiers, which can be larger than maximum_number_of_identifiers.
+ * The metadata index is not changed by a query
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_metadata_index_query(
+     libfsapfs_metadata_index_t *metadata_index,
+     uint8_t filter_flags,
+     int time_value_type,
+     int64_t minimum_posix_time,
+     int64_t maximum_posix_time,
+     uint64_t minimum_size,
+     uint64_t maximum_size,
+     uint32_t owner_identifier,
+     uint32_t group_identifier,
+     const uint8_t *utf8_extension,
+     size_t utf8_extension_length,
+     uint64_t *identifiers,
+     int maximum_number_of_identifiers,
+     int *number_of_identifiers,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_metadata_index_t *internal_metadata_index = NULL;
+	libfsapfs_metadata_index_entry_t *entry                      = NULL;
+	int *entry_indexes                                           = NULL;
+	static char *function                                        = "libfsapfs_metadata_index_query";
+	uint64_t filter_maximum_values[ 5 ];
+	uint64_t filter_minimum_values[ 5 ];
+	int filter_key_types[ 5 ];
+	uint64_t extension_key                                       = 0;
+	int candidate_index                                          = 0;
+	int entry_index                                              = 0;
+	int filter_index                                             = 0;
+	int first_key_index                                          = 0;
+	int number_of_candidates                                     = 0;
+	int number_of_filters                                        = 0;
+	int number_of_keys                                           = 0;
+	int number_of_matches                                        = 0;
+	int result                                                   = 0;
+	int selected_filter_index                                    = -1;
+
+	if( metadata_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_metadata_index = (libfsapfs_internal_metadata_index_t *) metadata_index;
+
+	if( ( filter_flags & ~( LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_TIME | LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_SIZE | LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_OWNER_IDENTIFIER | LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_GROUP_IDENTIFIER | LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_EXTENSION ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported filter flags: 0x%02" PRIx8 ".",
+		 function,
+		 filter_flags );
+
+		return( -1 );
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_TIME ) != 0 )
+	{
+		if( ( time_value_type != LIBFSAPFS_TIME_VALUE_TYPE_CREATION_TIME )
+		 && ( time_value_type != LIBFSAPFS_TIME_VALUE_TYPE_MODIFICATION_TIME )
+		 && ( time_value_type != LIBFSAPFS_TIME_VALUE_TYPE_INODE_CHANGE_TIME )
+		 && ( time_value_type != LIBFSAPFS_TIME_VALUE_TYPE_ACCESS_TIME ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported time value type: %d.",
+			 function,
+			 time_value_type );
+
+			return( -1 );
+		}
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_EXTENSION ) != 0 )
+	{
+		if( utf8_extension == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 extension.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( maximum_number_of_identifiers < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of identifiers value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( identifiers == NULL )
+	 && ( maximum_number_of_identifiers > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_TIME ) != 0 )
+	{
+		filter_key_types[ number_of_filters ]      = time_value_type;
+		filter_minimum_values[ number_of_filters ] = libfsapfs_metadata_index_timestamp_to_key_value( minimum_posix_time );
+		filter_maximum_values[ number_of_filters ] = libfsapfs_metadata_index_timestamp_to_key_value( maximum_posix_time );
+
+		number_of_filters++;
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_SIZE ) != 0 )
+	{
+		filter_key_types[ number_of_filters ]      = LIBFSAPFS_METADATA_INDEX_KEY_TYPE_SIZE;
+		filter_minimum_values[ number_of_filters ] = minimum_size;
+		filter_maximum_values[ number_of_filters ] = maximum_size;
+
+		number_of_filters++;
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_OWNER_IDENTIFIER ) != 0 )
+	{
+		filter_key_types[ number_of_filters ]      = LIBFSAPFS_METADATA_INDEX_KEY_TYPE_OWNER_IDENTIFIER;
+		filter_minimum_values[ number_of_filters ] = (uint64_t) owner_identifier;
+		filter_maximum_values[ number_of_filters ] = (uint64_t) owner_identifier;
+
+		number_of_filters++;
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_GROUP_IDENTIFIER ) != 0 )
+	{
+		filter_key_types[ number_of_filters ]      = LIBFSAPFS_METADATA_INDEX_KEY_TYPE_GROUP_IDENTIFIER;
+		filter_minimum_values[ number_of_filters ] = (uint64_t) group_identifier;
+		filter_maximum_values[ number_of_filters ] = (uint64_t) group_identifier;
+
+		number_of_filters++;
+	}
+	if( ( filter_flags & LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_EXTENSION ) != 0 )
+	{
+		/* Skip the leading dot of the extension if present
+		 */
+		if( ( utf8_extension_length > 0 )
+		 && ( utf8_extension[ 0 ] == (uint8_t) '.' ) )
+		{
+			utf8_extension++;
+			utf8_extension_length--;
+		}
+		result = libfsapfs_metadata_index_get_extension_key(
+		          utf8_extension,
+		          utf8_extension_length,
+		          &extension_key,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extension key.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* An extension that is empty or too long to be indexed does not match any inode
+			 */
+			*number_of_identifiers = 0;
+
+			return( 1 );
+		}
+		filter_key_types[ number_of_filters ]      = LIBFSAPFS_METADATA_INDEX_KEY_TYPE_EXTENSION;
+		filter_minimum_values[ number_of_filters ] = extension_key;
+		filter_maximum_values[ number_of_filters ] = extension_key;
+
+		number_of_filters++;
+	}
+	if( number_of_filters == 0 )
+	{
+		for( entry_index = 0;
+		     ( entry_index < internal_metadata_index->number_of_entries ) && ( entry_index < maximum_number_of_identifiers );
+		     entry_index++ )
+		{
+			identifiers[ entry_index ] = internal_metadata_index->entries[ entry_index ].identifier;
+		}
+		*number_of_identifiers = internal_metadata_index->number_of_entries;
+
+		return( 1 );
+	}
+	/* Use the most selective filter to determine the candidates
+	 */
+	number_of_candidates = internal_metadata_index->number_of_entries;
+
+	for( filter_index = 0;
+	     filter_index < number_of_filters;
+	     filter_index++ )
+	{
+		if( libfsapfs_internal_metadata_index_get_key_range(
+		     internal_metadata_index,
+		     filter_key_types[ filter_index ],
+		     filter_minimum_values[ filter_index ],
+		     filter_maximum_values[ filter_index ],
+		     &first_key_index,
+		     &number_of_keys,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key range of filter: %d.",
+			 function,
+			 filter_index );
+
+			goto on_error;
+		}
+		if( ( selected_filter_index == -1 )
+		 || ( number_of_keys < number_of_candidates ) )
+		{
+			selected_filter_index = filter_index;
+			candidate_index       = first_key_index;
+			number_of_candidates  = number_of_keys;
+		}
+	}
+	if( number_of_candidates > 0 )
+	{
+		entry_indexes = (int *) memory_allocate(
+		                         sizeof( int ) * number_of_candidates );
+
+		if( entry_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry indexes.",
+			 function );
+
+			goto on_error;
+		}
+		first_key_index = candidate_index;
+
+		for( candidate_index = first_key_index;
+		     candidate_index < first_key_index + number_of_candidates;
+		     candidate_index++ )
+		{
+			entry_index = internal_metadata_index->sorted_keys[ filter_key_types[ selected_filter_index ] ][ candidate_index ].entry_index;
+			entry       = &( internal_metadata_index->entries[ entry_index ] );
+
+			for( filter_index = 0;
+			     filter_index < number_of_filters;
+			     filter_index++ )
+			{
+				if( ( entry->values[ filter_key_types[ filter_index ] ] < filter_minimum_values[ filter_index ] )
+				 || ( entry->values[ filter_key_types[ filter_index ] ] > filter_maximum_values[ filter_index ] ) )
+				{
+					break;
+				}
+			}
+			if( filter_index >= number_of_filters )
+			{
+				entry_indexes[ number_of_matches++ ] = entry_index;
+			}
+		}
+		/* The entries are sorted by identifier, hence sorting the entry indexes
+		 * returns the identifiers in increasing order
+		 */
+		if( number_of_matches > 1 )
+		{
+			qsort(
+			 entry_indexes,
+			 (size_t) number_of_matches,
+			 sizeof( int ),
+			 &libfsapfs_metadata_index_entry_index_compare );
+		}
+		for( candidate_index = 0;
+		     ( candidate_index < number_of_matches ) && ( candidate_index < maximum_number_of_identifiers );
+		     candidate_index++ )
+		{
+			identifiers[ candidate_index ] = internal_metadata_index->entries[ entry_indexes[ candidate_index ] ].identifier;
+		}
+		memory_free(
+		 entry_indexes );
+	}
+	*number_of_identifiers = number_of_matches;
+
+	return( 1 );
+
+on_error:
+	if( entry_indexes != NULL )
+	{
+		memory_free(
+		 entry_indexes );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,173 @@
+/*
+ * Metadata index functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_METADATA_INDEX_H )
+#define _LIBFSAPFS_METADATA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_inode.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_metadata_index_entry libfsapfs_metadata_index_entry_t;
+
+struct libfsapfs_metadata_index_entry
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The key values
+	 */
+	uint64_t values[ LIBFSAPFS_METADATA_INDEX_NUMBER_OF_KEY_TYPES ];
+};
+
+typedef struct libfsapfs_metadata_index_key libfsapfs_metadata_index_key_t;
+
+struct libfsapfs_metadata_index_key
+{
+	/* The value
+	 */
+	uint64_t value;
+
+	/* The entry index
+	 */
+	int entry_index;
+};
+
+typedef struct libfsapfs_internal_metadata_index libfsapfs_internal_metadata_index_t;
+
+struct libfsapfs_internal_metadata_index
+{
+	/* The entries sorted by identifier
+	 */
+	libfsapfs_metadata_index_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The keys sorted by value per key type
+	 */
+	libfsapfs_metadata_index_key_t *sorted_keys[ LIBFSAPFS_METADATA_INDEX_NUMBER_OF_KEY_TYPES ];
+};
+
+int libfsapfs_metadata_index_initialize(
+     libfsapfs_metadata_index_t **metadata_index,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_metadata_index_free(
+     libfsapfs_metadata_index_t **metadata_index,
+     libcerror_error_t **error );
+
+int libfsapfs_metadata_index_get_extension_key(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint64_t *extension_key,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_metadata_index_append_entry(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_inode_t *inode,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_metadata_index_read_leaf_node(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_metadata_index_read_file_system_btree(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_metadata_index_entry_compare(
+     const void *first_entry,
+     const void *second_entry );
+
+int libfsapfs_metadata_index_key_compare(
+     const void *first_key,
+     const void *second_key );
+
+int libfsapfs_metadata_index_entry_index_compare(
+     const void *first_entry_index,
+     const void *second_entry_index );
+
+int libfsapfs_internal_metadata_index_build_sorted_keys(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_metadata_index_get_key_range(
+     libfsapfs_internal_metadata_index_t *internal_metadata_index,
+     int key_type,
+     uint64_t minimum_value,
+     uint64_t maximum_value,
+     int *first_key_index,
+     int *number_of_keys,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_metadata_index_get_number_of_entries(
+     libfsapfs_metadata_index_t *metadata_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_metadata_index_query(
+     libfsapfs_metadata_index_t *metadata_index,
+     uint8_t filter_flags,
+     int time_value_type,
+     int64_t minimum_posix_time,
+     int64_t maximum_posix_time,
+     uint64_t minimum_size,
+     uint64_t maximum_size,
+     uint32_t owner_identifier,
+     uint32_t group_identifier,
+     const uint8_t *utf8_extension,
+     size_t utf8_extension_length,
+     uint64_t *identifiers,
+     int maximum_number_of_identifiers,
+     int *number_of_identifiers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_METADATA_INDEX_H ) */
+
@@ -7393,3 +7393,219 @@ int libfsapfs_name_compare_with_utf16_string(
 	return( LIBUNA_COMPARE_EQUAL );
 }
 
+/* Copies an UTF-8 encoded file entry name to decomposed (NFD) Unicode characters
+ * The characters are case folded if use_case_folding is set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_copy_to_decomposed_characters(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     uint32_t *characters,
+     size_t maximum_number_of_characters,
+     size_t *number_of_characters,
+     libcerror_error_t **error )
+{
+	libfsapfs_name_decomposition_mapping_t single_nfd_mapping = { 1, { 0 } };
+
+	libfsapfs_name_decomposition_mapping_t *nfd_mapping       = NULL;
+	static char *function                                     = "libfsapfs_name_copy_to_decomposed_characters";
+	libuna_unicode_character_t unicode_character             = 0;
+	size_t character_index                                    = 0;
+	size_t name_index                                         = 0;
+	uint8_t nfd_character_index                               = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 encoded name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 encoded name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_characters > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of characters value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size >= 1 )
+	 && ( name[ name_size - 1 ] == 0 ) )
+	{
+		name_size -= 1;
+	}
+	while( name_index < name_size )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     name,
+		     name_size,
+		     &name_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8 encoded name.",
+			 function );
+
+			return( -1 );
+		}
+		if( use_case_folding != 0 )
+		{
+			libfsapfs_name_get_case_folding_mapping(
+			 unicode_character );
+		}
+		libfsapfs_name_get_decomposition_mapping(
+		 unicode_character,
+		 nfd_mapping,
+		 single_nfd_mapping );
+
+		if( (size_t) nfd_mapping->number_of_characters > ( maximum_number_of_characters - character_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid maximum number of characters value too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( nfd_character_index = 0;
+		     nfd_character_index < nfd_mapping->number_of_characters;
+		     nfd_character_index++ )
+		{
+			characters[ character_index++ ] = nfd_mapping->characters[ nfd_character_index ];
+		}
+	}
+	*number_of_characters = character_index;
+
+	return( 1 );
+}
+
+/* Determines if decomposed (NFD) Unicode characters match a pattern
+ * The pattern consists of decomposed (NFD) Unicode characters where '*' matches
+ * zero or more characters and '?' matches a single character
+ * Returns 1 if the characters match, 0 if not or -1 on error
+ */
+int libfsapfs_name_match_pattern(
+     const uint32_t *characters,
+     size_t number_of_characters,
+     const uint32_t *pattern,
+     size_t pattern_length,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsapfs_name_match_pattern";
+	size_t character_index      = 0;
+	size_t pattern_index        = 0;
+	size_t star_character_index = 0;
+	size_t star_pattern_index   = 0;
+	uint8_t has_star            = 0;
+
+	if( ( characters == NULL )
+	 && ( number_of_characters > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern == NULL )
+	 && ( pattern_length > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	/* On a mismatch the last '*' is retried to match one more character
+	 */
+	while( character_index < number_of_characters )
+	{
+		if( ( pattern_index < pattern_length )
+		 && ( pattern[ pattern_index ] == (uint32_t) '*' ) )
+		{
+			has_star             = 1;
+			star_pattern_index   = pattern_index++;
+			star_character_index = character_index;
+		}
+		else if( ( pattern_index < pattern_length )
+		      && ( ( pattern[ pattern_index ] == (uint32_t) '?' )
+		       ||  ( pattern[ pattern_index ] == characters[ character_index ] ) ) )
+		{
+			pattern_index++;
+			character_index++;
+		}
+		else if( has_star != 0 )
+		{
+			pattern_index   = star_pattern_index + 1;
+			character_index = ++star_character_index;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	while( ( pattern_index < pattern_length )
+	    && ( pattern[ pattern_index ] == (uint32_t) '*' ) )
+	{
+		pattern_index++;
+	}
+	if( pattern_index < pattern_length )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
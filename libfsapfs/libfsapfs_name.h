@@ -432,6 +432,22 @@ int libfsapfs_name_compare_with_utf16_string(
      uint8_t use_case_folding,
      libcerror_error_t **error );
 
+int libfsapfs_name_copy_to_decomposed_characters(
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t use_case_folding,
+     uint32_t *characters,
+     size_t maximum_number_of_characters,
+     size_t *number_of_characters,
+     libcerror_error_t **error );
+
+int libfsapfs_name_match_pattern(
+     const uint32_t *characters,
+     size_t number_of_characters,
+     const uint32_t *pattern,
+     size_t pattern_length,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
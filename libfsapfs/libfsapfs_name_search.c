@@ -0,0 +1,1357 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_name.h"
+#include "libfsapfs_name_search.h"
+
+#include "fsapfs_file_system.h"
+
+/* Creates a name search
+ * Make sure the value name_search is referencing, is set to NULL
+ * The pattern is an UTF-8 string where '*' matches zero or more characters
+ * and '?' matches a single character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_initialize(
+     libfsapfs_name_search_t **name_search,
+     const uint8_t *utf8_pattern,
+     size_t utf8_pattern_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                  = "libfsapfs_name_search_initialize";
+	size_t maximum_pattern_length                          = 0;
+	size_t pattern_index                                   = 0;
+	size_t run_index                                       = 0;
+	size_t run_length                                      = 0;
+	size_t string_index                                    = 0;
+	uint8_t byte_value                                     = 0;
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_pattern_length > (size_t) SSIZE_MAX )
+	 || ( utf8_pattern_length > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 4 * sizeof( uint32_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 pattern length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_pattern_length >= 1 )
+	 && ( utf8_pattern[ utf8_pattern_length - 1 ] == 0 ) )
+	{
+		utf8_pattern_length -= 1;
+	}
+	internal_name_search = memory_allocate_structure(
+	                        libfsapfs_internal_name_search_t );
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name search.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_name_search,
+	     0,
+	     sizeof( libfsapfs_internal_name_search_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name search.",
+		 function );
+
+		memory_free(
+		 internal_name_search );
+
+		return( -1 );
+	}
+	/* Every byte of the pattern decomposes into at most 4 characters
+	 */
+	maximum_pattern_length = 4 * ( utf8_pattern_length + 1 );
+
+	internal_name_search->pattern = (uint32_t *) memory_allocate(
+	                                              sizeof( uint32_t ) * maximum_pattern_length );
+
+	if( internal_name_search->pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_pattern_length > 0 )
+	{
+		if( libfsapfs_name_copy_to_decomposed_characters(
+		     utf8_pattern,
+		     utf8_pattern_length,
+		     1,
+		     internal_name_search->pattern,
+		     maximum_pattern_length,
+		     &( internal_name_search->pattern_length ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy UTF-8 pattern to decomposed characters.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The longest run of ASCII characters without wildcards must be contained
+	 * in every ASCII name that matches the pattern
+	 */
+	for( pattern_index = 0;
+	     pattern_index <= utf8_pattern_length;
+	     pattern_index++ )
+	{
+		if( pattern_index < utf8_pattern_length )
+		{
+			byte_value = utf8_pattern[ pattern_index ];
+		}
+		if( ( pattern_index < utf8_pattern_length )
+		 && ( byte_value < 0x80 )
+		 && ( byte_value != (uint8_t) '*' )
+		 && ( byte_value != (uint8_t) '?' ) )
+		{
+			continue;
+		}
+		if( ( pattern_index - run_index ) > run_length )
+		{
+			string_index = run_index;
+			run_length   = pattern_index - run_index;
+		}
+		run_index = pattern_index + 1;
+	}
+	if( run_length > 0 )
+	{
+		internal_name_search->prefilter_string = (uint8_t *) memory_allocate(
+		                                                      sizeof( uint8_t ) * run_length );
+
+		if( internal_name_search->prefilter_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create prefilter string.",
+			 function );
+
+			goto on_error;
+		}
+		for( pattern_index = 0;
+		     pattern_index < run_length;
+		     pattern_index++ )
+		{
+			byte_value = utf8_pattern[ string_index + pattern_index ];
+
+			if( ( byte_value >= (uint8_t) 'A' )
+			 && ( byte_value <= (uint8_t) 'Z' ) )
+			{
+				byte_value += (uint8_t) ( 'a' - 'A' );
+			}
+			internal_name_search->prefilter_string[ pattern_index ] = byte_value;
+		}
+		internal_name_search->prefilter_string_length = run_length;
+	}
+	*name_search = (libfsapfs_name_search_t *) internal_name_search;
+
+	return( 1 );
+
+on_error:
+	if( internal_name_search != NULL )
+	{
+		if( internal_name_search->pattern != NULL )
+		{
+			memory_free(
+			 internal_name_search->pattern );
+		}
+		memory_free(
+		 internal_name_search );
+	}
+	return( -1 );
+}
+
+/* Frees a name search
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_free(
+     libfsapfs_name_search_t **name_search,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                  = "libfsapfs_name_search_free";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_search != NULL )
+	{
+		internal_name_search = (libfsapfs_internal_name_search_t *) *name_search;
+		*name_search         = NULL;
+
+		if( internal_name_search->paths_data != NULL )
+		{
+			memory_free(
+			 internal_name_search->paths_data );
+		}
+		if( internal_name_search->names_data != NULL )
+		{
+			memory_free(
+			 internal_name_search->names_data );
+		}
+		if( internal_name_search->results != NULL )
+		{
+			memory_free(
+			 internal_name_search->results );
+		}
+		if( internal_name_search->directories != NULL )
+		{
+			memory_free(
+			 internal_name_search->directories );
+		}
+		if( internal_name_search->prefilter_string != NULL )
+		{
+			memory_free(
+			 internal_name_search->prefilter_string );
+		}
+		if( internal_name_search->pattern != NULL )
+		{
+			memory_free(
+			 internal_name_search->pattern );
+		}
+		memory_free(
+		 internal_name_search );
+	}
+	return( 1 );
+}
+
+/* Determines if a name can match the prefilter string
+ * The name is converted to lower case 8 bytes at a time, which also detects
+ * non-ASCII characters. Names that contain non-ASCII characters are not
+ * prefiltered since case folding could map them onto ASCII characters.
+ * Returns 1 if the name can match or 0 if not
+ */
+int libfsapfs_name_search_prefilter(
+     const uint8_t *name,
+     size_t name_size,
+     const uint8_t *prefilter_string,
+     size_t prefilter_string_length )
+{
+	uint8_t lower_case_name[ 1024 ];
+
+	size_t name_index    = 0;
+	uint64_t heptets     = 0;
+	uint64_t is_upper    = 0;
+	uint64_t value_64bit = 0;
+	uint8_t byte_value   = 0;
+
+	if( ( name == NULL )
+	 || ( prefilter_string == NULL )
+	 || ( prefilter_string_length == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( name_size >= 1 )
+	 && ( name[ name_size - 1 ] == 0 ) )
+	{
+		name_size -= 1;
+	}
+	if( name_size > sizeof( lower_case_name ) )
+	{
+		return( 1 );
+	}
+	while( ( name_index + 8 ) <= name_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( name[ name_index ] ),
+		 value_64bit );
+
+		if( ( value_64bit & 0x8080808080808080ULL ) != 0 )
+		{
+			return( 1 );
+		}
+		/* The sum of a 7-bit value and 0x3f sets the high bit for values >= 'A'
+		 * and the sum with 0x25 sets the high bit for values > 'Z'
+		 */
+		heptets  = value_64bit & 0x7f7f7f7f7f7f7f7fULL;
+		is_upper = ( ( heptets + 0x3f3f3f3f3f3f3f3fULL ) ^ ( heptets + 0x2525252525252525ULL ) ) & 0x8080808080808080ULL;
+
+		value_64bit |= is_upper >> 2;
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( lower_case_name[ name_index ] ),
+		 value_64bit );
+
+		name_index += 8;
+	}
+	while( name_index < name_size )
+	{
+		byte_value = name[ name_index ];
+
+		if( byte_value >= 0x80 )
+		{
+			return( 1 );
+		}
+		if( ( byte_value >= (uint8_t) 'A' )
+		 && ( byte_value <= (uint8_t) 'Z' ) )
+		{
+			byte_value += (uint8_t) ( 'a' - 'A' );
+		}
+		lower_case_name[ name_index++ ] = byte_value;
+	}
+	if( name_size < prefilter_string_length )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index <= ( name_size - prefilter_string_length );
+	     name_index++ )
+	{
+		if( lower_case_name[ name_index ] != prefilter_string[ 0 ] )
+		{
+			continue;
+		}
+		if( memory_compare(
+		     &( lower_case_name[ name_index ] ),
+		     prefilter_string,
+		     prefilter_string_length ) == 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Appends a directory or result record
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_name_search_append_record(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     uint8_t is_result,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     const uint8_t *name,
+     uint16_t name_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_name_search_record_t **records = NULL;
+	libfsapfs_name_search_record_t *record   = NULL;
+	uint8_t *names_data                      = NULL;
+	static char *function                    = "libfsapfs_internal_name_search_append_record";
+	size_t allocated_names_data_size         = 0;
+	int *number_of_allocated_records         = NULL;
+	int *number_of_records                   = NULL;
+	int new_number_of_allocated_records      = 0;
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name == NULL )
+	 && ( name_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_result != 0 )
+	{
+		records                     = &( internal_name_search->results );
+		number_of_records           = &( internal_name_search->number_of_results );
+		number_of_allocated_records = &( internal_name_search->number_of_allocated_results );
+	}
+	else
+	{
+		records                     = &( internal_name_search->directories );
+		number_of_records           = &( internal_name_search->number_of_directories );
+		number_of_allocated_records = &( internal_name_search->number_of_allocated_directories );
+	}
+	if( *number_of_records >= *number_of_allocated_records )
+	{
+		if( *number_of_allocated_records == 0 )
+		{
+			new_number_of_allocated_records = 1024;
+		}
+		else if( *number_of_allocated_records <= ( INT_MAX / 2 ) )
+		{
+			new_number_of_allocated_records = *number_of_allocated_records * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid name search - number of allocated records value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) new_number_of_allocated_records > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_name_search_record_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid records size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		record = (libfsapfs_name_search_record_t *) memory_reallocate(
+		                                             *records,
+		                                             sizeof( libfsapfs_name_search_record_t ) * new_number_of_allocated_records );
+
+		if( record == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			return( -1 );
+		}
+		*records                     = record;
+		*number_of_allocated_records = new_number_of_allocated_records;
+	}
+	if( (size_t) name_size > ( internal_name_search->allocated_names_data_size - internal_name_search->names_data_size ) )
+	{
+		allocated_names_data_size = internal_name_search->allocated_names_data_size;
+
+		if( allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = 64 * 1024;
+		}
+		while( (size_t) name_size > ( allocated_names_data_size - internal_name_search->names_data_size ) )
+		{
+			if( allocated_names_data_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid names data size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_names_data_size *= 2;
+		}
+		names_data = (uint8_t *) memory_reallocate(
+		                          internal_name_search->names_data,
+		                          sizeof( uint8_t ) * allocated_names_data_size );
+
+		if( names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_name_search->names_data                = names_data;
+		internal_name_search->allocated_names_data_size = allocated_names_data_size;
+	}
+	record = &( ( *records )[ *number_of_records ] );
+
+	record->identifier        = identifier;
+	record->parent_identifier = parent_identifier;
+	record->name_offset       = internal_name_search->names_data_size;
+	record->name_size         = name_size;
+	record->path_offset       = 0;
+	record->path_size         = 0;
+
+	if( name_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_name_search->names_data[ internal_name_search->names_data_size ] ),
+		     name,
+		     (size_t) name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			return( -1 );
+		}
+		internal_name_search->names_data_size += name_size;
+	}
+	*number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Reads the directory records of a file system B-tree leaf node
+ * The names are matched in place in the key data, without creating directory records
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_name_search_read_leaf_node(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	const uint8_t *name                  = NULL;
+	static char *function                = "libfsapfs_internal_name_search_read_leaf_node";
+	size_t data_offset                   = 0;
+	size_t number_of_characters          = 0;
+	uint64_t file_system_identifier      = 0;
+	uint64_t identifier                  = 0;
+	uint32_t name_size                   = 0;
+	uint16_t directory_entry_flags       = 0;
+	uint8_t is_directory                 = 0;
+	int btree_entry_index                = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	for( btree_entry_index = 0;
+	     btree_entry_index < number_of_entries;
+	     btree_entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     btree_entry_index,
+		     &btree_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		if( btree_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry: %d.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		if( ( btree_entry->key_data == NULL )
+		 || ( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_directory_record_t ) ) )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_directory_record_t *) btree_entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		if( (uint8_t) ( file_system_identifier >> 60 ) != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD )
+		{
+			continue;
+		}
+		if( ( btree_entry->value_data == NULL )
+		 || ( btree_entry->value_data_size < sizeof( fsapfs_file_system_btree_value_directory_record_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - value data size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		/* Determine if the directory record key data contains a name or a name and hash based on its size
+		 */
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsapfs_file_system_btree_key_directory_record_t *) btree_entry->key_data )->name_size,
+		 name_size );
+
+		name_size &= 0x000003ffUL;
+
+		data_offset = sizeof( fsapfs_file_system_btree_key_directory_record_t );
+
+		if( (size_t) name_size < ( btree_entry->key_data_size - data_offset ) )
+		{
+			if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_directory_record_with_hash_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+				 function,
+				 btree_entry_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (fsapfs_file_system_btree_key_directory_record_with_hash_t *) btree_entry->key_data )->name_size_and_hash,
+			 name_size );
+
+			name_size &= 0x000003ffUL;
+
+			data_offset = sizeof( fsapfs_file_system_btree_key_directory_record_with_hash_t );
+		}
+		if( (size_t) name_size > ( btree_entry->key_data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry: %d - name size value out of bounds.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		name = &( btree_entry->key_data[ data_offset ] );
+
+		if( ( name_size >= 1 )
+		 && ( name[ name_size - 1 ] == 0 ) )
+		{
+			name_size -= 1;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_value_directory_record_t *) btree_entry->value_data )->file_system_identifier,
+		 identifier );
+
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (fsapfs_file_system_btree_value_directory_record_t *) btree_entry->value_data )->directory_entry_flags,
+		 directory_entry_flags );
+
+		file_system_identifier &= 0x0fffffffffffffffUL;
+		is_directory            = (uint8_t) ( ( directory_entry_flags & 0x000f ) == 4 );
+
+		if( is_directory != 0 )
+		{
+			if( libfsapfs_internal_name_search_append_record(
+			     internal_name_search,
+			     0,
+			     identifier,
+			     file_system_identifier,
+			     name,
+			     (uint16_t) name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory: %" PRIu64 ".",
+				 function,
+				 identifier );
+
+				return( -1 );
+			}
+		}
+		if( name_size == 0 )
+		{
+			continue;
+		}
+		result = libfsapfs_name_search_prefilter(
+		          name,
+		          (size_t) name_size,
+		          internal_name_search->prefilter_string,
+		          internal_name_search->prefilter_string_length );
+
+		if( result == 0 )
+		{
+			continue;
+		}
+		if( libfsapfs_name_copy_to_decomposed_characters(
+		     name,
+		     (size_t) name_size,
+		     1,
+		     internal_name_search->name_characters,
+		     LIBFSAPFS_NAME_SEARCH_MAXIMUM_NUMBER_OF_CHARACTERS,
+		     &number_of_characters,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy name of B-tree entry: %d to decomposed characters.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		result = libfsapfs_name_match_pattern(
+		          internal_name_search->name_characters,
+		          number_of_characters,
+		          internal_name_search->pattern,
+		          internal_name_search->pattern_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match name of B-tree entry: %d with pattern.",
+			 function,
+			 btree_entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( libfsapfs_internal_name_search_append_record(
+			     internal_name_search,
+			     1,
+			     identifier,
+			     file_system_identifier,
+			     name,
+			     (uint16_t) name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append result: %" PRIu64 ".",
+				 function,
+				 identifier );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two name search records by identifier
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_name_search_record_compare(
+     const void *first_record,
+     const void *second_record )
+{
+	const libfsapfs_name_search_record_t *first  = (const libfsapfs_name_search_record_t *) first_record;
+	const libfsapfs_name_search_record_t *second = (const libfsapfs_name_search_record_t *) second_record;
+
+	if( first->identifier != second->identifier )
+	{
+		return( ( first->identifier < second->identifier ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Builds the paths of the results from the directories
+ * A path consists of the names of the parent directories up to the root directory.
+ * If a parent directory is missing the path is relative to the first missing directory
+ * and does not start with a separator.
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_name_search_build_paths(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libcerror_error_t **error )
+{
+	libfsapfs_name_search_record_t key_record;
+
+	libfsapfs_name_search_record_t *record    = NULL;
+	libfsapfs_name_search_record_t *result    = NULL;
+	uint8_t *paths_data                       = NULL;
+	static char *function                     = "libfsapfs_internal_name_search_build_paths";
+	size_t path_index                         = 0;
+	size_t path_size                          = 0;
+	uint64_t parent_identifier                = 0;
+	uint8_t is_complete                       = 0;
+	int recursion_depth                       = 0;
+	int result_index                          = 0;
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_name_search->number_of_directories > 1 )
+	{
+		qsort(
+		 internal_name_search->directories,
+		 (size_t) internal_name_search->number_of_directories,
+		 sizeof( libfsapfs_name_search_record_t ),
+		 &libfsapfs_name_search_record_compare );
+	}
+	for( result_index = 0;
+	     result_index < internal_name_search->number_of_results;
+	     result_index++ )
+	{
+		result = &( internal_name_search->results[ result_index ] );
+
+		/* Determine the path size
+		 */
+		is_complete     = 0;
+		path_size       = 1;
+		record          = result;
+		recursion_depth = 0;
+
+		while( record != NULL )
+		{
+			if( recursion_depth > LIBFSAPFS_MAXIMUM_DIRECTORY_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid recursion depth value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			path_size += 1 + (size_t) record->name_size;
+
+			parent_identifier = record->parent_identifier;
+			record            = NULL;
+
+			/* The parent identifier of the entries in the root directory is 2
+			 */
+			if( parent_identifier == 2 )
+			{
+				is_complete = 1;
+
+				break;
+			}
+			key_record.identifier = parent_identifier;
+
+			if( internal_name_search->number_of_directories > 0 )
+			{
+				record = (libfsapfs_name_search_record_t *) bsearch(
+				                                             &key_record,
+				                                             internal_name_search->directories,
+				                                             (size_t) internal_name_search->number_of_directories,
+				                                             sizeof( libfsapfs_name_search_record_t ),
+				                                             &libfsapfs_name_search_record_compare );
+			}
+			recursion_depth++;
+		}
+		if( is_complete == 0 )
+		{
+			path_size -= 1;
+		}
+		if( path_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - internal_name_search->paths_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid paths data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		paths_data = (uint8_t *) memory_reallocate(
+		                          internal_name_search->paths_data,
+		                          sizeof( uint8_t ) * ( internal_name_search->paths_data_size + path_size ) );
+
+		if( paths_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize paths data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_name_search->paths_data = paths_data;
+
+		result->path_offset = internal_name_search->paths_data_size;
+		result->path_size   = path_size;
+
+		/* Copy the names from the end of the path towards its start
+		 */
+		paths_data = &( internal_name_search->paths_data[ result->path_offset ] );
+		path_index = path_size - 1;
+		record     = result;
+
+		paths_data[ path_index ] = 0;
+
+		while( record != NULL )
+		{
+			path_index -= (size_t) record->name_size;
+
+			if( record->name_size > 0 )
+			{
+				if( memory_copy(
+				     &( paths_data[ path_index ] ),
+				     &( internal_name_search->names_data[ record->name_offset ] ),
+				     (size_t) record->name_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy name.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( path_index == 0 )
+			{
+				break;
+			}
+			paths_data[ --path_index ] = (uint8_t) LIBFSAPFS_SEPARATOR;
+
+			if( path_index == 0 )
+			{
+				break;
+			}
+			key_record.identifier = record->parent_identifier;
+
+			record = (libfsapfs_name_search_record_t *) bsearch(
+			                                             &key_record,
+			                                             internal_name_search->directories,
+			                                             (size_t) internal_name_search->number_of_directories,
+			                                             sizeof( libfsapfs_name_search_record_t ),
+			                                             &libfsapfs_name_search_record_compare );
+		}
+		internal_name_search->paths_data_size += path_size;
+	}
+	return( 1 );
+}
+
+/* Reads the directory records of the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_name_search_read_file_system_btree(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_name_search_read_file_system_btree";
+
+	if( internal_name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_file_system_btree_read_leaf_nodes(
+	     file_system_btree,
+	     file_io_handle,
+	     file_system_btree->root_node_block_number,
+	     (int (*)(intptr_t *, libfsapfs_btree_node_t *, libcerror_error_t **)) &libfsapfs_internal_name_search_read_leaf_node,
+	     (intptr_t *) internal_name_search,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree leaf nodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_name_search_build_paths(
+	     internal_name_search,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build result paths.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of results
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_get_number_of_results(
+     libfsapfs_name_search_t *name_search,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                  = "libfsapfs_name_search_get_number_of_results";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfsapfs_internal_name_search_t *) name_search;
+
+	if( number_of_results == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_results = internal_name_search->number_of_results;
+
+	return( 1 );
+}
+
+/* Retrieves the identifier of a specific result
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_get_result_identifier(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                  = "libfsapfs_name_search_get_result_identifier";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfsapfs_internal_name_search_t *) name_search;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_name_search->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = internal_name_search->results[ result_index ].identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded path of a specific result
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_get_utf8_result_path_size(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	static char *function                                  = "libfsapfs_name_search_get_utf8_result_path_size";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfsapfs_internal_name_search_t *) name_search;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_name_search->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = internal_name_search->results[ result_index ].path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded path of a specific result
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_name_search_get_utf8_result_path(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_name_search_t *internal_name_search = NULL;
+	libfsapfs_name_search_record_t *result                 = NULL;
+	static char *function                                  = "libfsapfs_name_search_get_utf8_result_path";
+
+	if( name_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_name_search = (libfsapfs_internal_name_search_t *) name_search;
+
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_name_search->number_of_results ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	result = &( internal_name_search->results[ result_index ] );
+
+	if( ( utf8_string_size < result->path_size )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     &( internal_name_search->paths_data[ result->path_offset ] ),
+	     result->path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
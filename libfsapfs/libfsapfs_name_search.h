@@ -0,0 +1,220 @@
+/*
+ * Name search functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_NAME_SEARCH_H )
+#define _LIBFSAPFS_NAME_SEARCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of decomposed characters of a name
+ * A name consists of at most 1023 bytes and every character decomposes into at most 4 characters
+ */
+#define LIBFSAPFS_NAME_SEARCH_MAXIMUM_NUMBER_OF_CHARACTERS	4096
+
+typedef struct libfsapfs_name_search_record libfsapfs_name_search_record_t;
+
+struct libfsapfs_name_search_record
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The parent identifier
+	 */
+	uint64_t parent_identifier;
+
+	/* The offset of the name in the names data
+	 */
+	size_t name_offset;
+
+	/* The name size without end-of-string character
+	 */
+	uint16_t name_size;
+
+	/* The offset of the path in the paths data
+	 */
+	size_t path_offset;
+
+	/* The path size including end-of-string character
+	 */
+	size_t path_size;
+};
+
+typedef struct libfsapfs_internal_name_search libfsapfs_internal_name_search_t;
+
+struct libfsapfs_internal_name_search
+{
+	/* The decomposed and case folded characters of the pattern
+	 */
+	uint32_t *pattern;
+
+	/* The pattern length
+	 */
+	size_t pattern_length;
+
+	/* The lower case ASCII string used as prefilter
+	 */
+	uint8_t *prefilter_string;
+
+	/* The prefilter string length
+	 */
+	size_t prefilter_string_length;
+
+	/* The directories
+	 */
+	libfsapfs_name_search_record_t *directories;
+
+	/* The number of directories
+	 */
+	int number_of_directories;
+
+	/* The number of allocated directories
+	 */
+	int number_of_allocated_directories;
+
+	/* The results
+	 */
+	libfsapfs_name_search_record_t *results;
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of allocated results
+	 */
+	int number_of_allocated_results;
+
+	/* The names data
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The paths data
+	 */
+	uint8_t *paths_data;
+
+	/* The paths data size
+	 */
+	size_t paths_data_size;
+
+	/* The decomposed and case folded characters of the current name
+	 */
+	uint32_t name_characters[ LIBFSAPFS_NAME_SEARCH_MAXIMUM_NUMBER_OF_CHARACTERS ];
+};
+
+int libfsapfs_name_search_initialize(
+     libfsapfs_name_search_t **name_search,
+     const uint8_t *utf8_pattern,
+     size_t utf8_pattern_length,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_name_search_free(
+     libfsapfs_name_search_t **name_search,
+     libcerror_error_t **error );
+
+int libfsapfs_name_search_prefilter(
+     const uint8_t *name,
+     size_t name_size,
+     const uint8_t *prefilter_string,
+     size_t prefilter_string_length );
+
+int libfsapfs_internal_name_search_append_record(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     uint8_t is_result,
+     uint64_t identifier,
+     uint64_t parent_identifier,
+     const uint8_t *name,
+     uint16_t name_size,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_name_search_read_leaf_node(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libfsapfs_btree_node_t *node,
+     libcerror_error_t **error );
+
+int libfsapfs_name_search_record_compare(
+     const void *first_record,
+     const void *second_record );
+
+int libfsapfs_internal_name_search_build_paths(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_name_search_read_file_system_btree(
+     libfsapfs_internal_name_search_t *internal_name_search,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_name_search_get_number_of_results(
+     libfsapfs_name_search_t *name_search,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_name_search_get_result_identifier(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     uint64_t *identifier,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_name_search_get_utf8_result_path_size(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_name_search_get_utf8_result_path(
+     libfsapfs_name_search_t *name_search,
+     int result_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_NAME_SEARCH_H ) */
+
@@ -0,0 +1,1726 @@
+/*
+ * Node carver functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_checksum.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_node_carver.h"
+
+#include "fsapfs_btree.h"
+#include "fsapfs_file_system.h"
+#include "fsapfs_object.h"
+
+/* Creates a node carver
+ * Make sure the value node_carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_initialize(
+     libfsapfs_node_carver_t **node_carver,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_node_carver_t *internal_node_carver = NULL;
+	static char *function                                  = "libfsapfs_node_carver_initialize";
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node_carver = memory_allocate_structure(
+	                        libfsapfs_internal_node_carver_t );
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_node_carver,
+	     0,
+	     sizeof( libfsapfs_internal_node_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node carver.",
+		 function );
+
+		goto on_error;
+	}
+	*node_carver = (libfsapfs_node_carver_t *) internal_node_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_node_carver != NULL )
+	{
+		memory_free(
+		 internal_node_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a node carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_free(
+     libfsapfs_node_carver_t **node_carver,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_node_carver_t *internal_node_carver = NULL;
+	static char *function                                  = "libfsapfs_node_carver_free";
+	int node_index                                         = 0;
+	int result                                             = 1;
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_carver != NULL )
+	{
+		internal_node_carver = (libfsapfs_internal_node_carver_t *) *node_carver;
+		*node_carver         = NULL;
+
+		if( internal_node_carver->nodes != NULL )
+		{
+			for( node_index = 0;
+			     node_index < internal_node_carver->number_of_nodes;
+			     node_index++ )
+			{
+				if( internal_node_carver->nodes[ node_index ].btree_node != NULL )
+				{
+					if( libfsapfs_btree_node_free(
+					     &( internal_node_carver->nodes[ node_index ].btree_node ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free node: %d B-tree node.",
+						 function,
+						 node_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 internal_node_carver->nodes );
+		}
+		memory_free(
+		 internal_node_carver );
+	}
+	return( result );
+}
+
+/* Appends a carved node
+ * The node carver takes over the management of the B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_node_carver_append_node(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     uint64_t block_number,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     libfsapfs_btree_node_t *btree_node,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_carver_node_t *node  = NULL;
+	libfsapfs_node_carver_node_t *nodes = NULL;
+	static char *function               = "libfsapfs_internal_node_carver_append_node";
+	size_t nodes_size                   = 0;
+	int number_of_allocated_nodes       = 0;
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node_carver->number_of_nodes >= internal_node_carver->number_of_allocated_nodes )
+	{
+		if( internal_node_carver->number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 256;
+		}
+		else if( internal_node_carver->number_of_allocated_nodes <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_nodes = internal_node_carver->number_of_allocated_nodes * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid node carver - number of allocated nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_nodes > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_node_carver_node_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid nodes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		nodes_size = sizeof( libfsapfs_node_carver_node_t ) * number_of_allocated_nodes;
+
+		nodes = (libfsapfs_node_carver_node_t *) memory_reallocate(
+		                                          internal_node_carver->nodes,
+		                                          nodes_size );
+
+		if( nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_node_carver->nodes                     = nodes;
+		internal_node_carver->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	node = &( internal_node_carver->nodes[ internal_node_carver->number_of_nodes ] );
+
+	node->block_number           = block_number;
+	node->object_identifier      = object_identifier;
+	node->transaction_identifier = transaction_identifier;
+	node->btree_node             = btree_node;
+
+	internal_node_carver->number_of_nodes += 1;
+
+	return( 1 );
+}
+
+/* Appends the carved nodes of another node carver
+ * The B-tree nodes are moved from the source node carver
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_node_carver_append_nodes(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libfsapfs_internal_node_carver_t *source_internal_node_carver,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_carver_node_t *source_node = NULL;
+	static char *function                     = "libfsapfs_internal_node_carver_append_nodes";
+	int node_index                            = 0;
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source node carver.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < source_internal_node_carver->number_of_nodes;
+	     node_index++ )
+	{
+		source_node = &( source_internal_node_carver->nodes[ node_index ] );
+
+		if( libfsapfs_internal_node_carver_append_node(
+		     internal_node_carver,
+		     source_node->block_number,
+		     source_node->object_identifier,
+		     source_node->transaction_identifier,
+		     source_node->btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append node: %d.",
+			 function,
+			 node_index );
+
+			return( -1 );
+		}
+		source_node->btree_node = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a block and carves it if it contains a file system B-tree leaf node
+ * Returns 1 if a node was carved, 0 if not or -1 on error
+ */
+int libfsapfs_internal_node_carver_read_block_data(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *btree_node = NULL;
+	static char *function              = "libfsapfs_internal_node_carver_read_block_data";
+	uint64_t calculated_checksum       = 0;
+	uint64_t object_identifier         = 0;
+	uint64_t stored_checksum           = 0;
+	uint64_t transaction_identifier    = 0;
+	uint32_t object_subtype            = 0;
+	uint32_t object_type               = 0;
+	uint16_t node_flags                = 0;
+	int result                         = 0;
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ( sizeof( fsapfs_object_t ) + sizeof( fsapfs_btree_node_header_t ) ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Check the object type, subtype and node flags first since most blocks
+	 * are not file system B-tree leaf nodes and the checksum is costly
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_object_t *) data )->type,
+	 object_type );
+
+	object_type &= 0x0fffffffUL;
+
+	if( ( object_type != 0x00000002UL )
+	 && ( object_type != 0x00000003UL ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fsapfs_object_t *) data )->subtype,
+	 object_subtype );
+
+	if( object_subtype != 0x0000000eUL )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_btree_node_header_t *) &( data[ sizeof( fsapfs_object_t ) ] ) )->flags,
+	 node_flags );
+
+	if( ( node_flags & 0x0002 ) == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_object_t *) data )->identifier,
+	 object_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_object_t *) data )->transaction_identifier,
+	 transaction_identifier );
+
+	if( ( object_identifier == 0 )
+	 || ( transaction_identifier == 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_object_t *) data )->checksum,
+	 stored_checksum );
+
+	if( libfsapfs_checksum_calculate_fletcher64(
+	     &calculated_checksum,
+	     &( data[ 8 ] ),
+	     data_size - 8,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate Fletcher-64 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	if( libfsapfs_btree_node_initialize(
+	     &btree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	/* A block with a valid checksum can still contain records that cannot be decoded
+	 * in which case the block is not carved
+	 */
+	result = libfsapfs_btree_node_read_data(
+	          btree_node,
+	          data,
+	          data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_free(
+		 error );
+
+		libfsapfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+
+		return( 0 );
+	}
+	if( libfsapfs_internal_node_carver_append_node(
+	     internal_node_carver,
+	     block_number,
+	     object_identifier,
+	     transaction_identifier,
+	     btree_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( btree_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares two carved nodes by object identifier, transaction identifier and block number
+ * Returns -1 if the first node sorts before the second, 1 if after or 0 if equal
+ */
+int libfsapfs_node_carver_node_compare(
+     const void *first_node,
+     const void *second_node )
+{
+	const libfsapfs_node_carver_node_t *first  = (const libfsapfs_node_carver_node_t *) first_node;
+	const libfsapfs_node_carver_node_t *second = (const libfsapfs_node_carver_node_t *) second_node;
+
+	if( first->object_identifier != second->object_identifier )
+	{
+		return( ( first->object_identifier < second->object_identifier ) ? -1 : 1 );
+	}
+	if( first->transaction_identifier != second->transaction_identifier )
+	{
+		return( ( first->transaction_identifier < second->transaction_identifier ) ? -1 : 1 );
+	}
+	if( first->block_number != second->block_number )
+	{
+		return( ( first->block_number < second->block_number ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the carved nodes and removes the nodes with a duplicate object and transaction identifier
+ * Of the duplicates the node with the lowest block number is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_node_carver_deduplicate(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_carver_node_t *last_node = NULL;
+	libfsapfs_node_carver_node_t *node      = NULL;
+	static char *function                   = "libfsapfs_internal_node_carver_deduplicate";
+	int node_index                          = 0;
+	int number_of_nodes                     = 0;
+	int result                              = 1;
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_node_carver->number_of_nodes <= 1 )
+	{
+		return( 1 );
+	}
+	qsort(
+	 internal_node_carver->nodes,
+	 (size_t) internal_node_carver->number_of_nodes,
+	 sizeof( libfsapfs_node_carver_node_t ),
+	 &libfsapfs_node_carver_node_compare );
+
+	for( node_index = 0;
+	     node_index < internal_node_carver->number_of_nodes;
+	     node_index++ )
+	{
+		node = &( internal_node_carver->nodes[ node_index ] );
+
+		if( ( last_node != NULL )
+		 && ( last_node->object_identifier == node->object_identifier )
+		 && ( last_node->transaction_identifier == node->transaction_identifier ) )
+		{
+			if( libfsapfs_btree_node_free(
+			     &( node->btree_node ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free duplicate node: %d B-tree node.",
+				 function,
+				 node_index );
+
+				result = -1;
+			}
+			continue;
+		}
+		internal_node_carver->nodes[ number_of_nodes ] = *node;
+
+		last_node = &( internal_node_carver->nodes[ number_of_nodes++ ] );
+	}
+	internal_node_carver->number_of_nodes = number_of_nodes;
+
+	return( result );
+}
+
+/* Reads the blocks of a partition
+ * The blocks are read sequentially in chunks of LIBFSAPFS_NODE_CARVER_READ_BUFFER_SIZE
+ * This function is used as a thread entry point
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_partition_read(
+     libfsapfs_node_carver_partition_t *partition )
+{
+	uint8_t *buffer                    = NULL;
+	static char *function              = "libfsapfs_node_carver_partition_read";
+	size_t block_offset                = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	off64_t file_offset                = 0;
+	uint64_t block_number              = 0;
+	uint64_t last_block_number         = 0;
+	uint64_t number_of_buffer_blocks   = 0;
+	uint64_t number_of_read_blocks     = 0;
+	uint32_t block_size                = 0;
+
+	if( partition == NULL )
+	{
+		return( -1 );
+	}
+	partition->result = -1;
+
+	if( partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = partition->io_handle->block_size;
+
+	if( ( block_size == 0 )
+	 || ( block_size > LIBFSAPFS_NODE_CARVER_READ_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_buffer_blocks = LIBFSAPFS_NODE_CARVER_READ_BUFFER_SIZE / block_size;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * number_of_buffer_blocks * block_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	block_number      = partition->first_block_number;
+	last_block_number = partition->first_block_number + partition->number_of_blocks;
+	file_offset       = (off64_t) ( block_number * block_size );
+
+	if( libbfio_handle_seek_offset(
+	     partition->file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     &( partition->error ) ) == -1 )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	while( block_number < last_block_number )
+	{
+		if( partition->io_handle->abort != 0 )
+		{
+			break;
+		}
+		number_of_read_blocks = last_block_number - block_number;
+
+		if( number_of_read_blocks > number_of_buffer_blocks )
+		{
+			number_of_read_blocks = number_of_buffer_blocks;
+		}
+		read_size = (size_t) ( number_of_read_blocks * block_size );
+
+		read_count = libbfio_handle_read_buffer(
+		              partition->file_io_handle,
+		              buffer,
+		              read_size,
+		              &( partition->error ) );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blocks: %" PRIu64 " - %" PRIu64 ".",
+			 function,
+			 block_number,
+			 block_number + number_of_read_blocks - 1 );
+
+			goto on_error;
+		}
+		for( block_offset = 0;
+		     block_offset < read_size;
+		     block_offset += block_size )
+		{
+			if( libfsapfs_internal_node_carver_read_block_data(
+			     partition->internal_node_carver,
+			     &( buffer[ block_offset ] ),
+			     (size_t) block_size,
+			     block_number,
+			     &( partition->error ) ) == -1 )
+			{
+				libcerror_error_set(
+				 &( partition->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to carve block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+			block_number++;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	partition->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Frees partitions
+ * Joins threads that are still running
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_partitions_free(
+     libfsapfs_node_carver_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_carver_partition_t *partition = NULL;
+	static char *function                        = "libfsapfs_node_carver_partitions_free";
+	int partition_index                          = 0;
+	int result                                   = 1;
+
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( ( *partitions )[ partition_index ] );
+
+			if( partition->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( partition->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join partition: %d thread.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->file_io_handle != NULL )
+			{
+				if( partition->file_io_handle_opened != 0 )
+				{
+					if( libbfio_handle_close(
+					     partition->file_io_handle,
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close partition: %d file IO handle.",
+						 function,
+						 partition_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( partition->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->internal_node_carver != NULL )
+			{
+				if( libfsapfs_node_carver_free(
+				     (libfsapfs_node_carver_t **) &( partition->internal_node_carver ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d node carver.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( partition->error != NULL )
+			{
+				libcerror_error_free(
+				 &( partition->error ) );
+			}
+		}
+		memory_free(
+		 *partitions );
+
+		*partitions = NULL;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+/* Carves file system B-tree leaf nodes from a range of blocks
+ * The blocks are divided into partitions of consecutive block ranges
+ * that are read by separate threads, each using its own clone of the file IO handle
+ * The carved nodes are deduplicated by object and transaction identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_node_carver_read_file_io_handle(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t first_block_number,
+     uint64_t number_of_blocks,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_carver_partition_t serial_partition;
+
+	static char *function                         = "libfsapfs_internal_node_carver_read_file_io_handle";
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libfsapfs_node_carver_partition_t *partition  = NULL;
+	libfsapfs_node_carver_partition_t *partitions = NULL;
+	size_t partitions_size                        = 0;
+	uint64_t partition_first_block_number         = 0;
+	int number_of_partitions                      = 0;
+	int partition_index                           = 0;
+	int result                                    = 0;
+#endif
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &serial_partition,
+	     0,
+	     sizeof( libfsapfs_node_carver_partition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear serial partition.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the blocks are read by a single partition
+	 */
+	number_of_threads = 1;
+#endif
+	if( (uint64_t) number_of_threads > number_of_blocks )
+	{
+		number_of_threads = 1;
+	}
+	if( number_of_threads == 1 )
+	{
+		serial_partition.io_handle            = io_handle;
+		serial_partition.file_io_handle       = file_io_handle;
+		serial_partition.first_block_number   = first_block_number;
+		serial_partition.number_of_blocks     = number_of_blocks;
+		serial_partition.internal_node_carver = internal_node_carver;
+
+		if( libfsapfs_node_carver_partition_read(
+		     &serial_partition ) != 1 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error                 = serial_partition.error;
+				serial_partition.error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read blocks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	else
+	{
+		partitions_size = sizeof( libfsapfs_node_carver_partition_t ) * number_of_threads;
+
+		partitions = (libfsapfs_node_carver_partition_t *) memory_allocate(
+		                                                    partitions_size );
+
+		if( partitions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create partitions.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     partitions,
+		     0,
+		     partitions_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear partitions.",
+			 function );
+
+			memory_free(
+			 partitions );
+
+			partitions = NULL;
+
+			goto on_error;
+		}
+		number_of_partitions = number_of_threads;
+
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			partition_first_block_number = ( number_of_blocks / number_of_partitions ) * partition_index;
+
+			partition->io_handle          = io_handle;
+			partition->first_block_number = first_block_number + partition_first_block_number;
+
+			if( partition_index == ( number_of_partitions - 1 ) )
+			{
+				partition->number_of_blocks = number_of_blocks - partition_first_block_number;
+			}
+			else
+			{
+				partition->number_of_blocks = number_of_blocks / number_of_partitions;
+			}
+			if( libfsapfs_node_carver_initialize(
+			     (libfsapfs_node_carver_t **) &( partition->internal_node_carver ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d node carver.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libbfio_handle_clone(
+			     &( partition->file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d file IO handle.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          partition->file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if partition: %d file IO handle is open.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     partition->file_io_handle,
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				partition->file_io_handle_opened = 1;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_create(
+			     &( partition->thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsapfs_node_carver_partition_read,
+			     (void *) partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_join(
+			     &( partition->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( partition->result != 1 )
+			{
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error           = partition->error;
+					partition->error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read partition: %d.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			if( libfsapfs_internal_node_carver_append_nodes(
+			     internal_node_carver,
+			     partition->internal_node_carver,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append partition: %d nodes.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		if( libfsapfs_node_carver_partitions_free(
+		     &partitions,
+		     number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partitions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+	if( libfsapfs_internal_node_carver_deduplicate(
+	     internal_node_carver,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to deduplicate nodes.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( partitions != NULL )
+	{
+		libfsapfs_node_carver_partitions_free(
+		 &partitions,
+		 number_of_partitions,
+		 NULL );
+	}
+#endif
+	if( serial_partition.error != NULL )
+	{
+		libcerror_error_free(
+		 &( serial_partition.error ) );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of carved nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_get_number_of_nodes(
+     libfsapfs_node_carver_t *node_carver,
+     int *number_of_nodes,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_node_carver_t *internal_node_carver = NULL;
+	static char *function                                  = "libfsapfs_node_carver_get_number_of_nodes";
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node_carver = (libfsapfs_internal_node_carver_t *) node_carver;
+
+	if( number_of_nodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of nodes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_nodes = internal_node_carver->number_of_nodes;
+
+	return( 1 );
+}
+
+/* Retrieves a specific carved node
+ * The nodes are sorted by object identifier and transaction identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_get_node_by_index(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     uint64_t *block_number,
+     uint64_t *object_identifier,
+     uint64_t *transaction_identifier,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_node_carver_t *internal_node_carver = NULL;
+	libfsapfs_node_carver_node_t *node                     = NULL;
+	static char *function                                  = "libfsapfs_node_carver_get_node_by_index";
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_node_carver = (libfsapfs_internal_node_carver_t *) node_carver;
+
+	if( ( node_index < 0 )
+	 || ( node_index >= internal_node_carver->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( transaction_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	node = &( internal_node_carver->nodes[ node_index ] );
+
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node->btree_node,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of B-tree node entries.",
+		 function );
+
+		return( -1 );
+	}
+	*block_number           = node->block_number;
+	*object_identifier      = node->object_identifier;
+	*transaction_identifier = node->transaction_identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the B-tree entry of a specific record of a carved node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_node_carver_get_btree_entry(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     int node_index,
+     int record_index,
+     libfsapfs_btree_entry_t **btree_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_node_carver_get_btree_entry";
+
+	if( internal_node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= internal_node_carver->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_entry_by_index(
+	     internal_node_carver->nodes[ node_index ].btree_node,
+	     record_index,
+	     btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node: %d B-tree entry: %d.",
+		 function,
+		 node_index,
+		 record_index );
+
+		return( -1 );
+	}
+	if( ( *btree_entry == NULL )
+	 || ( ( *btree_entry )->key_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node: %d B-tree entry: %d.",
+		 function,
+		 node_index,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the file system identifier, record type and data sizes of a specific record of a carved node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_get_record_by_index(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     int record_index,
+     uint64_t *identifier,
+     uint8_t *record_type,
+     size_t *key_data_size,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	static char *function                = "libfsapfs_node_carver_get_record_by_index";
+	uint64_t value_64bit                 = 0;
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record type.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_node_carver_get_btree_entry(
+	     (libfsapfs_internal_node_carver_t *) node_carver,
+	     node_index,
+	     record_index,
+	     &btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node: %d record: %d.",
+		 function,
+		 node_index,
+		 record_index );
+
+		return( -1 );
+	}
+	if( btree_entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node: %d record: %d - key data size value out of bounds.",
+		 function,
+		 node_index,
+		 record_index );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_file_system_btree_key_common_t *) btree_entry->key_data )->file_system_identifier,
+	 value_64bit );
+
+	*identifier      = value_64bit & 0x0fffffffffffffffUL;
+	*record_type     = (uint8_t) ( value_64bit >> 60 );
+	*key_data_size   = btree_entry->key_data_size;
+	*value_data_size = btree_entry->value_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the key and value data of a specific record of a carved node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_carver_get_record_data(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     int record_index,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	static char *function                = "libfsapfs_node_carver_get_record_data";
+
+	if( node_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_node_carver_get_btree_entry(
+	     (libfsapfs_internal_node_carver_t *) node_carver,
+	     node_index,
+	     record_index,
+	     &btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node: %d record: %d.",
+		 function,
+		 node_index,
+		 record_index );
+
+		return( -1 );
+	}
+	if( ( key_data_size < btree_entry->key_data_size )
+	 || ( value_data_size < btree_entry->value_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key or value data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     key_data,
+	     btree_entry->key_data,
+	     btree_entry->key_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( btree_entry->value_data != NULL )
+	 && ( btree_entry->value_data_size > 0 ) )
+	{
+		if( memory_copy(
+		     value_data,
+		     btree_entry->value_data,
+		     btree_entry->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
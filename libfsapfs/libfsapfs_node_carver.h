@@ -0,0 +1,230 @@
+/*
+ * Node carver functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_NODE_CARVER_H )
+#define _LIBFSAPFS_NODE_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_extern.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_node_carver_node libfsapfs_node_carver_node_t;
+
+struct libfsapfs_node_carver_node
+{
+	/* The block number
+	 */
+	uint64_t block_number;
+
+	/* The object identifier
+	 */
+	uint64_t object_identifier;
+
+	/* The transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The B-tree node
+	 */
+	libfsapfs_btree_node_t *btree_node;
+};
+
+typedef struct libfsapfs_internal_node_carver libfsapfs_internal_node_carver_t;
+
+struct libfsapfs_internal_node_carver
+{
+	/* The carved nodes
+	 */
+	libfsapfs_node_carver_node_t *nodes;
+
+	/* The number of carved nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+};
+
+typedef struct libfsapfs_node_carver_partition libfsapfs_node_carver_partition_t;
+
+struct libfsapfs_node_carver_partition
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The (partition specific) file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened
+	 */
+	uint8_t file_io_handle_opened;
+
+	/* The first block number
+	 */
+	uint64_t first_block_number;
+
+	/* The number of blocks
+	 */
+	uint64_t number_of_blocks;
+
+	/* The (partition specific) node carver
+	 */
+	libfsapfs_internal_node_carver_t *internal_node_carver;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libfsapfs_node_carver_initialize(
+     libfsapfs_node_carver_t **node_carver,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_node_carver_free(
+     libfsapfs_node_carver_t **node_carver,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_node_carver_append_node(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     uint64_t block_number,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     libfsapfs_btree_node_t *btree_node,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_node_carver_append_nodes(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libfsapfs_internal_node_carver_t *source_internal_node_carver,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_node_carver_read_block_data(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+int libfsapfs_node_carver_node_compare(
+     const void *first_node,
+     const void *second_node );
+
+int libfsapfs_internal_node_carver_deduplicate(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libcerror_error_t **error );
+
+int libfsapfs_node_carver_partition_read(
+     libfsapfs_node_carver_partition_t *partition );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+int libfsapfs_node_carver_partitions_free(
+     libfsapfs_node_carver_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsapfs_internal_node_carver_read_file_io_handle(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t first_block_number,
+     uint64_t number_of_blocks,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_node_carver_get_number_of_nodes(
+     libfsapfs_node_carver_t *node_carver,
+     int *number_of_nodes,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_node_carver_get_node_by_index(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     uint64_t *block_number,
+     uint64_t *object_identifier,
+     uint64_t *transaction_identifier,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_node_carver_get_btree_entry(
+     libfsapfs_internal_node_carver_t *internal_node_carver,
+     int node_index,
+     int record_index,
+     libfsapfs_btree_entry_t **btree_entry,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_node_carver_get_record_by_index(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     int record_index,
+     uint64_t *identifier,
+     uint8_t *record_type,
+     size_t *key_data_size,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_node_carver_get_record_data(
+     libfsapfs_node_carver_t *node_carver,
+     int node_index,
+     int record_index,
+     uint8_t *key_data,
+     size_t key_data_size,
+     uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_NODE_CARVER_H ) */
+
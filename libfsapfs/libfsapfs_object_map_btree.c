@@ -26,12 +26,14 @@
 
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_usage.h"
 #include "libfsapfs_data_block.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_btree.h"
@@ -136,6 +138,21 @@ int libfsapfs_object_map_btree_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *object_map_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *object_map_btree )->io_handle              = io_handle;
 	( *object_map_btree )->data_block_vector      = data_block_vector;
 	( *object_map_btree )->root_node_block_number = root_node_block_number;
@@ -153,6 +170,101 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a object map B-tree view
+ * The view has its own root node but shares the data block and node caches
+ * and the read/write lock of the source object map B-tree, which must remain
+ * available while the view is used. The caches are keyed by block number
+ * hence nodes that are shared between both B-trees are only read once
+ * Make sure the value object_map_btree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_object_map_btree_initialize_view(
+     libfsapfs_object_map_btree_t **object_map_btree,
+     libfsapfs_object_map_btree_t *source_object_map_btree,
+     uint64_t root_node_block_number,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_object_map_btree_initialize_view";
+
+	if( object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *object_map_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid object map B-tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	*object_map_btree = memory_allocate_structure(
+	                     libfsapfs_object_map_btree_t );
+
+	if( *object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *object_map_btree,
+	     0,
+	     sizeof( libfsapfs_object_map_btree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object map B-tree.",
+		 function );
+
+		memory_free(
+		 *object_map_btree );
+
+		*object_map_btree = NULL;
+
+		return( -1 );
+	}
+	( *object_map_btree )->io_handle              = source_object_map_btree->io_handle;
+	( *object_map_btree )->data_block_vector      = source_object_map_btree->data_block_vector;
+	( *object_map_btree )->data_block_cache       = source_object_map_btree->data_block_cache;
+	( *object_map_btree )->node_cache             = source_object_map_btree->node_cache;
+	( *object_map_btree )->root_node_block_number = root_node_block_number;
+	( *object_map_btree )->is_view                = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	( *object_map_btree )->read_write_lock = source_object_map_btree->read_write_lock;
+#endif
+	return( 1 );
+}
+
 /* Frees a object map B-tree
  * Returns 1 if successful or -1 on error
  */
@@ -178,6 +290,17 @@ int libfsapfs_object_map_btree_free(
 	{
 		/* The data_block_vector is referenced and freed elsewhere
 		 */
+		if( ( *object_map_btree )->is_view != 0 )
+		{
+			/* The caches and read/write lock are referenced and freed elsewhere
+			 */
+			memory_free(
+			 *object_map_btree );
+
+			*object_map_btree = NULL;
+
+			return( 1 );
+		}
 		if( libfcache_cache_free(
 		     &( ( *object_map_btree )->node_cache ),
 		     error ) != 1 )
@@ -204,6 +327,21 @@ int libfsapfs_object_map_btree_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *object_map_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *object_map_btree );
 
@@ -1232,6 +1370,21 @@ int libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libfsapfs_object_map_btree_get_entry_by_identifier(
 	          object_map_btree,
 	          file_io_handle,
@@ -1320,6 +1473,27 @@ int libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
 		}
 		node = NULL;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( *descriptor != NULL )
+		{
+			libfsapfs_object_map_descriptor_free(
+			 descriptor,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
 	return( result );
 
 on_error:
@@ -1329,6 +1503,182 @@ on_error:
 		 descriptor,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 object_map_btree->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
+/* Retrieves the amount of memory used by the caches of the object map B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_object_map_btree_get_memory_usage(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_object_map_btree_get_memory_usage";
+	int result            = 1;
+
+	if( object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_cache_usage_get_node_cache_memory_usage(
+	     object_map_btree->node_cache,
+	     node_cache_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          object_map_btree->data_block_cache,
+	          data_block_cache_memory_usage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Trims the caches of the object map B-tree for a specific trim level
+ * Values are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_object_map_btree_trim_caches(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_object_map_btree_trim_caches";
+	int result            = 1;
+
+	if( object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( trim_level == LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS )
+	{
+		result = libfsapfs_cache_usage_trim_data_block_cache(
+		          object_map_btree->data_block_cache,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_cache_usage_trim_node_cache(
+		          object_map_btree->node_cache,
+		          trim_level,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to trim caches.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     object_map_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
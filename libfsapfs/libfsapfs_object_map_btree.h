@@ -30,6 +30,7 @@
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_descriptor.h"
@@ -61,6 +62,17 @@ struct libfsapfs_object_map_btree
 	/* Block number of B-tree root node
 	 */
 	uint64_t root_node_block_number;
+
+	/* Value to indicate the B-tree is a view that shares the caches
+	 * and read/write lock of another object map B-tree
+	 */
+	uint8_t is_view;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsapfs_object_map_btree_initialize(
@@ -70,6 +82,12 @@ int libfsapfs_object_map_btree_initialize(
      uint64_t root_node_block_number,
      libcerror_error_t **error );
 
+int libfsapfs_object_map_btree_initialize_view(
+     libfsapfs_object_map_btree_t **object_map_btree,
+     libfsapfs_object_map_btree_t *source_object_map_btree,
+     uint64_t root_node_block_number,
+     libcerror_error_t **error );
+
 int libfsapfs_object_map_btree_free(
      libfsapfs_object_map_btree_t **object_map_btree,
      libcerror_error_t **error );
@@ -110,6 +128,19 @@ int libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
      libfsapfs_object_map_descriptor_t **descriptor,
      libcerror_error_t **error );
 
+int libfsapfs_object_map_btree_get_memory_usage(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_object_map_btree_trim_caches(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1082 @@
+/*
+ * Read scheduler functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_entry.h"
+#include "libfsapfs_file_extent.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcdata.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_read_scheduler.h"
+
+/* Creates a read scheduler
+ * Make sure the value read_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_initialize(
+     libfsapfs_read_scheduler_t **read_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_read_scheduler_initialize";
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_scheduler = memory_allocate_structure(
+	                   libfsapfs_read_scheduler_t );
+
+	if( *read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_scheduler,
+	     0,
+	     sizeof( libfsapfs_read_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_scheduler != NULL )
+	{
+		memory_free(
+		 *read_scheduler );
+
+		*read_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_free(
+     libfsapfs_read_scheduler_t **read_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_read_scheduler_free";
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_scheduler != NULL )
+	{
+		if( ( *read_scheduler )->ranges != NULL )
+		{
+			memory_free(
+			 ( *read_scheduler )->ranges );
+		}
+		memory_free(
+		 *read_scheduler );
+
+		*read_scheduler = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a range
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_append_range(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     int file_entry_index,
+     off64_t logical_offset,
+     off64_t physical_offset,
+     size64_t size,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_read_scheduler_range_t *ranges = NULL;
+	libfsapfs_read_scheduler_range_t *range  = NULL;
+	static char *function                    = "libfsapfs_read_scheduler_append_range";
+	size_t ranges_size                       = 0;
+	int number_of_allocated_ranges           = 0;
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_scheduler->number_of_ranges >= read_scheduler->number_of_allocated_ranges )
+	{
+		if( read_scheduler->number_of_allocated_ranges == 0 )
+		{
+			number_of_allocated_ranges = 64;
+		}
+		else if( read_scheduler->number_of_allocated_ranges <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_ranges = read_scheduler->number_of_allocated_ranges * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read scheduler - number of allocated ranges value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_ranges > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfsapfs_read_scheduler_range_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid ranges size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		ranges_size = sizeof( libfsapfs_read_scheduler_range_t ) * number_of_allocated_ranges;
+
+		ranges = (libfsapfs_read_scheduler_range_t *) memory_reallocate(
+		                                               read_scheduler->ranges,
+		                                               ranges_size );
+
+		if( ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		read_scheduler->ranges                     = ranges;
+		read_scheduler->number_of_allocated_ranges = number_of_allocated_ranges;
+	}
+	range = &( read_scheduler->ranges[ read_scheduler->number_of_ranges ] );
+
+	range->file_entry_index      = file_entry_index;
+	range->logical_offset        = logical_offset;
+	range->physical_offset       = physical_offset;
+	range->size                  = size;
+	range->encryption_identifier = encryption_identifier;
+
+	read_scheduler->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Appends the ranges of the data of a file entry
+ * Ranges without physical data, such as sparse ranges or compressed data,
+ * are appended with a physical offset of 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_append_file_entry(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int file_entry_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_read_scheduler_append_file_entry";
+	size64_t range_size                  = 0;
+	off64_t logical_offset               = 0;
+	off64_t physical_offset              = 0;
+	int extent_index                     = 0;
+	int number_of_extents                = 0;
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->file_size == (size64_t) -1 )
+	{
+		if( libfsapfs_internal_file_entry_get_file_size(
+		     internal_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file_entry->file_size == 0 )
+	{
+		/* Nothing to schedule */
+	}
+	else if( internal_file_entry->compression_method != 0 )
+	{
+		/* The compressed data is read as a whole by the data stream
+		 */
+		if( libfsapfs_read_scheduler_append_range(
+		     read_scheduler,
+		     file_entry_index,
+		     0,
+		     0,
+		     internal_file_entry->file_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append compressed data range.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( internal_file_entry->file_extents == NULL )
+		{
+			if( libfsapfs_internal_file_entry_get_file_extents(
+			     internal_file_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine file extents.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->file_extents,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of file extents.",
+			 function );
+
+			goto on_error;
+		}
+		for( extent_index = 0;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_file_entry->file_extents,
+			     extent_index,
+			     (intptr_t **) &file_extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			if( file_extent == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing file extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			if( file_extent->logical_offset >= internal_file_entry->file_size )
+			{
+				break;
+			}
+			/* Schedule the data not covered by a file extent as a sparse range
+			 */
+			if( (size64_t) logical_offset < file_extent->logical_offset )
+			{
+				if( libfsapfs_read_scheduler_append_range(
+				     read_scheduler,
+				     file_entry_index,
+				     logical_offset,
+				     0,
+				     (size64_t) file_extent->logical_offset - logical_offset,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sparse range.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			logical_offset = (off64_t) file_extent->logical_offset;
+			range_size     = file_extent->data_size;
+
+			if( range_size > ( internal_file_entry->file_size - logical_offset ) )
+			{
+				range_size = internal_file_entry->file_size - logical_offset;
+			}
+			physical_offset = (off64_t) file_extent->physical_block_number * internal_file_entry->io_handle->block_size;
+
+			if( libfsapfs_read_scheduler_append_range(
+			     read_scheduler,
+			     file_entry_index,
+			     logical_offset,
+			     physical_offset,
+			     range_size,
+			     file_extent->encryption_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append range of file extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			logical_offset += range_size;
+		}
+		if( (size64_t) logical_offset < internal_file_entry->file_size )
+		{
+			if( libfsapfs_read_scheduler_append_range(
+			     read_scheduler,
+			     file_entry_index,
+			     logical_offset,
+			     0,
+			     internal_file_entry->file_size - logical_offset,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sparse range.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_file_entry->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Compares two ranges by physical offset
+ * Ranges that share the same physical data are ordered next to each other
+ * Returns -1 if first is less than second, 0 if equal or 1 if greater
+ */
+int libfsapfs_read_scheduler_range_compare(
+     const void *first_range,
+     const void *second_range )
+{
+	const libfsapfs_read_scheduler_range_t *first  = (const libfsapfs_read_scheduler_range_t *) first_range;
+	const libfsapfs_read_scheduler_range_t *second = (const libfsapfs_read_scheduler_range_t *) second_range;
+
+	if( first->physical_offset != second->physical_offset )
+	{
+		return( ( first->physical_offset < second->physical_offset ) ? -1 : 1 );
+	}
+	if( first->encryption_identifier != second->encryption_identifier )
+	{
+		return( ( first->encryption_identifier < second->encryption_identifier ) ? -1 : 1 );
+	}
+	if( first->size != second->size )
+	{
+		return( ( first->size < second->size ) ? -1 : 1 );
+	}
+	if( first->file_entry_index != second->file_entry_index )
+	{
+		return( ( first->file_entry_index < second->file_entry_index ) ? -1 : 1 );
+	}
+	if( first->logical_offset != second->logical_offset )
+	{
+		return( ( first->logical_offset < second->logical_offset ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Sorts the ranges in physical order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_sort(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_read_scheduler_sort";
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_scheduler->number_of_ranges > 1 )
+	{
+		qsort(
+		 read_scheduler->ranges,
+		 (size_t) read_scheduler->number_of_ranges,
+		 sizeof( libfsapfs_read_scheduler_range_t ),
+		 &libfsapfs_read_scheduler_range_compare );
+	}
+	return( 1 );
+}
+
+/* Reads the data of physically adjacent or nearby ranges with a single read
+ * The ranges, starting with the first range, are coalesced while they are less
+ * than a block apart and fit in the buffer. Only ranges of file entries without
+ * encryption that are stored in the same file IO pool, or the same file IO handle
+ * if there is no pool, are coalesced, since their data can be read as-is.
+ * Returns 1 if successful, 0 if the first range cannot be read coalesced or -1 on error
+ */
+int libfsapfs_read_scheduler_read_coalesced_ranges(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int first_range_index,
+     int *last_range_index,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libbfio_pool_t *file_io_pool                         = NULL;
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsapfs_read_scheduler_range_t *range              = NULL;
+	static char *function                                = "libfsapfs_read_scheduler_read_coalesced_ranges";
+	size64_t maximum_gap_size                            = 0;
+	size_t read_size                                     = 0;
+	ssize_t read_count                                   = 0;
+	off64_t range_end_offset                             = 0;
+	off64_t read_end_offset                              = 0;
+	off64_t read_offset                                  = 0;
+	int file_io_pool_entry                               = 0;
+	int range_index                                      = 0;
+	int safe_last_range_index                            = 0;
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_range_index < 0 )
+	 || ( first_range_index >= read_scheduler->number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_range_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last range index.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	safe_last_range_index = first_range_index;
+
+	for( range_index = first_range_index;
+	     range_index < read_scheduler->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( read_scheduler->ranges[ range_index ] );
+
+		/* Ranges without physical data are read by the data stream
+		 */
+		if( range->physical_offset == 0 )
+		{
+			break;
+		}
+		if( ( range->file_entry_index < 0 )
+		 || ( range->file_entry_index >= number_of_file_entries ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range: %d - file entry index value out of bounds.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entries[ range->file_entry_index ];
+
+		if( ( internal_file_entry == NULL )
+		 || ( internal_file_entry->io_handle == NULL )
+		 || ( internal_file_entry->encryption_context != NULL ) )
+		{
+			break;
+		}
+		range_end_offset = range->physical_offset + (off64_t) range->size;
+
+		if( range_index == first_range_index )
+		{
+			if( range->size > (size64_t) buffer_size )
+			{
+				break;
+			}
+			file_io_handle     = internal_file_entry->file_io_handle;
+			file_io_pool       = internal_file_entry->file_io_pool;
+			file_io_pool_entry = internal_file_entry->file_io_pool_entry;
+			maximum_gap_size   = (size64_t) internal_file_entry->io_handle->block_size;
+			read_offset        = range->physical_offset;
+			read_end_offset    = range_end_offset;
+		}
+		else
+		{
+			if( internal_file_entry->file_io_pool != file_io_pool )
+			{
+				break;
+			}
+			if( ( file_io_pool == NULL )
+			 && ( internal_file_entry->file_io_handle != file_io_handle ) )
+			{
+				break;
+			}
+			if( ( range->physical_offset > read_end_offset )
+			 && ( (size64_t) ( range->physical_offset - read_end_offset ) > maximum_gap_size ) )
+			{
+				break;
+			}
+			if( range_end_offset < read_end_offset )
+			{
+				range_end_offset = read_end_offset;
+			}
+			if( (size64_t) ( range_end_offset - read_offset ) > (size64_t) buffer_size )
+			{
+				break;
+			}
+			read_end_offset = range_end_offset;
+		}
+		safe_last_range_index = range_index;
+	}
+	if( range_index == first_range_index )
+	{
+		return( 0 );
+	}
+	read_size = (size_t) ( read_end_offset - read_offset );
+
+	if( file_io_pool != NULL )
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              file_io_pool,
+		              file_io_pool_entry,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              read_offset,
+		              error );
+	}
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 read_offset,
+		 read_offset );
+
+		return( -1 );
+	}
+	for( range_index = first_range_index;
+	     range_index <= safe_last_range_index;
+	     range_index++ )
+	{
+		range = &( read_scheduler->ranges[ range_index ] );
+
+		if( callback_function(
+		     file_entries[ range->file_entry_index ],
+		     range->file_entry_index,
+		     range->logical_offset,
+		     &( buffer[ range->physical_offset - read_offset ] ),
+		     (size_t) range->size,
+		     callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for file entry: %d.",
+			 function,
+			 range->file_entry_index );
+
+			return( -1 );
+		}
+	}
+	*last_range_index = safe_last_range_index;
+
+	return( 1 );
+}
+
+/* Reads the data of the ranges in scheduled order and passes it to the callback function
+ * Physically adjacent or nearby ranges of unencrypted file entries are read
+ * with a single read. Ranges that share the same physical data, such as those
+ * of cloned files, are read once and passed to the callback function for each
+ * file entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_read_scheduler_read(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error )
+{
+	libfsapfs_read_scheduler_range_t *first_range = NULL;
+	libfsapfs_read_scheduler_range_t *range       = NULL;
+	uint8_t *buffer                               = NULL;
+	static char *function                         = "libfsapfs_read_scheduler_read";
+	size64_t range_offset                         = 0;
+	size_t read_size                              = 0;
+	ssize_t read_count                            = 0;
+	int first_range_index                         = 0;
+	int last_range_index                          = 0;
+	int range_index                               = 0;
+	int result                                    = 0;
+
+	if( read_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_scheduler->number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBFSAPFS_READ_SCHEDULER_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	first_range_index = 0;
+
+	while( first_range_index < read_scheduler->number_of_ranges )
+	{
+		result = libfsapfs_read_scheduler_read_coalesced_ranges(
+		          read_scheduler,
+		          file_entries,
+		          number_of_file_entries,
+		          first_range_index,
+		          &last_range_index,
+		          buffer,
+		          LIBFSAPFS_READ_SCHEDULER_BUFFER_SIZE,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read coalesced ranges starting with range: %d.",
+			 function,
+			 first_range_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			first_range_index = last_range_index + 1;
+
+			continue;
+		}
+		first_range = &( read_scheduler->ranges[ first_range_index ] );
+
+		/* Determine the ranges that share the same physical data
+		 */
+		last_range_index = first_range_index;
+
+		if( first_range->physical_offset != 0 )
+		{
+			while( ( last_range_index + 1 ) < read_scheduler->number_of_ranges )
+			{
+				range = &( read_scheduler->ranges[ last_range_index + 1 ] );
+
+				if( ( range->physical_offset != first_range->physical_offset )
+				 || ( range->encryption_identifier != first_range->encryption_identifier )
+				 || ( range->size != first_range->size ) )
+				{
+					break;
+				}
+				last_range_index++;
+			}
+		}
+		for( range_index = first_range_index;
+		     range_index <= last_range_index;
+		     range_index++ )
+		{
+			range = &( read_scheduler->ranges[ range_index ] );
+
+			if( ( range->file_entry_index < 0 )
+			 || ( range->file_entry_index >= number_of_file_entries ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid range: %d - file entry index value out of bounds.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		range_offset = 0;
+
+		while( range_offset < first_range->size )
+		{
+			read_size = LIBFSAPFS_READ_SCHEDULER_BUFFER_SIZE;
+
+			if( (size64_t) read_size > ( first_range->size - range_offset ) )
+			{
+				read_size = (size_t) ( first_range->size - range_offset );
+			}
+			read_count = libfsapfs_file_entry_read_buffer_at_offset(
+			              file_entries[ first_range->file_entry_index ],
+			              buffer,
+			              read_size,
+			              first_range->logical_offset + (off64_t) range_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data of file entry: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 first_range->file_entry_index,
+				 first_range->logical_offset + (off64_t) range_offset,
+				 first_range->logical_offset + (off64_t) range_offset );
+
+				goto on_error;
+			}
+			for( range_index = first_range_index;
+			     range_index <= last_range_index;
+			     range_index++ )
+			{
+				range = &( read_scheduler->ranges[ range_index ] );
+
+				if( callback_function(
+				     file_entries[ range->file_entry_index ],
+				     range->file_entry_index,
+				     range->logical_offset + (off64_t) range_offset,
+				     buffer,
+				     read_size,
+				     callback_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: callback function failed for file entry: %d.",
+					 function,
+					 range->file_entry_index );
+
+					goto on_error;
+				}
+			}
+			range_offset += read_size;
+		}
+		first_range_index = last_range_index + 1;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,148 @@
+/*
+ * Read scheduler functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_READ_SCHEDULER_H )
+#define _LIBFSAPFS_READ_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_file_entry.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_read_scheduler_range libfsapfs_read_scheduler_range_t;
+
+struct libfsapfs_read_scheduler_range
+{
+	/* The index of the file entry
+	 */
+	int file_entry_index;
+
+	/* The logical offset
+	 */
+	off64_t logical_offset;
+
+	/* The physical offset
+	 */
+	off64_t physical_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The encryption identifier
+	 */
+	uint64_t encryption_identifier;
+};
+
+typedef struct libfsapfs_read_scheduler libfsapfs_read_scheduler_t;
+
+struct libfsapfs_read_scheduler
+{
+	/* The ranges
+	 */
+	libfsapfs_read_scheduler_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The number of allocated ranges
+	 */
+	int number_of_allocated_ranges;
+};
+
+int libfsapfs_read_scheduler_initialize(
+     libfsapfs_read_scheduler_t **read_scheduler,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_free(
+     libfsapfs_read_scheduler_t **read_scheduler,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_append_range(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     int file_entry_index,
+     off64_t logical_offset,
+     off64_t physical_offset,
+     size64_t size,
+     uint64_t encryption_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_append_file_entry(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int file_entry_index,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_range_compare(
+     const void *first_range,
+     const void *second_range );
+
+int libfsapfs_read_scheduler_sort(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_read_coalesced_ranges(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int first_range_index,
+     int *last_range_index,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+int libfsapfs_read_scheduler_read(
+     libfsapfs_read_scheduler_t *read_scheduler,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_READ_SCHEDULER_H ) */
+
@@ -0,0 +1,1368 @@
+/*
+ * Seal verifier functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_btree_entry.h"
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libhmac.h"
+#include "libfsapfs_seal_verifier.h"
+
+/* Clears a level
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_level_clear(
+     libfsapfs_seal_verifier_level_t *level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_seal_verifier_level_clear";
+
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( level->nodes != NULL )
+	{
+		memory_free(
+		 level->nodes );
+	}
+	level->nodes                     = NULL;
+	level->number_of_nodes           = 0;
+	level->number_of_allocated_nodes = 0;
+
+	return( 1 );
+}
+
+/* Appends a node to a level
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_level_append_node(
+     libfsapfs_seal_verifier_level_t *level,
+     uint64_t block_number,
+     const uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_seal_verifier_node_t *node  = NULL;
+	libfsapfs_seal_verifier_node_t *nodes = NULL;
+	static char *function                 = "libfsapfs_seal_verifier_level_append_node";
+	size_t nodes_size                     = 0;
+	int number_of_allocated_nodes         = 0;
+
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hash_size == 0 )
+	 || ( hash_size > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( level->number_of_nodes >= level->number_of_allocated_nodes )
+	{
+		if( level->number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 256;
+		}
+		else if( level->number_of_allocated_nodes < LIBFSAPFS_SEAL_VERIFIER_MAXIMUM_NUMBER_OF_NODES )
+		{
+			number_of_allocated_nodes = level->number_of_allocated_nodes * 2;
+
+			if( number_of_allocated_nodes > LIBFSAPFS_SEAL_VERIFIER_MAXIMUM_NUMBER_OF_NODES )
+			{
+				number_of_allocated_nodes = LIBFSAPFS_SEAL_VERIFIER_MAXIMUM_NUMBER_OF_NODES;
+			}
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid level - number of allocated nodes value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		nodes_size = sizeof( libfsapfs_seal_verifier_node_t ) * number_of_allocated_nodes;
+
+		nodes = (libfsapfs_seal_verifier_node_t *) memory_reallocate(
+		                                            level->nodes,
+		                                            nodes_size );
+
+		if( nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		level->nodes                     = nodes;
+		level->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	node = &( level->nodes[ level->number_of_nodes ] );
+
+	node->block_number = block_number;
+
+	if( memory_copy(
+	     node->hash,
+	     hash,
+	     hash_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy hash.",
+		 function );
+
+		return( -1 );
+	}
+	level->number_of_nodes += 1;
+
+	return( 1 );
+}
+
+/* Appends the nodes of another level
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_level_append_nodes(
+     libfsapfs_seal_verifier_level_t *level,
+     libfsapfs_seal_verifier_level_t *source_level,
+     libcerror_error_t **error )
+{
+	libfsapfs_seal_verifier_node_t *source_node = NULL;
+	static char *function                       = "libfsapfs_seal_verifier_level_append_nodes";
+	int node_index                              = 0;
+
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source level.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < source_level->number_of_nodes;
+	     node_index++ )
+	{
+		source_node = &( source_level->nodes[ node_index ] );
+
+		if( libfsapfs_seal_verifier_level_append_node(
+		     level,
+		     source_node->block_number,
+		     source_node->hash,
+		     64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append node: %d.",
+			 function,
+			 node_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of node data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_calculate_hash(
+     uint32_t hash_type,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_seal_verifier_calculate_hash";
+	int result            = 0;
+
+	switch( hash_type )
+	{
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA256:
+			result = libhmac_sha256_calculate(
+			          data,
+			          data_size,
+			          hash,
+			          hash_size,
+			          error );
+			break;
+
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA512:
+			result = libhmac_sha512_calculate(
+			          data,
+			          data_size,
+			          hash,
+			          hash_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type: %" PRIu32 ".",
+			 function,
+			 hash_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies the nodes of a partition
+ * Every node block is read and its hash compared against the hash stored in its parent,
+ * the children of branch nodes that match are added to the child level of the partition
+ * This function is used as a thread entry point
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_partition_verify(
+     libfsapfs_seal_verifier_partition_t *partition )
+{
+	uint8_t calculated_hash[ 64 ];
+
+	libfsapfs_btree_entry_t *entry             = NULL;
+	libfsapfs_btree_node_t *node               = NULL;
+	libfsapfs_seal_verifier_node_t *level_node = NULL;
+	uint8_t *buffer                            = NULL;
+	static char *function                      = "libfsapfs_seal_verifier_partition_verify";
+	size_t hash_size                           = 0;
+	ssize_t read_count                         = 0;
+	off64_t file_offset                        = 0;
+	uint64_t sub_node_block_number             = 0;
+	uint32_t block_size                        = 0;
+	int entry_index                            = 0;
+	int is_leaf_node                           = 0;
+	int last_node_index                        = 0;
+	int node_index                             = 0;
+	int number_of_entries                      = 0;
+	int result                                 = 0;
+
+	if( partition == NULL )
+	{
+		return( -1 );
+	}
+	partition->result = -1;
+
+	if( partition->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition->level == NULL )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition - missing level.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition->first_node_index < 0 )
+	 || ( partition->number_of_nodes < 0 )
+	 || ( partition->number_of_nodes > ( partition->level->number_of_nodes - partition->first_node_index ) ) )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - node range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_size = partition->io_handle->block_size;
+
+	if( ( block_size == 0 )
+	 || ( block_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition->hash_type == LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA512 )
+	{
+		hash_size = 64;
+	}
+	else
+	{
+		hash_size = 32;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * block_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &( partition->error ),
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
+	}
+	last_node_index = partition->first_node_index + partition->number_of_nodes;
+
+	for( node_index = partition->first_node_index;
+	     node_index < last_node_index;
+	     node_index++ )
+	{
+		if( partition->io_handle->abort != 0 )
+		{
+			break;
+		}
+		level_node = &( partition->level->nodes[ node_index ] );
+
+		file_offset = (off64_t) ( level_node->block_number * block_size );
+
+		if( libbfio_handle_seek_offset(
+		     partition->file_io_handle,
+		     file_offset,
+		     SEEK_SET,
+		     &( partition->error ) ) == -1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+		              partition->file_io_handle,
+		              buffer,
+		              (size_t) block_size,
+		              &( partition->error ) );
+
+		if( read_count != (ssize_t) block_size )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read node block: %" PRIu64 ".",
+			 function,
+			 level_node->block_number );
+
+			goto on_error;
+		}
+		if( libfsapfs_seal_verifier_calculate_hash(
+		     partition->hash_type,
+		     buffer,
+		     (size_t) block_size,
+		     calculated_hash,
+		     hash_size,
+		     &( partition->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to calculate hash of node block: %" PRIu64 ".",
+			 function,
+			 level_node->block_number );
+
+			goto on_error;
+		}
+		if( memory_compare(
+		     calculated_hash,
+		     level_node->hash,
+		     hash_size ) != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in hash of node block: %" PRIu64 ".\n",
+				 function,
+				 level_node->block_number );
+			}
+#endif
+			partition->number_of_mismatches += 1;
+
+			continue;
+		}
+		if( libfsapfs_btree_node_initialize(
+		     &node,
+		     &( partition->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_btree_node_read_data(
+		     node,
+		     buffer,
+		     (size_t) block_size,
+		     &( partition->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B-tree node block: %" PRIu64 ".",
+			 function,
+			 level_node->block_number );
+
+			goto on_error;
+		}
+		if( ( node->object_type != 0x00000002UL )
+		 && ( node->object_type != 0x10000002UL )
+		 && ( node->object_type != 0x00000003UL )
+		 && ( node->object_type != 0x10000003UL ) )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object type: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_type );
+
+			goto on_error;
+		}
+		if( node->object_subtype != 0x0000000eUL )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid object subtype: 0x%08" PRIx32 ".",
+			 function,
+			 node->object_subtype );
+
+			goto on_error;
+		}
+		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+		                node,
+		                &( partition->error ) );
+
+		if( is_leaf_node == -1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if B-tree node is a leaf node.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_leaf_node == 0 )
+		{
+			if( ( node->node_header->flags & 0x0008 ) == 0 )
+			{
+				libcerror_error_set(
+				 &( partition->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid B-tree node block: %" PRIu64 " - missing hashed flag.",
+				 function,
+				 level_node->block_number );
+
+				goto on_error;
+			}
+			if( libfsapfs_btree_node_get_number_of_entries(
+			     node,
+			     &number_of_entries,
+			     &( partition->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( partition->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries from B-tree node.",
+				 function );
+
+				goto on_error;
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				if( libfsapfs_btree_node_get_entry_by_index(
+				     node,
+				     entry_index,
+				     &entry,
+				     &( partition->error ) ) != 1 )
+				{
+					libcerror_error_set(
+					 &( partition->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve entry: %d from B-tree node.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( entry == NULL )
+				{
+					libcerror_error_set(
+					 &( partition->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: invalid B-tree entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( entry->value_data_size != ( 8 + 64 ) )
+				{
+					libcerror_error_set(
+					 &( partition->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid B-tree entry: %d - unsupported value data size.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+				          partition->file_system_btree,
+				          partition->file_io_handle,
+				          entry,
+				          &sub_node_block_number,
+				          &( partition->error ) );
+
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 &( partition->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine sub node block number of B-tree entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( libfsapfs_seal_verifier_level_append_node(
+				     &( partition->child_level ),
+				     sub_node_block_number,
+				     &( entry->value_data[ 8 ] ),
+				     64,
+				     &( partition->error ) ) != 1 )
+				{
+					libcerror_error_set(
+					 &( partition->error ),
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append sub node of B-tree entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libfsapfs_btree_node_free(
+		     &node,
+		     &( partition->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( partition->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 buffer );
+
+	partition->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Frees partitions
+ * Joins threads that are still running
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_seal_verifier_partitions_free(
+     libfsapfs_seal_verifier_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error )
+{
+	libfsapfs_seal_verifier_partition_t *partition = NULL;
+	static char *function                          = "libfsapfs_seal_verifier_partitions_free";
+	int partition_index                            = 0;
+	int result                                     = 1;
+
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partitions != NULL )
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( ( *partitions )[ partition_index ] );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+			if( partition->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( partition->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join partition: %d thread.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+#endif
+			if( partition->file_io_handle != NULL )
+			{
+				if( partition->file_io_handle_opened != 0 )
+				{
+					if( libbfio_handle_close(
+					     partition->file_io_handle,
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close partition: %d file IO handle.",
+						 function,
+						 partition_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( partition->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					result = -1;
+				}
+			}
+			if( libfsapfs_seal_verifier_level_clear(
+			     &( partition->child_level ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear partition: %d child level.",
+				 function,
+				 partition_index );
+
+				result = -1;
+			}
+			if( partition->error != NULL )
+			{
+				libcerror_error_free(
+				 &( partition->error ) );
+			}
+		}
+		memory_free(
+		 *partitions );
+
+		*partitions = NULL;
+	}
+	return( result );
+}
+
+/* Verifies the nodes of a level
+ * The nodes are divided into partitions that are verified by separate threads,
+ * each using its own clone of the file IO handle
+ * Returns 1 if all hashes match, 0 if not or -1 on error
+ */
+int libfsapfs_seal_verifier_verify_level(
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint32_t hash_type,
+     libfsapfs_seal_verifier_level_t *level,
+     libfsapfs_seal_verifier_level_t *child_level,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_seal_verifier_partition_t *partition  = NULL;
+	libfsapfs_seal_verifier_partition_t *partitions = NULL;
+	static char *function                           = "libfsapfs_seal_verifier_verify_level";
+	size_t partitions_size                          = 0;
+	int number_of_mismatches                        = 0;
+	int number_of_partitions                        = 0;
+	int partition_first_node_index                  = 0;
+	int partition_index                             = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	int result                                      = 0;
+#endif
+
+	if( level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid level.",
+		 function );
+
+		return( -1 );
+	}
+	if( child_level == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid child level.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* Without multi-threading support the nodes are verified by a single partition
+	 */
+	number_of_threads = 1;
+#endif
+	if( number_of_threads > level->number_of_nodes )
+	{
+		number_of_threads = 1;
+	}
+	number_of_partitions = number_of_threads;
+
+	partitions_size = sizeof( libfsapfs_seal_verifier_partition_t ) * number_of_partitions;
+
+	partitions = (libfsapfs_seal_verifier_partition_t *) memory_allocate(
+	                                                      partitions_size );
+
+	if( partitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     partitions,
+	     0,
+	     partitions_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partitions.",
+		 function );
+
+		memory_free(
+		 partitions );
+
+		partitions = NULL;
+
+		goto on_error;
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		partition = &( partitions[ partition_index ] );
+
+		partition_first_node_index = ( level->number_of_nodes / number_of_partitions ) * partition_index;
+
+		partition->io_handle         = io_handle;
+		partition->file_system_btree = file_system_btree;
+		partition->hash_type         = hash_type;
+		partition->level             = level;
+		partition->first_node_index  = partition_first_node_index;
+
+		if( partition_index == ( number_of_partitions - 1 ) )
+		{
+			partition->number_of_nodes = level->number_of_nodes - partition_first_node_index;
+		}
+		else
+		{
+			partition->number_of_nodes = level->number_of_nodes / number_of_partitions;
+		}
+	}
+	if( number_of_partitions == 1 )
+	{
+		partition = &( partitions[ 0 ] );
+
+		partition->file_io_handle = file_io_handle;
+
+		libfsapfs_seal_verifier_partition_verify(
+		 partition );
+
+		/* The file IO handle is not owned by the serial partition
+		 */
+		partition->file_io_handle = NULL;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	else
+	{
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libbfio_handle_clone(
+			     &( partition->file_io_handle ),
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d file IO handle.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			result = libbfio_handle_is_open(
+			          partition->file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to determine if partition: %d file IO handle is open.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libbfio_handle_open(
+				     partition->file_io_handle,
+				     LIBBFIO_OPEN_READ,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to open partition: %d file IO handle.",
+					 function,
+					 partition_index );
+
+					goto on_error;
+				}
+				partition->file_io_handle_opened = 1;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_create(
+			     &( partition->thread ),
+			     NULL,
+			     (int (*)(void *)) &libfsapfs_seal_verifier_partition_verify,
+			     (void *) partition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+		for( partition_index = 0;
+		     partition_index < number_of_partitions;
+		     partition_index++ )
+		{
+			partition = &( partitions[ partition_index ] );
+
+			if( libcthreads_thread_join(
+			     &( partition->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join partition: %d thread.",
+				 function,
+				 partition_index );
+
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		partition = &( partitions[ partition_index ] );
+
+		if( partition->result != 1 )
+		{
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error           = partition->error;
+				partition->error = NULL;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify partition: %d.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+		number_of_mismatches += partition->number_of_mismatches;
+
+		if( libfsapfs_seal_verifier_level_append_nodes(
+		     child_level,
+		     &( partition->child_level ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition: %d child nodes.",
+			 function,
+			 partition_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_seal_verifier_partitions_free(
+	     &partitions,
+	     number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free partitions.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_mismatches != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( partitions != NULL )
+	{
+		libfsapfs_seal_verifier_partitions_free(
+		 &partitions,
+		 number_of_partitions,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Verifies the seal of a file system B-tree
+ * The B-tree is verified level by level, starting with the root node
+ * of which the hash is stored in the integrity metadata
+ * Returns 1 if all hashes match, 0 if not or -1 on error
+ */
+int libfsapfs_seal_verifier_verify(
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint32_t hash_type,
+     const uint8_t *root_hash,
+     size_t root_hash_size,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_seal_verifier_level_t levels[ 2 ];
+
+	libfsapfs_seal_verifier_level_t *child_level = NULL;
+	libfsapfs_seal_verifier_level_t *level       = NULL;
+	static char *function                        = "libfsapfs_seal_verifier_verify";
+	size_t hash_size                             = 0;
+	int level_depth                              = 0;
+	int result                                   = 1;
+	int verify_result                            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	switch( hash_type )
+	{
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA256:
+			hash_size = 32;
+			break;
+
+		case LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA512:
+			hash_size = 64;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type: %" PRIu32 ".",
+			 function,
+			 hash_type );
+
+			return( -1 );
+	}
+	if( root_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_hash_size != hash_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root hash size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     levels,
+	     0,
+	     sizeof( libfsapfs_seal_verifier_level_t ) * 2 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear levels.",
+		 function );
+
+		return( -1 );
+	}
+	level       = &( levels[ 0 ] );
+	child_level = &( levels[ 1 ] );
+
+	if( libfsapfs_seal_verifier_level_append_node(
+	     level,
+	     file_system_btree->root_node_block_number,
+	     root_hash,
+	     root_hash_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root node.",
+		 function );
+
+		goto on_error;
+	}
+	while( level->number_of_nodes > 0 )
+	{
+		if( level_depth > LIBFSAPFS_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid level depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: verifying level: %d with %d nodes.\n",
+			 function,
+			 level_depth,
+			 level->number_of_nodes );
+		}
+#endif
+		verify_result = libfsapfs_seal_verifier_verify_level(
+		                 io_handle,
+		                 file_io_handle,
+		                 file_system_btree,
+		                 hash_type,
+		                 level,
+		                 child_level,
+		                 number_of_threads,
+		                 error );
+
+		if( verify_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify level: %d.",
+			 function,
+			 level_depth );
+
+			goto on_error;
+		}
+		else if( verify_result == 0 )
+		{
+			result = 0;
+		}
+		if( io_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfsapfs_seal_verifier_level_clear(
+		     level,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear level: %d.",
+			 function,
+			 level_depth );
+
+			goto on_error;
+		}
+		child_level = level;
+		level       = &( levels[ ( level_depth + 1 ) % 2 ] );
+
+		level_depth++;
+	}
+	libfsapfs_seal_verifier_level_clear(
+	 &( levels[ 0 ] ),
+	 NULL );
+	libfsapfs_seal_verifier_level_clear(
+	 &( levels[ 1 ] ),
+	 NULL );
+
+	return( result );
+
+on_error:
+	libfsapfs_seal_verifier_level_clear(
+	 &( levels[ 0 ] ),
+	 NULL );
+	libfsapfs_seal_verifier_level_clear(
+	 &( levels[ 1 ] ),
+	 NULL );
+
+	return( -1 );
+}
+
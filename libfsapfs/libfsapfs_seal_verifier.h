@@ -0,0 +1,184 @@
+/*
+ * Seal verifier functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_SEAL_VERIFIER_H )
+#define _LIBFSAPFS_SEAL_VERIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_file_system_btree.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_seal_verifier_node libfsapfs_seal_verifier_node_t;
+
+struct libfsapfs_seal_verifier_node
+{
+	/* The block number
+	 */
+	uint64_t block_number;
+
+	/* The expected hash
+	 */
+	uint8_t hash[ 64 ];
+};
+
+typedef struct libfsapfs_seal_verifier_level libfsapfs_seal_verifier_level_t;
+
+struct libfsapfs_seal_verifier_level
+{
+	/* The nodes
+	 */
+	libfsapfs_seal_verifier_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+};
+
+typedef struct libfsapfs_seal_verifier_partition libfsapfs_seal_verifier_partition_t;
+
+struct libfsapfs_seal_verifier_partition
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The (partition specific) file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened
+	 */
+	uint8_t file_io_handle_opened;
+
+	/* The file system B-tree
+	 */
+	libfsapfs_file_system_btree_t *file_system_btree;
+
+	/* The hash type
+	 */
+	uint32_t hash_type;
+
+	/* The level
+	 */
+	libfsapfs_seal_verifier_level_t *level;
+
+	/* The index of the first node
+	 */
+	int first_node_index;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The (partition specific) child level
+	 */
+	libfsapfs_seal_verifier_level_t child_level;
+
+	/* The number of hash mismatches
+	 */
+	int number_of_mismatches;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+int libfsapfs_seal_verifier_level_clear(
+     libfsapfs_seal_verifier_level_t *level,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_level_append_node(
+     libfsapfs_seal_verifier_level_t *level,
+     uint64_t block_number,
+     const uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_level_append_nodes(
+     libfsapfs_seal_verifier_level_t *level,
+     libfsapfs_seal_verifier_level_t *source_level,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_calculate_hash(
+     uint32_t hash_type,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_partition_verify(
+     libfsapfs_seal_verifier_partition_t *partition );
+
+int libfsapfs_seal_verifier_partitions_free(
+     libfsapfs_seal_verifier_partition_t **partitions,
+     int number_of_partitions,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_verify_level(
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint32_t hash_type,
+     libfsapfs_seal_verifier_level_t *level,
+     libfsapfs_seal_verifier_level_t *child_level,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libfsapfs_seal_verifier_verify(
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_file_system_btree_t *file_system_btree,
+     uint32_t hash_type,
+     const uint8_t *root_hash,
+     size_t root_hash_size,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_SEAL_VERIFIER_H ) */
+
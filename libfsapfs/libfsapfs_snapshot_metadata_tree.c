@@ -26,6 +26,7 @@
 
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_usage.h"
 #include "libfsapfs_data_block.h"
 #include "libfsapfs_debug.h"
 #include "libfsapfs_definitions.h"
@@ -33,6 +34,7 @@
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_btree.h"
@@ -140,6 +142,21 @@ int libfsapfs_snapshot_metadata_tree_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *snapshot_metadata_tree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *snapshot_metadata_tree )->io_handle              = io_handle;
 	( *snapshot_metadata_tree )->data_block_vector      = data_block_vector;
 	( *snapshot_metadata_tree )->object_map_btree       = object_map_btree;
@@ -209,6 +226,21 @@ int libfsapfs_snapshot_metadata_tree_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *snapshot_metadata_tree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *snapshot_metadata_tree );
 
@@ -2028,6 +2060,21 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_PROFILER )
 	if( snapshot_metadata_tree->io_handle->profiler != NULL )
 	{
@@ -2142,9 +2189,29 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 
 on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 snapshot_metadata_tree->read_write_lock,
+	 NULL );
+#endif
 	libcdata_array_empty(
 	 snapshots,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
@@ -2153,3 +2220,174 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the amount of memory used by the caches of the snapshot metadata tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_snapshot_metadata_tree_get_memory_usage(
+     libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_snapshot_metadata_tree_get_memory_usage";
+	int result            = 1;
+
+	if( snapshot_metadata_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot metadata tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_cache_usage_get_node_cache_memory_usage(
+	     snapshot_metadata_tree->node_cache,
+	     node_cache_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve node cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          snapshot_metadata_tree->data_block_cache,
+	          data_block_cache_memory_usage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Trims the caches of the snapshot metadata tree for a specific trim level
+ * Values are removed until memory usage is less than or equal to the target memory usage
+ * The memory usage is decremented with the memory used by the removed values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_snapshot_metadata_tree_trim_caches(
+     libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_snapshot_metadata_tree_trim_caches";
+	int result            = 1;
+
+	if( snapshot_metadata_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid snapshot metadata tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( trim_level == LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS )
+	{
+		result = libfsapfs_cache_usage_trim_data_block_cache(
+		          snapshot_metadata_tree->data_block_cache,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	else
+	{
+		result = libfsapfs_cache_usage_trim_node_cache(
+		          snapshot_metadata_tree->node_cache,
+		          trim_level,
+		          target_memory_usage,
+		          memory_usage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to trim caches.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     snapshot_metadata_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
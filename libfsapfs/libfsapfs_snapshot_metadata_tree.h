@@ -30,6 +30,7 @@
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_btree.h"
@@ -66,6 +67,12 @@ struct libfsapfs_snapshot_metadata_tree
 	/* Block number of B-tree root node
 	 */
 	uint64_t root_node_block_number;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsapfs_snapshot_metadata_tree_initialize(
@@ -143,6 +150,19 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots(
      libcdata_array_t *snapshots,
      libcerror_error_t **error );
 
+int libfsapfs_snapshot_metadata_tree_get_memory_usage(
+     libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+int libfsapfs_snapshot_metadata_tree_trim_caches(
+     libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree,
+     int trim_level,
+     size64_t target_memory_usage,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
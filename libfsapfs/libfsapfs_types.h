@@ -35,15 +35,27 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libfsapfs_container {}		libfsapfs_container_t;
+typedef struct libfsapfs_cursor {}		libfsapfs_cursor_t;
+typedef struct libfsapfs_disk_usage {}		libfsapfs_disk_usage_t;
 typedef struct libfsapfs_extended_attribute {}	libfsapfs_extended_attribute_t;
+typedef struct libfsapfs_extended_attribute_sweep {}	libfsapfs_extended_attribute_sweep_t;
 typedef struct libfsapfs_file_entry {}		libfsapfs_file_entry_t;
+typedef struct libfsapfs_metadata_index {}	libfsapfs_metadata_index_t;
+typedef struct libfsapfs_name_search {}		libfsapfs_name_search_t;
+typedef struct libfsapfs_node_carver {}		libfsapfs_node_carver_t;
 typedef struct libfsapfs_snapshot {}		libfsapfs_snapshot_t;
 typedef struct libfsapfs_volume {}		libfsapfs_volume_t;
 
 #else
 typedef intptr_t libfsapfs_container_t;
+typedef intptr_t libfsapfs_cursor_t;
+typedef intptr_t libfsapfs_disk_usage_t;
 typedef intptr_t libfsapfs_extended_attribute_t;
+typedef intptr_t libfsapfs_extended_attribute_sweep_t;
 typedef intptr_t libfsapfs_file_entry_t;
+typedef intptr_t libfsapfs_metadata_index_t;
+typedef intptr_t libfsapfs_name_search_t;
+typedef intptr_t libfsapfs_node_carver_t;
 typedef intptr_t libfsapfs_snapshot_t;
 typedef intptr_t libfsapfs_volume_t;
 
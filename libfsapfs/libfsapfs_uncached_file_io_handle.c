@@ -0,0 +1,1164 @@
+/*
+ * Uncached file IO handle functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _GNU_SOURCE )
+/* Required for O_DIRECT
+ */
+#define _GNU_SOURCE	1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfsapfs_block_buffer_pool.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_uncached_file_io_handle.h"
+#include "libfsapfs_unused.h"
+
+#if defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT )
+
+/* Creates a file IO handle that reads a file bypassing the operating system page cache
+ * Make sure the value file_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_initialize(
+     libbfio_handle_t **file_io_handle,
+     const char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_uncached_file_io_handle_t *io_handle = NULL;
+	static char *function                          = "libfsapfs_uncached_file_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_uncached_file_io_handle_initialize(
+	     &io_handle,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create uncached file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_read_buffer,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_write_buffer,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libfsapfs_uncached_file_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( io_handle != NULL )
+	{
+		libfsapfs_uncached_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates an uncached file IO handle
+ * Make sure the value io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_initialize(
+     libfsapfs_uncached_file_io_handle_t **io_handle,
+     const char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_initialize";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size <= 1 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*io_handle = memory_allocate_structure(
+	              libfsapfs_uncached_file_io_handle_t );
+
+	if( *io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_handle,
+	     0,
+	     sizeof( libfsapfs_uncached_file_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+
+		return( -1 );
+	}
+	( *io_handle )->name = narrow_string_allocate(
+	                        name_size );
+
+	if( ( *io_handle )->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     ( *io_handle )->name,
+	     name,
+	     name_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->name[ name_size - 1 ] = 0;
+
+	( *io_handle )->name_size       = name_size;
+	( *io_handle )->file_descriptor = -1;
+
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->name );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an uncached file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_free(
+     libfsapfs_uncached_file_io_handle_t **io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_free";
+	int result            = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_handle != NULL )
+	{
+		if( ( *io_handle )->file_descriptor != -1 )
+		{
+			if( libfsapfs_uncached_file_io_handle_close(
+			     *io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *io_handle )->name != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->name );
+		}
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the uncached file IO handle
+ * The destination IO handle is not opened
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_clone(
+     libfsapfs_uncached_file_io_handle_t **destination_io_handle,
+     libfsapfs_uncached_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_clone";
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		return( 1 );
+	}
+	if( libfsapfs_uncached_file_io_handle_initialize(
+	     destination_io_handle,
+	     source_io_handle->name,
+	     source_io_handle->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the uncached file IO handle
+ * The file is opened for direct IO if supported, otherwise the pages read
+ * are released from the operating system page cache after every read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_open(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_open";
+	off_t file_offset     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->use_direct_io = 0;
+
+#if defined( O_DIRECT )
+	/* Not all file systems support direct IO, for example tmpfs
+	 */
+	io_handle->file_descriptor = open(
+	                              io_handle->name,
+	                              O_RDONLY | O_DIRECT );
+
+	if( io_handle->file_descriptor != -1 )
+	{
+		io_handle->use_direct_io = 1;
+	}
+#endif
+	if( io_handle->file_descriptor == -1 )
+	{
+		io_handle->file_descriptor = open(
+		                              io_handle->name,
+		                              O_RDONLY );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 io_handle->name );
+
+		goto on_error;
+	}
+	/* Use lseek to determine the size since fstat does not provide the size of a device
+	 */
+	file_offset = lseek(
+	               io_handle->file_descriptor,
+	               0,
+	               SEEK_END );
+
+	if( file_offset < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to determine size of file: %s.",
+		 function,
+		 io_handle->name );
+
+		goto on_error;
+	}
+	io_handle->size = (size64_t) file_offset;
+
+	if( libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+	     LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE,
+	     &( io_handle->buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->current_offset   = 0;
+	io_handle->buffer_offset    = 0;
+	io_handle->buffer_data_size = 0;
+
+	return( 1 );
+
+on_error:
+	if( io_handle->file_descriptor != -1 )
+	{
+		close(
+		 io_handle->file_descriptor );
+
+		io_handle->file_descriptor = -1;
+	}
+	io_handle->use_direct_io = 0;
+
+	return( -1 );
+}
+
+/* Closes the uncached file IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_close(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_close";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( close(
+	     io_handle->file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file: %s.",
+		 function,
+		 io_handle->name );
+
+		result = -1;
+	}
+	io_handle->file_descriptor = -1;
+	io_handle->use_direct_io   = 0;
+
+	if( libfsapfs_block_buffer_pool_free_aligned_buffer(
+	     &( io_handle->buffer ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free buffer.",
+		 function );
+
+		result = -1;
+	}
+	io_handle->current_offset   = 0;
+	io_handle->size             = 0;
+	io_handle->buffer_offset    = 0;
+	io_handle->buffer_data_size = 0;
+
+	return( result );
+}
+
+/* Reads data at a specific offset directly from the file
+ * For direct IO the buffer, size and offset must be aligned to LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libfsapfs_uncached_file_io_handle_read_at_offset(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_read_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lseek(
+	     io_handle->file_descriptor,
+	     (off_t) offset,
+	     SEEK_SET ) != (off_t) offset )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 errno,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+		read_count = read(
+		              io_handle->file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset );
+
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 errno,
+			 "%s: unable to read from file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+#if defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	if( ( io_handle->use_direct_io == 0 )
+	 && ( buffer_offset > 0 ) )
+	{
+		/* The advice is not essential hence its result is ignored
+		 */
+		posix_fadvise(
+		 io_handle->file_descriptor,
+		 (off_t) offset,
+		 (off_t) buffer_offset,
+		 POSIX_FADV_DONTNEED );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads a buffer from the uncached file IO handle
+ * Data is read in aligned blocks of LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE into the read buffer,
+ * large aligned reads are read directly into the buffer
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t libfsapfs_uncached_file_io_handle_read_buffer(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function   = "libfsapfs_uncached_file_io_handle_read_buffer";
+	size_t buffer_offset    = 0;
+	size_t data_offset      = 0;
+	size_t read_size        = 0;
+	size_t remaining_size   = 0;
+	ssize_t read_count      = 0;
+	off64_t aligned_offset  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->current_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - current offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) io_handle->current_offset >= io_handle->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( io_handle->size - io_handle->current_offset ) )
+	{
+		size = (size_t) ( io_handle->size - io_handle->current_offset );
+	}
+	while( buffer_offset < size )
+	{
+		remaining_size = size - buffer_offset;
+
+		if( ( io_handle->buffer_data_size > 0 )
+		 && ( io_handle->current_offset >= io_handle->buffer_offset )
+		 && ( io_handle->current_offset < ( io_handle->buffer_offset + (off64_t) io_handle->buffer_data_size ) ) )
+		{
+			data_offset = (size_t) ( io_handle->current_offset - io_handle->buffer_offset );
+			read_size   = io_handle->buffer_data_size - data_offset;
+
+			if( read_size > remaining_size )
+			{
+				read_size = remaining_size;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( io_handle->buffer[ data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data from buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset             += read_size;
+			io_handle->current_offset += read_size;
+
+			continue;
+		}
+		aligned_offset = io_handle->current_offset - ( io_handle->current_offset % LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT );
+
+		if( ( aligned_offset == io_handle->current_offset )
+		 && ( remaining_size >= LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE )
+		 && ( ( (intptr_t) &( buffer[ buffer_offset ] ) % LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT ) == 0 ) )
+		{
+			read_size = remaining_size - ( remaining_size % LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT );
+
+			read_count = libfsapfs_uncached_file_io_handle_read_at_offset(
+			              io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              io_handle->current_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data.",
+				 function );
+
+				return( -1 );
+			}
+			if( read_count == 0 )
+			{
+				break;
+			}
+			buffer_offset             += (size_t) read_count;
+			io_handle->current_offset += (off64_t) read_count;
+		}
+		else
+		{
+			io_handle->buffer_data_size = 0;
+
+			read_count = libfsapfs_uncached_file_io_handle_read_at_offset(
+			              io_handle,
+			              io_handle->buffer,
+			              LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE,
+			              aligned_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data into buffer.",
+				 function );
+
+				return( -1 );
+			}
+			io_handle->buffer_offset    = aligned_offset;
+			io_handle->buffer_data_size = (size_t) read_count;
+
+			if( io_handle->current_offset >= ( aligned_offset + (off64_t) read_count ) )
+			{
+				break;
+			}
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes a buffer to the uncached file IO handle
+ * Returns the number of bytes written if successful, or -1 on error
+ */
+ssize_t libfsapfs_uncached_file_io_handle_write_buffer(
+         libfsapfs_uncached_file_io_handle_t *io_handle LIBFSAPFS_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer LIBFSAPFS_ATTRIBUTE_UNUSED,
+         size_t size LIBFSAPFS_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_write_buffer";
+
+	LIBFSAPFS_UNREFERENCED_PARAMETER( io_handle )
+	LIBFSAPFS_UNREFERENCED_PARAMETER( buffer )
+	LIBFSAPFS_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write access currently not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the uncached file IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libfsapfs_uncached_file_io_handle_seek_offset(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_seek_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if the file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_exists(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_exists";
+	int file_descriptor   = -1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor != -1 )
+	{
+		return( 1 );
+	}
+	file_descriptor = open(
+	                   io_handle->name,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	close(
+	 file_descriptor );
+
+	return( 1 );
+}
+
+/* Check if the uncached file IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_is_open(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_is_open";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the uncached file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_uncached_file_io_handle_get_size(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_uncached_file_io_handle_get_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = io_handle->size;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT ) */
+
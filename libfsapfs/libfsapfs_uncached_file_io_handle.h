@@ -0,0 +1,157 @@
+/*
+ * Uncached file IO handle functions
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_H )
+#define _LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_OPEN ) && defined( HAVE_READ ) && defined( HAVE_LSEEK ) && defined( HAVE_CLOSE )
+#define HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT )
+
+typedef struct libfsapfs_uncached_file_io_handle libfsapfs_uncached_file_io_handle_t;
+
+struct libfsapfs_uncached_file_io_handle
+{
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The file descriptor
+	 */
+	int file_descriptor;
+
+	/* Value to indicate the file was opened for direct IO
+	 */
+	uint8_t use_direct_io;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The aligned read buffer
+	 */
+	uint8_t *buffer;
+
+	/* The offset of the data in the read buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the read buffer
+	 */
+	size_t buffer_data_size;
+};
+
+int libfsapfs_uncached_file_initialize(
+     libbfio_handle_t **file_io_handle,
+     const char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_initialize(
+     libfsapfs_uncached_file_io_handle_t **io_handle,
+     const char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_free(
+     libfsapfs_uncached_file_io_handle_t **io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_clone(
+     libfsapfs_uncached_file_io_handle_t **destination_io_handle,
+     libfsapfs_uncached_file_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_open(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_close(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+ssize_t libfsapfs_uncached_file_io_handle_read_at_offset(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfsapfs_uncached_file_io_handle_read_buffer(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libfsapfs_uncached_file_io_handle_write_buffer(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libfsapfs_uncached_file_io_handle_seek_offset(
+         libfsapfs_uncached_file_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_exists(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_is_open(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_uncached_file_io_handle_get_size(
+     libfsapfs_uncached_file_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_H ) */
+
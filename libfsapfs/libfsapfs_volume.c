@@ -27,14 +27,20 @@
 
 #include "libfsapfs_container_data_handle.h"
 #include "libfsapfs_container_key_bag.h"
+#include "libfsapfs_cursor.h"
 #include "libfsapfs_debug.h"
 #include "libfsapfs_definitions.h"
+#include "libfsapfs_disk_usage.h"
 #include "libfsapfs_encryption_context.h"
+#include "libfsapfs_extended_attribute_sweep.h"
 #include "libfsapfs_extent_reference_tree.h"
 #include "libfsapfs_file_entry.h"
+#include "libfsapfs_file_reference.h"
+#include "libfsapfs_file_extent_tree.h"
 #include "libfsapfs_file_system_btree.h"
 #include "libfsapfs_file_system_data_handle.h"
 #include "libfsapfs_inode.h"
+#include "libfsapfs_integrity_metadata.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
@@ -42,9 +48,13 @@
 #include "libfsapfs_libcthreads.h"
 #include "libfsapfs_libfdata.h"
 #include "libfsapfs_libuna.h"
+#include "libfsapfs_metadata_index.h"
+#include "libfsapfs_name_search.h"
 #include "libfsapfs_object_map.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_object_map_descriptor.h"
+#include "libfsapfs_read_scheduler.h"
+#include "libfsapfs_seal_verifier.h"
 #include "libfsapfs_snapshot.h"
 #include "libfsapfs_snapshot_metadata.h"
 #include "libfsapfs_snapshot_metadata_tree.h"
@@ -236,572 +246,3337 @@ int libfsapfs_volume_free(
 	return( result );
 }
 
-/* Opens a volume for reading
+/* Creates a volume shared state
+ * Make sure the value shared_state is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_internal_volume_open_read(
-     libfsapfs_internal_volume_t *internal_volume,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+int libfsapfs_volume_shared_state_initialize(
+     libfsapfs_volume_shared_state_t **shared_state,
      libcerror_error_t **error )
 {
-	libfsapfs_container_data_handle_t *container_data_handle     = NULL;
-	libfsapfs_file_system_data_handle_t *file_system_data_handle = NULL;
-	libfsapfs_object_map_t *object_map                           = NULL;
-	static char *function                                        = "libfsapfs_internal_volume_open_read";
-	uint64_t key_bag_block_number                                = 0;
-	uint64_t key_bag_number_of_blocks                            = 0;
-	int element_index                                            = 0;
-	int result                                                   = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	libfsapfs_extent_reference_tree_t *extent_reference_tree     = NULL;
-#endif
+	static char *function = "libfsapfs_volume_shared_state_initialize";
 
-	if( internal_volume == NULL )
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 "%s: invalid shared state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->io_handle == NULL )
+	if( *shared_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid shared state value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->superblock != NULL )
+	*shared_state = memory_allocate_structure(
+	                 libfsapfs_volume_shared_state_t );
+
+	if( *shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - superblock map value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shared state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->container_data_block_vector != NULL )
+	if( memory_set(
+	     *shared_state,
+	     0,
+	     sizeof( libfsapfs_volume_shared_state_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - container data block vector value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shared state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->object_map_btree != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *shared_state )->read_write_lock ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - object map B-tree value already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_volume->snapshot_metadata_tree != NULL )
+#endif
+	return( 1 );
+
+on_error:
+	if( *shared_state != NULL )
+	{
+		memory_free(
+		 *shared_state );
+
+		*shared_state = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a volume shared state and the metadata it references
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_shared_state_free(
+     libfsapfs_volume_shared_state_t **shared_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_volume_shared_state_free";
+	int result            = 1;
+
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - snapshot metadata tree value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->key_bag != NULL )
+	if( *shared_state != NULL )
+	{
+		/* The container data handle and file system data handle are freed by their data block vector
+		 */
+		if( ( *shared_state )->superblock != NULL )
+		{
+			if( libfsapfs_volume_superblock_free(
+			     &( ( *shared_state )->superblock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free superblock.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->container_data_block_vector != NULL )
+		{
+			if( libfdata_vector_free(
+			     &( ( *shared_state )->container_data_block_vector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free container data block vector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->object_map_btree != NULL )
+		{
+			if( libfsapfs_object_map_btree_free(
+			     &( ( *shared_state )->object_map_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free object map B-tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->snapshot_metadata_tree != NULL )
+		{
+			if( libfsapfs_snapshot_metadata_tree_free(
+			     &( ( *shared_state )->snapshot_metadata_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free snapshot metadata tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->snapshots != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *shared_state )->snapshots ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free snapshots array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->key_bag != NULL )
+		{
+			if( libfsapfs_volume_key_bag_free(
+			     &( ( *shared_state )->key_bag ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key bag.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->encryption_context != NULL )
+		{
+			if( libfsapfs_encryption_context_free(
+			     &( ( *shared_state )->encryption_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free encryption context.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->file_system_data_block_vector != NULL )
+		{
+			if( libfdata_vector_free(
+			     &( ( *shared_state )->file_system_data_block_vector ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file system data block vector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->file_system_btree != NULL )
+		{
+			if( libfsapfs_file_system_btree_free(
+			     &( ( *shared_state )->file_system_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file system B-tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *shared_state )->file_extent_tree != NULL )
+		{
+			if( libfsapfs_file_extent_tree_free(
+			     &( ( *shared_state )->file_extent_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file extent tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *shared_state )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *shared_state );
+
+		*shared_state = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a reference to a volume shared state
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_shared_state_grab_reference(
+     libfsapfs_volume_shared_state_t *shared_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_volume_shared_state_grab_reference";
+
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - key bag value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared state.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->encryption_context != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shared_state->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - encryption context value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->file_system_data_block_vector != NULL )
+#endif
+	shared_state->reference_count += 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shared_state->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file system data block vector value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading volume superblock:\n" );
-	}
 #endif
-	if( libfsapfs_volume_superblock_initialize(
-	     &( internal_volume->superblock ),
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Releases a reference to a volume shared state
+ * The shared state and the metadata it references are freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_shared_state_release_reference(
+     libfsapfs_volume_shared_state_t **shared_state,
+     libcerror_error_t **error )
+{
+	libfsapfs_volume_shared_state_t *safe_shared_state = NULL;
+	static char *function                              = "libfsapfs_volume_shared_state_release_reference";
+	int reference_count                                = 0;
+
+	if( shared_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create volume superblock.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shared state.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsapfs_volume_superblock_read_file_io_handle(
-	     internal_volume->superblock,
-	     file_io_handle,
-	     file_offset,
+	if( *shared_state == NULL )
+	{
+		return( 1 );
+	}
+	safe_shared_state = *shared_state;
+	*shared_state     = NULL;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     safe_shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read volume superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsapfs_container_data_handle_initialize(
-	     &container_data_handle,
-	     internal_volume->io_handle,
+#endif
+	safe_shared_state->reference_count -= 1;
+
+	reference_count = safe_shared_state->reference_count;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     safe_shared_state->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfdata_vector_initialize(
-	     &( internal_volume->container_data_block_vector ),
-	     (size64_t) internal_volume->io_handle->block_size,
-	     (intptr_t *) container_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
+#endif
+	if( reference_count <= 0 )
+	{
+		if( libfsapfs_volume_shared_state_free(
+		     &safe_shared_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free shared state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Clones a volume
+ * The clone uses its own file IO handle but shares the metadata and caches
+ * of the source volume. The shared metadata is reference counted so that
+ * the source volume can be freed before the clone, the container however
+ * must remain open while the clone is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_clone(
+     libfsapfs_volume_t **destination_volume,
+     libfsapfs_volume_t *source_volume,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                          = NULL;
+	libfsapfs_internal_volume_t *internal_destination_volume = NULL;
+	libfsapfs_internal_volume_t *internal_source_volume      = NULL;
+	static char *function                                    = "libfsapfs_volume_clone";
+	int file_io_handle_is_open                               = 0;
+	int file_io_handle_opened_in_library                     = 0;
+
+	if( destination_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data block vector.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->container_data_handle = container_data_handle;
-	container_data_handle                  = NULL;
-
-	if( libfdata_vector_append_segment(
-	     internal_volume->container_data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_volume->io_handle->container_size,
-	     0,
-	     error ) != 1 )
+	if( *destination_volume != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to container data block vector.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination volume value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO refactor into function to read object map */
-	if( internal_volume->superblock->object_map_block_number == 0 )
+	if( source_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_source_volume = (libfsapfs_internal_volume_t *) source_volume;
+
+	if( internal_source_volume->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing object map block number.",
+		 "%s: invalid source volume - missing file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_source_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading object map:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	file_offset = internal_volume->superblock->object_map_block_number * internal_volume->io_handle->block_size;
+	/* The file system B-tree is determined here so that the clone
+	 * and the source volume share the same B-tree and its caches
+	 */
+	if( internal_source_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_source_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
 
-	if( libfsapfs_object_map_initialize(
-	     &object_map,
+			goto on_error;
+		}
+	}
+	if( internal_source_volume->shared_state == NULL )
+	{
+		if( libfsapfs_volume_shared_state_initialize(
+		     &( internal_source_volume->shared_state ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shared state.",
+			 function );
+
+			goto on_error;
+		}
+		/* From here on the metadata is owned by the shared state and
+		 * freed when the last volume referencing it is closed
+		 */
+		internal_source_volume->shared_state->superblock                    = internal_source_volume->superblock;
+		internal_source_volume->shared_state->container_data_handle         = internal_source_volume->container_data_handle;
+		internal_source_volume->shared_state->container_data_block_vector   = internal_source_volume->container_data_block_vector;
+		internal_source_volume->shared_state->object_map_btree              = internal_source_volume->object_map_btree;
+		internal_source_volume->shared_state->snapshot_metadata_tree        = internal_source_volume->snapshot_metadata_tree;
+		internal_source_volume->shared_state->snapshots                     = internal_source_volume->snapshots;
+		internal_source_volume->shared_state->key_bag                       = internal_source_volume->key_bag;
+		internal_source_volume->shared_state->encryption_context            = internal_source_volume->encryption_context;
+		internal_source_volume->shared_state->file_system_data_handle       = internal_source_volume->file_system_data_handle;
+		internal_source_volume->shared_state->file_system_data_block_vector = internal_source_volume->file_system_data_block_vector;
+		internal_source_volume->shared_state->file_extent_tree              = internal_source_volume->file_extent_tree;
+		internal_source_volume->shared_state->file_system_btree             = internal_source_volume->file_system_btree;
+
+		/* The reference of the source volume, the shared state is not
+		 * visible to other volumes yet so no locking is needed here
+		 */
+		internal_source_volume->shared_state->reference_count = 1;
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     internal_source_volume->file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create object map.",
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsapfs_object_map_read_file_io_handle(
-	     object_map,
-	     file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read object map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
 
 		goto on_error;
 	}
-	if( object_map->btree_block_number == 0 )
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libfsapfs_volume_initialize(
+	     destination_volume,
+	     internal_source_volume->io_handle,
+	     file_io_handle,
+	     internal_source_volume->container_key_bag,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing object map B-tree block number.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination volume.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading object map B-tree:\n" );
-	}
-#endif
-	if( libfsapfs_object_map_btree_initialize(
-	     &( internal_volume->object_map_btree ),
-	     internal_volume->io_handle,
-	     internal_volume->container_data_block_vector,
-	     object_map->btree_block_number,
+	internal_destination_volume = (libfsapfs_internal_volume_t *) *destination_volume;
+
+	internal_destination_volume->file_io_handle_created_in_library = 1;
+	internal_destination_volume->file_io_handle_opened_in_library  = (uint8_t) file_io_handle_opened_in_library;
+
+	file_io_handle                   = NULL;
+	file_io_handle_opened_in_library = 0;
+
+	if( libfsapfs_volume_shared_state_grab_reference(
+	     internal_source_volume->shared_state,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create object map B-tree.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab reference to shared state.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsapfs_object_map_free(
-	     &object_map,
+	internal_destination_volume->shared_state                  = internal_source_volume->shared_state;
+	internal_destination_volume->superblock                    = internal_destination_volume->shared_state->superblock;
+	internal_destination_volume->container_data_handle         = internal_destination_volume->shared_state->container_data_handle;
+	internal_destination_volume->container_data_block_vector   = internal_destination_volume->shared_state->container_data_block_vector;
+	internal_destination_volume->object_map_btree              = internal_destination_volume->shared_state->object_map_btree;
+	internal_destination_volume->snapshot_metadata_tree        = internal_destination_volume->shared_state->snapshot_metadata_tree;
+	internal_destination_volume->snapshots                     = internal_destination_volume->shared_state->snapshots;
+	internal_destination_volume->key_bag                       = internal_destination_volume->shared_state->key_bag;
+	internal_destination_volume->encryption_context            = internal_destination_volume->shared_state->encryption_context;
+	internal_destination_volume->file_system_data_handle       = internal_destination_volume->shared_state->file_system_data_handle;
+	internal_destination_volume->file_system_data_block_vector = internal_destination_volume->shared_state->file_system_data_block_vector;
+	internal_destination_volume->file_extent_tree              = internal_destination_volume->shared_state->file_extent_tree;
+	internal_destination_volume->file_system_btree             = internal_destination_volume->shared_state->file_system_btree;
+	internal_destination_volume->is_locked                     = internal_source_volume->is_locked;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_source_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free object map.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		libfsapfs_volume_free(
+		 destination_volume,
+		 NULL );
+
+		return( -1 );
 	}
-	internal_volume->is_locked = 0;
+#endif
+	return( 1 );
 
-	if( ( internal_volume->container_key_bag != NULL )
-	 && ( ( internal_volume->superblock->volume_flags & 0x00000001UL ) == 0 ) )
+on_error:
+	if( *destination_volume != NULL )
 	{
-		internal_volume->is_locked = internal_volume->container_key_bag->is_locked;
+		libfsapfs_volume_free(
+		 destination_volume,
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_source_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
 
-		result = libfsapfs_container_key_bag_get_volume_key_bag_extent_by_identifier(
-		          internal_volume->container_key_bag,
-		          internal_volume->superblock->volume_identifier,
-		          &key_bag_block_number,
-		          &key_bag_number_of_blocks,
-		          error );
+/* Opens a volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_volume_open_read(
+     libfsapfs_internal_volume_t *internal_volume,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	libfsapfs_container_data_handle_t *container_data_handle     = NULL;
+	libfsapfs_file_system_data_handle_t *file_system_data_handle = NULL;
+	libfsapfs_object_map_t *object_map                           = NULL;
+	static char *function                                        = "libfsapfs_internal_volume_open_read";
+	uint64_t key_bag_block_number                                = 0;
+	uint64_t key_bag_number_of_blocks                            = 0;
+	int element_index                                            = 0;
+	int result                                                   = 0;
 
-		if( result == -1 )
-		{
+#if defined( HAVE_DEBUG_OUTPUT )
+	libfsapfs_extent_reference_tree_t *extent_reference_tree     = NULL;
+#endif
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - superblock map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->container_data_block_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - container data block vector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->object_map_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - object map B-tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->snapshot_metadata_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - snapshot metadata tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->key_bag != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - key bag value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->encryption_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - encryption context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system_data_block_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - file system data block vector value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading volume superblock:\n" );
+	}
+#endif
+	if( libfsapfs_volume_superblock_initialize(
+	     &( internal_volume->superblock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume superblock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_volume_superblock_read_file_io_handle(
+	     internal_volume->superblock,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume superblock at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( libfsapfs_container_data_handle_initialize(
+	     &container_data_handle,
+	     internal_volume->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     &( internal_volume->container_data_block_vector ),
+	     (size64_t) internal_volume->io_handle->block_size,
+	     (intptr_t *) container_data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create container data block vector.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->container_data_handle = container_data_handle;
+	container_data_handle                  = NULL;
+
+	if( libfdata_vector_append_segment(
+	     internal_volume->container_data_block_vector,
+	     &element_index,
+	     0,
+	     0,
+	     internal_volume->io_handle->container_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to container data block vector.",
+		 function );
+
+		goto on_error;
+	}
+/* TODO refactor into function to read object map */
+	if( internal_volume->superblock->object_map_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map block number.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading object map:\n" );
+	}
+#endif
+	file_offset = internal_volume->superblock->object_map_block_number * internal_volume->io_handle->block_size;
+
+	if( libfsapfs_object_map_initialize(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_read_file_io_handle(
+	     object_map,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read object map at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( object_map->btree_block_number == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing object map B-tree block number.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading object map B-tree:\n" );
+	}
+#endif
+	if( libfsapfs_object_map_btree_initialize(
+	     &( internal_volume->object_map_btree ),
+	     internal_volume->io_handle,
+	     internal_volume->container_data_block_vector,
+	     object_map->btree_block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create object map B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_object_map_free(
+	     &object_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->is_locked = 0;
+
+	if( ( internal_volume->container_key_bag != NULL )
+	 && ( ( internal_volume->superblock->volume_flags & 0x00000001UL ) == 0 ) )
+	{
+		internal_volume->is_locked = internal_volume->container_key_bag->is_locked;
+
+		result = libfsapfs_container_key_bag_get_volume_key_bag_extent_by_identifier(
+		          internal_volume->container_key_bag,
+		          internal_volume->superblock->volume_identifier,
+		          &key_bag_block_number,
+		          &key_bag_number_of_blocks,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume key bag extent.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( ( key_bag_block_number == 0 )
+			 || ( key_bag_number_of_blocks == 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid volume key bag extent.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsapfs_volume_key_bag_initialize(
+			     &( internal_volume->key_bag ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create volume key bag.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset = key_bag_block_number * internal_volume->io_handle->block_size;
+
+			if( libfsapfs_volume_key_bag_read_file_io_handle(
+			     internal_volume->key_bag,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     file_offset,
+			     (size64_t) key_bag_number_of_blocks * internal_volume->io_handle->block_size,
+			     internal_volume->superblock->volume_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read volume key bag at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			if( libfsapfs_encryption_context_initialize(
+			     &( internal_volume->encryption_context ),
+			     LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to initialize encryption context.",
+				 function );
+
+				goto on_error;
+			}
+			internal_volume->is_locked = 1;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( internal_volume->superblock->extent_reference_tree_block_number != 0 )
+	{
+		if( libfsapfs_extent_reference_tree_initialize(
+		     &extent_reference_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extent reference tree.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset = internal_volume->superblock->extent_reference_tree_block_number * internal_volume->io_handle->block_size;
+
+		if( libfsapfs_extent_reference_tree_read_file_io_handle(
+		     extent_reference_tree,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent reference tree at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( libfsapfs_extent_reference_tree_free(
+		     &extent_reference_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extent reference tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libcdata_array_initialize(
+	     &( internal_volume->snapshots ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create snapshots array.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume->superblock->snapshot_metadata_tree_block_number != 0 )
+	{
+		if( libfsapfs_snapshot_metadata_tree_initialize(
+		     &( internal_volume->snapshot_metadata_tree ),
+		     internal_volume->io_handle,
+		     internal_volume->container_data_block_vector,
+		     internal_volume->object_map_btree,
+		     internal_volume->superblock->snapshot_metadata_tree_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create snapshot metadata tree.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_snapshot_metadata_tree_get_snapshots(
+		     internal_volume->snapshot_metadata_tree,
+		     file_io_handle,
+		     internal_volume->snapshots,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve snapshots.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_volume->superblock->file_system_root_object_identifier == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file system root object identifier - value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_file_system_data_handle_initialize(
+	     &file_system_data_handle,
+	     internal_volume->io_handle,
+	     internal_volume->encryption_context,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file system data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_initialize(
+	     &( internal_volume->file_system_data_block_vector ),
+	     (size64_t) internal_volume->io_handle->block_size,
+	     (intptr_t *) file_system_data_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_system_data_handle_free,
+	     NULL,
+	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_file_system_data_handle_read_data_block,
+	     NULL,
+	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file system data block vector.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->file_system_data_handle = file_system_data_handle;
+	file_system_data_handle                  = NULL;
+
+	if( libfdata_vector_append_segment(
+	     internal_volume->file_system_data_block_vector,
+	     &element_index,
+	     0,
+	     0,
+	     internal_volume->io_handle->container_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segment to file system data block vector.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_volume->file_system_data_block_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_volume->file_system_data_block_vector ),
+		 NULL );
+	}
+	if( file_system_data_handle != NULL )
+	{
+		libfsapfs_file_system_data_handle_free(
+		 &file_system_data_handle,
+		 NULL );
+	}
+	if( internal_volume->encryption_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &( internal_volume->encryption_context ),
+		 NULL );
+	}
+	if( internal_volume->key_bag != NULL )
+	{
+		libfsapfs_volume_key_bag_free(
+		 &( internal_volume->key_bag ),
+		 NULL );
+	}
+	if( internal_volume->snapshot_metadata_tree != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_volume->snapshots ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
+		 NULL );
+	}
+	if( internal_volume->snapshot_metadata_tree != NULL )
+	{
+		libfsapfs_snapshot_metadata_tree_free(
+		 &( internal_volume->snapshot_metadata_tree ),
+		 NULL );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( extent_reference_tree != NULL )
+	{
+		libfsapfs_extent_reference_tree_free(
+		 &extent_reference_tree,
+		 NULL );
+	}
+#endif
+	if( internal_volume->object_map_btree != NULL )
+	{
+		libfsapfs_object_map_btree_free(
+		 &( internal_volume->object_map_btree ),
+		 NULL );
+	}
+	if( object_map != NULL )
+	{
+		libfsapfs_object_map_free(
+		 &object_map,
+		 NULL );
+	}
+	if( internal_volume->container_data_block_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_volume->container_data_block_vector ),
+		 NULL );
+	}
+	if( container_data_handle != NULL )
+	{
+		libfsapfs_container_data_handle_free(
+		 &container_data_handle,
+		 NULL );
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		libfsapfs_volume_superblock_free(
+		 &( internal_volume->superblock ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a volume
+ * Returns 0 if successful or -1 on error
+ */
+int libfsapfs_internal_volume_close(
+     libfsapfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_volume_close";
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_volume->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_volume->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_volume->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_volume->file_io_handle_created_in_library = 0;
+	}
+	internal_volume->file_io_handle     = NULL;
+	internal_volume->file_io_pool       = NULL;
+	internal_volume->file_io_pool_entry = 0;
+	internal_volume->is_locked          = 1;
+
+	if( internal_volume->shared_state != NULL )
+	{
+		/* The metadata owned by the shared state is freed when the last reference
+		 * is released, metadata created after cloning, such as by unlocking a clone
+		 * of a locked volume, is owned by this volume and freed below
+		 */
+		if( internal_volume->superblock == internal_volume->shared_state->superblock )
+		{
+			internal_volume->superblock = NULL;
+		}
+		if( internal_volume->container_data_handle == internal_volume->shared_state->container_data_handle )
+		{
+			internal_volume->container_data_handle = NULL;
+		}
+		if( internal_volume->container_data_block_vector == internal_volume->shared_state->container_data_block_vector )
+		{
+			internal_volume->container_data_block_vector = NULL;
+		}
+		if( internal_volume->object_map_btree == internal_volume->shared_state->object_map_btree )
+		{
+			internal_volume->object_map_btree = NULL;
+		}
+		if( internal_volume->snapshot_metadata_tree == internal_volume->shared_state->snapshot_metadata_tree )
+		{
+			internal_volume->snapshot_metadata_tree = NULL;
+		}
+		if( internal_volume->snapshots == internal_volume->shared_state->snapshots )
+		{
+			internal_volume->snapshots = NULL;
+		}
+		if( internal_volume->key_bag == internal_volume->shared_state->key_bag )
+		{
+			internal_volume->key_bag = NULL;
+		}
+		if( internal_volume->encryption_context == internal_volume->shared_state->encryption_context )
+		{
+			internal_volume->encryption_context = NULL;
+		}
+		if( internal_volume->file_system_data_handle == internal_volume->shared_state->file_system_data_handle )
+		{
+			internal_volume->file_system_data_handle = NULL;
+		}
+		if( internal_volume->file_system_data_block_vector == internal_volume->shared_state->file_system_data_block_vector )
+		{
+			internal_volume->file_system_data_block_vector = NULL;
+		}
+		if( internal_volume->file_extent_tree == internal_volume->shared_state->file_extent_tree )
+		{
+			internal_volume->file_extent_tree = NULL;
+		}
+		if( internal_volume->file_system_btree == internal_volume->shared_state->file_system_btree )
+		{
+			internal_volume->file_system_btree = NULL;
+		}
+	}
+
+	if( internal_volume->user_password != NULL )
+	{
+		if( memory_set(
+		     internal_volume->user_password,
+		     0,
+		     internal_volume->user_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear user password.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_volume->user_password );
+
+		internal_volume->user_password      = NULL;
+		internal_volume->user_password_size = 0;
+	}
+	if( internal_volume->recovery_password != NULL )
+	{
+		if( memory_set(
+		     internal_volume->recovery_password,
+		     0,
+		     internal_volume->recovery_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear recovery password.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_volume->recovery_password );
+
+		internal_volume->recovery_password      = NULL;
+		internal_volume->recovery_password_size = 0;
+	}
+	if( internal_volume->superblock != NULL )
+	{
+		if( libfsapfs_volume_superblock_free(
+		     &( internal_volume->superblock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free superblock.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfdata_vector_free(
+	     &( internal_volume->container_data_block_vector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free container data block vector.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->object_map_btree != NULL )
+	{
+		if( libfsapfs_object_map_btree_free(
+		     &( internal_volume->object_map_btree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free object map B-tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->snapshot_metadata_tree != NULL )
+	{
+		if( libfsapfs_snapshot_metadata_tree_free(
+		     &( internal_volume->snapshot_metadata_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free snapshot metadata tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->snapshots != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_volume->snapshots ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free snapshots array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->key_bag != NULL )
+	{
+		if( libfsapfs_volume_key_bag_free(
+		     &( internal_volume->key_bag ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key bag.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->encryption_context != NULL )
+	{
+		if( libfsapfs_encryption_context_free(
+		     &( internal_volume->encryption_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encryption context.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfdata_vector_free(
+	     &( internal_volume->file_system_data_block_vector ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file system data block vector.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_volume->file_system_btree != NULL )
+	{
+		if( libfsapfs_file_system_btree_free(
+		     &( internal_volume->file_system_btree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system B-tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->file_extent_tree != NULL )
+	{
+		if( libfsapfs_file_extent_tree_free(
+		     &( internal_volume->file_extent_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file extent tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfsapfs_volume_shared_state_release_reference(
+	     &( internal_volume->shared_state ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release reference to shared state.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Unlocks an encrypted volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libfsapfs_internal_volume_unlock(
+     libfsapfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	uint8_t volume_key[ 32 ];
+	uint8_t volume_master_key[ 32 ];
+
+	static char *function = "libfsapfs_internal_volume_unlock";
+	int result            = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->key_bag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing key bag.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_volume_key_bag_get_volume_key(
+	          internal_volume->key_bag,
+	          internal_volume->user_password,
+	          internal_volume->user_password_size - 1,
+	          internal_volume->recovery_password,
+	          internal_volume->recovery_password_size - 1,
+	          volume_key,
+	          256,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume key using password.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsapfs_container_key_bag_get_volume_master_key_by_identifier(
+		     internal_volume->container_key_bag,
+		     internal_volume->superblock->volume_identifier,
+		     volume_key,
+		     256,
+		     volume_master_key,
+		     256,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume master key.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 volume_key,
+		 0,
+		 32 );
+
+		if( libfsapfs_encryption_context_set_keys(
+		     internal_volume->encryption_context,
+		     volume_master_key,
+		     16,
+		     &( volume_master_key[ 16 ] ),
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 volume_master_key,
+		 0,
+		 32 );
+	}
+	if( result != 0 )
+	{
+		internal_volume->is_locked = 0;
+	}
+	return( result );
+
+on_error:
+	memory_set(
+	 volume_master_key,
+	 0,
+	 32 );
+
+	memory_set(
+	 volume_key,
+	 0,
+	 32 );
+
+	return( -1 );
+}
+
+/* Unlocks the volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libfsapfs_volume_unlock(
+     libfsapfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_unlock";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->is_locked != 0 )
+	{
+		result = libfsapfs_internal_volume_unlock(
+		          internal_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unlock volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_size(
+     libfsapfs_volume_t *volume,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_size";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+/* TODO implement */
+	*size = (size64_t) 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( -1 );
+}
+
+/* Retrieves the identifier
+ * The identifier is an UUID stored in big-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_identifier(
+     libfsapfs_volume_t *volume,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_identifier";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_volume_superblock_get_volume_identifier(
+	     internal_volume->superblock,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume identifier.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_utf8_name_size(
+     libfsapfs_volume_t *volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_utf8_name_size";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_volume_superblock_get_utf8_volume_name_size(
+	     internal_volume->superblock,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_utf8_name(
+     libfsapfs_volume_t *volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_utf8_name";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_volume_superblock_get_utf8_volume_name(
+	     internal_volume->superblock,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_utf16_name_size(
+     libfsapfs_volume_t *volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_utf16_name_size";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_volume_superblock_get_utf16_volume_name_size(
+	     internal_volume->superblock,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_utf16_name(
+     libfsapfs_volume_t *volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_utf16_name";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_volume_superblock_get_utf16_volume_name(
+	     internal_volume->superblock,
+	     utf16_string,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines if the volume is locked
+ * Returns 1 if locked, 0 if not or -1 on error
+ */
+int libfsapfs_volume_is_locked(
+     libfsapfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_is_locked";
+	uint8_t is_locked                            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	is_locked = internal_volume->is_locked;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( is_locked );
+}
+
+/* Sets an UTF-8 formatted password
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful, 0 if password is invalid or -1 on error
+ */
+int libfsapfs_volume_set_utf8_password(
+     libfsapfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_utf8_password";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->user_password != NULL )
+	{
+		if( memory_set(
+		     internal_volume->user_password,
+		     0,
+		     internal_volume->user_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear user password.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 internal_volume->user_password );
+
+		internal_volume->user_password      = NULL;
+		internal_volume->user_password_size = 0;
+	}
+	internal_volume->user_password_size = 1 + narrow_string_length(
+	                                           (char *) utf8_string );
+
+	if( internal_volume->user_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume - user password size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->user_password = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * internal_volume->user_password_size );
+
+	if( internal_volume->user_password == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create user password.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_volume->user_password,
+	     utf8_string,
+	     utf8_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy user password.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->user_password[ internal_volume->user_password_size - 1 ] = 0;
+
+	internal_volume->user_password_is_set = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: user password: %s\n",
+		 function,
+		 internal_volume->user_password );
+	}
+#endif
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->user_password != NULL )
+	{
+		memory_set(
+		 internal_volume->user_password,
+		 0,
+		 internal_volume->user_password_size );
+		memory_free(
+		 internal_volume->user_password );
+
+		internal_volume->user_password = NULL;
+	}
+	internal_volume->user_password_size = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets an UTF-16 formatted password
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful, 0 if password is invalid or -1 on error
+ */
+int libfsapfs_volume_set_utf16_password(
+     libfsapfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_utf16_password";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->user_password != NULL )
+	{
+		if( memory_set(
+		     internal_volume->user_password,
+		     0,
+		     internal_volume->user_password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear user password.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 internal_volume->user_password );
+
+		internal_volume->user_password      = NULL;
+		internal_volume->user_password_size = 0;
+	}
+	if( libuna_utf8_string_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     &( internal_volume->user_password_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set password size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->user_password_size += 1;
+
+	if( internal_volume->user_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume - user password size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->user_password = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * internal_volume->user_password_size );
+
+	if( internal_volume->user_password == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create user password.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     internal_volume->user_password,
+	     internal_volume->user_password_size,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy user password.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->user_password[ internal_volume->user_password_size - 1 ] = 0;
+
+	internal_volume->user_password_is_set = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: user password: %s\n",
+		 function,
+		 internal_volume->user_password );
+	}
+#endif
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->user_password != NULL )
+	{
+		memory_set(
+		 internal_volume->user_password,
+		 0,
+		 internal_volume->user_password_size );
+		memory_free(
+		 internal_volume->user_password );
+
+		internal_volume->user_password = NULL;
+	}
+	internal_volume->user_password_size = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets an UTF-8 formatted recovery password
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful, 0 if recovery password is invalid or -1 on error
+ */
+int libfsapfs_volume_set_utf8_recovery_password(
+     libfsapfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_utf8_recovery_password";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->recovery_password != NULL )
+	{
+		if( memory_set(
+		     internal_volume->recovery_password,
+		     0,
+		     internal_volume->recovery_password_size ) == NULL )
+		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume key bag extent.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear recovery password.",
 			 function );
 
 			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			if( ( key_bag_block_number == 0 )
-			 || ( key_bag_number_of_blocks == 0 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid volume key bag extent.",
-				 function );
+		memory_free(
+		 internal_volume->recovery_password );
 
-				goto on_error;
-			}
-			if( libfsapfs_volume_key_bag_initialize(
-			     &( internal_volume->key_bag ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create volume key bag.",
-				 function );
+		internal_volume->recovery_password      = NULL;
+		internal_volume->recovery_password_size = 0;
+	}
+	internal_volume->recovery_password_size = 1 + narrow_string_length(
+	                                               (char *) utf8_string );
 
-				goto on_error;
-			}
-			file_offset = key_bag_block_number * internal_volume->io_handle->block_size;
+	if( internal_volume->recovery_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume - recovery password size value exceeds maximum allocation size.",
+		 function );
 
-			if( libfsapfs_volume_key_bag_read_file_io_handle(
-			     internal_volume->key_bag,
-			     internal_volume->io_handle,
-			     file_io_handle,
-			     file_offset,
-			     (size64_t) key_bag_number_of_blocks * internal_volume->io_handle->block_size,
-			     internal_volume->superblock->volume_identifier,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read volume key bag at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-				 function,
-				 file_offset,
-				 file_offset );
+		goto on_error;
+	}
+	internal_volume->recovery_password = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * internal_volume->recovery_password_size );
 
-				goto on_error;
-			}
-			if( libfsapfs_encryption_context_initialize(
-			     &( internal_volume->encryption_context ),
-			     LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to initialize encryption context.",
-				 function );
+	if( internal_volume->recovery_password == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create recovery password.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     internal_volume->recovery_password,
+	     utf8_string,
+	     utf8_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy recovery password.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->recovery_password[ internal_volume->recovery_password_size - 1 ] = 0;
+
+	internal_volume->recovery_password_is_set = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: recovery password: %s\n",
+		 function,
+		 internal_volume->recovery_password );
+	}
+#endif
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->recovery_password != NULL )
+	{
+		memory_set(
+		 internal_volume->recovery_password,
+		 0,
+		 internal_volume->recovery_password_size );
+		memory_free(
+		 internal_volume->recovery_password );
+
+		internal_volume->recovery_password = NULL;
+	}
+	internal_volume->recovery_password_size = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets an UTF-16 formatted recovery password
+ * This function needs to be used before one of the open or unlock functions
+ * Returns 1 if successful, 0 if recovery password is invalid or -1 on error
+ */
+int libfsapfs_volume_set_utf16_recovery_password(
+     libfsapfs_volume_t *volume,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_utf16_recovery_password";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-				goto on_error;
-			}
-			internal_volume->is_locked = 1;
-		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( internal_volume->superblock->extent_reference_tree_block_number != 0 )
+#endif
+	if( internal_volume->recovery_password != NULL )
 	{
-		if( libfsapfs_extent_reference_tree_initialize(
-		     &extent_reference_tree,
-		     error ) != 1 )
+		if( memory_set(
+		     internal_volume->recovery_password,
+		     0,
+		     internal_volume->recovery_password_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extent reference tree.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear recovery password.",
 			 function );
 
 			goto on_error;
 		}
-		file_offset = internal_volume->superblock->extent_reference_tree_block_number * internal_volume->io_handle->block_size;
+		memory_free(
+		 internal_volume->recovery_password );
 
-		if( libfsapfs_extent_reference_tree_read_file_io_handle(
-		     extent_reference_tree,
-		     file_io_handle,
-		     file_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read extent reference tree at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 file_offset,
-			 file_offset );
+		internal_volume->recovery_password      = NULL;
+		internal_volume->recovery_password_size = 0;
+	}
+	if( libuna_utf8_string_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     &( internal_volume->recovery_password_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set password size.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfsapfs_extent_reference_tree_free(
-		     &extent_reference_tree,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free extent reference tree.",
-			 function );
+		goto on_error;
+	}
+	internal_volume->recovery_password_size += 1;
+
+	if( internal_volume->recovery_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid volume - recovery password size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->recovery_password = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * internal_volume->recovery_password_size );
+
+	if( internal_volume->recovery_password == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to create recovery password.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     internal_volume->recovery_password,
+	     internal_volume->recovery_password_size,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy recovery password.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->recovery_password[ internal_volume->recovery_password_size - 1 ] = 0;
+
+	internal_volume->recovery_password_is_set = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: recovery password: %s\n",
+		 function,
+		 internal_volume->recovery_password );
+	}
+#endif
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( internal_volume->recovery_password != NULL )
+	{
+		memory_set(
+		 internal_volume->recovery_password,
+		 0,
+		 internal_volume->recovery_password_size );
+		memory_free(
+		 internal_volume->recovery_password );
+
+		internal_volume->recovery_password = NULL;
+	}
+	internal_volume->recovery_password_size = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the next file entry identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_next_file_entry_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t *identifier,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_next_file_entry_identifier";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*identifier = internal_volume->superblock->next_file_system_object_identifier;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines the file system B-tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_volume_get_file_system_btree(
+     libfsapfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
+	static char *function                                    = "libfsapfs_internal_volume_get_file_system_btree";
+	uint8_t use_case_folding                                 = 0;
+	int result                                               = 0;
 
-			goto on_error;
-		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
 
-	if( libcdata_array_initialize(
-	     &( internal_volume->snapshots ),
-	     0,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create snapshots array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( internal_volume->superblock->snapshot_metadata_tree_block_number != 0 )
+	if( internal_volume->is_locked != 0 )
 	{
-		if( libfsapfs_snapshot_metadata_tree_initialize(
-		     &( internal_volume->snapshot_metadata_tree ),
-		     internal_volume->io_handle,
-		     internal_volume->container_data_block_vector,
-		     internal_volume->object_map_btree,
-		     internal_volume->superblock->snapshot_metadata_tree_block_number,
+		if( libfsapfs_internal_volume_unlock(
+		     internal_volume,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create snapshot metadata tree.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unlock volume.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsapfs_snapshot_metadata_tree_get_snapshots(
-		     internal_volume->snapshot_metadata_tree,
-		     internal_volume->file_io_handle,
-		     internal_volume->snapshots,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve snapshots.",
-			 function );
+	}
+	if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+	     internal_volume->object_map_btree,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->file_system_root_object_identifier,
+	     &object_map_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object map descriptor for file system root object identifier: %" PRIu64 ".",
+		 function,
+		 internal_volume->superblock->file_system_root_object_identifier );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( internal_volume->superblock->file_system_root_object_identifier == 0 )
+	if( object_map_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid file system root object identifier - value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid object map descriptor.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfsapfs_file_system_data_handle_initialize(
-	     &file_system_data_handle,
-	     internal_volume->io_handle,
-	     internal_volume->encryption_context,
-	     NULL,
-	     error ) != 1 )
+	if( ( internal_volume->superblock->incompatibility_features_flags & 0x00000000000000001 ) != 0 )
+	{
+		use_case_folding = 1;
+	}
+	result = libfsapfs_volume_superblock_is_sealed(
+	          internal_volume->superblock,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system data handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is sealed.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_vector_initialize(
-	     &( internal_volume->file_system_data_block_vector ),
-	     (size64_t) internal_volume->io_handle->block_size,
-	     (intptr_t *) file_system_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_system_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_file_system_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+	else if( ( result != 0 )
+	      && ( internal_volume->superblock->file_extent_tree_block_number != 0 ) )
+	{
+		if( libfsapfs_file_extent_tree_initialize(
+		     &( internal_volume->file_extent_tree ),
+		     internal_volume->io_handle,
+		     internal_volume->file_system_data_block_vector,
+		     internal_volume->superblock->file_extent_tree_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file extent tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_file_system_btree_initialize(
+	     &( internal_volume->file_system_btree ),
+	     internal_volume->io_handle,
+	     internal_volume->encryption_context,
+	     internal_volume->file_system_data_block_vector,
+	     internal_volume->object_map_btree,
+	     internal_volume->file_extent_tree,
+	     object_map_descriptor->physical_address,
+	     use_case_folding,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system data block vector.",
+		 "%s: unable to create file system B-tree.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->file_system_data_handle = file_system_data_handle;
-	file_system_data_handle                  = NULL;
+	internal_volume->file_system_btree->transaction_identifier = internal_volume->superblock->transaction_identifier;
 
-	if( libfdata_vector_append_segment(
-	     internal_volume->file_system_data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_volume->io_handle->container_size,
-	     0,
+	if( libfsapfs_object_map_descriptor_free(
+	     &object_map_descriptor,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to file system data block vector.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map descriptor.",
 		 function );
 
 		goto on_error;
@@ -809,95 +3584,139 @@ int libfsapfs_internal_volume_open_read(
 	return( 1 );
 
 on_error:
-	if( internal_volume->file_system_data_block_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &( internal_volume->file_system_data_block_vector ),
-		 NULL );
-	}
-	if( file_system_data_handle != NULL )
-	{
-		libfsapfs_file_system_data_handle_free(
-		 &file_system_data_handle,
-		 NULL );
-	}
-	if( internal_volume->encryption_context != NULL )
+	if( object_map_descriptor != NULL )
 	{
-		libfsapfs_encryption_context_free(
-		 &( internal_volume->encryption_context ),
+		libfsapfs_object_map_descriptor_free(
+		 &object_map_descriptor,
 		 NULL );
 	}
-	if( internal_volume->key_bag != NULL )
+	if( internal_volume->file_system_btree != NULL )
 	{
-		libfsapfs_volume_key_bag_free(
-		 &( internal_volume->key_bag ),
+		libfsapfs_file_system_btree_free(
+		 &( internal_volume->file_system_btree ),
 		 NULL );
 	}
-	if( internal_volume->snapshot_metadata_tree != NULL )
+	if( internal_volume->file_extent_tree != NULL )
 	{
-		libcdata_array_free(
-		 &( internal_volume->snapshots ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
+		libfsapfs_file_extent_tree_free(
+		 &( internal_volume->file_extent_tree ),
 		 NULL );
 	}
-	if( internal_volume->snapshot_metadata_tree != NULL )
+	return( -1 );
+}
+
+/* Retrieves the file IO handle to be used by a new file entry
+ * If the volume has a file IO pool the handles of the pool are used in turn
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_volume_get_file_entry_file_io_handle(
+     libfsapfs_internal_volume_t *internal_volume,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_pool_entry,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfsapfs_internal_volume_get_file_entry_file_io_handle";
+	int number_of_file_io_handles = 0;
+
+	if( internal_volume == NULL )
 	{
-		libfsapfs_snapshot_metadata_tree_free(
-		 &( internal_volume->snapshot_metadata_tree ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( extent_reference_tree != NULL )
+	if( file_io_handle == NULL )
 	{
-		libfsapfs_extent_reference_tree_free(
-		 &extent_reference_tree,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( internal_volume->object_map_btree != NULL )
+	if( file_io_pool_entry == NULL )
 	{
-		libfsapfs_object_map_btree_free(
-		 &( internal_volume->object_map_btree ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool entry.",
+		 function );
+
+		return( -1 );
 	}
-	if( object_map != NULL )
+	if( internal_volume->file_io_pool == NULL )
 	{
-		libfsapfs_object_map_free(
-		 &object_map,
-		 NULL );
+		*file_io_handle     = internal_volume->file_io_handle;
+		*file_io_pool_entry = 0;
+
+		return( 1 );
 	}
-	if( internal_volume->container_data_block_vector != NULL )
+	if( libbfio_pool_get_number_of_handles(
+	     internal_volume->file_io_pool,
+	     &number_of_file_io_handles,
+	     error ) != 1 )
 	{
-		libfdata_vector_free(
-		 &( internal_volume->container_data_block_vector ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file IO handles.",
+		 function );
+
+		return( -1 );
 	}
-	if( container_data_handle != NULL )
+	if( ( internal_volume->file_io_pool_entry < 0 )
+	 || ( internal_volume->file_io_pool_entry >= number_of_file_io_handles ) )
 	{
-		libfsapfs_container_data_handle_free(
-		 &container_data_handle,
-		 NULL );
+		internal_volume->file_io_pool_entry = 0;
 	}
-	if( internal_volume->superblock != NULL )
+	if( libbfio_pool_get_handle(
+	     internal_volume->file_io_pool,
+	     internal_volume->file_io_pool_entry,
+	     file_io_handle,
+	     error ) != 1 )
 	{
-		libfsapfs_volume_superblock_free(
-		 &( internal_volume->superblock ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle: %d from pool.",
+		 function,
+		 internal_volume->file_io_pool_entry );
+
+		return( -1 );
 	}
-	return( -1 );
+	*file_io_pool_entry = internal_volume->file_io_pool_entry;
+
+	internal_volume->file_io_pool_entry += 1;
+
+	return( 1 );
 }
 
-/* Closes a volume
- * Returns 0 if successful or -1 on error
+/* Retrieves a specific file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libfsapfs_internal_volume_close(
-     libfsapfs_internal_volume_t *internal_volume,
+int libfsapfs_volume_get_file_entry_by_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t identifier,
+     libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	static char *function = "libfsapfs_internal_volume_close";
-	int result            = 0;
+	libbfio_handle_t *file_io_handle             = NULL;
+	libfsapfs_inode_t *inode                     = NULL;
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_file_entry_by_identifier";
+	int result                                   = 0;
+	int file_io_pool_entry                       = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -908,220 +3727,252 @@ int libfsapfs_internal_volume_close(
 
 		return( -1 );
 	}
-	if( internal_volume->io_handle == NULL )
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	internal_volume->file_io_handle = NULL;
-	internal_volume->is_locked      = 1;
-
-	if( internal_volume->user_password != NULL )
+	if( *file_entry != NULL )
 	{
-		if( memory_set(
-		     internal_volume->user_password,
-		     0,
-		     internal_volume->user_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear user password.",
-			 function );
-
-			result = -1;
-		}
-		memory_free(
-		 internal_volume->user_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
 
-		internal_volume->user_password      = NULL;
-		internal_volume->user_password_size = 0;
+		return( -1 );
 	}
-	if( internal_volume->recovery_password != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( memory_set(
-		     internal_volume->recovery_password,
-		     0,
-		     internal_volume->recovery_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear recovery password.",
-			 function );
-
-			result = -1;
-		}
-		memory_free(
-		 internal_volume->recovery_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-		internal_volume->recovery_password      = NULL;
-		internal_volume->recovery_password_size = 0;
+		return( -1 );
 	}
-	if( internal_volume->superblock != NULL )
+#endif
+	if( internal_volume->file_system_btree == NULL )
 	{
-		if( libfsapfs_volume_superblock_free(
-		     &( internal_volume->superblock ),
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free superblock.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-	if( libfdata_vector_free(
-	     &( internal_volume->container_data_block_vector ),
-	     error ) != 1 )
+	result = libfsapfs_file_system_btree_get_inode_by_identifier(
+	          internal_volume->file_system_btree,
+	          internal_volume->file_io_handle,
+	          identifier,
+	          &inode,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free container data block vector.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from file system B-tree.",
+		 function,
+		 identifier );
 
-		result = -1;
+		goto on_error;
 	}
-	if( internal_volume->object_map_btree != NULL )
+	else if( result != 0 )
 	{
-		if( libfsapfs_object_map_btree_free(
-		     &( internal_volume->object_map_btree ),
+		if( libfsapfs_internal_volume_get_file_entry_file_io_handle(
+		     internal_volume,
+		     &file_io_handle,
+		     &file_io_pool_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free object map B-tree.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	if( internal_volume->snapshot_metadata_tree != NULL )
-	{
-		if( libfsapfs_snapshot_metadata_tree_free(
-		     &( internal_volume->snapshot_metadata_tree ),
+		if( libfsapfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     internal_volume->encryption_context,
+		     internal_volume->file_system_btree,
+		     inode,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free snapshot metadata tree.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool            = internal_volume->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
 	}
-	if( internal_volume->snapshots != NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libcdata_array_free(
-		     &( internal_volume->snapshots ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free snapshots array.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_volume->key_bag != NULL )
-	{
-		if( libfsapfs_volume_key_bag_free(
-		     &( internal_volume->key_bag ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free key bag.",
-			 function );
+#endif
+	return( result );
 
-			result = -1;
-		}
-	}
-	if( internal_volume->encryption_context != NULL )
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file entry of a specific file reference
+ * The file reference must have been created from the same volume
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_volume_get_file_entry_by_file_reference(
+     libfsapfs_volume_t *volume,
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     libfsapfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_volume_get_file_entry_by_file_reference";
+	uint64_t identifier                                  = 0;
+	uint64_t transaction_identifier                      = 0;
+	int result                                           = 0;
+
+	if( libfsapfs_file_reference_get_transaction_identifier(
+	     file_reference,
+	     file_reference_size,
+	     &transaction_identifier,
+	     error ) != 1 )
 	{
-		if( libfsapfs_encryption_context_free(
-		     &( internal_volume->encryption_context ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free encryption context.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve transaction identifier from file reference.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( libfdata_vector_free(
-	     &( internal_volume->file_system_data_block_vector ),
+	if( libfsapfs_file_reference_get_identifier(
+	     file_reference,
+	     file_reference_size,
+	     &identifier,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file system data block vector.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier from file reference.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_volume->file_system_btree != NULL )
+	result = libfsapfs_volume_get_file_entry_by_identifier(
+	          volume,
+	          identifier,
+	          file_entry,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libfsapfs_file_system_btree_free(
-		     &( internal_volume->file_system_btree ),
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_file_entry = (libfsapfs_internal_file_entry_t *) *file_entry;
+
+		if( internal_file_entry->file_system_btree->transaction_identifier != transaction_identifier )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file system B-tree.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in transaction identifier ( %" PRIu64 " != %" PRIu64 " ).",
+			 function,
+			 transaction_identifier,
+			 internal_file_entry->file_system_btree->transaction_identifier );
 
-			result = -1;
+			libfsapfs_file_entry_free(
+			 file_entry,
+			 NULL );
+
+			return( -1 );
 		}
 	}
 	return( result );
 }
 
-/* Unlocks an encrypted volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+/* Retrieves the root directory file entry
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_internal_volume_unlock(
-     libfsapfs_internal_volume_t *internal_volume,
+int libfsapfs_volume_get_root_directory(
+     libfsapfs_volume_t *volume,
+     libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	uint8_t volume_key[ 32 ];
-	uint8_t volume_master_key[ 32 ];
-
-	static char *function = "libfsapfs_internal_volume_unlock";
-	int result            = 0;
+	libbfio_handle_t *file_io_handle             = NULL;
+	libfsapfs_inode_t *inode                     = NULL;
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_root_directory";
+	int result                                   = 0;
+	int file_io_pool_entry                       = 0;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1132,126 +3983,168 @@ int libfsapfs_internal_volume_unlock(
 
 		return( -1 );
 	}
-	if( internal_volume->superblock == NULL )
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->key_bag == NULL )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing key bag.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfsapfs_volume_key_bag_get_volume_key(
-	          internal_volume->key_bag,
-	          internal_volume->user_password,
-	          internal_volume->user_password_size - 1,
-	          internal_volume->recovery_password,
-	          internal_volume->recovery_password_size - 1,
-	          volume_key,
-	          256,
-	          error );
-
-	if( result == -1 )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume key using password.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+#endif
+	if( internal_volume->file_system_btree == NULL )
 	{
-		if( libfsapfs_container_key_bag_get_volume_master_key_by_identifier(
-		     internal_volume->container_key_bag,
-		     internal_volume->superblock->volume_identifier,
-		     volume_key,
-		     256,
-		     volume_master_key,
-		     256,
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve volume master key.",
+			 "%s: unable to determine file system B-tree.",
 			 function );
 
 			goto on_error;
 		}
-		memory_set(
-		 volume_key,
-		 0,
-		 32 );
+	}
+	result = libfsapfs_file_system_btree_get_inode_by_identifier(
+	          internal_volume->file_system_btree,
+	          internal_volume->file_io_handle,
+	          2,
+	          &inode,
+	          error );
 
-		if( libfsapfs_encryption_context_set_keys(
-		     internal_volume->encryption_context,
-		     volume_master_key,
-		     16,
-		     &( volume_master_key[ 16 ] ),
-		     16,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set keys in encryption context.",
-			 function );
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root directory inode from file system B-tree.",
+		 function );
 
-			goto on_error;
-		}
-		memory_set(
-		 volume_master_key,
-		 0,
-		 32 );
+		goto on_error;
 	}
-	if( result != 0 )
+/* TODO return 0 if no root directory inode */
+
+	if( libfsapfs_internal_volume_get_file_entry_file_io_handle(
+	     internal_volume,
+	     &file_io_handle,
+	     &file_io_pool_entry,
+	     error ) != 1 )
 	{
-		internal_volume->is_locked = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file IO handle for file entry.",
+		 function );
+
+		goto on_error;
 	}
-	return( result );
+	if( libfsapfs_file_entry_initialize(
+	     file_entry,
+	     internal_volume->io_handle,
+	     file_io_handle,
+	     internal_volume->encryption_context,
+	     internal_volume->file_system_btree,
+	     inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
 
-on_error:
-	memory_set(
-	 volume_master_key,
-	 0,
-	 32 );
+		goto on_error;
+	}
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool            = internal_volume->file_io_pool;
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool_entry      = file_io_pool_entry;
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
 
-	memory_set(
-	 volume_key,
-	 0,
-	 32 );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
 
+on_error:
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Unlocks the volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+/* Retrieves the file entry for an UTF-8 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsapfs_volume_unlock(
+int libfsapfs_volume_get_file_entry_by_utf8_path(
      libfsapfs_volume_t *volume,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_unlock";
-	int result                                   = 1;
+	libbfio_handle_t *file_io_handle               = NULL;
+	libfsapfs_directory_record_t *directory_record = NULL;
+	libfsapfs_inode_t *inode                       = NULL;
+	libfsapfs_internal_volume_t *internal_volume   = NULL;
+	static char *function                          = "libfsapfs_volume_get_file_entry_by_utf8_path";
+	int result                                     = 0;
+	int file_io_pool_entry                         = 0;
 
 	if( volume == NULL )
 	{
@@ -1266,6 +4159,28 @@ int libfsapfs_volume_unlock(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -1281,23 +4196,85 @@ int libfsapfs_volume_unlock(
 		return( -1 );
 	}
 #endif
-	if( internal_volume->is_locked != 0 )
+	if( internal_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libfsapfs_file_system_btree_get_inode_by_utf8_path(
+	          internal_volume->file_system_btree,
+	          internal_volume->file_io_handle,
+	          2,
+	          utf8_string,
+	          utf8_string_length,
+	          &inode,
+	          &directory_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode from file system B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
 	{
-		result = libfsapfs_internal_volume_unlock(
-		          internal_volume,
-		          error );
+		if( libfsapfs_internal_volume_get_file_entry_file_io_handle(
+		     internal_volume,
+		     &file_io_handle,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
+			 function );
 
-		if( result == -1 )
+			goto on_error;
+		}
+		if( libfsapfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     internal_volume->encryption_context,
+		     internal_volume->file_system_btree,
+		     inode,
+		     directory_record,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to unlock volume.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool            = internal_volume->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
+
+		inode            = NULL;
+		directory_record = NULL;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -1315,18 +4292,51 @@ int libfsapfs_volume_unlock(
 	}
 #endif
 	return( result );
+
+on_error:
+	if( *file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 file_entry,
+		 NULL );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the size
- * Returns 1 if successful or -1 on error
+/* Retrieves the file entry for an UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
-int libfsapfs_volume_get_size(
+int libfsapfs_volume_get_file_entry_by_utf16_path(
      libfsapfs_volume_t *volume,
-     size64_t *size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_size";
+	libbfio_handle_t *file_io_handle               = NULL;
+	libfsapfs_directory_record_t *directory_record = NULL;
+	libfsapfs_inode_t *inode                       = NULL;
+	libfsapfs_internal_volume_t *internal_volume   = NULL;
+	static char *function                          = "libfsapfs_volume_get_file_entry_by_utf16_path";
+	int result                                     = 0;
+	int file_io_pool_entry                         = 0;
 
 	if( volume == NULL )
 	{
@@ -1341,48 +4351,30 @@ int libfsapfs_volume_get_size(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
-		 function );
-
-		return( -1 );
-	}
-	if( size == NULL )
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid file entry.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( *file_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-/* TODO implement */
-	*size = (size64_t) 0;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1390,85 +4382,94 @@ int libfsapfs_volume_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( -1 );
-}
-
-/* Retrieves the identifier
- * The identifier is an UUID stored in big-endian and is 16 bytes of size
- * Returns 1 if successful or -1 on error
- */
-int libfsapfs_volume_get_identifier(
-     libfsapfs_volume_t *volume,
-     uint8_t *uuid_data,
-     size_t uuid_data_size,
-     libcerror_error_t **error )
-{
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_identifier";
-	int result                                   = 1;
-
-	if( volume == NULL )
+	if( internal_volume->file_system_btree == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
-		 function );
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
+	result = libfsapfs_file_system_btree_get_inode_by_utf16_path(
+	          internal_volume->file_system_btree,
+	          internal_volume->file_io_handle,
+	          2,
+	          utf16_string,
+	          utf16_string_length,
+	          &inode,
+	          &directory_record,
+	          error );
 
-	if( internal_volume->superblock == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode from file system B-tree.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libfsapfs_internal_volume_get_file_entry_file_io_handle(
+		     internal_volume,
+		     &file_io_handle,
+		     &file_io_pool_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle for file entry.",
+			 function );
 
-		return( -1 );
-	}
-#endif
-	if( libfsapfs_volume_superblock_get_volume_identifier(
-	     internal_volume->superblock,
-	     uuid_data,
-	     uuid_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve volume identifier.",
-		 function );
+			goto on_error;
+		}
+		if( libfsapfs_file_entry_initialize(
+		     file_entry,
+		     internal_volume->io_handle,
+		     file_io_handle,
+		     internal_volume->encryption_context,
+		     internal_volume->file_system_btree,
+		     inode,
+		     directory_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
 
-		result = -1;
+			goto on_error;
+		}
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool            = internal_volume->file_io_pool;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->file_io_pool_entry      = file_io_pool_entry;
+		( (libfsapfs_internal_file_entry_t *) *file_entry )->next_file_io_pool_entry = file_io_pool_entry + 1;
+
+		inode            = NULL;
+		directory_record = NULL;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1476,27 +4477,71 @@ int libfsapfs_volume_get_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
 	return( result );
+
+on_error:
+	if( *file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 file_entry,
+		 NULL );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded name
- * The returned size includes the end of string character
+/* Reads the data of multiple file entries in physical order
+ * The callback function is called for every part of the data that was read,
+ * with the index of the file entry in file_entries and the offset of the data
+ * relative to the start of the file entry data. The data of the file entries
+ * is read in order of increasing physical offset, so that data is read with
+ * a minimal amount of seeking. Data shared by multiple file entries is read once.
+ * The callback function should return 1 if successful or -1 on error
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_utf8_name_size(
+int libfsapfs_volume_read_file_entries_data(
      libfsapfs_volume_t *volume,
-     size_t *utf8_string_size,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_utf8_name_size";
-	int result                                   = 1;
+	libfsapfs_file_system_btree_t *file_system_btree     = NULL;
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	libfsapfs_internal_volume_t *internal_volume         = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler           = NULL;
+	static char *function                                = "libfsapfs_volume_read_file_entries_data";
+	int file_entry_index                                 = 0;
 
 	if( volume == NULL )
 	{
@@ -1511,6 +4556,39 @@ int libfsapfs_volume_get_utf8_name_size(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
+	if( file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of file entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
@@ -1526,20 +4604,8 @@ int libfsapfs_volume_get_utf8_name_size(
 		return( -1 );
 	}
 #endif
-	if( libfsapfs_volume_superblock_get_utf8_volume_name_size(
-	     internal_volume->superblock,
-	     utf8_string_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size.",
-		 function );
+	file_system_btree = internal_volume->file_system_btree;
 
-		result = -1;
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
@@ -1555,96 +4621,143 @@ int libfsapfs_volume_get_utf8_name_size(
 		return( -1 );
 	}
 #endif
-	return( result );
-}
-
-/* Retrieves the UTF-8 encoded name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfsapfs_volume_get_utf8_name(
-     libfsapfs_volume_t *volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     libcerror_error_t **error )
-{
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_utf8_name";
-	int result                                   = 1;
-
-	if( volume == NULL )
+	if( libfsapfs_read_scheduler_initialize(
+	     &read_scheduler,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read scheduler.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
+	for( file_entry_index = 0;
+	     file_entry_index < number_of_file_entries;
+	     file_entry_index++ )
+	{
+		internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entries[ file_entry_index ];
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+		if( internal_file_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid file entry: %d.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		/* The file entries of a volume share the file system B-tree of the volume,
+		 * the IO handle is shared by all the volumes of the container
+		 */
+		if( ( file_system_btree == NULL )
+		 || ( internal_file_entry->file_system_btree != file_system_btree ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid file entry: %d - not part of volume.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsapfs_read_scheduler_append_file_entry(
+		     read_scheduler,
+		     internal_file_entry,
+		     file_entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file entry: %d to read scheduler.",
+			 function,
+			 file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_read_scheduler_sort(
+	     read_scheduler,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort read scheduler.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libfsapfs_volume_superblock_get_utf8_volume_name(
-	     internal_volume->superblock,
-	     utf8_string,
-	     utf8_string_size,
+	if( libfsapfs_read_scheduler_read(
+	     read_scheduler,
+	     file_entries,
+	     number_of_file_entries,
+	     callback_function,
+	     callback_data,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file entries data.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsapfs_read_scheduler_free(
+	     &read_scheduler,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read scheduler.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded name
- * The returned size includes the end of string character
+/* Calculates the disk usage of the directories of the volume
+ * The inodes are read in a single sweep of the file system B-tree leaf nodes
+ * after which the logical size, allocated size and number of files of every
+ * directory are aggregated from the bottom up.
+ * The sizes of decmpfs-compressed files are read from their extended attributes
+ * If number_of_threads is larger than 1 the sweep is divided into key ranges
+ * that are read concurrently
+ * The disk usage must be freed after use with libfsapfs_disk_usage_free
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_utf16_name_size(
+int libfsapfs_volume_get_disk_usage(
      libfsapfs_volume_t *volume,
-     size_t *utf16_string_size,
+     int number_of_threads,
+     libfsapfs_disk_usage_t **disk_usage,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_utf16_name_size";
-	int result                                   = 1;
+	static char *function                        = "libfsapfs_volume_get_disk_usage";
 
 	if( volume == NULL )
 	{
@@ -1659,37 +4772,41 @@ int libfsapfs_volume_get_utf16_name_size(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( number_of_threads < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( libfsapfs_volume_superblock_get_utf16_volume_name_size(
-	     internal_volume->superblock,
-	     utf16_string_size,
-	     error ) != 1 )
+	if( disk_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid disk usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *disk_usage != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid disk usage value already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1697,74 +4814,72 @@ int libfsapfs_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
-}
-
-/* Retrieves the UTF-16 encoded name
- * The size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfsapfs_volume_get_utf16_name(
-     libfsapfs_volume_t *volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     libcerror_error_t **error )
-{
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_utf16_name";
-	int result                                   = 1;
+	if( internal_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
 
-	if( volume == NULL )
+			goto on_error;
+		}
+	}
+	if( libfsapfs_disk_usage_initialize(
+	     disk_usage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create disk usage.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
+	if( libfsapfs_internal_disk_usage_read_file_system_btree(
+	     (libfsapfs_internal_disk_usage_t *) *disk_usage,
+	     internal_volume->file_system_btree,
+	     internal_volume->file_io_handle,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( libfsapfs_volume_superblock_get_utf16_volume_name(
-	     internal_volume->superblock,
-	     utf16_string,
-	     utf16_string_size,
+	if( libfsapfs_internal_disk_usage_calculate_totals(
+	     (libfsapfs_internal_disk_usage_t *) *disk_usage,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate disk usage totals.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1772,25 +4887,50 @@ int libfsapfs_volume_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_disk_usage_free(
+		 disk_usage,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( *disk_usage != NULL )
+	{
+		libfsapfs_disk_usage_free(
+		 disk_usage,
+		 NULL );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Determines if the volume is locked
- * Returns 1 if locked, 0 if not or -1 on error
+/* Verifies the seal of the volume
+ * The hashes of all the file system B-tree nodes of a sealed volume are verified
+ * against the root hash stored in the integrity metadata. If number_of_threads
+ * is larger than 1 the nodes of every level of the B-tree are verified concurrently
+ * Returns 1 if the seal is valid, 0 if not or -1 on error
  */
-int libfsapfs_volume_is_locked(
+int libfsapfs_volume_verify_seal(
      libfsapfs_volume_t *volume,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_is_locked";
-	uint8_t is_locked                            = 0;
+	libfsapfs_integrity_metadata_t *integrity_metadata       = NULL;
+	libfsapfs_internal_volume_t *internal_volume             = NULL;
+	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
+	static char *function                                    = "libfsapfs_volume_verify_seal";
+	off64_t file_offset                                      = 0;
+	int result                                               = 0;
 
 	if( volume == NULL )
 	{
@@ -1805,25 +4945,45 @@ int libfsapfs_volume_is_locked(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	is_locked = internal_volume->is_locked;
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
 
+		return( -1 );
+	}
+	if( number_of_threads == 0 )
+	{
+		number_of_threads = 1;
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1831,144 +4991,175 @@ int libfsapfs_volume_is_locked(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( is_locked );
-}
-
-/* Sets an UTF-8 formatted password
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful, 0 if password is invalid or -1 on error
- */
-int libfsapfs_volume_set_utf8_password(
-     libfsapfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libcerror_error_t **error )
-{
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_set_utf8_password";
+	result = libfsapfs_volume_superblock_is_sealed(
+	          internal_volume->superblock,
+	          error );
 
-	if( volume == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if volume is sealed.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
-
-	if( utf8_string == NULL )
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported volume - not sealed.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	/* The seal is verified against the node blocks as stored, which requires
+	 * the nodes of an encrypted volume to be decrypted first
+	 */
+	if( ( internal_volume->superblock->volume_flags & 0x00000001UL ) == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported volume - encrypted sealed volumes are not supported.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_volume->user_password != NULL )
+	if( internal_volume->file_system_btree == NULL )
 	{
-		if( memory_set(
-		     internal_volume->user_password,
-		     0,
-		     internal_volume->user_password_size ) == NULL )
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear user password.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
 			 function );
 
 			goto on_error;
 		}
-		memory_free(
-		 internal_volume->user_password );
-
-		internal_volume->user_password      = NULL;
-		internal_volume->user_password_size = 0;
 	}
-	internal_volume->user_password_size = 1 + narrow_string_length(
-	                                           (char *) utf8_string );
+	if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+	     internal_volume->object_map_btree,
+	     internal_volume->file_io_handle,
+	     internal_volume->superblock->integrity_metadata_object_identifier,
+	     &object_map_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve object map descriptor for integrity metadata object identifier: %" PRIu64 ".",
+		 function,
+		 internal_volume->superblock->integrity_metadata_object_identifier );
 
-	if( internal_volume->user_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		goto on_error;
+	}
+	if( object_map_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid volume - user password size value exceeds maximum allocation size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid object map descriptor.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->user_password = (uint8_t *) memory_allocate(
-	                                              sizeof( uint8_t ) * internal_volume->user_password_size );
+	file_offset = (off64_t) ( object_map_descriptor->physical_address * internal_volume->io_handle->block_size );
 
-	if( internal_volume->user_password == NULL )
+	if( libfsapfs_object_map_descriptor_free(
+	     &object_map_descriptor,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to create user password.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free object map descriptor.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_copy(
-	     internal_volume->user_password,
-	     utf8_string,
-	     utf8_string_length ) == NULL )
+	if( libfsapfs_integrity_metadata_initialize(
+	     &integrity_metadata,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy user password.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create integrity metadata.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->user_password[ internal_volume->user_password_size - 1 ] = 0;
+	if( libfsapfs_integrity_metadata_read_file_io_handle(
+	     integrity_metadata,
+	     internal_volume->file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read integrity metadata at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
-	internal_volume->user_password_is_set = 1;
+		goto on_error;
+	}
+	result = libfsapfs_seal_verifier_verify(
+	          internal_volume->io_handle,
+	          internal_volume->file_io_handle,
+	          internal_volume->file_system_btree,
+	          integrity_metadata->hash_type,
+	          integrity_metadata->root_hash,
+	          integrity_metadata->root_hash_size,
+	          number_of_threads,
+	          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == -1 )
 	{
-		libcnotify_printf(
-		 "%s: user password: %s\n",
-		 function,
-		 internal_volume->user_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify seal.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_integrity_metadata_free(
+	     &integrity_metadata,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free integrity metadata.",
+		 function );
+
+		goto on_error;
 	}
-#endif
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -1984,22 +5175,21 @@ int libfsapfs_volume_set_utf8_password(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 
 on_error:
-	if( internal_volume->user_password != NULL )
+	if( integrity_metadata != NULL )
 	{
-		memory_set(
-		 internal_volume->user_password,
-		 0,
-		 internal_volume->user_password_size );
-		memory_free(
-		 internal_volume->user_password );
-
-		internal_volume->user_password = NULL;
+		libfsapfs_integrity_metadata_free(
+		 &integrity_metadata,
+		 NULL );
+	}
+	if( object_map_descriptor != NULL )
+	{
+		libfsapfs_object_map_descriptor_free(
+		 &object_map_descriptor,
+		 NULL );
 	}
-	internal_volume->user_password_size = 0;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
@@ -2008,18 +5198,21 @@ on_error:
 	return( -1 );
 }
 
-/* Sets an UTF-16 formatted password
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful, 0 if password is invalid or -1 on error
+/* Builds a metadata index of the volume
+ * The inodes are read in a single sweep of the file system B-tree leaf nodes
+ * after which sorted keys are created of the time values, size, owner and group
+ * identifier and name extension of every inode.
+ * The metadata index can be queried without reading from the volume
+ * The metadata index must be freed after use with libfsapfs_metadata_index_free
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_set_utf16_password(
+int libfsapfs_volume_get_metadata_index(
      libfsapfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+     libfsapfs_metadata_index_t **metadata_index,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_set_utf16_password";
+	static char *function                        = "libfsapfs_volume_get_metadata_index";
 
 	if( volume == NULL )
 	{
@@ -2034,114 +5227,100 @@ int libfsapfs_volume_set_utf16_password(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( metadata_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata index.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->user_password != NULL )
+	if( *metadata_index != NULL )
 	{
-		if( memory_set(
-		     internal_volume->user_password,
-		     0,
-		     internal_volume->user_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear user password.",
-			 function );
-
-			goto on_error;
-		}
-		memory_free(
-		 internal_volume->user_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata index value already set.",
+		 function );
 
-		internal_volume->user_password      = NULL;
-		internal_volume->user_password_size = 0;
+		return( -1 );
 	}
-	if( libuna_utf8_string_size_from_utf16(
-	     utf16_string,
-	     utf16_string_length,
-	     &( internal_volume->user_password_size ),
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set password size.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->user_password_size += 1;
+#endif
+	if( internal_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
 
-	if( internal_volume->user_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			goto on_error;
+		}
+	}
+	if( libfsapfs_metadata_index_initialize(
+	     metadata_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid volume - user password size value exceeds maximum allocation size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata index.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->user_password = (uint8_t *) memory_allocate(
-	                                              sizeof( uint8_t ) * internal_volume->user_password_size );
-
-	if( internal_volume->user_password == NULL )
+	if( libfsapfs_internal_metadata_index_read_file_system_btree(
+	     (libfsapfs_internal_metadata_index_t *) *metadata_index,
+	     internal_volume->file_system_btree,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to create user password.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree.",
 		 function );
 
 		goto on_error;
 	}
-	if( libuna_utf8_string_copy_from_utf16(
-	     internal_volume->user_password,
-	     internal_volume->user_password_size,
-	     utf16_string,
-	     utf16_string_length,
+	if( libfsapfs_internal_metadata_index_build_sorted_keys(
+	     (libfsapfs_internal_metadata_index_t *) *metadata_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy user password.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to build metadata index sorted keys.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->user_password[ internal_volume->user_password_size - 1 ] = 0;
-
-	internal_volume->user_password_is_set = 1;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: user password: %s\n",
-		 function,
-		 internal_volume->user_password );
-	}
-#endif
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2154,25 +5333,22 @@ int libfsapfs_volume_set_utf16_password(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_metadata_index_free(
+		 metadata_index,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( 1 );
 
 on_error:
-	if( internal_volume->user_password != NULL )
+	if( *metadata_index != NULL )
 	{
-		memory_set(
-		 internal_volume->user_password,
-		 0,
-		 internal_volume->user_password_size );
-		memory_free(
-		 internal_volume->user_password );
-
-		internal_volume->user_password = NULL;
+		libfsapfs_metadata_index_free(
+		 metadata_index,
+		 NULL );
 	}
-	internal_volume->user_password_size = 0;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
@@ -2181,18 +5357,23 @@ on_error:
 	return( -1 );
 }
 
-/* Sets an UTF-8 formatted recovery password
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful, 0 if recovery password is invalid or -1 on error
+/* Searches the volume for file entries with a name that matches a pattern
+ * The pattern is an UTF-8 string where '*' matches zero or more characters and '?'
+ * a single character. Names are compared case folded.
+ * The directory records are read in a single sweep of the file system B-tree leaf
+ * nodes, where the names are matched in place. Paths are only created for the results.
+ * The name search must be freed after use with libfsapfs_name_search_free
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_set_utf8_recovery_password(
+int libfsapfs_volume_search_by_utf8_name_pattern(
      libfsapfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
+     const uint8_t *utf8_pattern,
+     size_t utf8_pattern_length,
+     libfsapfs_name_search_t **name_search,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_set_utf8_recovery_password";
+	static char *function                        = "libfsapfs_volume_search_by_utf8_name_pattern";
 
 	if( volume == NULL )
 	{
@@ -2207,98 +5388,93 @@ int libfsapfs_volume_set_utf8_recovery_password(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( name_search == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name search.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->recovery_password != NULL )
+	if( *name_search != NULL )
 	{
-		if( memory_set(
-		     internal_volume->recovery_password,
-		     0,
-		     internal_volume->recovery_password_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear recovery password.",
-			 function );
-
-			goto on_error;
-		}
-		memory_free(
-		 internal_volume->recovery_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name search value already set.",
+		 function );
 
-		internal_volume->recovery_password      = NULL;
-		internal_volume->recovery_password_size = 0;
+		return( -1 );
 	}
-	internal_volume->recovery_password_size = 1 + narrow_string_length(
-	                                               (char *) utf8_string );
-
-	if( internal_volume->recovery_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	if( libfsapfs_name_search_initialize(
+	     name_search,
+	     utf8_pattern,
+	     utf8_pattern_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid volume - recovery password size value exceeds maximum allocation size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name search.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->recovery_password = (uint8_t *) memory_allocate(
-	                                                  sizeof( uint8_t ) * internal_volume->recovery_password_size );
-
-	if( internal_volume->recovery_password == NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to create recovery password.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		libfsapfs_name_search_free(
+		 name_search,
+		 NULL );
+
+		return( -1 );
 	}
-	if( memory_copy(
-	     internal_volume->recovery_password,
-	     utf8_string,
-	     utf8_string_length ) == NULL )
+#endif
+	if( internal_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_internal_name_search_read_file_system_btree(
+	     (libfsapfs_internal_name_search_t *) *name_search,
+	     internal_volume->file_system_btree,
+	     internal_volume->file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy recovery password.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->recovery_password[ internal_volume->recovery_password_size - 1 ] = 0;
-
-	internal_volume->recovery_password_is_set = 1;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: recovery password: %s\n",
-		 function,
-		 internal_volume->recovery_password );
-	}
-#endif
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2311,25 +5487,22 @@ int libfsapfs_volume_set_utf8_recovery_password(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_name_search_free(
+		 name_search,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( 1 );
 
 on_error:
-	if( internal_volume->recovery_password != NULL )
+	if( *name_search != NULL )
 	{
-		memory_set(
-		 internal_volume->recovery_password,
-		 0,
-		 internal_volume->recovery_password_size );
-		memory_free(
-		 internal_volume->recovery_password );
-
-		internal_volume->recovery_password = NULL;
+		libfsapfs_name_search_free(
+		 name_search,
+		 NULL );
 	}
-	internal_volume->recovery_password_size = 0;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
@@ -2338,20 +5511,19 @@ on_error:
 	return( -1 );
 }
 
-/* Sets an UTF-16 formatted recovery password
- * This function needs to be used before one of the open or unlock functions
- * Returns 1 if successful, 0 if recovery password is invalid or -1 on error
+/* Retrieves the extended attributes of the file entries of the volume
+ * A directory identifier of 0 represents the whole volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_set_utf16_recovery_password(
-     libfsapfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
+int libfsapfs_internal_volume_get_extended_attribute_sweep(
+     libfsapfs_internal_volume_t *internal_volume,
+     uint64_t directory_identifier,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_set_utf16_recovery_password";
+	static char *function = "libfsapfs_internal_volume_get_extended_attribute_sweep";
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2362,116 +5534,155 @@ int libfsapfs_volume_set_utf16_recovery_password(
 
 		return( -1 );
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
+		 function );
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+		return( -1 );
+	}
+	if( *extended_attribute_sweep != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extended attribute sweep value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_volume->recovery_password != NULL )
+	if( internal_volume->file_system_btree == NULL )
 	{
-		if( memory_set(
-		     internal_volume->recovery_password,
-		     0,
-		     internal_volume->recovery_password_size ) == NULL )
+		if( libfsapfs_internal_volume_get_file_system_btree(
+		     internal_volume,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to clear recovery password.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
 			 function );
 
 			goto on_error;
 		}
-		memory_free(
-		 internal_volume->recovery_password );
-
-		internal_volume->recovery_password      = NULL;
-		internal_volume->recovery_password_size = 0;
 	}
-	if( libuna_utf8_string_size_from_utf16(
-	     utf16_string,
-	     utf16_string_length,
-	     &( internal_volume->recovery_password_size ),
+	if( libfsapfs_extended_attribute_sweep_initialize(
+	     extended_attribute_sweep,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->encryption_context,
+	     internal_volume->file_system_btree,
+	     directory_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extended attribute sweep.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_internal_extended_attribute_sweep_read_file_system_btree(
+	     (libfsapfs_internal_extended_attribute_sweep_t *) *extended_attribute_sweep,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set password size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file system B-tree.",
 		 function );
 
 		goto on_error;
 	}
-	internal_volume->recovery_password_size += 1;
+	return( 1 );
 
-	if( internal_volume->recovery_password_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+on_error:
+	if( *extended_attribute_sweep != NULL )
+	{
+		libfsapfs_extended_attribute_sweep_free(
+		 extended_attribute_sweep,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the extended attributes of all the file entries of the volume
+ * The extended attribute records are read in a single sweep of the file system B-tree
+ * leaf nodes, where the names and inline values are copied without creating extended attributes
+ * The extended attribute sweep must be freed after use with libfsapfs_extended_attribute_sweep_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_extended_attribute_sweep(
+     libfsapfs_volume_t *volume,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_extended_attribute_sweep";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid volume - recovery password size value exceeds maximum allocation size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->recovery_password = (uint8_t *) memory_allocate(
-	                                                  sizeof( uint8_t ) * internal_volume->recovery_password_size );
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( internal_volume->recovery_password == NULL )
+	if( extended_attribute_sweep == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to create recovery password.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libuna_utf8_string_copy_from_utf16(
-	     internal_volume->recovery_password,
-	     internal_volume->recovery_password_size,
-	     utf16_string,
-	     utf16_string_length,
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy recovery password.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_volume->recovery_password[ internal_volume->recovery_password_size - 1 ] = 0;
-
-	internal_volume->recovery_password_is_set = 1;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+#endif
+	if( libfsapfs_internal_volume_get_extended_attribute_sweep(
+	     internal_volume,
+	     0,
+	     extended_attribute_sweep,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "%s: recovery password: %s\n",
-		 function,
-		 internal_volume->recovery_password );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extended attribute sweep.",
+		 function );
+
+		goto on_error;
 	}
-#endif
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2484,25 +5695,16 @@ int libfsapfs_volume_set_utf16_recovery_password(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_extended_attribute_sweep_free(
+		 extended_attribute_sweep,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( 1 );
 
 on_error:
-	if( internal_volume->recovery_password != NULL )
-	{
-		memory_set(
-		 internal_volume->recovery_password,
-		 0,
-		 internal_volume->recovery_password_size );
-		memory_free(
-		 internal_volume->recovery_password );
-
-		internal_volume->recovery_password = NULL;
-	}
-	internal_volume->recovery_password_size = 0;
-
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
@@ -2511,16 +5713,20 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the next file entry identifier
+/* Retrieves the extended attributes of a directory and its descendants
+ * The inode records are read in the same sweep as the extended attribute records,
+ * a file entry is a descendant if the directory is on the path of its parent identifiers
+ * The extended attribute sweep must be freed after use with libfsapfs_extended_attribute_sweep_free
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_next_file_entry_identifier(
+int libfsapfs_volume_get_extended_attribute_sweep_by_directory_identifier(
      libfsapfs_volume_t *volume,
-     uint64_t *identifier,
+     uint64_t directory_identifier,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_next_file_entry_identifier";
+	static char *function                        = "libfsapfs_volume_get_extended_attribute_sweep_by_directory_identifier";
 
 	if( volume == NULL )
 	{
@@ -2535,19 +5741,30 @@ int libfsapfs_volume_get_next_file_entry_identifier(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( identifier == NULL )
+	if( directory_identifier == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid identifier.",
+		 "%s: invalid directory identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( extended_attribute_sweep == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute sweep.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2555,16 +5772,29 @@ int libfsapfs_volume_get_next_file_entry_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*identifier = internal_volume->superblock->next_file_system_object_identifier;
+	if( libfsapfs_internal_volume_get_extended_attribute_sweep(
+	     internal_volume,
+	     directory_identifier,
+	     extended_attribute_sweep,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve extended attribute sweep.",
+		 function );
 
+		goto on_error;
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2572,27 +5802,71 @@ int libfsapfs_volume_get_next_file_entry_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_extended_attribute_sweep_free(
+		 extended_attribute_sweep,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
 	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
-/* Determines the file system B-tree
+/* Retrieves a cursor positioned at the first record of the file system B-tree
+ * The cursor must be freed after use with libfsapfs_cursor_free
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_internal_volume_get_file_system_btree(
-     libfsapfs_internal_volume_t *internal_volume,
+int libfsapfs_volume_get_cursor(
+     libfsapfs_volume_t *volume,
+     libfsapfs_cursor_t **cursor,
      libcerror_error_t **error )
 {
-	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
-	static char *function                                    = "libfsapfs_internal_volume_get_file_system_btree";
-	uint8_t use_case_folding                                 = 0;
+	static char *function = "libfsapfs_volume_get_cursor";
 
-	if( internal_volume == NULL )
+	if( libfsapfs_volume_get_cursor_by_identifier(
+	     volume,
+	     0,
+	     cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cursor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a cursor positioned at the first record of a specific identifier in the file system B-tree
+ * If no records of the identifier exist the cursor is positioned at the first record of the next identifier
+ * The cursor must be freed after use with libfsapfs_cursor_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_cursor_by_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t identifier,
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_cursor_by_identifier";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2603,127 +5877,195 @@ int libfsapfs_internal_volume_get_file_system_btree(
 
 		return( -1 );
 	}
-	if( internal_volume->superblock == NULL )
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cursor != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cursor value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_volume->is_locked != 0 )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		if( libfsapfs_internal_volume_unlock(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->file_system_btree == NULL )
+	{
+		if( libfsapfs_internal_volume_get_file_system_btree(
 		     internal_volume,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to unlock volume.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine file system B-tree.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
-	     internal_volume->object_map_btree,
+	if( libfsapfs_cursor_initialize(
+	     cursor,
+	     internal_volume->io_handle,
 	     internal_volume->file_io_handle,
-	     internal_volume->superblock->file_system_root_object_identifier,
-	     &object_map_descriptor,
+	     internal_volume->encryption_context,
+	     internal_volume->file_system_btree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve object map descriptor for file system root object identifier: %" PRIu64 ".",
-		 function,
-		 internal_volume->superblock->file_system_root_object_identifier );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
 
 		goto on_error;
 	}
-	if( object_map_descriptor == NULL )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->file_system_btree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid object map descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( internal_volume->superblock->incompatibility_features_flags & 0x00000000000000001 ) != 0 )
+#endif
+	if( libfsapfs_internal_cursor_seek(
+	     (libfsapfs_internal_cursor_t *) *cursor,
+	     identifier,
+	     0,
+	     error ) != 1 )
 	{
-		use_case_folding = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to seek first record of identifier: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		libcthreads_read_write_lock_release_for_read(
+		 internal_volume->file_system_btree->read_write_lock,
+		 NULL );
+#endif
+		goto on_error;
 	}
-	if( libfsapfs_file_system_btree_initialize(
-	     &( internal_volume->file_system_btree ),
-	     internal_volume->io_handle,
-	     internal_volume->encryption_context,
-	     internal_volume->file_system_data_block_vector,
-	     internal_volume->object_map_btree,
-	     object_map_descriptor->physical_address,
-	     use_case_folding,
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system B-tree.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		libfsapfs_cursor_free(
+		 cursor,
+		 NULL );
+
+		return( -1 );
 	}
-	if( libfsapfs_object_map_descriptor_free(
-	     &object_map_descriptor,
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_volume->file_system_btree,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free object map descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
 		 function );
 
-		goto on_error;
+		libfsapfs_cursor_free(
+		 cursor,
+		 NULL );
+
+		return( -1 );
 	}
 	return( 1 );
 
 on_error:
-	if( object_map_descriptor != NULL )
-	{
-		libfsapfs_object_map_descriptor_free(
-		 &object_map_descriptor,
-		 NULL );
-	}
-	if( internal_volume->file_system_btree != NULL )
+	if( *cursor != NULL )
 	{
-		libfsapfs_file_system_btree_free(
-		 &( internal_volume->file_system_btree ),
+		libfsapfs_cursor_free(
+		 cursor,
 		 NULL );
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
-/* Retrieves a specific file entry
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves a cursor from a byte stream created by libfsapfs_cursor_copy_to_byte_stream
+ * The byte stream is only valid for the transaction of the volume it was created from
+ * and is rejected if the path it stores no longer leads to the same record
+ * The cursor must be freed after use with libfsapfs_cursor_free
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_file_entry_by_identifier(
+int libfsapfs_volume_get_cursor_from_byte_stream(
      libfsapfs_volume_t *volume,
-     uint64_t identifier,
-     libfsapfs_file_entry_t **file_entry,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfsapfs_cursor_t **cursor,
      libcerror_error_t **error )
 {
-	libfsapfs_inode_t *inode                     = NULL;
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_file_entry_by_identifier";
+	static char *function                        = "libfsapfs_volume_get_cursor_from_byte_stream";
 	int result                                   = 0;
 
 	if( volume == NULL )
@@ -2739,24 +6081,24 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( cursor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid cursor.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( *cursor != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 "%s: invalid cursor value already set.",
 		 function );
 
 		return( -1 );
@@ -2792,46 +6134,106 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 			goto on_error;
 		}
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_identifier(
-	          internal_volume->file_system_btree,
-	          internal_volume->file_io_handle,
-	          identifier,
-	          &inode,
+	if( libfsapfs_cursor_initialize(
+	     cursor,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->encryption_context,
+	     internal_volume->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_internal_cursor_read_byte_stream(
+	     (libfsapfs_internal_cursor_t *) *cursor,
+	     byte_stream,
+	     byte_stream_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cursor from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab file system B-tree read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libfsapfs_internal_cursor_validate_path(
+	          (libfsapfs_internal_cursor_t *) *cursor,
 	          error );
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->file_system_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file system B-tree read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfsapfs_file_system_btree_flush_pending_nodes(
+	     internal_volume->file_system_btree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to flush pending file system B-tree nodes.",
+		 function );
+
+		goto on_error;
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 " from file system B-tree.",
-		 function,
-		 identifier );
+		 "%s: unable to validate cursor path.",
+		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libfsapfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->encryption_context,
-		     internal_volume->file_system_btree,
-		     inode,
-		     NULL,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: invalid cursor - path does not match file system B-tree.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2845,12 +6247,22 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		libfsapfs_cursor_free(
+		 cursor,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 
 on_error:
+	if( *cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 cursor,
+		 NULL );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
@@ -2859,18 +6271,25 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the root directory file entry
+/* Partitions the file system B-tree into ranges of identifiers with roughly equal numbers of leaf nodes
+ * The partitions are determined from the keys of the branch nodes, the leaf nodes are not read
+ * Partition N contains the records with an identifier from partition_identifiers[ N ] up to,
+ * but not including, partition_identifiers[ N + 1 ], the last partition contains the remaining records
+ * Every partition can be iterated independently, for example from another process with its own
+ * container, using libfsapfs_volume_get_cursor_by_identifier
+ * Less partitions than requested are returned when the B-tree is too small to be partitioned further
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_root_directory(
+int libfsapfs_volume_partition_file_system_tree(
      libfsapfs_volume_t *volume,
-     libfsapfs_file_entry_t **file_entry,
+     uint64_t *partition_identifiers,
+     int maximum_number_of_partitions,
+     int *number_of_partitions,
      libcerror_error_t **error )
 {
-	libfsapfs_inode_t *inode                     = NULL;
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_root_directory";
-	int result                                   = 0;
+	static char *function                        = "libfsapfs_volume_partition_file_system_tree";
+	int result                                   = 1;
 
 	if( volume == NULL )
 	{
@@ -2885,28 +6304,6 @@ int libfsapfs_volume_get_root_directory(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
-		 function );
-
-		return( -1 );
-	}
-	if( *file_entry != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -2935,50 +6332,103 @@ int libfsapfs_volume_get_root_directory(
 			 "%s: unable to determine file system B-tree.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_identifier(
-	          internal_volume->file_system_btree,
-	          internal_volume->file_io_handle,
-	          2,
-	          &inode,
-	          error );
+	if( result == 1 )
+	{
+		if( libfsapfs_file_system_btree_get_partition_identifiers(
+		     internal_volume->file_system_btree,
+		     internal_volume->file_io_handle,
+		     partition_identifiers,
+		     maximum_number_of_partitions,
+		     number_of_partitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition identifiers from file system B-tree.",
+			 function );
 
-	if( result != 1 )
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root directory inode from file system B-tree.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO return 0 if no root directory inode */
+#endif
+	return( result );
+}
+
+/* Retrieves the number of snapshots
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_number_of_snapshots(
+     libfsapfs_volume_t *volume,
+     int *number_of_snapshots,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_number_of_snapshots";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-	if( libfsapfs_file_entry_initialize(
-	     file_entry,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     internal_volume->encryption_context,
-	     internal_volume->file_system_btree,
-	     inode,
-	     NULL,
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->snapshots,
+	     number_of_snapshots,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file entry.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from snapshots array.",
 		 function );
 
-		goto on_error;
+		result = -1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2986,44 +6436,29 @@ int libfsapfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
-
-on_error:
-	if( inode != NULL )
-	{
-		libfsapfs_inode_free(
-		 &inode,
-		 NULL );
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves the file entry for an UTF-8 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves a specific of snapshot
+ * The snapshot reference must be freed after use with libfsapfs_snapshot_free
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_file_entry_by_utf8_path(
+int libfsapfs_volume_get_snapshot_by_index(
      libfsapfs_volume_t *volume,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libfsapfs_file_entry_t **file_entry,
+     int snapshot_index,
+     libfsapfs_snapshot_t **snapshot,
      libcerror_error_t **error )
 {
-	libfsapfs_directory_record_t *directory_record = NULL;
-	libfsapfs_inode_t *inode                       = NULL;
-	libfsapfs_internal_volume_t *internal_volume   = NULL;
-	static char *function                          = "libfsapfs_volume_get_file_entry_by_utf8_path";
-	int result                                     = 0;
+	libfsapfs_internal_volume_t *internal_volume     = NULL;
+	libfsapfs_snapshot_metadata_t *snapshot_metadata = NULL;
+	static char *function                            = "libfsapfs_volume_get_snapshot_by_index";
+	off64_t file_offset                              = 0;
 
 	if( volume == NULL )
 	{
@@ -3038,30 +6473,30 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( file_entry == NULL )
+	if( snapshot == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid snapshot.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( *snapshot != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 "%s: invalid snapshot value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3069,75 +6504,76 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->file_system_btree == NULL )
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume->snapshots,
+	     snapshot_index,
+	     (intptr_t **) &snapshot_metadata,
+	     error ) != 1 )
 	{
-		if( libfsapfs_internal_volume_get_file_system_btree(
-		     internal_volume,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file system B-tree.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve snapshot metadata: %d.",
+		 function,
+		 snapshot_index );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_utf8_path(
-	          internal_volume->file_system_btree,
-	          internal_volume->file_io_handle,
-	          2,
-	          utf8_string,
-	          utf8_string_length,
-	          &inode,
-	          &directory_record,
-	          error );
+	if( snapshot_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid snapshot metadata: %d.",
+		 function,
+		 snapshot_index );
 
-	if( result == -1 )
+		goto on_error;
+	}
+	if( libfsapfs_snapshot_initialize(
+	     snapshot,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     snapshot_metadata,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode from file system B-tree.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create snapshot.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	file_offset = (off64_t) ( snapshot_metadata->volume_superblock_block_number * internal_volume->io_handle->block_size );
+
+	if( libfsapfs_internal_snapshot_open_read(
+	     (libfsapfs_internal_snapshot_t *) *snapshot,
+	     internal_volume->file_io_handle,
+	     file_offset,
+	     error ) != 1 )
 	{
-		if( libfsapfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->encryption_context,
-		     internal_volume->file_system_btree,
-		     inode,
-		     directory_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open snapshot: %d.",
+		 function,
+		 snapshot_index );
 
-			goto on_error;
-		}
-		inode            = NULL;
-		directory_record = NULL;
+		goto on_error;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3145,58 +6581,45 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 
 on_error:
-	if( *file_entry != NULL )
-	{
-		libfsapfs_file_entry_free(
-		 file_entry,
-		 NULL );
-	}
-	if( directory_record != NULL )
-	{
-		libfsapfs_directory_record_free(
-		 &directory_record,
-		 NULL );
-	}
-	if( inode != NULL )
+	if( *snapshot != NULL )
 	{
-		libfsapfs_inode_free(
-		 &inode,
+		libfsapfs_snapshot_free(
+		 snapshot,
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_volume->read_write_lock,
 	 NULL );
 #endif
 	return( -1 );
 }
 
-/* Retrieves the file entry for an UTF-16 encoded path
- * Returns 1 if successful, 0 if no such file entry or -1 on error
+/* Retrieves the amount of memory used by the caches of the volume
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_file_entry_by_utf16_path(
-     libfsapfs_volume_t *volume,
-     const uint16_t *utf16_string,
-     size_t utf16_string_length,
-     libfsapfs_file_entry_t **file_entry,
+int libfsapfs_internal_volume_get_memory_usage(
+     libfsapfs_internal_volume_t *internal_volume,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
      libcerror_error_t **error )
 {
-	libfsapfs_directory_record_t *directory_record = NULL;
-	libfsapfs_inode_t *inode                       = NULL;
-	libfsapfs_internal_volume_t *internal_volume   = NULL;
-	static char *function                          = "libfsapfs_volume_get_file_entry_by_utf16_path";
-	int result                                     = 0;
+	static char *function                       = "libfsapfs_internal_volume_get_memory_usage";
+	size64_t safe_data_block_cache_memory_usage = 0;
+	size64_t safe_node_cache_memory_usage       = 0;
+	size64_t tree_data_block_cache_memory_usage = 0;
+	size64_t tree_node_cache_memory_usage       = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3207,160 +6630,129 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
-
-	if( file_entry == NULL )
+	if( node_cache_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file entry.",
+		 "%s: invalid node cache memory usage.",
 		 function );
 
 		return( -1 );
 	}
-	if( *file_entry != NULL )
+	if( data_block_cache_memory_usage == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block cache memory usage.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->file_system_btree != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
+		if( libfsapfs_file_system_btree_get_memory_usage(
+		     internal_volume->file_system_btree,
+		     &tree_node_cache_memory_usage,
+		     &tree_data_block_cache_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file system B-tree memory usage.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		safe_node_cache_memory_usage       += tree_node_cache_memory_usage;
+		safe_data_block_cache_memory_usage += tree_data_block_cache_memory_usage;
 	}
-#endif
-	if( internal_volume->file_system_btree == NULL )
+	if( internal_volume->file_extent_tree != NULL )
 	{
-		if( libfsapfs_internal_volume_get_file_system_btree(
-		     internal_volume,
+		if( libfsapfs_file_extent_tree_get_memory_usage(
+		     internal_volume->file_extent_tree,
+		     &tree_node_cache_memory_usage,
+		     &tree_data_block_cache_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extent tree memory usage.",
+			 function );
+
+			return( -1 );
+		}
+		safe_node_cache_memory_usage       += tree_node_cache_memory_usage;
+		safe_data_block_cache_memory_usage += tree_data_block_cache_memory_usage;
+	}
+	if( internal_volume->snapshot_metadata_tree != NULL )
+	{
+		if( libfsapfs_snapshot_metadata_tree_get_memory_usage(
+		     internal_volume->snapshot_metadata_tree,
+		     &tree_node_cache_memory_usage,
+		     &tree_data_block_cache_memory_usage,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file system B-tree.",
+			 "%s: unable to retrieve snapshot metadata tree memory usage.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		safe_node_cache_memory_usage       += tree_node_cache_memory_usage;
+		safe_data_block_cache_memory_usage += tree_data_block_cache_memory_usage;
 	}
-	result = libfsapfs_file_system_btree_get_inode_by_utf16_path(
-	          internal_volume->file_system_btree,
-	          internal_volume->file_io_handle,
-	          2,
-	          utf16_string,
-	          utf16_string_length,
-	          &inode,
-	          &directory_record,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode from file system B-tree.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
+	if( internal_volume->object_map_btree != NULL )
 	{
-		if( libfsapfs_file_entry_initialize(
-		     file_entry,
-		     internal_volume->io_handle,
-		     internal_volume->file_io_handle,
-		     internal_volume->encryption_context,
-		     internal_volume->file_system_btree,
-		     inode,
-		     directory_record,
+		if( libfsapfs_object_map_btree_get_memory_usage(
+		     internal_volume->object_map_btree,
+		     &tree_node_cache_memory_usage,
+		     &tree_data_block_cache_memory_usage,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create file entry.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve object map B-tree memory usage.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		inode            = NULL;
-		directory_record = NULL;
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
+		safe_node_cache_memory_usage       += tree_node_cache_memory_usage;
+		safe_data_block_cache_memory_usage += tree_data_block_cache_memory_usage;
 	}
-#endif
-	return( result );
+	*node_cache_memory_usage       = safe_node_cache_memory_usage;
+	*data_block_cache_memory_usage = safe_data_block_cache_memory_usage;
 
-on_error:
-	if( *file_entry != NULL )
-	{
-		libfsapfs_file_entry_free(
-		 file_entry,
-		 NULL );
-	}
-	if( directory_record != NULL )
-	{
-		libfsapfs_directory_record_free(
-		 &directory_record,
-		 NULL );
-	}
-	if( inode != NULL )
-	{
-		libfsapfs_inode_free(
-		 &inode,
-		 NULL );
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
-	 internal_volume->read_write_lock,
-	 NULL );
-#endif
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the number of snapshots
+/* Retrieves the amount of memory used by the volume
+ * The memory usage type specifies the subsystem, where LIBFSAPFS_MEMORY_USAGE_TYPE_ALL
+ * retrieves the sum of all subsystems
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_number_of_snapshots(
+int libfsapfs_volume_get_memory_usage(
      libfsapfs_volume_t *volume,
-     int *number_of_snapshots,
+     int memory_usage_type,
+     size64_t *memory_usage,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_number_of_snapshots";
+	static char *function                        = "libfsapfs_volume_get_memory_usage";
+	size64_t data_block_cache_memory_usage       = 0;
+	size64_t node_cache_memory_usage             = 0;
 	int result                                   = 1;
 
 	if( volume == NULL )
@@ -3376,6 +6768,30 @@ int libfsapfs_volume_get_number_of_snapshots(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
+	if( ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_ALL )
+	 && ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_BTREE_NODES )
+	 && ( memory_usage_type != LIBFSAPFS_MEMORY_USAGE_TYPE_DATA_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory usage type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
@@ -3391,16 +6807,17 @@ int libfsapfs_volume_get_number_of_snapshots(
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_number_of_entries(
-	     internal_volume->snapshots,
-	     number_of_snapshots,
+	if( libfsapfs_internal_volume_get_memory_usage(
+	     internal_volume,
+	     &node_cache_memory_usage,
+	     &data_block_cache_memory_usage,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from snapshots array.",
+		 "%s: unable to retrieve memory usage.",
 		 function );
 
 		result = -1;
@@ -3420,23 +6837,42 @@ int libfsapfs_volume_get_number_of_snapshots(
 		return( -1 );
 	}
 #endif
+	if( result == 1 )
+	{
+		switch( memory_usage_type )
+		{
+			case LIBFSAPFS_MEMORY_USAGE_TYPE_BTREE_NODES:
+				*memory_usage = node_cache_memory_usage;
+				break;
+
+			case LIBFSAPFS_MEMORY_USAGE_TYPE_DATA_BLOCKS:
+				*memory_usage = data_block_cache_memory_usage;
+				break;
+
+			default:
+				*memory_usage = node_cache_memory_usage + data_block_cache_memory_usage;
+				break;
+		}
+	}
 	return( result );
 }
 
-/* Retrieves a specific of snapshot
- * The snapshot reference must be freed after use with libfsapfs_snapshot_free
+/* Trims the caches of the volume until the memory used is less than or equal to the target memory usage
+ * The caches are trimmed progressively, first the data block caches, then the B-tree leaf nodes,
+ * then the B-tree branch nodes and finally the B-tree root nodes
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_snapshot_by_index(
+int libfsapfs_volume_trim_caches(
      libfsapfs_volume_t *volume,
-     int snapshot_index,
-     libfsapfs_snapshot_t **snapshot,
+     size64_t target_memory_usage,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume     = NULL;
-	libfsapfs_snapshot_metadata_t *snapshot_metadata = NULL;
-	static char *function                            = "libfsapfs_volume_get_snapshot_by_index";
-	off64_t file_offset                              = 0;
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_trim_caches";
+	size64_t data_block_cache_memory_usage       = 0;
+	size64_t memory_usage                        = 0;
+	size64_t node_cache_memory_usage             = 0;
+	int trim_level                               = 0;
 
 	if( volume == NULL )
 	{
@@ -3451,30 +6887,8 @@ int libfsapfs_volume_get_snapshot_by_index(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( snapshot == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid snapshot.",
-		 function );
-
-		return( -1 );
-	}
-	if( *snapshot != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid snapshot value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3482,76 +6896,120 @@ int libfsapfs_volume_get_snapshot_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_volume->snapshots,
-	     snapshot_index,
-	     (intptr_t **) &snapshot_metadata,
+	if( libfsapfs_internal_volume_get_memory_usage(
+	     internal_volume,
+	     &node_cache_memory_usage,
+	     &data_block_cache_memory_usage,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve snapshot metadata: %d.",
-		 function,
-		 snapshot_index );
-
-		return( -1 );
-	}
-	if( snapshot_metadata == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid snapshot metadata: %d.",
-		 function,
-		 snapshot_index );
-
-		goto on_error;
-	}
-	if( libfsapfs_snapshot_initialize(
-	     snapshot,
-	     internal_volume->io_handle,
-	     internal_volume->file_io_handle,
-	     snapshot_metadata,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create snapshot.",
+		 "%s: unable to retrieve memory usage.",
 		 function );
 
 		goto on_error;
 	}
-	file_offset = (off64_t) ( snapshot_metadata->volume_superblock_block_number * internal_volume->io_handle->block_size );
+	memory_usage = node_cache_memory_usage + data_block_cache_memory_usage;
 
-	if( libfsapfs_internal_snapshot_open_read(
-	     (libfsapfs_internal_snapshot_t *) *snapshot,
-	     internal_volume->file_io_handle,
-	     file_offset,
-	     error ) != 1 )
+	for( trim_level = LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS;
+	     trim_level < LIBFSAPFS_NUMBER_OF_CACHE_TRIM_LEVELS;
+	     trim_level++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open snapshot: %d.",
-		 function,
-		 snapshot_index );
+		if( memory_usage <= target_memory_usage )
+		{
+			break;
+		}
+		if( ( internal_volume->file_system_btree != NULL )
+		 && ( memory_usage > target_memory_usage ) )
+		{
+			if( libfsapfs_file_system_btree_trim_caches(
+			     internal_volume->file_system_btree,
+			     trim_level,
+			     target_memory_usage,
+			     &memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to trim file system B-tree caches.",
+				 function );
 
-		goto on_error;
+				goto on_error;
+			}
+		}
+		if( ( internal_volume->file_extent_tree != NULL )
+		 && ( memory_usage > target_memory_usage ) )
+		{
+			if( libfsapfs_file_extent_tree_trim_caches(
+			     internal_volume->file_extent_tree,
+			     trim_level,
+			     target_memory_usage,
+			     &memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to trim file extent tree caches.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( internal_volume->snapshot_metadata_tree != NULL )
+		 && ( memory_usage > target_memory_usage ) )
+		{
+			if( libfsapfs_snapshot_metadata_tree_trim_caches(
+			     internal_volume->snapshot_metadata_tree,
+			     trim_level,
+			     target_memory_usage,
+			     &memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to trim snapshot metadata tree caches.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( internal_volume->object_map_btree != NULL )
+		 && ( memory_usage > target_memory_usage ) )
+		{
+			if( libfsapfs_object_map_btree_trim_caches(
+			     internal_volume->object_map_btree,
+			     trim_level,
+			     target_memory_usage,
+			     &memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to trim object map B-tree caches.",
+				 function );
+
+				goto on_error;
+			}
+		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3559,7 +7017,7 @@ int libfsapfs_volume_get_snapshot_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -3568,14 +7026,8 @@ int libfsapfs_volume_get_snapshot_by_index(
 	return( 1 );
 
 on_error:
-	if( *snapshot != NULL )
-	{
-		libfsapfs_snapshot_free(
-		 snapshot,
-		 NULL );
-	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_read(
+	libcthreads_read_write_lock_release_for_write(
 	 internal_volume->read_write_lock,
 	 NULL );
 #endif
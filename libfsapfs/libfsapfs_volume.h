@@ -29,6 +29,7 @@
 #include "libfsapfs_container_key_bag.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_extern.h"
+#include "libfsapfs_file_extent_tree.h"
 #include "libfsapfs_file_system_btree.h"
 #include "libfsapfs_file_system_data_handle.h"
 #include "libfsapfs_io_handle.h"
@@ -47,6 +48,74 @@
 extern "C" {
 #endif
 
+/* The data handles, data block vectors and snapshots are not modified after
+ * the volume is opened. The data block vectors are only read through the
+ * B-trees, each of which uses its own caches and read/write lock, so the
+ * read/write lock of the shared state only needs to protect the reference count
+ */
+typedef struct libfsapfs_volume_shared_state libfsapfs_volume_shared_state_t;
+
+struct libfsapfs_volume_shared_state
+{
+	/* The volume superblock
+	 */
+	libfsapfs_volume_superblock_t *superblock;
+
+	/* The container data handle
+	 */
+	libfsapfs_container_data_handle_t *container_data_handle;
+
+	/* The container data block vector
+	 */
+	libfdata_vector_t *container_data_block_vector;
+
+	/* The object map B-tree
+	 */
+	libfsapfs_object_map_btree_t *object_map_btree;
+
+	/* The snapshot metadata tree
+	 */
+	libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree;
+
+	/* The snapshot
+	 */
+	libcdata_array_t *snapshots;
+
+	/* The volume key bag
+	 */
+	libfsapfs_volume_key_bag_t *key_bag;
+
+	/* The encryption context
+	 */
+	libfsapfs_encryption_context_t *encryption_context;
+
+	/* The file system data handle
+	 */
+	libfsapfs_file_system_data_handle_t *file_system_data_handle;
+
+	/* The file system data block vector
+	 */
+	libfdata_vector_t *file_system_data_block_vector;
+
+	/* The file extent tree
+	 */
+	libfsapfs_file_extent_tree_t *file_extent_tree;
+
+	/* The file system B-tree
+	 */
+	libfsapfs_file_system_btree_t *file_system_btree;
+
+	/* The number of volumes that reference the shared state
+	 */
+	int reference_count;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
 typedef struct libfsapfs_internal_volume libfsapfs_internal_volume_t;
 
 struct libfsapfs_internal_volume
@@ -95,6 +164,10 @@ struct libfsapfs_internal_volume
 	 */
 	libfdata_vector_t *file_system_data_block_vector;
 
+	/* The file extent tree
+	 */
+	libfsapfs_file_extent_tree_t *file_extent_tree;
+
 	/* The file system B-tree
 	 */
 	libfsapfs_file_system_btree_t *file_system_btree;
@@ -107,6 +180,26 @@ struct libfsapfs_internal_volume
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+	/* Value to indicate if the file IO handle was opened inside the library
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The file IO pool
+	 */
+	libbfio_pool_t *file_io_pool;
+
+	/* The file IO pool entry used for the next file entry
+	 */
+	int file_io_pool_entry;
+
+	/* The metadata shared with clones of the volume
+	 */
+	libfsapfs_volume_shared_state_t *shared_state;
+
 	/* Value to indicate if the volume is locked
 	 */
 	uint8_t is_locked;
@@ -154,6 +247,28 @@ int libfsapfs_volume_free(
      libfsapfs_volume_t **volume,
      libcerror_error_t **error );
 
+int libfsapfs_volume_shared_state_initialize(
+     libfsapfs_volume_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_volume_shared_state_free(
+     libfsapfs_volume_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_volume_shared_state_grab_reference(
+     libfsapfs_volume_shared_state_t *shared_state,
+     libcerror_error_t **error );
+
+int libfsapfs_volume_shared_state_release_reference(
+     libfsapfs_volume_shared_state_t **shared_state,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_clone(
+     libfsapfs_volume_t **destination_volume,
+     libfsapfs_volume_t *source_volume,
+     libcerror_error_t **error );
+
 int libfsapfs_internal_volume_open_read(
      libfsapfs_internal_volume_t *internal_volume,
      libbfio_handle_t *file_io_handle,
@@ -255,6 +370,12 @@ int libfsapfs_internal_volume_get_file_system_btree(
      libfsapfs_internal_volume_t *internal_volume,
      libcerror_error_t **error );
 
+int libfsapfs_internal_volume_get_file_entry_file_io_handle(
+     libfsapfs_internal_volume_t *internal_volume,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_pool_entry,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_volume_get_file_entry_by_identifier(
      libfsapfs_volume_t *volume,
@@ -262,6 +383,14 @@ int libfsapfs_volume_get_file_entry_by_identifier(
      libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_file_entry_by_file_reference(
+     libfsapfs_volume_t *volume,
+     const uint8_t *file_reference,
+     size_t file_reference_size,
+     libfsapfs_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_volume_get_root_directory(
      libfsapfs_volume_t *volume,
@@ -284,6 +413,97 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
      libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_read_file_entries_data(
+     libfsapfs_volume_t *volume,
+     libfsapfs_file_entry_t **file_entries,
+     int number_of_file_entries,
+     int (*callback_function)(
+            libfsapfs_file_entry_t *file_entry,
+            int file_entry_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size,
+            intptr_t *callback_data,
+            libcerror_error_t **error ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_disk_usage(
+     libfsapfs_volume_t *volume,
+     int number_of_threads,
+     libfsapfs_disk_usage_t **disk_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_verify_seal(
+     libfsapfs_volume_t *volume,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_metadata_index(
+     libfsapfs_volume_t *volume,
+     libfsapfs_metadata_index_t **metadata_index,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_search_by_utf8_name_pattern(
+     libfsapfs_volume_t *volume,
+     const uint8_t *utf8_pattern,
+     size_t utf8_pattern_length,
+     libfsapfs_name_search_t **name_search,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_volume_get_extended_attribute_sweep(
+     libfsapfs_internal_volume_t *internal_volume,
+     uint64_t directory_identifier,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_extended_attribute_sweep(
+     libfsapfs_volume_t *volume,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_extended_attribute_sweep_by_directory_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t directory_identifier,
+     libfsapfs_extended_attribute_sweep_t **extended_attribute_sweep,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_cursor(
+     libfsapfs_volume_t *volume,
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_cursor_by_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t identifier,
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_cursor_from_byte_stream(
+     libfsapfs_volume_t *volume,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libfsapfs_cursor_t **cursor,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_partition_file_system_tree(
+     libfsapfs_volume_t *volume,
+     uint64_t *partition_identifiers,
+     int maximum_number_of_partitions,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_volume_get_number_of_snapshots(
      libfsapfs_volume_t *volume,
@@ -297,6 +517,25 @@ int libfsapfs_volume_get_snapshot_by_index(
      libfsapfs_snapshot_t **snapshot,
      libcerror_error_t **error );
 
+int libfsapfs_internal_volume_get_memory_usage(
+     libfsapfs_internal_volume_t *internal_volume,
+     size64_t *node_cache_memory_usage,
+     size64_t *data_block_cache_memory_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_memory_usage(
+     libfsapfs_volume_t *volume,
+     int memory_usage_type,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_trim_caches(
+     libfsapfs_volume_t *volume,
+     size64_t target_memory_usage,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -343,6 +343,10 @@ int libfsapfs_volume_superblock_read_data(
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_volume_superblock_t *) data )->object_transaction_identifier,
+	 volume_superblock->transaction_identifier );
+
 	byte_stream_copy_to_uint64_little_endian(
 	 ( (fsapfs_volume_superblock_t *) data )->incompatible_features_flags,
 	 volume_superblock->incompatibility_features_flags );
@@ -401,6 +405,14 @@ int libfsapfs_volume_superblock_read_data(
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_volume_superblock_t *) data )->integrity_metadata_object_identifier,
+	 volume_superblock->integrity_metadata_object_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (fsapfs_volume_superblock_t *) data )->file_extent_tree_block_number,
+	 volume_superblock->file_extent_tree_block_number );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1080,6 +1092,51 @@ int libfsapfs_volume_superblock_read_data(
 		 ( (fsapfs_volume_superblock_t *) data )->unknown62,
 		 32,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "%s: volume group identifier:\n",
+		 function );
+		libcnotify_print_data(
+		 ( (fsapfs_volume_superblock_t *) data )->volume_group_identifier,
+		 16,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "%s: integrity metadata object identifier\t: %" PRIu64 "\n",
+		 function,
+		 volume_superblock->integrity_metadata_object_identifier );
+
+		libcnotify_printf(
+		 "%s: file extent tree block number\t\t: %" PRIu64 "\n",
+		 function,
+		 volume_superblock->file_extent_tree_block_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_volume_superblock_t *) data )->file_extent_tree_object_type,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: file extent tree object type\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_volume_superblock_t *) data )->unknown63,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: unknown63\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_volume_superblock_t *) data )->unknown64,
+		 value_64bit );
+		libcnotify_printf(
+		 "%s: unknown64\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 value_64bit );
+
+		libcnotify_printf(
+		 "\n" );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -1115,6 +1172,35 @@ int libfsapfs_volume_superblock_read_data(
 	return( 1 );
 }
 
+/* Determines if the volume is sealed
+ * A sealed volume stores its file extents in a separate file extent tree
+ * and its file system tree is protected by integrity metadata
+ * Returns 1 if sealed, 0 if not or -1 on error
+ */
+int libfsapfs_volume_superblock_is_sealed(
+     libfsapfs_volume_superblock_t *volume_superblock,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_volume_superblock_is_sealed";
+
+	if( volume_superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_superblock->incompatibility_features_flags & 0x0000000000000020 ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
 /* Retrieves the volume identifier
  * The identifier is an UUID stored in big-endian and is 16 bytes of size
  * Returns 1 if successful or -1 on error
@@ -36,6 +36,10 @@ typedef struct libfsapfs_volume_superblock libfsapfs_volume_superblock_t;
 
 struct libfsapfs_volume_superblock
 {
+	/* The object transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
 	/* The incompatibility features flags
 	 */
 	uint64_t incompatibility_features_flags;
@@ -71,6 +75,14 @@ struct libfsapfs_volume_superblock
 	/* The volume name
 	 */
 	uint8_t volume_name[ 256 ];
+
+	/* The integrity metadata object identifier
+	 */
+	uint64_t integrity_metadata_object_identifier;
+
+	/* The file extent tree block number
+	 */
+	uint64_t file_extent_tree_block_number;
 };
 
 int libfsapfs_volume_superblock_initialize(
@@ -93,6 +105,10 @@ int libfsapfs_volume_superblock_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_volume_superblock_is_sealed(
+     libfsapfs_volume_superblock_t *volume_superblock,
+     libcerror_error_t **error );
+
 int libfsapfs_volume_superblock_get_volume_identifier(
      libfsapfs_volume_superblock_t *volume_superblock,
      uint8_t *uuid_data,
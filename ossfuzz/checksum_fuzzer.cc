@@ -0,0 +1,177 @@
+/*
+ * OSS-Fuzz target for libfsapfs checksum functions
+ * The checksums are compared against reference implementations
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libfsapfs.h"
+
+#include "../libfsapfs/libfsapfs_checksum.h"
+
+/* Calculates the CRC-32C of a buffer one bit at a time
+ */
+uint32_t checksum_fuzzer_calculate_reference_crc32(
+          const uint8_t *buffer,
+          size_t size,
+          uint32_t initial_value )
+{
+	size_t buffer_offset = 0;
+	uint32_t checksum    = 0;
+	uint8_t bit_iterator = 0;
+
+	checksum = initial_value;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset++ )
+	{
+		checksum ^= buffer[ buffer_offset ];
+
+		for( bit_iterator = 0;
+		     bit_iterator < 8;
+		     bit_iterator++ )
+		{
+			if( ( checksum & 1 ) != 0 )
+			{
+				checksum = 0x82f63b78UL ^ ( checksum >> 1 );
+			}
+			else
+			{
+				checksum = checksum >> 1;
+			}
+		}
+	}
+	return( checksum );
+}
+
+/* Calculates the Fletcher-64 of a buffer reducing the sums after every value
+ */
+uint64_t checksum_fuzzer_calculate_reference_fletcher64(
+          const uint8_t *buffer,
+          size_t size )
+{
+	size_t buffer_offset = 0;
+	uint64_t lower_32bit = 0;
+	uint64_t upper_32bit = 0;
+	uint64_t value_32bit = 0;
+
+	for( buffer_offset = 0;
+	     buffer_offset < size;
+	     buffer_offset += 4 )
+	{
+		value_32bit = (uint64_t) buffer[ buffer_offset ]
+		            | ( (uint64_t) buffer[ buffer_offset + 1 ] << 8 )
+		            | ( (uint64_t) buffer[ buffer_offset + 2 ] << 16 )
+		            | ( (uint64_t) buffer[ buffer_offset + 3 ] << 24 );
+
+		lower_32bit = ( lower_32bit + value_32bit ) % 0xffffffffUL;
+		upper_32bit = ( upper_32bit + lower_32bit ) % 0xffffffffUL;
+	}
+	value_32bit = 0xffffffffUL - ( ( lower_32bit + upper_32bit ) % 0xffffffffUL );
+	upper_32bit = 0xffffffffUL - ( ( lower_32bit + value_32bit ) % 0xffffffffUL );
+
+	return( ( upper_32bit << 32 ) | value_32bit );
+}
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	uint64_t fletcher64_checksum = 0;
+	uint32_t crc32_checksum      = 0;
+	size_t split_offset          = 0;
+
+	/* The Fletcher-64 implementation reduces its sums only once, which
+	 * cannot overflow for the sizes of the objects it is used for
+	 */
+	if( size > 65536 )
+	{
+		return( 0 );
+	}
+	if( libfsapfs_checksum_calculate_weak_crc32(
+	     &crc32_checksum,
+	     data,
+	     size,
+	     0,
+	     NULL ) == 1 )
+	{
+		if( crc32_checksum != checksum_fuzzer_calculate_reference_crc32(
+		                       data,
+		                       size,
+		                       0 ) )
+		{
+			abort();
+		}
+	}
+	/* Calculating the CRC-32 in two parts should give the same result
+	 */
+	split_offset = size / 2;
+
+	if( libfsapfs_checksum_calculate_weak_crc32(
+	     &crc32_checksum,
+	     data,
+	     split_offset,
+	     0xffffffffUL,
+	     NULL ) == 1 )
+	{
+		if( libfsapfs_checksum_calculate_weak_crc32(
+		     &crc32_checksum,
+		     &( data[ split_offset ] ),
+		     size - split_offset,
+		     crc32_checksum,
+		     NULL ) == 1 )
+		{
+			if( crc32_checksum != checksum_fuzzer_calculate_reference_crc32(
+			                       data,
+			                       size,
+			                       0xffffffffUL ) )
+			{
+				abort();
+			}
+		}
+	}
+	size -= size % 4;
+
+	if( libfsapfs_checksum_calculate_fletcher64(
+	     &fletcher64_checksum,
+	     data,
+	     size,
+	     0,
+	     NULL ) == 1 )
+	{
+		if( fletcher64_checksum != checksum_fuzzer_calculate_reference_fletcher64(
+		                            data,
+		                            size ) )
+		{
+			abort();
+		}
+	}
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,115 @@
+/*
+ * OSS-Fuzz target for libfsapfs DEFLATE decompression
+ * The output is compared against zlib if available
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libfsapfs.h"
+#include "ossfuzz_throughput.h"
+
+#if defined( HAVE_ZLIB ) || defined( ZLIB_DLL )
+#include <zlib.h>
+#endif
+
+#include "../libfsapfs/libfsapfs_deflate.h"
+
+/* The size of a compression unit
+ */
+uint8_t deflate_fuzzer_uncompressed_data[ 65536 ];
+
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
+uint8_t deflate_fuzzer_zlib_uncompressed_data[ 65536 ];
+#endif
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
+	uLongf zlib_uncompressed_data_size = 65536;
+	int zlib_result                    = 0;
+#endif
+	size_t uncompressed_data_size      = 65536;
+	clock_t start_time                 = 0;
+	int result                         = 0;
+
+	start_time = clock();
+
+	result = libfsapfs_deflate_decompress_zlib(
+	          data,
+	          size,
+	          deflate_fuzzer_uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL );
+
+	ossfuzz_throughput_check(
+	 start_time,
+	 size + 65536 );
+
+	if( ( result == 1 )
+	 && ( uncompressed_data_size > 65536 ) )
+	{
+		abort();
+	}
+#if ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL )
+	if( size > (size_t) ULONG_MAX )
+	{
+		return( 0 );
+	}
+	zlib_result = uncompress(
+	               (Bytef *) deflate_fuzzer_zlib_uncompressed_data,
+	               &zlib_uncompressed_data_size,
+	               (Bytef *) data,
+	               (uLong) size );
+
+	/* Only compare the output if both implementations consider the input valid
+	 */
+	if( ( result == 1 )
+	 && ( zlib_result == Z_OK ) )
+	{
+		if( uncompressed_data_size != (size_t) zlib_uncompressed_data_size )
+		{
+			abort();
+		}
+		if( memcmp(
+		     deflate_fuzzer_uncompressed_data,
+		     deflate_fuzzer_zlib_uncompressed_data,
+		     uncompressed_data_size ) != 0 )
+		{
+			abort();
+		}
+	}
+#endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) */
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
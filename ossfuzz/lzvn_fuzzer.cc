@@ -0,0 +1,111 @@
+/*
+ * OSS-Fuzz target for libfsapfs LZVN decompression
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libfsapfs.h"
+#include "ossfuzz_throughput.h"
+
+#include "../libfsapfs/libfsapfs_lzvn.h"
+
+/* The size of a compression unit
+ */
+uint8_t lzvn_fuzzer_uncompressed_data[ 65536 ];
+
+uint8_t lzvn_fuzzer_verification_data[ 65536 ];
+
+/* The maximum number of uncompressed bytes per compressed byte
+ * A 1-byte small match oppcode produces at most 15 bytes and
+ * a 2-byte large match oppcode at most 271 bytes
+ */
+#define LZVN_FUZZER_MAXIMUM_EXPANSION_RATIO	136
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	size_t uncompressed_data_size  = 65536;
+	size_t verification_data_size  = 0;
+	clock_t start_time             = 0;
+	int result                     = 0;
+
+	start_time = clock();
+
+	result = libfsapfs_lzvn_decompress(
+	          data,
+	          size,
+	          lzvn_fuzzer_uncompressed_data,
+	          &uncompressed_data_size,
+	          NULL );
+
+	ossfuzz_throughput_check(
+	 start_time,
+	 size + 65536 );
+
+	if( result != 1 )
+	{
+		return( 0 );
+	}
+	if( ( uncompressed_data_size > 65536 )
+	 || ( uncompressed_data_size > ( size * LZVN_FUZZER_MAXIMUM_EXPANSION_RATIO ) ) )
+	{
+		abort();
+	}
+	/* Decompressing into a buffer of exactly the uncompressed data size
+	 * must succeed and produce the same data
+	 */
+	verification_data_size = uncompressed_data_size;
+
+	result = libfsapfs_lzvn_decompress(
+	          data,
+	          size,
+	          lzvn_fuzzer_verification_data,
+	          &verification_data_size,
+	          NULL );
+
+	if( result != 1 )
+	{
+		abort();
+	}
+	if( verification_data_size != uncompressed_data_size )
+	{
+		abort();
+	}
+	if( memcmp(
+	     lzvn_fuzzer_uncompressed_data,
+	     lzvn_fuzzer_verification_data,
+	     uncompressed_data_size ) != 0 )
+	{
+		abort();
+	}
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,161 @@
+/*
+ * OSS-Fuzz target for libfsapfs name comparison and hashing
+ * The UTF-8 and UTF-16 implementations are compared against each other
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_libfsapfs.h"
+
+#include "../libfsapfs/libfsapfs_libuna.h"
+#include "../libfsapfs/libfsapfs_name.h"
+#include "../libfsapfs/libfsapfs_name_hash.h"
+
+libuna_utf16_character_t name_fuzzer_utf16_string[ 1024 ];
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	const uint8_t *name        = NULL;
+	const uint8_t *utf8_string = NULL;
+	size_t name_size           = 0;
+	size_t string_index        = 0;
+	size_t utf16_string_size   = 0;
+	size_t utf8_string_length  = 0;
+	uint32_t utf16_name_hash   = 0;
+	uint32_t utf8_name_hash    = 0;
+	uint8_t use_case_folding   = 0;
+	int utf16_result           = 0;
+	int utf8_result            = 0;
+
+	if( size < 2 )
+	{
+		return( 0 );
+	}
+	/* The first byte controls case folding and the remainder is split
+	 * into the name and the string to compare with
+	 */
+	use_case_folding = data[ 0 ] & 0x01;
+
+	name      = &( data[ 1 ] );
+	name_size = ( size - 1 ) / 2;
+
+	if( name_size == 0 )
+	{
+		return( 0 );
+	}
+	utf8_string        = &( data[ 1 + name_size ] );
+	utf8_string_length = size - 1 - name_size;
+
+	/* Embedded end-of-string characters and UTF-8 encoded surrogates are
+	 * not preserved by the conversion to UTF-16
+	 */
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		if( utf8_string[ string_index ] == 0 )
+		{
+			return( 0 );
+		}
+		if( ( utf8_string[ string_index ] == 0xed )
+		 && ( ( string_index + 1 ) < utf8_string_length )
+		 && ( utf8_string[ string_index + 1 ] >= 0xa0 ) )
+		{
+			return( 0 );
+		}
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &utf16_string_size,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size > 1024 ) )
+	{
+		return( 0 );
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     name_fuzzer_utf16_string,
+	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_length,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	utf8_result = libfsapfs_name_compare_with_utf8_string(
+	               name,
+	               name_size,
+	               utf8_string,
+	               utf8_string_length,
+	               use_case_folding,
+	               NULL );
+
+	utf16_result = libfsapfs_name_compare_with_utf16_string(
+	                name,
+	                name_size,
+	                name_fuzzer_utf16_string,
+	                utf16_string_size - 1,
+	                use_case_folding,
+	                NULL );
+
+	if( ( utf8_result != -1 )
+	 && ( utf16_result != -1 )
+	 && ( utf8_result != utf16_result ) )
+	{
+		abort();
+	}
+	utf8_result = libfsapfs_name_hash_calculate_from_utf8_string(
+	               &utf8_name_hash,
+	               utf8_string,
+	               utf8_string_length,
+	               use_case_folding,
+	               NULL );
+
+	utf16_result = libfsapfs_name_hash_calculate_from_utf16_string(
+	                &utf16_name_hash,
+	                name_fuzzer_utf16_string,
+	                utf16_string_size - 1,
+	                use_case_folding,
+	                NULL );
+
+	if( ( utf8_result == 1 )
+	 && ( utf16_result == 1 )
+	 && ( utf8_name_hash != utf16_name_hash ) )
+	{
+		abort();
+	}
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,67 @@
+/*
+ * Throughput budget functions for OSS-Fuzz targets
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OSSFUZZ_THROUGHPUT_H )
+#define _OSSFUZZ_THROUGHPUT_H
+
+#include <stdlib.h>
+#include <time.h>
+
+/* The base processor time budget of a single run in milliseconds
+ */
+#define OSSFUZZ_THROUGHPUT_BASE_MILLISECONDS		100
+
+/* The processor time budget per KiB of processed data in milliseconds
+ * This is several orders of magnitude above the expected cost of the
+ * kernels so that sanitizer overhead does not trigger false positives
+ */
+#define OSSFUZZ_THROUGHPUT_MILLISECONDS_PER_KIB		2
+
+/* Checks if the processor time used since the start time is within
+ * the budget for the number of bytes processed
+ * If OSSFUZZ_ENABLE_THROUGHPUT_CHECK is defined, which Makefile.am does for
+ * the deflate and LZVN fuzz targets, the run is aborted if the budget was
+ * exceeded so that the fuzzing engine records the input as a pathological slowdown
+ */
+static void ossfuzz_throughput_check(
+             clock_t start_time,
+             size_t number_of_bytes )
+{
+#if defined( OSSFUZZ_ENABLE_THROUGHPUT_CHECK )
+	clock_t maximum_clocks = 0;
+	clock_t used_clocks    = 0;
+
+	used_clocks = clock() - start_time;
+
+	maximum_clocks = (clock_t) ( ( OSSFUZZ_THROUGHPUT_BASE_MILLISECONDS + ( ( number_of_bytes / 1024 ) * OSSFUZZ_THROUGHPUT_MILLISECONDS_PER_KIB ) ) * ( CLOCKS_PER_SEC / 1000 ) );
+
+	if( used_clocks > maximum_clocks )
+	{
+		abort();
+	}
+#else
+	(void) start_time;
+	(void) number_of_bytes;
+#endif
+}
+
+#endif /* !defined( _OSSFUZZ_THROUGHPUT_H ) */
+
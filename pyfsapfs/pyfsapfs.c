@@ -38,6 +38,7 @@
 #include "pyfsapfs_libbfio.h"
 #include "pyfsapfs_libcerror.h"
 #include "pyfsapfs_libfsapfs.h"
+#include "pyfsapfs_metadata_index.h"
 #include "pyfsapfs_python.h"
 #include "pyfsapfs_unused.h"
 #include "pyfsapfs_volume.h"
@@ -683,6 +684,23 @@ PyMODINIT_FUNC initpyfsapfs(
 	 "file_entry",
 	 (PyObject *) &pyfsapfs_file_entry_type_object );
 
+	/* Setup the metadata_index type object
+	 */
+	pyfsapfs_metadata_index_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfsapfs_metadata_index_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfsapfs_metadata_index_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "metadata_index",
+	 (PyObject *) &pyfsapfs_metadata_index_type_object );
+
 	/* Setup the volume type object
 	 */
 	pyfsapfs_volume_type_object.tp_new = PyType_GenericNew;
@@ -111,6 +111,15 @@ PyMethodDef pyfsapfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Returns the inode change date and time as a 64-bit integer containing an APFS timestamp value." },
 
+	{ "get_timestamps",
+	  (PyCFunction) pyfsapfs_file_entry_get_timestamps,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_timestamps(as_integers=False) -> Tuple\n"
+	  "\n"
+	  "Returns the creation, modification, access, inode change and added date and time in a single tuple.\n"
+	  "The values are Datetime objects or, if as_integers is True, 64-bit integers containing APFS timestamp values.\n"
+	  "The added date and time is None if not available." },
+
 	{ "get_owner_identifier",
 	  (PyCFunction) pyfsapfs_file_entry_get_owner_identifier,
 	  METH_NOARGS,
@@ -209,6 +218,13 @@ PyMethodDef pyfsapfs_file_entry_object_methods[] = {
 	  "\n"
 	  "Reads a buffer of data at a specific offset." },
 
+	{ "read_vector",
+	  (PyCFunction) pyfsapfs_file_entry_read_vector,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "read_vector(ranges) -> List of binary strings\n"
+	  "\n"
+	  "Reads the data of multiple ranges, where ranges is a sequence of (offset, size) tuples." },
+
 	{ "seek_offset",
 	  (PyCFunction) pyfsapfs_file_entry_seek_offset,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -1201,6 +1217,142 @@ PyObject *pyfsapfs_file_entry_get_inode_change_time_as_integer(
 	return( integer_object );
 }
 
+/* Retrieves the creation, modification, access, inode change and added date and time
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_file_entry_get_timestamps(
+           pyfsapfs_file_entry_t *pyfsapfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	int64_t posix_times[ 5 ];
+
+	PyObject *as_integers_object = NULL;
+	PyObject *tuple_object       = NULL;
+	PyObject *value_object       = NULL;
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pyfsapfs_file_entry_get_timestamps";
+	static char *keyword_list[]  = { "as_integers", NULL };
+	int as_integers              = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+	if( pyfsapfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &as_integers_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( as_integers_object != NULL )
+	{
+		as_integers = PyObject_IsTrue(
+		               as_integers_object );
+
+		if( as_integers == -1 )
+		{
+			return( NULL );
+		}
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsapfs_file_entry_get_timestamps(
+	          pyfsapfs_file_entry->file_entry,
+	          &( posix_times[ 0 ] ),
+	          &( posix_times[ 1 ] ),
+	          &( posix_times[ 2 ] ),
+	          &( posix_times[ 3 ] ),
+	          &( posix_times[ 4 ] ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve timestamps.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	tuple_object = PyTuple_New(
+	                5 );
+
+	if( tuple_object == NULL )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		/* The added time is the last value
+		 */
+		if( ( value_index == 4 )
+		 && ( result == 0 ) )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		else if( as_integers != 0 )
+		{
+			value_object = pyfsapfs_integer_signed_new_from_64bit(
+			                posix_times[ value_index ] );
+		}
+		else
+		{
+			value_object = pyfsapfs_datetime_new_from_posix_time_in_micro_seconds(
+			                posix_times[ value_index ] / 1000 );
+		}
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		/* Tuple set item does not increment the reference count of the value object
+		 */
+		if( PyTuple_SetItem(
+		     tuple_object,
+		     (Py_ssize_t) value_index,
+		     value_object ) != 0 )
+		{
+			goto on_error;
+		}
+		value_object = NULL;
+	}
+	return( tuple_object );
+
+on_error:
+	if( value_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) value_object );
+	}
+	if( tuple_object != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) tuple_object );
+	}
+	return( NULL );
+}
+
 /* Retrieves the owner identifier
  * Returns a Python object if successful or NULL on error
  */
@@ -2728,6 +2880,297 @@ PyObject *pyfsapfs_file_entry_read_buffer_at_offset(
 	return( string_object );
 }
 
+/* Reads data from multiple ranges
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_file_entry_read_vector(
+           pyfsapfs_file_entry_t *pyfsapfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *list_object       = NULL;
+	PyObject *range_object      = NULL;
+	PyObject *ranges_object     = NULL;
+	PyObject *sequence_object   = NULL;
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	uint8_t **buffers           = NULL;
+	size_t *buffer_sizes        = NULL;
+	off64_t *offsets            = NULL;
+	ssize_t *read_counts        = NULL;
+	static char *function       = "pyfsapfs_file_entry_read_vector";
+	static char *keyword_list[] = { "ranges", NULL };
+	Py_ssize_t number_of_ranges = 0;
+	Py_ssize_t range_index      = 0;
+	ssize_t read_count          = 0;
+	off64_t read_offset         = 0;
+	int64_t read_size           = 0;
+
+	if( pyfsapfs_file_entry == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &ranges_object ) == 0 )
+	{
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   ranges_object,
+	                   "ranges must be a sequence of (offset, size) tuples" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_ranges = PySequence_Fast_GET_SIZE(
+	                    sequence_object );
+
+	if( number_of_ranges > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               number_of_ranges );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	if( number_of_ranges == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	buffers = (uint8_t **) PyMem_Malloc(
+	                        sizeof( uint8_t * ) * number_of_ranges );
+
+	buffer_sizes = (size_t *) PyMem_Malloc(
+	                           sizeof( size_t ) * number_of_ranges );
+
+	offsets = (off64_t *) PyMem_Malloc(
+	                       sizeof( off64_t ) * number_of_ranges );
+
+	read_counts = (ssize_t *) PyMem_Malloc(
+	                           sizeof( ssize_t ) * number_of_ranges );
+
+	if( ( buffers == NULL )
+	 || ( buffer_sizes == NULL )
+	 || ( offsets == NULL )
+	 || ( read_counts == NULL ) )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		range_object = PySequence_Fast_GET_ITEM(
+		                sequence_object,
+		                range_index );
+
+		if( PyArg_ParseTuple(
+		     range_object,
+		     "LL",
+		     &read_offset,
+		     &read_size ) == 0 )
+		{
+			goto on_error;
+		}
+		if( read_offset < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid read offset value less than zero.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_size < 0 )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid read size value less than zero.",
+			 function );
+
+			goto on_error;
+		}
+		/* Make sure the data fits into a memory buffer
+		 */
+		if( ( read_size > (int64_t) INT_MAX )
+		 || ( read_size > (int64_t) SSIZE_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid argument read size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+#if PY_MAJOR_VERSION >= 3
+		string_object = PyBytes_FromStringAndSize(
+		                 NULL,
+		                 (Py_ssize_t) read_size );
+#else
+		string_object = PyString_FromStringAndSize(
+		                 NULL,
+		                 (Py_ssize_t) read_size );
+#endif
+		if( string_object == NULL )
+		{
+			goto on_error;
+		}
+		/* The list takes over the reference of the string object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+
+#if PY_MAJOR_VERSION >= 3
+		buffers[ range_index ] = (uint8_t *) PyBytes_AsString(
+		                                      string_object );
+#else
+		buffers[ range_index ] = (uint8_t *) PyString_AsString(
+		                                      string_object );
+#endif
+		buffer_sizes[ range_index ] = (size_t) read_size;
+		offsets[ range_index ]      = read_offset;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              pyfsapfs_file_entry->file_entry,
+	              buffers,
+	              buffer_sizes,
+	              offsets,
+	              read_counts,
+	              (int) number_of_ranges,
+	              &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( read_count == -1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Need to resize the strings here in case a range was not fully read.
+	 */
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( read_counts[ range_index ] == (ssize_t) buffer_sizes[ range_index ] )
+		{
+			continue;
+		}
+		string_object = PyList_GET_ITEM(
+		                 list_object,
+		                 range_index );
+
+#if PY_MAJOR_VERSION >= 3
+		if( _PyBytes_Resize(
+		     &string_object,
+		     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#else
+		if( _PyString_Resize(
+		     &string_object,
+		     (Py_ssize_t) read_counts[ range_index ] ) != 0 )
+#endif
+		{
+			/* The string object was released by the resize function
+			 */
+			PyList_SET_ITEM(
+			 list_object,
+			 range_index,
+			 NULL );
+
+			goto on_error;
+		}
+		PyList_SET_ITEM(
+		 list_object,
+		 range_index,
+		 string_object );
+	}
+	PyMem_Free(
+	 read_counts );
+
+	PyMem_Free(
+	 offsets );
+
+	PyMem_Free(
+	 buffer_sizes );
+
+	PyMem_Free(
+	 buffers );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( read_counts != NULL )
+	{
+		PyMem_Free(
+		 read_counts );
+	}
+	if( offsets != NULL )
+	{
+		PyMem_Free(
+		 offsets );
+	}
+	if( buffer_sizes != NULL )
+	{
+		PyMem_Free(
+		 buffer_sizes );
+	}
+	if( buffers != NULL )
+	{
+		PyMem_Free(
+		 buffers );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
 /* Seeks a certain offset
  * Returns a Python object if successful or NULL on error
  */
@@ -102,6 +102,11 @@ PyObject *pyfsapfs_file_entry_get_inode_change_time_as_integer(
            pyfsapfs_file_entry_t *pyfsapfs_file_entry,
            PyObject *arguments );
 
+PyObject *pyfsapfs_file_entry_get_timestamps(
+           pyfsapfs_file_entry_t *pyfsapfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsapfs_file_entry_get_owner_identifier(
            pyfsapfs_file_entry_t *pyfsapfs_file_entry,
            PyObject *arguments );
@@ -181,6 +186,11 @@ PyObject *pyfsapfs_file_entry_read_buffer_at_offset(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsapfs_file_entry_read_vector(
+           pyfsapfs_file_entry_t *pyfsapfs_file_entry,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfsapfs_file_entry_seek_offset(
            pyfsapfs_file_entry_t *pyfsapfs_file_entry,
            PyObject *arguments,
@@ -0,0 +1,727 @@
+/*
+ * Python object wrapper of libfsapfs_extended_attribute_t
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfsapfs_error.h"
+#include "pyfsapfs_integer.h"
+#include "pyfsapfs_libcerror.h"
+#include "pyfsapfs_libfsapfs.h"
+#include "pyfsapfs_metadata_index.h"
+#include "pyfsapfs_python.h"
+#include "pyfsapfs_unused.h"
+
+PyMethodDef pyfsapfs_metadata_index_object_methods[] = {
+
+	{ "get_number_of_entries",
+	  (PyCFunction) pyfsapfs_metadata_index_get_number_of_entries,
+	  METH_NOARGS,
+	  "get_number_of_entries() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of entries." },
+
+	{ "query",
+	  (PyCFunction) pyfsapfs_metadata_index_query,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "query(time_value='modification', minimum_time=None, maximum_time=None, minimum_size=None, maximum_size=None, owner_identifier=None, group_identifier=None, extension=None) -> List of integers\n"
+	  "\n"
+	  "Retrieves the identifiers of the file entries that match all of the specified filters.\n"
+	  "The time_value is one of 'access', 'creation', 'inode_change' or 'modification' and\n"
+	  "the time values are POSIX timestamps in number of nano seconds." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyfsapfs_metadata_index_object_get_set_definitions[] = {
+
+	{ "number_of_entries",
+	  (getter) pyfsapfs_metadata_index_get_number_of_entries,
+	  (setter) 0,
+	  "The number of entries.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyfsapfs_metadata_index_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfsapfs.metadata_index",
+	/* tp_basicsize */
+	sizeof( pyfsapfs_metadata_index_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfsapfs_metadata_index_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfsapfs metadata index object (wraps libfsapfs_metadata_index_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfsapfs_metadata_index_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyfsapfs_metadata_index_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfsapfs_metadata_index_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new metadata index object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_metadata_index_new(
+           libfsapfs_metadata_index_t *metadata_index,
+           PyObject *parent_object )
+{
+	pyfsapfs_metadata_index_t *pyfsapfs_metadata_index = NULL;
+	static char *function                              = "pyfsapfs_metadata_index_new";
+
+	if( metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyfsapfs_metadata_index = PyObject_New(
+	                           struct pyfsapfs_metadata_index,
+	                           &pyfsapfs_metadata_index_type_object );
+
+	if( pyfsapfs_metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to initialize metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	pyfsapfs_metadata_index->metadata_index = metadata_index;
+	pyfsapfs_metadata_index->parent_object  = parent_object;
+
+	if( pyfsapfs_metadata_index->parent_object != NULL )
+	{
+		Py_IncRef(
+		 pyfsapfs_metadata_index->parent_object );
+	}
+	return( (PyObject *) pyfsapfs_metadata_index );
+
+on_error:
+	if( pyfsapfs_metadata_index != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyfsapfs_metadata_index );
+	}
+	return( NULL );
+}
+
+/* Intializes a metadata index object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfsapfs_metadata_index_init(
+     pyfsapfs_metadata_index_t *pyfsapfs_metadata_index )
+{
+	static char *function = "pyfsapfs_metadata_index_init";
+
+	if( pyfsapfs_metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libfsapfs metadata index is set to NULL
+	 */
+	pyfsapfs_metadata_index->metadata_index = NULL;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of metadata index not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a metadata index object
+ */
+void pyfsapfs_metadata_index_free(
+      pyfsapfs_metadata_index_t *pyfsapfs_metadata_index )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfsapfs_metadata_index_free";
+	int result                  = 0;
+
+	if( pyfsapfs_metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfsapfs_metadata_index );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfsapfs_metadata_index->metadata_index != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libfsapfs_metadata_index_free(
+		          &( pyfsapfs_metadata_index->metadata_index ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libfsapfs metadata index.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyfsapfs_metadata_index->parent_object != NULL )
+	{
+		Py_DecRef(
+		 pyfsapfs_metadata_index->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfsapfs_metadata_index );
+}
+
+
+/* Retrieves the number of entries
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_metadata_index_get_number_of_entries(
+           pyfsapfs_metadata_index_t *pyfsapfs_metadata_index,
+           PyObject *arguments PYFSAPFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfsapfs_metadata_index_get_number_of_entries";
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	PYFSAPFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsapfs_metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsapfs_metadata_index_get_number_of_entries(
+	          pyfsapfs_metadata_index->metadata_index,
+	          &number_of_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_entries );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_entries );
+#endif
+	return( integer_object );
+}
+
+/* Queries the metadata index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_metadata_index_query(
+           pyfsapfs_metadata_index_t *pyfsapfs_metadata_index,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *group_identifier_object = NULL;
+	PyObject *integer_object          = NULL;
+	PyObject *list_object             = NULL;
+	PyObject *maximum_size_object     = NULL;
+	PyObject *maximum_time_object     = NULL;
+	PyObject *minimum_size_object     = NULL;
+	PyObject *minimum_time_object     = NULL;
+	PyObject *owner_identifier_object = NULL;
+	libcerror_error_t *error          = NULL;
+	uint64_t *identifiers             = NULL;
+	char *time_value_string           = NULL;
+	char *utf8_extension              = NULL;
+	static char *function             = "pyfsapfs_metadata_index_query";
+	static char *keyword_list[]       = { "time_value", "minimum_time", "maximum_time", "minimum_size", "maximum_size", "owner_identifier", "group_identifier", "extension", NULL };
+	size_t utf8_extension_length      = 0;
+	int64_t maximum_posix_time        = (int64_t) INT64_MAX;
+	int64_t minimum_posix_time        = -( (int64_t) INT64_MAX ) - 1;
+	uint64_t group_identifier         = 0;
+	uint64_t maximum_size             = UINT64_MAX;
+	uint64_t minimum_size             = 0;
+	uint64_t owner_identifier         = 0;
+	uint8_t filter_flags              = 0;
+	int identifier_index              = 0;
+	int number_of_entries             = 0;
+	int number_of_identifiers         = 0;
+	int result                        = 0;
+	int time_value_type               = LIBFSAPFS_TIME_VALUE_TYPE_MODIFICATION_TIME;
+
+	if( pyfsapfs_metadata_index == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid metadata index.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|sOOOOOOz",
+	     keyword_list,
+	     &time_value_string,
+	     &minimum_time_object,
+	     &maximum_time_object,
+	     &minimum_size_object,
+	     &maximum_size_object,
+	     &owner_identifier_object,
+	     &group_identifier_object,
+	     &utf8_extension ) == 0 )
+	{
+		return( NULL );
+	}
+	if( time_value_string != NULL )
+	{
+		if( narrow_string_compare(
+		     time_value_string,
+		     "access",
+		     7 ) == 0 )
+		{
+			time_value_type = LIBFSAPFS_TIME_VALUE_TYPE_ACCESS_TIME;
+		}
+		else if( narrow_string_compare(
+		          time_value_string,
+		          "creation",
+		          9 ) == 0 )
+		{
+			time_value_type = LIBFSAPFS_TIME_VALUE_TYPE_CREATION_TIME;
+		}
+		else if( narrow_string_compare(
+		          time_value_string,
+		          "inode_change",
+		          13 ) == 0 )
+		{
+			time_value_type = LIBFSAPFS_TIME_VALUE_TYPE_INODE_CHANGE_TIME;
+		}
+		else if( narrow_string_compare(
+		          time_value_string,
+		          "modification",
+		          13 ) == 0 )
+		{
+			time_value_type = LIBFSAPFS_TIME_VALUE_TYPE_MODIFICATION_TIME;
+		}
+		else
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: unsupported time value: %s.",
+			 function,
+			 time_value_string );
+
+			return( NULL );
+		}
+	}
+	if( ( minimum_time_object != NULL )
+	 && ( minimum_time_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_signed_copy_to_64bit(
+		     minimum_time_object,
+		     &minimum_posix_time,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert minimum time.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_TIME;
+	}
+	if( ( maximum_time_object != NULL )
+	 && ( maximum_time_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_signed_copy_to_64bit(
+		     maximum_time_object,
+		     &maximum_posix_time,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert maximum time.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_TIME;
+	}
+	if( ( minimum_size_object != NULL )
+	 && ( minimum_size_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_unsigned_copy_to_64bit(
+		     minimum_size_object,
+		     &minimum_size,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert minimum size.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_SIZE;
+	}
+	if( ( maximum_size_object != NULL )
+	 && ( maximum_size_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_unsigned_copy_to_64bit(
+		     maximum_size_object,
+		     &maximum_size,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert maximum size.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_SIZE;
+	}
+	if( ( owner_identifier_object != NULL )
+	 && ( owner_identifier_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_unsigned_copy_to_64bit(
+		     owner_identifier_object,
+		     &owner_identifier,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert owner identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( owner_identifier > (uint64_t) UINT32_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid owner identifier value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_OWNER_IDENTIFIER;
+	}
+	if( ( group_identifier_object != NULL )
+	 && ( group_identifier_object != Py_None ) )
+	{
+		if( pyfsapfs_integer_unsigned_copy_to_64bit(
+		     group_identifier_object,
+		     &group_identifier,
+		     &error ) != 1 )
+		{
+			pyfsapfs_error_raise(
+			 error,
+			 PyExc_ValueError,
+			 "%s: unable to convert group identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( group_identifier > (uint64_t) UINT32_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid group identifier value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_GROUP_IDENTIFIER;
+	}
+	if( utf8_extension != NULL )
+	{
+		utf8_extension_length = narrow_string_length(
+		                         utf8_extension );
+
+		filter_flags |= LIBFSAPFS_METADATA_QUERY_FILTER_FLAG_EXTENSION;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsapfs_metadata_index_get_number_of_entries(
+	          pyfsapfs_metadata_index->metadata_index,
+	          &number_of_entries,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		identifiers = (uint64_t *) PyMem_Malloc(
+		                            sizeof( uint64_t ) * number_of_entries );
+
+		if( identifiers == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create identifiers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsapfs_metadata_index_query(
+	          pyfsapfs_metadata_index->metadata_index,
+	          filter_flags,
+	          time_value_type,
+	          minimum_posix_time,
+	          maximum_posix_time,
+	          minimum_size,
+	          maximum_size,
+	          (uint32_t) owner_identifier,
+	          (uint32_t) group_identifier,
+	          (uint8_t *) utf8_extension,
+	          utf8_extension_length,
+	          identifiers,
+	          number_of_entries,
+	          &number_of_identifiers,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to query metadata index.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_identifiers );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	for( identifier_index = 0;
+	     identifier_index < number_of_identifiers;
+	     identifier_index++ )
+	{
+		integer_object = pyfsapfs_integer_unsigned_new_from_64bit(
+		                  identifiers[ identifier_index ] );
+
+		if( integer_object == NULL )
+		{
+			goto on_error;
+		}
+		/* The list takes over the reference of the integer object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 (Py_ssize_t) identifier_index,
+		 integer_object );
+	}
+	if( identifiers != NULL )
+	{
+		PyMem_Free(
+		 identifiers );
+	}
+	return( list_object );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( identifiers != NULL )
+	{
+		PyMem_Free(
+		 identifiers );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Python object wrapper of libfsapfs_metadata_index_t
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYFSAPFS_METADATA_INDEX_H )
+#define _PYFSAPFS_METADATA_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfsapfs_libfsapfs.h"
+#include "pyfsapfs_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfsapfs_metadata_index pyfsapfs_metadata_index_t;
+
+struct pyfsapfs_metadata_index
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libfsapfs metadata index
+	 */
+	libfsapfs_metadata_index_t *metadata_index;
+
+	/* The parent object
+	 */
+	PyObject *parent_object;
+};
+
+extern PyMethodDef pyfsapfs_metadata_index_object_methods[];
+extern PyTypeObject pyfsapfs_metadata_index_type_object;
+
+PyObject *pyfsapfs_metadata_index_new(
+           libfsapfs_metadata_index_t *metadata_index,
+           PyObject *parent_object );
+
+int pyfsapfs_metadata_index_init(
+     pyfsapfs_metadata_index_t *pyfsapfs_metadata_index );
+
+void pyfsapfs_metadata_index_free(
+      pyfsapfs_metadata_index_t *pyfsapfs_metadata_index );
+
+PyObject *pyfsapfs_metadata_index_get_number_of_entries(
+           pyfsapfs_metadata_index_t *pyfsapfs_metadata_index,
+           PyObject *arguments );
+
+PyObject *pyfsapfs_metadata_index_query(
+           pyfsapfs_metadata_index_t *pyfsapfs_metadata_index,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFSAPFS_METADATA_INDEX_H ) */
+
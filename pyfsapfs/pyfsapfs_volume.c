@@ -35,6 +35,7 @@
 #include "pyfsapfs_libbfio.h"
 #include "pyfsapfs_libcerror.h"
 #include "pyfsapfs_libfsapfs.h"
+#include "pyfsapfs_metadata_index.h"
 #include "pyfsapfs_python.h"
 #include "pyfsapfs_unused.h"
 #include "pyfsapfs_volume.h"
@@ -129,6 +130,13 @@ PyMethodDef pyfsapfs_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the file entry for an UTF-8 encoded path specified by the path." },
 
+	{ "get_metadata_index",
+	  (PyCFunction) pyfsapfs_volume_get_metadata_index,
+	  METH_NOARGS,
+	  "get_metadata_index() -> Object\n"
+	  "\n"
+	  "Builds a metadata index of the inodes in the file system." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -1229,3 +1237,74 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the metadata index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfsapfs_volume_get_metadata_index(
+           pyfsapfs_volume_t *pyfsapfs_volume,
+           PyObject *arguments PYFSAPFS_ATTRIBUTE_UNUSED )
+{
+	PyObject *metadata_index_object            = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_metadata_index_t *metadata_index = NULL;
+	static char *function                      = "pyfsapfs_volume_get_metadata_index";
+	int result                                 = 0;
+
+	PYFSAPFS_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfsapfs_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfsapfs_volume_get_metadata_index(
+	          pyfsapfs_volume->volume,
+	          &metadata_index,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfsapfs_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve metadata index.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	metadata_index_object = pyfsapfs_metadata_index_new(
+	                         metadata_index,
+	                         (PyObject *) pyfsapfs_volume );
+
+	if( metadata_index_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create metadata index object.",
+		 function );
+
+		goto on_error;
+	}
+	return( metadata_index_object );
+
+on_error:
+	if( metadata_index != NULL )
+	{
+		libfsapfs_metadata_index_free(
+		 &metadata_index,
+		 NULL );
+	}
+	return( NULL );
+}
+
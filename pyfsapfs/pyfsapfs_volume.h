@@ -129,6 +129,10 @@ PyObject *pyfsapfs_volume_get_file_entry_by_path(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfsapfs_volume_get_metadata_index(
+           pyfsapfs_volume_t *pyfsapfs_volume,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
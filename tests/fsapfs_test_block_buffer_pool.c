@@ -0,0 +1,683 @@
+/*
+ * Library block_buffer_pool type test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_block_buffer_pool.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_block_buffer_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_block_buffer_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_block_buffer_pool_t *block_buffer_pool = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                  = 1;
+	int number_of_memset_fail_tests                  = 1;
+	int test_number                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_block_buffer_pool_initialize(
+	          &block_buffer_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_buffer_pool",
+	 block_buffer_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_block_buffer_pool_free(
+	          &block_buffer_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "block_buffer_pool",
+	 block_buffer_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_block_buffer_pool_initialize(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_buffer_pool = (libfsapfs_block_buffer_pool_t *) 0x12345678UL;
+
+	result = libfsapfs_block_buffer_pool_initialize(
+	          &block_buffer_pool,
+	          &error );
+
+	block_buffer_pool = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_block_buffer_pool_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_block_buffer_pool_initialize(
+		          &block_buffer_pool,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( block_buffer_pool != NULL )
+			{
+				libfsapfs_block_buffer_pool_free(
+				 &block_buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "block_buffer_pool",
+			 block_buffer_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_block_buffer_pool_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_block_buffer_pool_initialize(
+		          &block_buffer_pool,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( block_buffer_pool != NULL )
+			{
+				libfsapfs_block_buffer_pool_free(
+				 &block_buffer_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "block_buffer_pool",
+			 block_buffer_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_buffer_pool != NULL )
+	{
+		libfsapfs_block_buffer_pool_free(
+		 &block_buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_block_buffer_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_block_buffer_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_block_buffer_pool_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_block_buffer_pool_allocate_aligned_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_block_buffer_pool_allocate_aligned_buffer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *buffer          = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+	          4096,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "alignment",
+	 (int) ( (intptr_t) buffer % LIBFSAPFS_BLOCK_BUFFER_POOL_ALIGNMENT ),
+	 0 );
+
+	result = libfsapfs_block_buffer_pool_free_aligned_buffer(
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+	          0,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+	          4096,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		libfsapfs_block_buffer_pool_free_aligned_buffer(
+		 &buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_block_buffer_pool_get_buffer and libfsapfs_block_buffer_pool_release_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_block_buffer_pool_get_buffer(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_block_buffer_pool_t *block_buffer_pool = NULL;
+	uint8_t *buffer                                  = NULL;
+	uint8_t *released_buffer                         = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_block_buffer_pool_initialize(
+	          &block_buffer_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "block_buffer_pool",
+	 block_buffer_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_block_buffer_pool_get_buffer(
+	          block_buffer_pool,
+	          4096,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer[ 0 ]     = 0xff;
+	released_buffer = buffer;
+
+	result = libfsapfs_block_buffer_pool_release_buffer(
+	          block_buffer_pool,
+	          &buffer,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "block_buffer_pool->number_of_buffers",
+	 block_buffer_pool->number_of_buffers,
+	 1 );
+
+	/* Test if a released buffer is reused and was cleared
+	 */
+	result = libfsapfs_block_buffer_pool_get_buffer(
+	          block_buffer_pool,
+	          4096,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer",
+	 (intptr_t) buffer,
+	 (intptr_t) released_buffer );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 0 ]",
+	 buffer[ 0 ],
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a buffer of a different size is not pooled
+	 */
+	result = libfsapfs_block_buffer_pool_release_buffer(
+	          block_buffer_pool,
+	          &buffer,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsapfs_block_buffer_pool_get_buffer(
+	          block_buffer_pool,
+	          512,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "block_buffer_pool->number_of_buffers",
+	 block_buffer_pool->number_of_buffers,
+	 1 );
+
+	result = libfsapfs_block_buffer_pool_release_buffer(
+	          block_buffer_pool,
+	          &buffer,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "block_buffer_pool->number_of_buffers",
+	 block_buffer_pool->number_of_buffers,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_block_buffer_pool_get_buffer(
+	          NULL,
+	          4096,
+	          &buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_block_buffer_pool_get_buffer(
+	          block_buffer_pool,
+	          4096,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_block_buffer_pool_release_buffer(
+	          NULL,
+	          &buffer,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_block_buffer_pool_free(
+	          &block_buffer_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "block_buffer_pool",
+	 block_buffer_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		libfsapfs_block_buffer_pool_free_aligned_buffer(
+		 &buffer,
+		 NULL );
+	}
+	if( block_buffer_pool != NULL )
+	{
+		libfsapfs_block_buffer_pool_free(
+		 &block_buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_block_buffer_pool_initialize",
+	 fsapfs_test_block_buffer_pool_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_block_buffer_pool_free",
+	 fsapfs_test_block_buffer_pool_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_block_buffer_pool_allocate_aligned_buffer",
+	 fsapfs_test_block_buffer_pool_allocate_aligned_buffer );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_block_buffer_pool_get_buffer",
+	 fsapfs_test_block_buffer_pool_get_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -1254,6 +1254,159 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_btree_node_is_root_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_btree_node_is_root_node(
+     libfsapfs_btree_node_t *btree_node )
+{
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_btree_node_header_t *btree_node_header = NULL;
+	int result                                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_btree_node_is_root_node(
+	          btree_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_btree_node_is_root_node(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	btree_node_header       = btree_node->node_header;
+	btree_node->node_header = NULL;
+
+	result = libfsapfs_btree_node_is_root_node(
+	          btree_node,
+	          &error );
+
+	btree_node->node_header = btree_node_header;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_btree_node_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_btree_node_get_memory_usage(
+     libfsapfs_btree_node_t *btree_node )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_usage    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_btree_node_get_memory_usage(
+	          btree_node,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "memory_usage",
+	 (int64_t) memory_usage,
+	 (int64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_btree_node_get_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_get_memory_usage(
+	          btree_node,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -1347,6 +1500,16 @@ int main(
 	 fsapfs_test_btree_node_get_entry_by_index,
 	 btree_node );
 
+	FSAPFS_TEST_RUN_WITH_ARGS(
+	 "libfsapfs_btree_node_is_root_node",
+	 fsapfs_test_btree_node_is_root_node,
+	 btree_node );
+
+	FSAPFS_TEST_RUN_WITH_ARGS(
+	 "libfsapfs_btree_node_get_memory_usage",
+	 fsapfs_test_btree_node_get_memory_usage,
+	 btree_node );
+
 	/* Clean up
 	 */
 	result = libfsapfs_btree_node_free(
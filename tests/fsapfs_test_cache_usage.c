@@ -0,0 +1,1120 @@
+/*
+ * Library cache usage functions test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfcache.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_btree_node.h"
+#include "../libfsapfs/libfsapfs_btree_node_header.h"
+#include "../libfsapfs/libfsapfs_cache_usage.h"
+#include "../libfsapfs/libfsapfs_data_block.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Sets a B-tree node with the node header flags in a node cache
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_cache_usage_set_node(
+     libfcache_cache_t *node_cache,
+     off64_t cache_value_offset,
+     uint16_t node_header_flags,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *node = NULL;
+	static char *function        = "fsapfs_test_cache_usage_set_node";
+
+	if( libfsapfs_btree_node_initialize(
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_btree_node_header_initialize(
+	     &( node->node_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B-tree node header.",
+		 function );
+
+		goto on_error;
+	}
+	node->node_header->flags = node_header_flags;
+
+	if( libfcache_cache_set_value_by_identifier(
+	     node_cache,
+	     0,
+	     cache_value_offset,
+	     0,
+	     (intptr_t *) node,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set B-tree node in cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets a data block in a data block cache
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_cache_usage_set_data_block(
+     libfcache_cache_t *data_block_cache,
+     off64_t cache_value_offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_data_block_t *data_block = NULL;
+	static char *function              = "fsapfs_test_cache_usage_set_data_block";
+
+	if( libfsapfs_data_block_initialize(
+	     &data_block,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_identifier(
+	     data_block_cache,
+	     0,
+	     cache_value_offset,
+	     0,
+	     (intptr_t *) data_block,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_data_block_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data block in cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libfsapfs_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsapfs_cache_usage_get_node_cache_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_usage_get_node_cache_memory_usage(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfcache_cache_t *node_cache = NULL;
+	size64_t memory_usage         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &node_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          node_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	result = fsapfs_test_cache_usage_set_node(
+	          node_cache,
+	          0,
+	          0x0003,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          node_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( sizeof( libfsapfs_btree_node_t ) + sizeof( libfsapfs_btree_node_header_t ) ) );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          node_cache,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &node_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &node_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cache_usage_get_data_block_cache_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_usage_get_data_block_cache_memory_usage(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfcache_cache_t *data_block_cache = NULL;
+	size64_t memory_usage               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &data_block_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          data_block_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	result = fsapfs_test_cache_usage_set_data_block(
+	          data_block_cache,
+	          0,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_cache_usage_set_data_block(
+	          data_block_cache,
+	          1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          data_block_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( ( 2 * sizeof( libfsapfs_data_block_t ) ) + 512 + 4096 ) );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          NULL,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          data_block_cache,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &data_block_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &data_block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cache_usage_trim_node_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_usage_trim_node_cache(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *node_cache        = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_btree_node_t *node         = NULL;
+	size64_t memory_usage                = 0;
+	size64_t node_memory_usage           = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &node_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache contains a root node, a branch node and a leaf node
+	 */
+	result = fsapfs_test_cache_usage_set_node(
+	          node_cache,
+	          0,
+	          0x0001,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_cache_usage_set_node(
+	          node_cache,
+	          1,
+	          0x0000,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_cache_usage_set_node(
+	          node_cache,
+	          2,
+	          0x0002,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	node_memory_usage = sizeof( libfsapfs_btree_node_t ) + sizeof( libfsapfs_btree_node_header_t );
+
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          node_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( 3 * node_memory_usage ) );
+
+	/* Test regular cases
+	 */
+	/* Trimming the leaf nodes leaves the root and branch nodes
+	 */
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_LEAF_NODES,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( 2 * node_memory_usage ) );
+
+	/* Test that the root node can still be looked up
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          node_cache,
+	          0,
+	          0,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          (intptr_t **) &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	/* Trimming stops when the target memory usage is reached
+	 */
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_BRANCH_NODES,
+	          2 * node_memory_usage,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( 2 * node_memory_usage ) );
+
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_BRANCH_NODES,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) node_memory_usage );
+
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_ROOT_NODES,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	result = libfsapfs_cache_usage_get_node_cache_memory_usage(
+	          node_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          NULL,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_LEAF_NODES,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_DATA_BLOCKS,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_usage_trim_node_cache(
+	          node_cache,
+	          LIBFSAPFS_CACHE_TRIM_LEVEL_LEAF_NODES,
+	          0,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &node_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &node_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cache_usage_trim_data_block_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_usage_trim_data_block_cache(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfcache_cache_t *data_block_cache  = NULL;
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	size64_t memory_usage                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfcache_cache_initialize(
+	          &data_block_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_cache_usage_set_data_block(
+	          data_block_cache,
+	          0,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_cache_usage_set_data_block(
+	          data_block_cache,
+	          1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          data_block_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Trimming stops after the first data block when the target memory usage is reached
+	 */
+	result = libfsapfs_cache_usage_trim_data_block_cache(
+	          data_block_cache,
+	          sizeof( libfsapfs_data_block_t ) + 4096,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( sizeof( libfsapfs_data_block_t ) + 4096 ) );
+
+	result = libfsapfs_cache_usage_get_data_block_cache_memory_usage(
+	          data_block_cache,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) ( sizeof( libfsapfs_data_block_t ) + 4096 ) );
+
+	/* Test that the remaining data block can still be looked up
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          data_block_cache,
+	          0,
+	          1,
+	          0,
+	          &cache_value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_value",
+	 cache_value );
+
+	result = libfcache_cache_value_get_value(
+	          cache_value,
+	          (intptr_t **) &data_block,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	result = libfsapfs_cache_usage_trim_data_block_cache(
+	          data_block_cache,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "memory_usage",
+	 (uint64_t) memory_usage,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_usage_trim_data_block_cache(
+	          NULL,
+	          0,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_usage_trim_data_block_cache(
+	          data_block_cache,
+	          0,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfcache_cache_free(
+	          &data_block_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &data_block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_usage_get_node_cache_memory_usage",
+	 fsapfs_test_cache_usage_get_node_cache_memory_usage );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_usage_get_data_block_cache_memory_usage",
+	 fsapfs_test_cache_usage_get_data_block_cache_memory_usage );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_usage_trim_node_cache",
+	 fsapfs_test_cache_usage_trim_node_cache );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_usage_trim_data_block_cache",
+	 fsapfs_test_cache_usage_trim_data_block_cache );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
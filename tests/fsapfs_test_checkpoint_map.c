@@ -22,6 +22,7 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -36,6 +37,9 @@
 #include "fsapfs_test_unused.h"
 
 #include "../libfsapfs/libfsapfs_checkpoint_map.h"
+#include "../libfsapfs/libfsapfs_checkpoint_map_entry.h"
+#include "../libfsapfs/libfsapfs_checksum.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
 
 uint8_t fsapfs_test_checkpoint_map_data1[ 4096 ] = {
 	0x96, 0xb2, 0x61, 0x3f, 0x2d, 0x25, 0x9e, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -765,6 +769,796 @@ on_error:
 	return( 0 );
 }
 
+/* Sets a checkpoint map block for testing
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_checkpoint_map_set_block_data(
+     uint8_t *block_data,
+     uint64_t transaction_identifier,
+     uint32_t object_type,
+     uint32_t flags,
+     const uint64_t *object_identifiers,
+     const uint64_t *physical_addresses,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data = NULL;
+	uint64_t checksum   = 0;
+	int entry_index     = 0;
+
+	if( memory_set(
+	     block_data,
+	     0,
+	     4096 ) == NULL )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( block_data[ 16 ] ),
+	 transaction_identifier );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_data[ 24 ] ),
+	 object_type );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_data[ 32 ] ),
+	 flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_data[ 36 ] ),
+	 (uint32_t) number_of_entries );
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_data = &( block_data[ 40 + ( entry_index * 40 ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( entry_data[ 0 ] ),
+		 0x80000005UL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( entry_data[ 8 ] ),
+		 4096 );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( entry_data[ 24 ] ),
+		 object_identifiers[ entry_index ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( entry_data[ 32 ] ),
+		 physical_addresses[ entry_index ] );
+	}
+	if( libfsapfs_checksum_calculate_fletcher64(
+	     &checksum,
+	     &( block_data[ 8 ] ),
+	     4096 - 8,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( block_data[ 0 ] ),
+	 checksum );
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_checkpoint_map_read_descriptor_area function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_checkpoint_map_read_descriptor_area(
+     void )
+{
+	uint8_t descriptor_area_data[ 4 * 4096 ];
+
+	uint64_t object_identifiers[ 2 ];
+	uint64_t physical_addresses[ 2 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_checkpoint_map_t *checkpoint_map = NULL;
+	libfsapfs_io_handle_t *io_handle           = NULL;
+	uint64_t physical_address                  = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 * The checkpoint descriptor area consists of 4 blocks where block 0 contains
+	 * a checkpoint map of a previous checkpoint, blocks 1 and 2 the checkpoint map
+	 * of which only the last block is flagged as such and block 3 the container superblock
+	 */
+	object_identifiers[ 0 ] = 1026;
+	physical_addresses[ 0 ] = 99;
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 0 ] ),
+	          4,
+	          0x4000000cUL,
+	          0x00000001UL,
+	          object_identifiers,
+	          physical_addresses,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	object_identifiers[ 0 ] = 1027;
+	physical_addresses[ 0 ] = 20;
+	object_identifiers[ 1 ] = 1024;
+	physical_addresses[ 1 ] = 17;
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 4096 ] ),
+	          5,
+	          0x4000000cUL,
+	          0x00000000UL,
+	          object_identifiers,
+	          physical_addresses,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	object_identifiers[ 0 ] = 1025;
+	physical_addresses[ 0 ] = 18;
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 2 * 4096 ] ),
+	          5,
+	          0x4000000cUL,
+	          0x00000001UL,
+	          object_identifiers,
+	          physical_addresses,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 3 * 4096 ] ),
+	          5,
+	          0x80000001UL,
+	          0x00000000UL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          descriptor_area_data,
+	          4 * 4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_initialize(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint_map",
+	 checkpoint_map );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          1,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint_map->number_of_sorted_entries",
+	 checkpoint_map->number_of_sorted_entries,
+	 3 );
+
+	/* The block data is returned to the block buffer pool of the IO handle
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->block_buffer_pool->number_of_buffers",
+	 io_handle->block_buffer_pool->number_of_buffers,
+	 1 );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1024,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 17 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1025,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 18 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1027,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 20 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The checkpoint map of the previous checkpoint is not read
+	 */
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1026,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_free(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a checkpoint map that wraps around the end of the checkpoint descriptor area
+	 * where block 3 and 0 contain the checkpoint map and block 1 the container superblock
+	 */
+	object_identifiers[ 0 ] = 1025;
+	physical_addresses[ 0 ] = 31;
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 0 ] ),
+	          6,
+	          0x4000000cUL,
+	          0x00000001UL,
+	          object_identifiers,
+	          physical_addresses,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 4096 ] ),
+	          6,
+	          0x80000001UL,
+	          0x00000000UL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	object_identifiers[ 0 ] = 1024;
+	physical_addresses[ 0 ] = 30;
+
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 3 * 4096 ] ),
+	          6,
+	          0x4000000cUL,
+	          0x00000000UL,
+	          object_identifiers,
+	          physical_addresses,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_initialize(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint_map",
+	 checkpoint_map );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint_map->number_of_sorted_entries",
+	 checkpoint_map->number_of_sorted_entries,
+	 2 );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1024,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 30 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1025,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 31 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->block_size = 16;
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	io_handle->block_size = 4096;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          4,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          5,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          NULL,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the checkpoint map blocks have a different transaction identifier
+	 */
+	result = fsapfs_test_checkpoint_map_set_block_data(
+	          &( descriptor_area_data[ 0 ] ),
+	          7,
+	          0x4000000cUL,
+	          0x00000001UL,
+	          object_identifiers,
+	          physical_addresses,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_read_descriptor_area(
+	          checkpoint_map,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          4,
+	          3,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_checkpoint_map_free(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "checkpoint_map",
+	 checkpoint_map );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint_map != NULL )
+	{
+		libfsapfs_checkpoint_map_free(
+		 &checkpoint_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_checkpoint_map_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -811,6 +1605,23 @@ int fsapfs_test_checkpoint_map_read_data(
 	 "error",
 	 error );
 
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint_map->transaction_identifier",
+	 checkpoint_map->transaction_identifier,
+	 (uint64_t) 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "checkpoint_map->flags",
+	 checkpoint_map->flags,
+	 (uint32_t) 0x00000001UL );
+
+	/* The entries are not sorted until libfsapfs_checkpoint_map_sort_entries is called
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint_map->number_of_sorted_entries",
+	 checkpoint_map->number_of_sorted_entries,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = libfsapfs_checkpoint_map_read_data(
@@ -1033,6 +1844,152 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_checkpoint_map_sort_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_checkpoint_map_sort_entries(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_checkpoint_map_t *checkpoint_map = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_checkpoint_map_initialize(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint_map",
+	 checkpoint_map );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_checkpoint_map_sort_entries(
+	          checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint_map->number_of_sorted_entries",
+	 checkpoint_map->number_of_sorted_entries,
+	 0 );
+
+	result = libfsapfs_checkpoint_map_read_data(
+	          checkpoint_map,
+	          fsapfs_test_checkpoint_map_data1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_sort_entries(
+	          checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "checkpoint_map->number_of_sorted_entries",
+	 checkpoint_map->number_of_sorted_entries,
+	 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint_map->sorted_entries[ 0 ]->object_identifier",
+	 checkpoint_map->sorted_entries[ 0 ]->object_identifier,
+	 (uint64_t) 1024 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoint_map->sorted_entries[ 1 ]->object_identifier",
+	 checkpoint_map->sorted_entries[ 1 ]->object_identifier,
+	 (uint64_t) 1025 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_checkpoint_map_sort_entries(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_checkpoint_map_free(
+	          &checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "checkpoint_map",
+	 checkpoint_map );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint_map != NULL )
+	{
+		libfsapfs_checkpoint_map_free(
+		 &checkpoint_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_checkpoint_map_get_physical_address_by_object_identifier function
  * Returns 1 if successful or 0 if not
  */
@@ -1080,6 +2037,41 @@ int fsapfs_checkpoint_map_get_physical_address_by_object_identifier(
 	 "error",
 	 error );
 
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1025,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "physical_address",
+	 physical_address,
+	 (uint64_t) 10 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
+	          checkpoint_map,
+	          1026,
+	          &physical_address,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libfsapfs_checkpoint_map_get_physical_address_by_object_identifier(
@@ -1167,10 +2159,18 @@ int main(
 	 "libfsapfs_checkpoint_map_read_file_io_handle",
 	 fsapfs_test_checkpoint_map_read_file_io_handle );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_checkpoint_map_read_descriptor_area",
+	 fsapfs_test_checkpoint_map_read_descriptor_area );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_checkpoint_map_read_data",
 	 fsapfs_test_checkpoint_map_read_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_checkpoint_map_sort_entries",
+	 fsapfs_test_checkpoint_map_sort_entries );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -1207,6 +2207,19 @@ int main(
 	 "error",
 	 error );
 
+	result = libfsapfs_checkpoint_map_sort_entries(
+	          checkpoint_map,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	FSAPFS_TEST_RUN_WITH_ARGS(
 	 "libfsapfs_checkpoint_map_get_physical_address_by_object_identifier",
 	 fsapfs_checkpoint_map_get_physical_address_by_object_identifier,
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -64,6 +65,13 @@ int libfsapfs_container_open_file_io_handle(
      int access_flags,
      libfsapfs_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_open_file_io_pool(
+     libfsapfs_container_t *container,
+     libbfio_pool_t *file_io_pool,
+     int access_flags,
+     libfsapfs_error_t **error );
+
 #endif /* !defined( LIBFSAPFS_HAVE_BFIO ) */
 
 /* Creates and opens a source container
@@ -424,6 +432,135 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_container_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_clone(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfsapfs_container_t *container             = NULL;
+	libfsapfs_container_t *destination_container = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_container_initialize(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_clone(
+	          NULL,
+	          container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_clone(
+	          &destination_container,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_container",
+	 destination_container );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test clone of a container that is not open
+	 */
+	result = libfsapfs_container_clone(
+	          &destination_container,
+	          container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_container",
+	 destination_container );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_container_free(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( container != NULL )
+	{
+		libfsapfs_container_free(
+		 &container,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_container_open function
  * Returns 1 if successful or 0 if not
  */
@@ -891,56 +1028,106 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsapfs_container_close function
+/* Tests the libfsapfs_container_open_file_io_pool function
  * Returns 1 if successful or 0 if not
  */
-int fsapfs_test_container_close(
-     void )
+int fsapfs_test_container_open_file_io_pool(
+     const system_character_t *source )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	libbfio_pool_t *file_io_pool     = NULL;
+	libcerror_error_t *error         = NULL;
+	libfsapfs_container_t *container = NULL;
+	size_t string_length             = 0;
+	int entry_index                  = 0;
+	int handle_index                 = 0;
+	int result                       = 0;
 
-	/* Test error cases
+	/* Initialize test
 	 */
-	result = libfsapfs_container_close(
-	          NULL,
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          LIBBFIO_POOL_UNLIMITED_NUMBER_OF_OPEN_HANDLES,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	string_length = system_string_length(
+	                 source );
 
-on_error:
-	if( error != NULL )
+	for( handle_index = 0;
+	     handle_index < 2;
+	     handle_index++ )
 	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
 
-/* Tests the libfsapfs_container_open and libfsapfs_container_close functions
- * Returns 1 if successful or 0 if not
- */
-int fsapfs_test_container_open_close(
-     const system_character_t *source )
-{
-	libcerror_error_t *error         = NULL;
-	libfsapfs_container_t *container = NULL;
-	int result                       = 0;
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	/* Initialize test
-	 */
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_pool_append_handle(
+		          file_io_pool,
+		          &entry_index,
+		          file_io_handle,
+		          LIBBFIO_OPEN_READ,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_io_handle = NULL;
+	}
 	result = libfsapfs_container_initialize(
 	          &container,
 	          &error );
@@ -958,21 +1145,13 @@ int fsapfs_test_container_open_close(
 	 "error",
 	 error );
 
-	/* Test open and close
+	/* Test regular cases
 	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsapfs_container_open_wide(
-	          container,
-	          source,
-	          LIBFSAPFS_OPEN_READ,
-	          &error );
-#else
-	result = libfsapfs_container_open(
+	result = libfsapfs_container_open_file_io_pool(
 	          container,
-	          source,
+	          file_io_pool,
 	          LIBFSAPFS_OPEN_READ,
 	          &error );
-#endif
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -983,57 +1162,152 @@ int fsapfs_test_container_open_close(
 	 "error",
 	 error );
 
-	result = libfsapfs_container_close(
-	          container,
+	/* Test error cases
+	 */
+	result = libfsapfs_container_open_file_io_pool(
+	          NULL,
+	          file_io_pool,
+	          LIBFSAPFS_OPEN_READ,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	FSAPFS_TEST_ASSERT_IS_NULL(
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfsapfs_container_open_wide(
-	          container,
-	          source,
-	          LIBFSAPFS_OPEN_READ,
-	          &error );
-#else
-	result = libfsapfs_container_open(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_file_io_pool(
 	          container,
-	          source,
+	          NULL,
 	          LIBFSAPFS_OPEN_READ,
 	          &error );
-#endif
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	FSAPFS_TEST_ASSERT_IS_NULL(
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libfsapfs_container_close(
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_file_io_pool(
 	          container,
+	          file_io_pool,
+	          -1,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	FSAPFS_TEST_ASSERT_IS_NULL(
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libfsapfs_container_open_file_io_pool(
+	          container,
+	          file_io_pool,
+	          LIBFSAPFS_OPEN_READ,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_container_free(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with a pool that cannot keep all its handles open
+	 */
+	result = libbfio_pool_set_maximum_number_of_open_handles(
+	          file_io_pool,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_initialize(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_open_file_io_pool(
+	          container,
+	          file_io_pool,
+	          LIBFSAPFS_OPEN_READ,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libfsapfs_container_free(
@@ -1053,6 +1327,23 @@ int fsapfs_test_container_open_close(
 	 "error",
 	 error );
 
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -1067,23 +1358,103 @@ on_error:
 		 &container,
 		 NULL );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsapfs_container_signal_abort function
+/* Tests the libfsapfs_container_close function
  * Returns 1 if successful or 0 if not
  */
-int fsapfs_test_container_signal_abort(
-     libfsapfs_container_t *container )
+int fsapfs_test_container_close(
+     void )
 {
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
-	/* Test regular cases
+	/* Test error cases
 	 */
-	result = libfsapfs_container_signal_abort(
+	result = libfsapfs_container_close(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_open and libfsapfs_container_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_container_t *container = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_container_initialize(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsapfs_container_open_wide(
 	          container,
+	          source,
+	          LIBFSAPFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsapfs_container_open(
+	          container,
+	          source,
+	          LIBFSAPFS_OPEN_READ,
 	          &error );
+#endif
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1094,50 +1465,1357 @@ int fsapfs_test_container_signal_abort(
 	 "error",
 	 error );
 
-	/* Test error cases
+	result = libfsapfs_container_close(
+	          container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
 	 */
-	result = libfsapfs_container_signal_abort(
-	          NULL,
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfsapfs_container_open_wide(
+	          container,
+	          source,
+	          LIBFSAPFS_OPEN_READ,
+	          &error );
+#else
+	result = libfsapfs_container_open(
+	          container,
+	          source,
+	          LIBFSAPFS_OPEN_READ,
 	          &error );
+#endif
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfsapfs_container_close(
+	          container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_container_free(
+	          &container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "container",
+	 container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( container != NULL )
+	{
+		libfsapfs_container_free(
+		 &container,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_signal_abort(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_signal_abort(
+	          container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_signal_abort(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_get_size(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_get_size(
+	          container,
+	          &size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_get_size(
+	          container,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_get_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_get_number_of_volumes(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_get_number_of_volumes(
+	          container,
+	          &number_of_volumes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_get_number_of_volumes(
+	          NULL,
+	          &number_of_volumes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_get_number_of_volumes(
+	          container,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_get_memory_usage function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_get_memory_usage(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	size64_t memory_usage    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_ALL,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_BTREE_NODES,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_DATA_BLOCKS,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_get_memory_usage(
+	          NULL,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_ALL,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          -1,
+	          &memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_ALL,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_trim_caches function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_trim_caches(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error      = NULL;
+	libfsapfs_volume_t *volume    = NULL;
+	size64_t trimmed_memory_usage = 0;
+	int number_of_volumes         = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_container_get_number_of_volumes(
+	          container,
+	          &number_of_volumes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_volumes > 0 )
+	{
+		/* Retrieving a volume reads the object map B-tree of the container
+		 */
+		result = libfsapfs_container_get_volume_by_index(
+		          container,
+		          0,
+		          &volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		result = libfsapfs_volume_free(
+		          &volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_trim_caches(
+	          container,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_get_memory_usage(
+	          container,
+	          LIBFSAPFS_MEMORY_USAGE_TYPE_ALL,
+	          &trimmed_memory_usage,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "trimmed_memory_usage",
+	 (uint64_t) trimmed_memory_usage,
+	 (uint64_t) 0 );
+
+	if( number_of_volumes > 0 )
+	{
+		/* Test that a lookup after trimming reads the object map B-tree again
+		 */
+		result = libfsapfs_container_get_volume_by_index(
+		          container,
+		          0,
+		          &volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volume );
+
+		result = libfsapfs_volume_free(
+		          &volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsapfs_container_trim_caches(
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_open_all_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_open_all_volumes(
+     libfsapfs_container_t *container )
+{
+	libfsapfs_volume_t *volumes[ 100 ];
+
+	libcerror_error_t *error = NULL;
+	int number_of_volumes    = 0;
+	int result               = 0;
+	int volume_index         = 0;
+
+	for( volume_index = 0;
+	     volume_index < 100;
+	     volume_index++ )
+	{
+		volumes[ volume_index ] = NULL;
+	}
+	result = libfsapfs_container_get_number_of_volumes(
+	          container,
+	          &number_of_volumes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 101 );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_open_all_volumes(
+	          container,
+	          volumes,
+	          number_of_volumes,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( volume_index = 0;
+	     volume_index < number_of_volumes;
+	     volume_index++ )
+	{
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "volume",
+		 volumes[ volume_index ] );
+
+		result = libfsapfs_volume_free(
+		          &( volumes[ volume_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfsapfs_container_open_all_volumes(
+	          NULL,
+	          volumes,
+	          number_of_volumes,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_all_volumes(
+	          container,
+	          NULL,
+	          number_of_volumes,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_all_volumes(
+	          container,
+	          volumes,
+	          number_of_volumes + 1,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_all_volumes(
+	          container,
+	          volumes,
+	          number_of_volumes,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( volume_index = 0;
+	     volume_index < 100;
+	     volume_index++ )
+	{
+		if( volumes[ volume_index ] != NULL )
+		{
+			libfsapfs_volume_free(
+			 &( volumes[ volume_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_container_checkpoints_set_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_checkpoints_set_block_number(
+     void )
+{
+	libfsapfs_container_checkpoint_t checkpoints[ 2 ];
+
+	libcerror_error_t *error  = NULL;
+	void *memset_result       = NULL;
+	int number_of_checkpoints = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 checkpoints,
+	                 0,
+	                 sizeof( libfsapfs_container_checkpoint_t ) * 2 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          5,
+	          10,
+	          0x4000000cUL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          5,
+	          11,
+	          0x4000000cUL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          5,
+	          12,
+	          0x80000001UL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          6,
+	          13,
+	          0x80000001UL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_checkpoints",
+	 number_of_checkpoints,
+	 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoints[ 0 ].transaction_identifier",
+	 checkpoints[ 0 ].transaction_identifier,
+	 (uint64_t) 5 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoints[ 0 ].checkpoint_map_block_number",
+	 checkpoints[ 0 ].checkpoint_map_block_number,
+	 (uint64_t) 10 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoints[ 0 ].superblock_block_number",
+	 checkpoints[ 0 ].superblock_block_number,
+	 (uint64_t) 12 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoints[ 1 ].checkpoint_map_block_number",
+	 checkpoints[ 1 ].checkpoint_map_block_number,
+	 (uint64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "checkpoints[ 1 ].superblock_block_number",
+	 checkpoints[ 1 ].superblock_block_number,
+	 (uint64_t) 13 );
+
+	/* Test the most recent checkpoint is sorted first
+	 */
+	result = libfsapfs_container_checkpoint_compare(
+	          &( checkpoints[ 1 ] ),
+	          &( checkpoints[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          NULL,
+	          &number_of_checkpoints,
+	          2,
+	          7,
+	          14,
+	          0x80000001UL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          NULL,
+	          2,
+	          7,
+	          14,
+	          0x80000001UL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          7,
+	          14,
+	          0x0000000bUL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of checkpoints exceeds the maximum
+	 */
+	result = libfsapfs_container_checkpoints_set_block_number(
+	          checkpoints,
+	          &number_of_checkpoints,
+	          2,
+	          7,
+	          14,
+	          0x80000001UL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* Tests the libfsapfs_container_get_number_of_checkpoints function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_get_number_of_checkpoints(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error  = NULL;
+	int number_of_checkpoints = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_get_number_of_checkpoints(
+	          container,
+	          &number_of_checkpoints,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_get_number_of_checkpoints(
+	          NULL,
+	          &number_of_checkpoints,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_get_number_of_checkpoints(
+	          container,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_open_checkpoint function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_open_checkpoint(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error                    = NULL;
+	libfsapfs_container_t *checkpoint_container = NULL;
+	uint64_t transaction_identifier             = 0;
+	int number_of_checkpoints                   = 0;
+	int number_of_volumes                       = 0;
+	int result                                  = 0;
+
+	result = libfsapfs_container_get_number_of_checkpoints(
+	          container,
+	          &number_of_checkpoints,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_checkpoints > 0 )
+	{
+		result = libfsapfs_container_get_checkpoint_transaction_identifier_by_index(
+		          container,
+		          number_of_checkpoints - 1,
+		          &transaction_identifier,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libfsapfs_container_open_checkpoint(
+		          container,
+		          transaction_identifier,
+		          &checkpoint_container,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "checkpoint_container",
+		 checkpoint_container );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_container_get_number_of_volumes(
+		          checkpoint_container,
+		          &number_of_volumes,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_container_free(
+		          &checkpoint_container,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test retrieving a checkpoint that is not available
+	 */
+	result = libfsapfs_container_open_checkpoint(
+	          container,
+	          0,
+	          &checkpoint_container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "checkpoint_container",
+	 checkpoint_container );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_open_checkpoint(
+	          NULL,
+	          transaction_identifier,
+	          &checkpoint_container,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_open_checkpoint(
+	          container,
+	          transaction_identifier,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint_container != NULL )
+	{
+		libfsapfs_container_free(
+		 &checkpoint_container,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The number of volume clones read in parallel by the clone tests
+ */
+#define FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES	4
+
+typedef struct fsapfs_test_container_clone_read fsapfs_test_container_clone_read_t;
+
+struct fsapfs_test_container_clone_read
+{
+	/* The volume clone
+	 */
+	libfsapfs_volume_t *volume;
+
+	/* The number of sub file entries of the root directory
+	 */
+	int number_of_sub_file_entries;
+
+	/* The result
+	 */
+	int result;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+/* Reads the root directory of a volume clone
+ * This function is used as a thread entry point
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_container_clone_read_root_directory(
+     fsapfs_test_container_clone_read_t *clone_read )
+{
+	libfsapfs_file_entry_t *file_entry = NULL;
 
-	return( 1 );
+	if( clone_read == NULL )
+	{
+		return( -1 );
+	}
+	clone_read->result = -1;
 
-on_error:
-	if( error != NULL )
+	if( libfsapfs_volume_get_root_directory(
+	     clone_read->volume,
+	     &file_entry,
+	     NULL ) == 1 )
 	{
-		libcerror_error_free(
-		 &error );
+		if( libfsapfs_file_entry_get_number_of_sub_file_entries(
+		     file_entry,
+		     &( clone_read->number_of_sub_file_entries ),
+		     NULL ) == 1 )
+		{
+			clone_read->result = 1;
+		}
+		if( libfsapfs_file_entry_free(
+		     &file_entry,
+		     NULL ) != 1 )
+		{
+			clone_read->result = -1;
+		}
 	}
-	return( 0 );
+	return( clone_read->result );
 }
 
-/* Tests the libfsapfs_container_get_size function
+/* Tests reading clones in parallel after their source has been freed
  * Returns 1 if successful or 0 if not
  */
-int fsapfs_test_container_get_size(
+int fsapfs_test_container_clone_parallel_read(
      libfsapfs_container_t *container )
 {
-	libcerror_error_t *error = NULL;
-	size64_t size            = 0;
-	int result               = 0;
+	fsapfs_test_container_clone_read_t clone_reads[ FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES ];
 
-	/* Test regular cases
+	fsapfs_test_container_clone_read_t source_read;
+
+	libcerror_error_t *error                = NULL;
+	libfsapfs_container_t *container_clone  = NULL;
+	libfsapfs_container_t *source_container = NULL;
+	libfsapfs_volume_t *source_volume       = NULL;
+	void *memset_result                     = NULL;
+	int clone_index                         = 0;
+	int number_of_volumes                   = 0;
+	int result                              = 0;
+
+	/* Initialize test
 	 */
-	result = libfsapfs_container_get_size(
+	memset_result = memory_set(
+	                 clone_reads,
+	                 0,
+	                 sizeof( fsapfs_test_container_clone_read_t ) * FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memset_result = memory_set(
+	                 &source_read,
+	                 0,
+	                 sizeof( fsapfs_test_container_clone_read_t ) );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Clone the container twice so that the first clone can be freed
+	 * before the second while the container passed by the caller stays open
+	 */
+	result = libfsapfs_container_clone(
+	          &source_container,
 	          container,
-	          &size,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
@@ -1145,72 +2823,194 @@ int fsapfs_test_container_get_size(
 	 result,
 	 1 );
 
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_container",
+	 source_container );
+
 	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsapfs_container_get_size(
-	          NULL,
-	          &size,
+	result = libfsapfs_container_clone(
+	          &container_clone,
+	          source_container,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "container_clone",
+	 container_clone );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsapfs_container_get_size(
-	          container,
-	          NULL,
+	result = libfsapfs_container_get_number_of_volumes(
+	          container_clone,
+	          &number_of_volumes,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( number_of_volumes > 0 )
+	{
+		result = libfsapfs_container_get_volume_by_index(
+		          container_clone,
+		          0,
+		          &source_volume,
+		          &error );
 
-	return( 1 );
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "source_volume",
+		 source_volume );
 
-/* Tests the libfsapfs_container_get_number_of_volumes function
- * Returns 1 if successful or 0 if not
- */
-int fsapfs_test_container_get_number_of_volumes(
-     libfsapfs_container_t *container )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_volumes    = 0;
-	int result               = 0;
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
+		source_read.volume = source_volume;
+
+		result = fsapfs_test_container_clone_read_root_directory(
+		          &source_read );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		for( clone_index = 0;
+		     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+		     clone_index++ )
+		{
+			result = libfsapfs_volume_clone(
+			          &( clone_reads[ clone_index ].volume ),
+			          source_volume,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "volume",
+			 clone_reads[ clone_index ].volume );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Free the source volume before the clones
+		 */
+		result = libfsapfs_volume_free(
+		          &source_volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		for( clone_index = 0;
+		     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+		     clone_index++ )
+		{
+			result = libcthreads_thread_create(
+			          &( clone_reads[ clone_index ].thread ),
+			          NULL,
+			          (int (*)(void *)) &fsapfs_test_container_clone_read_root_directory,
+			          (void *) &( clone_reads[ clone_index ] ),
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		for( clone_index = 0;
+		     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+		     clone_index++ )
+		{
+			result = libcthreads_thread_join(
+			          &( clone_reads[ clone_index ].thread ),
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+#else
+		for( clone_index = 0;
+		     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+		     clone_index++ )
+		{
+			fsapfs_test_container_clone_read_root_directory(
+			 &( clone_reads[ clone_index ] ) );
+		}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+		for( clone_index = 0;
+		     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+		     clone_index++ )
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 clone_reads[ clone_index ].result,
+			 1 );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "number_of_sub_file_entries",
+			 clone_reads[ clone_index ].number_of_sub_file_entries,
+			 source_read.number_of_sub_file_entries );
+
+			result = libfsapfs_volume_free(
+			          &( clone_reads[ clone_index ].volume ),
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Free the source container before its clone
 	 */
-	result = libfsapfs_container_get_number_of_volumes(
-	          container,
-	          &number_of_volumes,
+	result = libfsapfs_container_free(
+	          &source_container,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
@@ -1222,42 +3022,75 @@ int fsapfs_test_container_get_number_of_volumes(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
 	result = libfsapfs_container_get_number_of_volumes(
-	          NULL,
+	          container_clone,
 	          &number_of_volumes,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( number_of_volumes > 0 )
+	{
+		result = libfsapfs_container_get_volume_by_index(
+		          container_clone,
+		          0,
+		          &source_volume,
+		          &error );
 
-	result = libfsapfs_container_get_number_of_volumes(
-	          container,
-	          NULL,
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		source_read.volume = source_volume;
+
+		result = fsapfs_test_container_clone_read_root_directory(
+		          &source_read );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfsapfs_volume_free(
+		          &source_volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libfsapfs_container_free(
+	          &container_clone,
 	          &error );
 
 	FSAPFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	FSAPFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1266,6 +3099,35 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( clone_index = 0;
+	     clone_index < FSAPFS_TEST_CONTAINER_NUMBER_OF_CLONES;
+	     clone_index++ )
+	{
+		if( clone_reads[ clone_index ].volume != NULL )
+		{
+			libfsapfs_volume_free(
+			 &( clone_reads[ clone_index ].volume ),
+			 NULL );
+		}
+	}
+	if( source_volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &source_volume,
+		 NULL );
+	}
+	if( container_clone != NULL )
+	{
+		libfsapfs_container_free(
+		 &container_clone,
+		 NULL );
+	}
+	if( source_container != NULL )
+	{
+		libfsapfs_container_free(
+		 &source_container,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -1356,6 +3218,18 @@ int main(
 	 "libfsapfs_container_free",
 	 fsapfs_test_container_free );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_container_clone",
+	 fsapfs_test_container_clone );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_container_checkpoints_set_block_number",
+	 fsapfs_test_container_checkpoints_set_block_number );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1451,6 +3325,11 @@ int main(
 		 fsapfs_test_container_open_file_io_handle,
 		 source );
 
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_open_file_io_pool",
+		 fsapfs_test_container_open_file_io_pool,
+		 source );
+
 		FSAPFS_TEST_RUN(
 		 "libfsapfs_container_close",
 		 fsapfs_test_container_close );
@@ -1507,6 +3386,36 @@ int main(
 
 		/* TODO: add tests for libfsapfs_container_get_volume_by_index */
 
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_get_memory_usage",
+		 fsapfs_test_container_get_memory_usage,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_trim_caches",
+		 fsapfs_test_container_trim_caches,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_open_all_volumes",
+		 fsapfs_test_container_open_all_volumes,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_get_number_of_checkpoints",
+		 fsapfs_test_container_get_number_of_checkpoints,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_open_checkpoint",
+		 fsapfs_test_container_open_checkpoint,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_clone",
+		 fsapfs_test_container_clone_parallel_read,
+		 container );
+
 		/* Clean up
 		 */
 		result = fsapfs_test_container_close_source(
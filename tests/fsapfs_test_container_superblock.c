@@ -810,6 +810,16 @@ int fsapfs_test_container_superblock_read_data(
 	 "error",
 	 error );
 
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "container_superblock->checkpoint_descriptor_index",
+	 container_superblock->checkpoint_descriptor_index,
+	 (uint32_t) 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "container_superblock->checkpoint_descriptor_number_of_blocks",
+	 container_superblock->checkpoint_descriptor_number_of_blocks,
+	 (uint32_t) 2 );
+
 	/* Test error cases
 	 */
 	result = libfsapfs_container_superblock_read_data(
@@ -0,0 +1,2272 @@
+/*
+ * Library cursor type test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_cursor.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_file_system_btree.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
+
+uint8_t fsapfs_test_cursor_data1[ 76 ] = {
+	0x66, 0x73, 0x61, 0x70, 0x66, 0x73, 0x63, 0x72, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x2e, 0x00 };
+
+/* A file system B-tree root node that is a leaf node with 18 records
+ */
+uint8_t fsapfs_test_cursor_data2[ 4096 ] = {
+	0xf0, 0xac, 0xe4, 0x68, 0xe9, 0xb0, 0xe2, 0x5a, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x0d, 0x01, 0x5b, 0x07,
+	0xff, 0xff, 0x00, 0x00, 0xb8, 0x05, 0x74, 0x02, 0x19, 0x00, 0x18, 0x00, 0x90, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x11, 0x00, 0x08, 0x00, 0x7e, 0x00, 0x6c, 0x00,
+	0x39, 0x00, 0x17, 0x00, 0x16, 0x01, 0x12, 0x00, 0x31, 0x00, 0x08, 0x00, 0x04, 0x01, 0x74, 0x00,
+	0x50, 0x00, 0x08, 0x00, 0x8a, 0x01, 0x74, 0x00, 0x58, 0x00, 0x1b, 0x00, 0x9c, 0x01, 0x12, 0x00,
+	0x93, 0x00, 0x1d, 0x00, 0xd8, 0x02, 0x12, 0x00, 0xd0, 0x00, 0x1d, 0x00, 0x44, 0x04, 0x12, 0x00,
+	0x73, 0x00, 0x08, 0x00, 0x90, 0x03, 0xa0, 0x00, 0x7b, 0x00, 0x08, 0x00, 0x14, 0x02, 0x04, 0x00,
+	0x83, 0x00, 0x10, 0x00, 0x2c, 0x02, 0x18, 0x00, 0xb0, 0x00, 0x08, 0x00, 0x04, 0x05, 0xa8, 0x00,
+	0xb8, 0x00, 0x08, 0x00, 0x4a, 0x02, 0x04, 0x00, 0xc0, 0x00, 0x10, 0x00, 0x46, 0x02, 0x18, 0x00,
+	0xed, 0x00, 0x08, 0x00, 0x78, 0x06, 0xa8, 0x00, 0xf5, 0x00, 0x08, 0x00, 0xb6, 0x03, 0x04, 0x00,
+	0xfd, 0x00, 0x10, 0x00, 0xb2, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+	0x05, 0xe4, 0x71, 0xb6, 0x72, 0x6f, 0x6f, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0c, 0x8c, 0xa6, 0xac, 0x70, 0x72, 0x69,
+	0x76, 0x61, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x14, 0xbe, 0x9c, 0x2e, 0x66, 0x73,
+	0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0f, 0x14, 0x12, 0x11, 0x66, 0x73, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x90, 0x11, 0x08, 0xef, 0x5f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+	0x11, 0xec, 0xcb, 0xd5, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37,
+	0x37, 0x32, 0x30, 0x36, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x13, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00,
+	0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd0, 0x05, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x48, 0x00,
+	0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x05, 0x00, 0x08, 0x00, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe5, 0xa2, 0x42, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0xe5, 0xa2, 0x42, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x40, 0x00, 0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x44, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0x08, 0x00, 0x9a, 0x03, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00,
+	0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x04, 0x02, 0x11, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x04,
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x40, 0xc1, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x1b, 0xf8, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x40, 0xc1, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x38, 0x00, 0x04, 0x02, 0x0f, 0x00, 0x08, 0x20, 0x28, 0x00,
+	0x66, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x08, 0x00, 0xf0, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23,
+	0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23,
+	0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00,
+	0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x18, 0x00, 0x04, 0x02, 0x11, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x02, 0x0f, 0x00, 0x66, 0x73, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x08, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f,
+	0x71, 0x56, 0x55, 0x23, 0x52, 0x15, 0xfc, 0x68, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xfc, 0x68,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xc1, 0xd6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xc0, 0x41,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x02,
+	0x0b, 0x00, 0x2e, 0x66, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x71, 0x56, 0x55, 0x23,
+	0x52, 0x15, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12,
+	0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12,
+	0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x10, 0x00, 0x04, 0x02, 0x0c, 0x00, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x2d,
+	0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x41, 0xb8, 0x12, 0x55, 0x23,
+	0x52, 0x15, 0x85, 0x2b, 0x71, 0x56, 0x55, 0x23, 0x52, 0x15, 0x85, 0x2b, 0x71, 0x56, 0x55, 0x23,
+	0x52, 0x15, 0xda, 0x41, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x04, 0x02, 0x05, 0x00, 0x72, 0x6f,
+	0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x41,
+	0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libfsapfs_cursor_t *cursor                      = NULL;
+	libfsapfs_file_system_btree_t file_system_btree;
+	int result                                      = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &file_system_btree,
+	 0,
+	 sizeof( libfsapfs_file_system_btree_t ) );
+
+	file_system_btree.transaction_identifier = 5;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_free(
+	          &cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cursor_initialize(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cursor = (libfsapfs_cursor_t *) 0x12345678UL;
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &file_system_btree,
+	          &error );
+
+	cursor = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_cursor_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_cursor_initialize(
+		          &cursor,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &file_system_btree,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( cursor != NULL )
+			{
+				libfsapfs_cursor_free(
+				 &cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "cursor",
+			 cursor );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_cursor_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_cursor_initialize(
+		          &cursor,
+		          NULL,
+		          NULL,
+		          NULL,
+		          &file_system_btree,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( cursor != NULL )
+			{
+				libfsapfs_cursor_free(
+				 &cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "cursor",
+			 cursor );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cursor_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_internal_cursor_read_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_internal_cursor_read_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 76 ];
+
+	libcerror_error_t *error                        = NULL;
+	libfsapfs_cursor_t *cursor                      = NULL;
+	libfsapfs_file_system_btree_t file_system_btree;
+	size_t byte_stream_size                         = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &file_system_btree,
+	 0,
+	 sizeof( libfsapfs_file_system_btree_t ) );
+
+	file_system_btree.transaction_identifier = 5;
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          fsapfs_test_cursor_data1,
+	          76,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_cursor->flags",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->flags,
+	 (uint32_t) LIBFSAPFS_CURSOR_FLAG_IS_DIRECTORY_CURSOR );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_cursor->directory_identifier",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->directory_identifier,
+	 (uint64_t) 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->number_of_levels",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->number_of_levels,
+	 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_cursor->block_numbers[ 1 ]",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->block_numbers[ 1 ],
+	 (uint64_t) 0x0422 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->entry_indexes[ 1 ]",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->entry_indexes[ 1 ],
+	 7 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_cursor->key_data_size",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->key_data_size,
+	 (size_t) 12 );
+
+	result = libfsapfs_cursor_get_byte_stream_size(
+	          cursor,
+	          &byte_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 76 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_copy_to_byte_stream(
+	          cursor,
+	          byte_stream,
+	          76,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fsapfs_test_cursor_data1,
+	          76 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          NULL,
+	          fsapfs_test_cursor_data1,
+	          76,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          NULL,
+	          76,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          fsapfs_test_cursor_data1,
+	          75,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	byte_stream[ 0 ] = 0xff;
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          byte_stream,
+	          76,
+	          &error );
+
+	byte_stream[ 0 ] = fsapfs_test_cursor_data1[ 0 ];
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the transaction identifier does not match
+	 */
+	byte_stream[ 16 ] = 0x06;
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          byte_stream,
+	          76,
+	          &error );
+
+	byte_stream[ 16 ] = fsapfs_test_cursor_data1[ 16 ];
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of levels is invalid
+	 */
+	byte_stream[ 32 ] = 0x00;
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          byte_stream,
+	          76,
+	          &error );
+
+	byte_stream[ 32 ] = fsapfs_test_cursor_data1[ 32 ];
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cursor_free(
+	          &cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_internal_cursor_seek function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_internal_cursor_seek(
+     void )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_cursor_t *cursor                       = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* The root node is a leaf node stored in block 0
+	 */
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_cursor_data2,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          16,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first of the 3 directory records of identifier 16 is entry 6 of the leaf node
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->number_of_levels",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->number_of_levels,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->entry_indexes[ 0 ]",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->entry_indexes[ 0 ],
+	 6 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_cursor->key_data_size",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->key_data_size,
+	 (size_t) 27 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_cursor->flags",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->flags,
+	 (uint32_t) 0 );
+
+	/* Seeking a record type that is not stored positions the cursor at the next record
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          17,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_EXTENDED_ATTRIBUTE,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->entry_indexes[ 0 ]",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->entry_indexes[ 0 ],
+	 10 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_cursor->key_data_size",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->key_data_size,
+	 (size_t) 8 );
+
+	/* Seeking past the last record positions the cursor at the end
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          20,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_cursor->flags",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->flags,
+	 (uint32_t) LIBFSAPFS_CURSOR_FLAG_IS_AT_END );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_cursor->key_data_size",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->key_data_size,
+	 (size_t) 0 );
+
+	/* Seeking again clears the end of the cursor
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "internal_cursor->entry_indexes[ 0 ]",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->entry_indexes[ 0 ],
+	 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_cursor->flags",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->flags,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          NULL,
+	          16,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libfsapfs_internal_cursor_t *) cursor )->file_system_btree = NULL;
+
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          16,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+	          &error );
+
+	( (libfsapfs_internal_cursor_t *) cursor )->file_system_btree = file_system_btree;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the root node cannot be read
+	 */
+	file_system_btree->root_node_block_number = 1;
+
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          16,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
+	          &error );
+
+	file_system_btree->root_node_block_number = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_cursor->flags",
+	 ( (libfsapfs_internal_cursor_t *) cursor )->flags,
+	 (uint32_t) LIBFSAPFS_CURSOR_FLAG_IS_AT_END );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cursor_free(
+	          &cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cursor_get_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cursor_get_record(
+     void )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_cursor_t *cursor                       = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	size_t key_data_size                             = 0;
+	size_t value_data_size                           = 0;
+	uint64_t identifier                              = 0;
+	uint8_t record_type                              = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* The root node is a leaf node stored in block 0
+	 */
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_cursor_data2,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          2,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 (uint64_t) 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "record_type",
+	 record_type,
+	 (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_size",
+	 key_data_size,
+	 (size_t) 8 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 108 );
+
+	/* Test get record when the cursor is positioned at the end
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          20,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cursor_get_record(
+	          NULL,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          NULL,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          NULL,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cursor_free(
+	          &cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cursor_move_to_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cursor_move_to_next_record(
+     void )
+{
+	uint8_t byte_stream[ 128 ];
+
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_cursor_t *cursor                       = NULL;
+	libfsapfs_cursor_t *resumed_cursor               = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	size_t byte_stream_size                          = 0;
+	size_t key_data_size                             = 0;
+	size_t value_data_size                           = 0;
+	uint64_t identifier                              = 0;
+	uint8_t record_type                              = 0;
+	int number_of_records                            = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* The root node is a leaf node stored in block 0
+	 */
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_cursor_data2,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_initialize(
+	          &cursor,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* The leaf node contains 18 records
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		number_of_records++;
+
+		result = libfsapfs_cursor_move_to_next_record(
+		          cursor,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( ( result == 1 )
+	    && ( number_of_records < 32 ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 18 );
+
+	/* Test move to next record when the cursor is positioned at the end
+	 */
+	result = libfsapfs_cursor_move_to_next_record(
+	          cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test resuming iteration from a byte stream of a cursor positioned by seek
+	 */
+	result = libfsapfs_internal_cursor_seek(
+	          (libfsapfs_internal_cursor_t *) cursor,
+	          17,
+	          LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_FILE_EXTENT,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_move_to_next_record(
+	          cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_get_record(
+	          cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 (uint64_t) 18 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "record_type",
+	 record_type,
+	 (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_size",
+	 key_data_size,
+	 (size_t) 8 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 168 );
+
+	result = libfsapfs_cursor_get_byte_stream_size(
+	          cursor,
+	          &byte_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "byte_stream_size",
+	 byte_stream_size,
+	 (size_t) 60 );
+
+	result = libfsapfs_cursor_copy_to_byte_stream(
+	          cursor,
+	          byte_stream,
+	          byte_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_initialize(
+	          &resumed_cursor,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "resumed_cursor",
+	 resumed_cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_internal_cursor_read_byte_stream(
+	          (libfsapfs_internal_cursor_t *) resumed_cursor,
+	          byte_stream,
+	          byte_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_internal_cursor_validate_path(
+	          (libfsapfs_internal_cursor_t *) resumed_cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_get_record(
+	          resumed_cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 (uint64_t) 18 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "record_type",
+	 record_type,
+	 (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_INODE );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_size",
+	 key_data_size,
+	 (size_t) 8 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 168 );
+
+	result = libfsapfs_cursor_move_to_next_record(
+	          resumed_cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_get_record(
+	          resumed_cursor,
+	          &identifier,
+	          &record_type,
+	          &key_data_size,
+	          &value_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 (uint64_t) 18 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "record_type",
+	 record_type,
+	 (uint8_t) 6 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "key_data_size",
+	 key_data_size,
+	 (size_t) 8 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cursor_move_to_next_record(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cursor_free(
+	          &resumed_cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "resumed_cursor",
+	 resumed_cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cursor_free(
+	          &cursor,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cursor",
+	 cursor );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resumed_cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &resumed_cursor,
+		 NULL );
+	}
+	if( cursor != NULL )
+	{
+		libfsapfs_cursor_free(
+		 &cursor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cursor_initialize",
+	 fsapfs_test_cursor_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cursor_free",
+	 fsapfs_test_cursor_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_internal_cursor_read_byte_stream",
+	 fsapfs_test_internal_cursor_read_byte_stream );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_internal_cursor_seek",
+	 fsapfs_test_internal_cursor_seek );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cursor_get_record",
+	 fsapfs_test_cursor_get_record );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cursor_move_to_next_record",
+	 fsapfs_test_cursor_move_to_next_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
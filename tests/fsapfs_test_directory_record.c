@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -590,6 +591,240 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_directory_record_get_utf8_name_view function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_directory_record_get_utf8_name_view(
+     void )
+{
+	uint8_t utf8_name[ 32 ];
+
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_directory_record_t *directory_record = NULL;
+	const uint8_t *utf8_string                     = NULL;
+	size_t utf8_name_size                          = 0;
+	size_t utf8_string_length                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_directory_record_initialize(
+	          &directory_record,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_record",
+	 directory_record );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test name not available
+	 */
+	result = libfsapfs_directory_record_get_utf8_name_view(
+	          directory_record,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_directory_record_read_key_data(
+	          directory_record,
+	          fsapfs_test_directory_record_key_data1,
+	          23,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_directory_record_get_utf8_name_view(
+	          directory_record,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          utf8_string,
+	          ".fseventsd",
+	          10 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsapfs_directory_record_get_utf8_name_size(
+	          directory_record,
+	          &utf8_name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 utf8_string_length + 1 );
+
+	result = libfsapfs_directory_record_get_utf8_name(
+	          directory_record,
+	          utf8_name,
+	          32,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          utf8_name,
+	          utf8_string_length );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_directory_record_get_utf8_name_view(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_utf8_name_view(
+	          directory_record,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_utf8_name_view(
+	          directory_record,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_directory_record_free(
+	          &directory_record,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "directory_record",
+	 directory_record );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -625,6 +860,10 @@ int main(
 	 "libfsapfs_directory_record_read_value_data",
 	 fsapfs_test_directory_record_read_value_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_directory_record_get_utf8_name_view",
+	 fsapfs_test_directory_record_get_utf8_name_view );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
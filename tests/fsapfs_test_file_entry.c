@@ -21,22 +21,1090 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcdata.h"
 #include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfdata.h"
 #include "fsapfs_test_libfsapfs.h"
 #include "fsapfs_test_macros.h"
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_data_stream.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_directory_record.h"
 #include "../libfsapfs/libfsapfs_file_entry.h"
+#include "../libfsapfs/libfsapfs_file_extent.h"
+#include "../libfsapfs/libfsapfs_inode.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
+
+uint8_t fsapfs_test_file_entry_directory_record_key_data1[ 23 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x14, 0xbe, 0x9c, 0x2e, 0x66, 0x73, 0x65,
+	0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x00 };
+
+uint8_t fsapfs_test_file_entry_inode_value_data1[ 160 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x35, 0xa8, 0x88, 0x4a, 0x54, 0x55, 0x52, 0x15, 0x40, 0x3f, 0x48, 0xfd, 0x55, 0x55, 0x52, 0x15,
+	0x6f, 0x74, 0x48, 0xfd, 0x55, 0x55, 0x52, 0x15, 0x40, 0x3f, 0x48, 0xfd, 0x55, 0x55, 0x52, 0x15,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x38, 0x00,
+	0x04, 0x02, 0x0f, 0x00, 0x08, 0x20, 0x28, 0x00, 0x66, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73,
+	0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
+/* Tests the libfsapfs_file_entry_read_vector function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_entry_read_vector(
+     void )
+{
+	uint8_t range_data[ 6 ][ 512 ];
+
+	/* The ranges are out of order, the second range overlaps with the third,
+	 * the third is adjacent to the fourth, the first crosses the boundary
+	 * between the file extents and the fifth extends beyond the end of the data
+	 */
+	off64_t range_offsets[ 6 ]             = { 8000, 100, 250, 350, 16300, 1000 };
+	size_t range_sizes[ 6 ]                = { 400, 200, 100, 50, 200, 0 };
+	ssize_t expected_read_counts[ 6 ]      = { 400, 200, 100, 50, 84, 0 };
+
+	uint8_t *range_buffers[ 6 ]            = { NULL, NULL, NULL, NULL, NULL, NULL };
+	ssize_t range_read_counts[ 6 ]         = { 0, 0, 0, 0, 0, 0 };
+
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcdata_array_t *file_extents         = NULL;
+	libcerror_error_t *error               = NULL;
+	libfdata_stream_t *data_stream         = NULL;
+	libfsapfs_file_entry_t *file_entry     = NULL;
+	libfsapfs_file_extent_t *file_extent   = NULL;
+	libfsapfs_io_handle_t *io_handle       = NULL;
+	uint8_t *data                          = NULL;
+	uint8_t *expected_data                 = NULL;
+	size_t data_offset                     = 0;
+	ssize_t read_count                     = 0;
+	off64_t offset                         = 0;
+	off64_t physical_offset                = 0;
+	int entry_index                        = 0;
+	int extent_index                       = 0;
+	int range_index                        = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	for( range_index = 0;
+	     range_index < 6;
+	     range_index++ )
+	{
+		range_buffers[ range_index ] = range_data[ range_index ];
+	}
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* The first file extent is stored in the second half of the data and
+	 * the second file extent in the first half
+	 */
+	result = libcdata_array_initialize(
+	          &file_extents,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extents",
+	 file_extents );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 2;
+	     extent_index++ )
+	{
+		result = libfsapfs_file_extent_initialize(
+		          &file_extent,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_extent",
+		 file_extent );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_extent->logical_offset        = (uint64_t) extent_index * 8192;
+		file_extent->physical_block_number = ( extent_index == 0 ) ? 2 : 0;
+		file_extent->data_size             = 8192;
+
+		result = libcdata_array_append_entry(
+		          file_extents,
+		          &entry_index,
+		          (intptr_t *) file_extent,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		file_extent = NULL;
+	}
+	result = libfsapfs_data_stream_initialize_from_file_extents(
+	          &data_stream,
+	          io_handle,
+	          NULL,
+	          file_extents,
+	          16384,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_stream",
+	 data_stream );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	data = (uint8_t *) memory_allocate(
+	                    16384 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             16384 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset % 251 ) + ( data_offset / 4096 ) );
+	}
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		if( data_offset < 8192 )
+		{
+			physical_offset = (off64_t) data_offset + 8192;
+		}
+		else
+		{
+			physical_offset = (off64_t) data_offset - 8192;
+		}
+		expected_data[ data_offset ] = data[ physical_offset ];
+	}
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          16384,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_entry_initialize(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libfsapfs_internal_file_entry_t *) file_entry )->file_extents = file_extents;
+	( (libfsapfs_internal_file_entry_t *) file_entry )->data_stream  = data_stream;
+
+	file_extents = NULL;
+	data_stream  = NULL;
+
+	/* Test regular cases
+	 */
+	offset = libfsapfs_file_entry_seek_offset(
+	          file_entry,
+	          4096,
+	          SEEK_SET,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 834 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_entry_get_offset(
+	          file_entry,
+	          &offset,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 6;
+	     range_index++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "range_read_counts[ range_index ]",
+		 range_read_counts[ range_index ],
+		 expected_read_counts[ range_index ] );
+
+		result = memory_compare(
+		          range_buffers[ range_index ],
+		          &( expected_data[ range_offsets[ range_index ] ] ),
+		          (size_t) expected_read_counts[ range_index ] );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsapfs_file_entry_read_vector(
+	              NULL,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              NULL,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              NULL,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              NULL,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              NULL,
+	              6,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              -1,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              LIBFSAPFS_READ_VECTOR_MAXIMUM_NUMBER_OF_RANGES + 1,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	range_buffers[ 1 ] = NULL;
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	range_buffers[ 1 ] = range_data[ 1 ];
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	range_offsets[ 1 ] = -1;
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	range_offsets[ 1 ] = 100;
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	range_offsets[ 1 ] = INT64_MAX - 100;
+
+	read_count = libfsapfs_file_entry_read_vector(
+	              file_entry,
+	              range_buffers,
+	              range_sizes,
+	              range_offsets,
+	              range_read_counts,
+	              6,
+	              &error );
+
+	range_offsets[ 1 ] = 100;
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 expected_data );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	if( file_extents != NULL )
+	{
+		libcdata_array_free(
+		 &file_extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_entry_get_utf8_name_view function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_entry_get_utf8_name_view(
+     void )
+{
+	uint8_t utf8_name[ 32 ];
+
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_directory_record_t *directory_record = NULL;
+	libfsapfs_file_entry_t *file_entry             = NULL;
+	libfsapfs_inode_t *inode                       = NULL;
+	const uint8_t *utf8_string                     = NULL;
+	size_t utf8_name_size                          = 0;
+	size_t utf8_string_length                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_inode_read_value_data(
+	          inode,
+	          fsapfs_test_file_entry_inode_value_data1,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_directory_record_initialize(
+	          &directory_record,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_record",
+	 directory_record );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_directory_record_read_key_data(
+	          directory_record,
+	          fsapfs_test_file_entry_directory_record_key_data1,
+	          23,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The file entry takes over management of the inode
+	 */
+	result = libfsapfs_file_entry_initialize(
+	          &file_entry,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          inode,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_entry_get_utf8_name_view(
+	          file_entry,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 14 );
+
+	result = libfsapfs_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &utf8_name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 utf8_string_length + 1 );
+
+	result = libfsapfs_file_entry_get_utf8_name(
+	          file_entry,
+	          utf8_name,
+	          32,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          utf8_name,
+	          utf8_string_length );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "fseventsd-uuid",
+	          14 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test name retrieved from the directory record
+	 */
+	( (libfsapfs_internal_file_entry_t *) file_entry )->directory_record = directory_record;
+
+	directory_record = NULL;
+
+	result = libfsapfs_file_entry_get_utf8_name_view(
+	          file_entry,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 10 );
+
+	result = libfsapfs_file_entry_get_utf8_name_size(
+	          file_entry,
+	          &utf8_name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 utf8_string_length + 1 );
+
+	result = libfsapfs_file_entry_get_utf8_name(
+	          file_entry,
+	          utf8_name,
+	          32,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          utf8_name,
+	          utf8_string_length );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          utf8_string,
+	          ".fseventsd",
+	          10 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_entry_get_utf8_name_view(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_entry_get_utf8_name_view(
+	          file_entry,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_entry_get_utf8_name_view(
+	          file_entry,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( directory_record != NULL )
+	{
+		libfsapfs_directory_record_free(
+		 &directory_record,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* Tests the libfsapfs_file_entry_free function
@@ -120,6 +1188,14 @@ int main(
 
 	/* TODO: add tests for libfsapfs_file_entry_get_utf8_name */
 
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_entry_get_utf8_name_view",
+	 fsapfs_test_file_entry_get_utf8_name_view );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
 	/* TODO: add tests for libfsapfs_file_entry_get_utf16_name_size */
 
 	/* TODO: add tests for libfsapfs_file_entry_get_utf16_name */
@@ -132,6 +1208,14 @@ int main(
 
 	/* TODO: add tests for libfsapfs_file_entry_read_buffer_at_offset */
 
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_entry_read_vector",
+	 fsapfs_test_file_entry_read_vector );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
 	/* TODO: add tests for libfsapfs_file_entry_seek_offset */
 
 	/* TODO: add tests for libfsapfs_file_entry_get_offset */
@@ -35,6 +35,9 @@
 
 #include "../libfsapfs/libfsapfs_file_extent.h"
 
+uint8_t fsapfs_test_file_extent_tree_value_data1[ 16 ] = {
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x34, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
 /* Tests the libfsapfs_file_extent_initialize function
@@ -270,6 +273,154 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_file_extent_read_file_extent_tree_value_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_extent_read_file_extent_tree_value_data(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_file_extent_t *file_extent = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_file_extent_initialize(
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extent",
+	 file_extent );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_extent_read_file_extent_tree_value_data(
+	          file_extent,
+	          fsapfs_test_file_extent_tree_value_data1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_extent->data_size",
+	 file_extent->data_size,
+	 (uint64_t) 0x00002000UL );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "file_extent->physical_block_number",
+	 file_extent->physical_block_number,
+	 (uint64_t) 0x00001234UL );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_extent_read_file_extent_tree_value_data(
+	          NULL,
+	          fsapfs_test_file_extent_tree_value_data1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_extent_read_file_extent_tree_value_data(
+	          file_extent,
+	          NULL,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_extent_read_file_extent_tree_value_data(
+	          file_extent,
+	          fsapfs_test_file_extent_tree_value_data1,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_extent_free(
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_extent",
+	 file_extent );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -301,6 +452,10 @@ int main(
 
 	/* TODO: add tests for libfsapfs_file_extent_read_value_data */
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_extent_read_file_extent_tree_value_data",
+	 fsapfs_test_file_extent_read_file_extent_tree_value_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,784 @@
+/*
+ * Library file reference functions test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_file_reference.h"
+#include "../libfsapfs/libfsapfs_inode.h"
+
+uint8_t fsapfs_test_file_reference_data1[ 42 ] = {
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xa4, 0x81 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_file_reference_set_from_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_set_from_inode(
+     void )
+{
+	uint8_t file_reference[ LIBFSAPFS_FILE_REFERENCE_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	libfsapfs_inode_t *inode = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	inode->identifier        = 16;
+	inode->parent_identifier = 2;
+	inode->data_stream_size  = 4096;
+	inode->modification_time = 0x1600000000000000UL;
+	inode->file_mode         = 0x81a4;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_set_from_inode(
+	          file_reference,
+	          LIBFSAPFS_FILE_REFERENCE_SIZE,
+	          5,
+	          inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          file_reference,
+	          fsapfs_test_file_reference_data1,
+	          LIBFSAPFS_FILE_REFERENCE_SIZE );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_set_from_inode(
+	          NULL,
+	          LIBFSAPFS_FILE_REFERENCE_SIZE,
+	          5,
+	          inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_set_from_inode(
+	          file_reference,
+	          LIBFSAPFS_FILE_REFERENCE_SIZE - 1,
+	          5,
+	          inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_set_from_inode(
+	          file_reference,
+	          LIBFSAPFS_FILE_REFERENCE_SIZE,
+	          5,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* Tests the libfsapfs_file_reference_get_transaction_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_transaction_identifier(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t transaction_identifier = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_transaction_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &transaction_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "transaction_identifier",
+	 transaction_identifier,
+	 (uint64_t) 5 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_transaction_identifier(
+	          NULL,
+	          42,
+	          &transaction_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_transaction_identifier(
+	          fsapfs_test_file_reference_data1,
+	          41,
+	          &transaction_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_transaction_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_reference_get_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t identifier      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 (uint64_t) 16 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_identifier(
+	          NULL,
+	          42,
+	          &identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_identifier(
+	          fsapfs_test_file_reference_data1,
+	          41,
+	          &identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_reference_get_parent_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_parent_identifier(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t parent_identifier = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_parent_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &parent_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "parent_identifier",
+	 parent_identifier,
+	 (uint64_t) 2 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_parent_identifier(
+	          NULL,
+	          42,
+	          &parent_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_parent_identifier(
+	          fsapfs_test_file_reference_data1,
+	          41,
+	          &parent_identifier,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_parent_identifier(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_reference_get_data_stream_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_data_stream_size(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t data_stream_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_data_stream_size(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &data_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_stream_size",
+	 data_stream_size,
+	 (uint64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_data_stream_size(
+	          NULL,
+	          42,
+	          &data_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_data_stream_size(
+	          fsapfs_test_file_reference_data1,
+	          41,
+	          &data_stream_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_reference_get_data_stream_size(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_reference_get_modification_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_modification_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_modification_time(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &posix_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "posix_time",
+	 posix_time,
+	 (int64_t) 0x1600000000000000L );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_modification_time(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_reference_get_file_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_reference_get_file_mode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t file_mode       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_reference_get_file_mode(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          &file_mode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT16(
+	 "file_mode",
+	 file_mode,
+	 (uint16_t) 0x81a4 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_reference_get_file_mode(
+	          fsapfs_test_file_reference_data1,
+	          42,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_set_from_inode",
+	 fsapfs_test_file_reference_set_from_inode );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_transaction_identifier",
+	 fsapfs_test_file_reference_get_transaction_identifier );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_identifier",
+	 fsapfs_test_file_reference_get_identifier );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_parent_identifier",
+	 fsapfs_test_file_reference_get_parent_identifier );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_data_stream_size",
+	 fsapfs_test_file_reference_get_data_stream_size );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_modification_time",
+	 fsapfs_test_file_reference_get_modification_time );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_reference_get_file_mode",
+	 fsapfs_test_file_reference_get_file_mode );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -28,13 +30,18 @@
 #endif
 
 #include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcdata.h"
 #include "fsapfs_test_libcerror.h"
 #include "fsapfs_test_libfsapfs.h"
 #include "fsapfs_test_macros.h"
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_btree_node.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
 #include "../libfsapfs/libfsapfs_file_system_btree.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
 
 uint8_t fsapfs_test_file_system_btree_data1[ 4096 ] = {
 	0xf0, 0xac, 0xe4, 0x68, 0xe9, 0xb0, 0xe2, 0x5a, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -320,6 +327,7 @@ int fsapfs_test_file_system_btree_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
 	          0,
 	          0,
 	          &error );
@@ -362,6 +370,7 @@ int fsapfs_test_file_system_btree_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
 	          0,
 	          0,
 	          &error );
@@ -386,6 +395,7 @@ int fsapfs_test_file_system_btree_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
 	          0,
 	          0,
 	          &error );
@@ -420,6 +430,7 @@ int fsapfs_test_file_system_btree_initialize(
 		          NULL,
 		          NULL,
 		          NULL,
+		          NULL,
 		          0,
 		          0,
 		          &error );
@@ -468,6 +479,7 @@ int fsapfs_test_file_system_btree_initialize(
 		          NULL,
 		          NULL,
 		          NULL,
+		          NULL,
 		          0,
 		          0,
 		          &error );
@@ -559,56 +571,1382 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libfsapfs_file_system_btree_read_node function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fsapfs_test_file_system_btree_read_node(
+     void )
 {
-	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
-	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_btree_node_t *node                     = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	uint8_t *pooled_buffer                           = NULL;
+	int result                                       = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	FSAPFS_TEST_RUN(
-	 "libfsapfs_file_system_btree_initialize",
-	 fsapfs_test_file_system_btree_initialize );
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FSAPFS_TEST_RUN(
-	 "libfsapfs_file_system_btree_free",
-	 fsapfs_test_file_system_btree_free );
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_root_node */
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_sub_node */
+	io_handle->block_size = 4096;
 
-/* TODO add tests for libfsapfs_file_system_btree_get_entry_from_node_by_identifier */
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_directory_record_from_node_by_utf8_name */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_directory_record_from_node_by_utf16_name */
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_directory_entries */
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_directory_entries_from_node */
+	/* Initialize file IO handle
+	 */
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_file_system_btree_data1,
+	          4096,
+	          &error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_file_extents */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_file_extents_from_node */
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_identifier */
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_utf8_path */
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
 
-/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_utf16_path */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_keys",
+	 node->node_header->number_of_keys,
+	 18 );
+
+	result = libfsapfs_btree_node_free(
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block data is returned to the block buffer pool of the IO handle
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->block_buffer_pool->number_of_buffers",
+	 io_handle->block_buffer_pool->number_of_buffers,
+	 1 );
+
+	pooled_buffer = io_handle->block_buffer_pool->buffers[ 0 ];
+
+	/* Test that a repeated node read reuses the pooled buffer
+	 */
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_btree_node_free(
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->block_buffer_pool->number_of_buffers",
+	 io_handle->block_buffer_pool->number_of_buffers,
+	 1 );
+
+	result = (int) ( io_handle->block_buffer_pool->buffers[ 0 ] == pooled_buffer );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_system_btree_read_node(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0xffffffffffffffffUL,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a root node is read as a non-root node
+	 */
+	file_system_btree->root_node_block_number = 1;
+
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
+
+	file_system_btree->root_node_block_number = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "node",
+	 node );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is outside the file
+	 */
+	result = libfsapfs_file_system_btree_read_node(
+	          file_system_btree,
+	          file_io_handle,
+	          1,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &node,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_system_btree_get_root_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_system_btree_get_root_node(
+     void )
+{
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_btree_node_t *cached_node              = NULL;
+	libfsapfs_btree_node_t *node                     = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	int number_of_pending_nodes                      = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_file_system_btree_data1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_system_btree_get_root_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_keys",
+	 node->node_header->number_of_keys,
+	 18 );
+
+	/* Test that the node is kept as a pending node until the pending nodes are flushed
+	 */
+	result = libcdata_array_get_number_of_entries(
+	          file_system_btree->pending_nodes_array,
+	          &number_of_pending_nodes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_nodes",
+	 number_of_pending_nodes,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_get_root_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &cached_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_node",
+	 ( cached_node == node ),
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_flush_pending_nodes(
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          file_system_btree->pending_nodes_array,
+	          &number_of_pending_nodes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_nodes",
+	 number_of_pending_nodes,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the flushed node is retrieved from the node cache
+	 */
+	cached_node = NULL;
+
+	result = libfsapfs_file_system_btree_get_root_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          &cached_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_node",
+	 ( cached_node == node ),
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test flush without pending nodes
+	 */
+	result = libfsapfs_file_system_btree_flush_pending_nodes(
+	          file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The node is managed by the file system B-tree
+	 */
+	node        = NULL;
+	cached_node = NULL;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_system_btree_get_root_node(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_root_node(
+	          file_system_btree,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is outside the file
+	 */
+	result = libfsapfs_file_system_btree_get_root_node(
+	          file_system_btree,
+	          file_io_handle,
+	          1,
+	          &node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_flush_pending_nodes(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_file_system_btree_get_partition_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_system_btree_get_partition_identifiers(
+     void )
+{
+	uint64_t partition_identifiers[ LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS ];
+	uint8_t empty_node_data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	void *memcpy_result                              = NULL;
+	int number_of_partitions                         = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	/* The root node is a leaf node with 18 records stored in block 0
+	 */
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_file_system_btree_data1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test a single leaf node tree with a maximum of 1 partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          1,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test a single leaf node tree with a maximum of 4 partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          4,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test a single leaf node tree with a maximum of LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          NULL,
+	          file_io_handle,
+	          partition_identifiers,
+	          4,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          NULL,
+	          4,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          0,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          -1,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS + 1,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          4,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the root node is outside the file
+	 */
+	file_system_btree->root_node_block_number = 1;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          4,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_system_btree->root_node_block_number = 0;
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test with a root leaf node without records
+	 */
+	memcpy_result = memory_copy(
+	                 empty_node_data,
+	                 fsapfs_test_file_system_btree_data1,
+	                 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( empty_node_data[ 36 ] ),
+	 0 );
+
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_node_data,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test an empty tree with a maximum of 1 partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          1,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test an empty tree with a maximum of 4 partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          4,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test an empty tree with a maximum of LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS partitions
+	 */
+	partition_identifiers[ 0 ] = 0xffffffffffffffffUL;
+	number_of_partitions       = 0;
+
+	result = libfsapfs_file_system_btree_get_partition_identifiers(
+	          file_system_btree,
+	          file_io_handle,
+	          partition_identifiers,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_PARTITIONS,
+	          &number_of_partitions,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_identifiers[ 0 ]",
+	 partition_identifiers[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Clean up
+	 */
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_btree_initialize",
+	 fsapfs_test_file_system_btree_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_btree_free",
+	 fsapfs_test_file_system_btree_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_btree_get_root_node",
+	 fsapfs_test_file_system_btree_get_root_node );
+
+/* TODO add tests for libfsapfs_file_system_btree_get_sub_node */
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_btree_read_node",
+	 fsapfs_test_file_system_btree_read_node );
+
+/* TODO add tests for libfsapfs_file_system_btree_get_entry_from_node_by_identifier */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_directory_record_from_node_by_utf8_name */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_directory_record_from_node_by_utf16_name */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_directory_entries */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_directory_entries_from_node */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_file_extents */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_file_extents_from_node */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_identifier */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_utf8_path */
+
+/* TODO add tests for libfsapfs_file_system_btree_get_inode_by_utf16_path */
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_btree_get_partition_identifiers",
+	 fsapfs_test_file_system_btree_get_partition_identifiers );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
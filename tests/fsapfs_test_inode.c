@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -597,6 +598,473 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_inode_get_timestamps function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_inode_get_timestamps(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsapfs_inode_t *inode  = NULL;
+	int64_t access_time       = 0;
+	int64_t creation_time     = 0;
+	int64_t inode_change_time = 0;
+	int64_t modification_time = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_inode_read_value_data(
+	          inode,
+	          fsapfs_test_inode_value_data1,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_inode_get_timestamps(
+	          inode,
+	          &creation_time,
+	          &modification_time,
+	          &access_time,
+	          &inode_change_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "creation_time",
+	 creation_time,
+	 (int64_t) 0x15525555fd483f40UL );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "modification_time",
+	 modification_time,
+	 (int64_t) 0x155255544a88a835UL );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "access_time",
+	 access_time,
+	 (int64_t) 0x15525555fd483f40UL );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "inode_change_time",
+	 inode_change_time,
+	 (int64_t) 0x15525555fd48746fUL );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_inode_get_timestamps(
+	          NULL,
+	          &creation_time,
+	          &modification_time,
+	          &access_time,
+	          &inode_change_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_timestamps(
+	          inode,
+	          NULL,
+	          &modification_time,
+	          &access_time,
+	          &inode_change_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_timestamps(
+	          inode,
+	          &creation_time,
+	          NULL,
+	          &access_time,
+	          &inode_change_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_timestamps(
+	          inode,
+	          &creation_time,
+	          &modification_time,
+	          NULL,
+	          &inode_change_time,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_timestamps(
+	          inode,
+	          &creation_time,
+	          &modification_time,
+	          &access_time,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_inode_get_utf8_name_view function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_inode_get_utf8_name_view(
+     void )
+{
+	uint8_t utf8_name[ 32 ];
+
+	libcerror_error_t *error   = NULL;
+	libfsapfs_inode_t *inode   = NULL;
+	const uint8_t *utf8_string = NULL;
+	size_t utf8_name_size      = 0;
+	size_t utf8_string_length  = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_inode_initialize(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test name not available
+	 */
+	result = libfsapfs_inode_get_utf8_name_view(
+	          inode,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_inode_read_value_data(
+	          inode,
+	          fsapfs_test_inode_value_data1,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_inode_get_utf8_name_view(
+	          inode,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 14 );
+
+	result = libfsapfs_inode_get_utf8_name_size(
+	          inode,
+	          &utf8_name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 utf8_string_length + 1 );
+
+	result = libfsapfs_inode_get_utf8_name(
+	          inode,
+	          utf8_name,
+	          32,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          utf8_name,
+	          utf8_string_length );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          utf8_string,
+	          "fseventsd-uuid",
+	          14 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_inode_get_utf8_name_view(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_utf8_name_view(
+	          inode,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_inode_get_utf8_name_view(
+	          inode,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -632,6 +1100,10 @@ int main(
 	 "libfsapfs_inode_read_value_data",
 	 fsapfs_test_inode_read_value_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_inode_get_timestamps",
+	 fsapfs_test_inode_get_timestamps );
+
 /* TODO add tests for libfsapfs_inode_get_identifier */
 
 /* TODO add tests for libfsapfs_inode_get_data_stream_identifier */
@@ -640,6 +1112,10 @@ int main(
 
 /* TODO add tests for libfsapfs_inode_get_utf8_name */
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_inode_get_utf8_name_view",
+	 fsapfs_test_inode_get_utf8_name_view );
+
 /* TODO add tests for libfsapfs_inode_get_utf16_name_size */
 
 /* TODO add tests for libfsapfs_inode_get_utf16_name */
@@ -0,0 +1,918 @@
+/*
+ * Library integrity_metadata type test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_checksum.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_integrity_metadata.h"
+
+uint8_t fsapfs_test_integrity_metadata_data1[ 160 ] = {
+	0x22, 0xa3, 0x1d, 0xe9, 0x1a, 0x05, 0x57, 0x53, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e, 0x55, 0x5c, 0x63, 0x6a,
+	0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2, 0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_integrity_metadata_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_integrity_metadata_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_integrity_metadata_t *integrity_metadata = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                  = 1;
+	int number_of_memset_fail_tests                  = 1;
+	int test_number                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_integrity_metadata_initialize(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_integrity_metadata_free(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_integrity_metadata_initialize(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	integrity_metadata = (libfsapfs_integrity_metadata_t *) 0x12345678UL;
+
+	result = libfsapfs_integrity_metadata_initialize(
+	          &integrity_metadata,
+	          &error );
+
+	integrity_metadata = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_integrity_metadata_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_integrity_metadata_initialize(
+		          &integrity_metadata,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( integrity_metadata != NULL )
+			{
+				libfsapfs_integrity_metadata_free(
+				 &integrity_metadata,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "integrity_metadata",
+			 integrity_metadata );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_integrity_metadata_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_integrity_metadata_initialize(
+		          &integrity_metadata,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( integrity_metadata != NULL )
+			{
+				libfsapfs_integrity_metadata_free(
+				 &integrity_metadata,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "integrity_metadata",
+			 integrity_metadata );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integrity_metadata != NULL )
+	{
+		libfsapfs_integrity_metadata_free(
+		 &integrity_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_integrity_metadata_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_integrity_metadata_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_integrity_metadata_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_integrity_metadata_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_integrity_metadata_read_file_io_handle(
+     void )
+{
+	uint8_t integrity_metadata_data[ 8192 ];
+
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_integrity_metadata_t *integrity_metadata = NULL;
+	uint64_t checksum                                  = 0;
+	void *memcpy_result                                = NULL;
+	void *memset_result                                = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 * The integrity metadata object is stored in the second 4096 byte block
+	 * with a checksum that is valid for the full block
+	 */
+	memset_result = memory_set(
+	                 integrity_metadata_data,
+	                 0,
+	                 8192 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	memcpy_result = memory_copy(
+	                 &( integrity_metadata_data[ 4096 ] ),
+	                 fsapfs_test_integrity_metadata_data1,
+	                 160 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memcpy_result",
+	 memcpy_result );
+
+	result = libfsapfs_checksum_calculate_fletcher64(
+	          &checksum,
+	          &( integrity_metadata_data[ 4096 + 8 ] ),
+	          4096 - 8,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( integrity_metadata_data[ 4096 ] ),
+	 checksum );
+
+	result = libfsapfs_integrity_metadata_initialize(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          integrity_metadata_data,
+	          8192,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          file_io_handle,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "integrity_metadata->hash_type",
+	 integrity_metadata->hash_type,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "integrity_metadata->root_hash_size",
+	 integrity_metadata->root_hash_size,
+	 (size_t) 32 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "integrity_metadata->root_hash[ 0 ]",
+	 integrity_metadata->root_hash[ 0 ],
+	 0x01 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "integrity_metadata->root_hash[ 31 ]",
+	 integrity_metadata->root_hash[ 31 ],
+	 0xda );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          NULL,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block does not contain integrity metadata
+	 */
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is outside the file
+	 */
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          file_io_handle,
+	          8192,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the block is truncated
+	 */
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          file_io_handle,
+	          6144,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the block is corrupted and checksum verification fails
+	 */
+	integrity_metadata_data[ 4096 + 4000 ] = 0xff;
+
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          integrity_metadata_data,
+	          8192,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_integrity_metadata_read_file_io_handle(
+	          integrity_metadata,
+	          file_io_handle,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_integrity_metadata_free(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( integrity_metadata != NULL )
+	{
+		libfsapfs_integrity_metadata_free(
+		 &integrity_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_integrity_metadata_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_integrity_metadata_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_integrity_metadata_t *integrity_metadata = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_integrity_metadata_initialize(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_integrity_metadata_read_data(
+	          integrity_metadata,
+	          fsapfs_test_integrity_metadata_data1,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "integrity_metadata->hash_type",
+	 integrity_metadata->hash_type,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "integrity_metadata->root_hash_size",
+	 integrity_metadata->root_hash_size,
+	 (size_t) 32 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_integrity_metadata_read_data(
+	          NULL,
+	          fsapfs_test_integrity_metadata_data1,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_integrity_metadata_read_data(
+	          integrity_metadata,
+	          NULL,
+	          160,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_integrity_metadata_read_data(
+	          integrity_metadata,
+	          fsapfs_test_integrity_metadata_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_integrity_metadata_read_data(
+	          integrity_metadata,
+	          fsapfs_test_integrity_metadata_data1,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_integrity_metadata_free(
+	          &integrity_metadata,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "integrity_metadata",
+	 integrity_metadata );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( integrity_metadata != NULL )
+	{
+		libfsapfs_integrity_metadata_free(
+		 &integrity_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_integrity_metadata_get_hash_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_integrity_metadata_get_hash_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t hash_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_integrity_metadata_get_hash_size(
+	          LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA384,
+	          &hash_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "hash_size",
+	 hash_size,
+	 (size_t) 48 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_integrity_metadata_get_hash_size(
+	          0,
+	          &hash_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_integrity_metadata_get_hash_size(
+	          LIBFSAPFS_INTEGRITY_HASH_TYPE_SHA256,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_integrity_metadata_initialize",
+	 fsapfs_test_integrity_metadata_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_integrity_metadata_free",
+	 fsapfs_test_integrity_metadata_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_integrity_metadata_read_file_io_handle",
+	 fsapfs_test_integrity_metadata_read_file_io_handle );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_integrity_metadata_read_data",
+	 fsapfs_test_integrity_metadata_read_data );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_integrity_metadata_get_hash_size",
+	 fsapfs_test_integrity_metadata_get_hash_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
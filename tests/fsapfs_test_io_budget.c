@@ -0,0 +1,2681 @@
+/*
+ * Library I/O budget test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_getopt.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_container.h"
+#include "../libfsapfs/libfsapfs_file_entry.h"
+#include "../libfsapfs/libfsapfs_file_system_btree.h"
+#include "../libfsapfs/libfsapfs_inode.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
+
+#if !defined( LIBFSAPFS_HAVE_BFIO )
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_check_container_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_open_file_io_handle(
+     libfsapfs_container_t *container,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfsapfs_error_t **error );
+
+#endif /* !defined( LIBFSAPFS_HAVE_BFIO ) */
+
+uint8_t fsapfs_test_io_budget_file_system_btree_data1[ 4096 ] = {
+	0xf0, 0xac, 0xe4, 0x68, 0xe9, 0xb0, 0xe2, 0x5a, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x0d, 0x01, 0x5b, 0x07,
+	0xff, 0xff, 0x00, 0x00, 0xb8, 0x05, 0x74, 0x02, 0x19, 0x00, 0x18, 0x00, 0x90, 0x00, 0x12, 0x00,
+	0x00, 0x00, 0x11, 0x00, 0x12, 0x00, 0x12, 0x00, 0x11, 0x00, 0x08, 0x00, 0x7e, 0x00, 0x6c, 0x00,
+	0x39, 0x00, 0x17, 0x00, 0x16, 0x01, 0x12, 0x00, 0x31, 0x00, 0x08, 0x00, 0x04, 0x01, 0x74, 0x00,
+	0x50, 0x00, 0x08, 0x00, 0x8a, 0x01, 0x74, 0x00, 0x58, 0x00, 0x1b, 0x00, 0x9c, 0x01, 0x12, 0x00,
+	0x93, 0x00, 0x1d, 0x00, 0xd8, 0x02, 0x12, 0x00, 0xd0, 0x00, 0x1d, 0x00, 0x44, 0x04, 0x12, 0x00,
+	0x73, 0x00, 0x08, 0x00, 0x90, 0x03, 0xa0, 0x00, 0x7b, 0x00, 0x08, 0x00, 0x14, 0x02, 0x04, 0x00,
+	0x83, 0x00, 0x10, 0x00, 0x2c, 0x02, 0x18, 0x00, 0xb0, 0x00, 0x08, 0x00, 0x04, 0x05, 0xa8, 0x00,
+	0xb8, 0x00, 0x08, 0x00, 0x4a, 0x02, 0x04, 0x00, 0xc0, 0x00, 0x10, 0x00, 0x46, 0x02, 0x18, 0x00,
+	0xed, 0x00, 0x08, 0x00, 0x78, 0x06, 0xa8, 0x00, 0xf5, 0x00, 0x08, 0x00, 0xb6, 0x03, 0x04, 0x00,
+	0xfd, 0x00, 0x10, 0x00, 0xb2, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+	0x05, 0xe4, 0x71, 0xb6, 0x72, 0x6f, 0x6f, 0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0c, 0x8c, 0xa6, 0xac, 0x70, 0x72, 0x69,
+	0x76, 0x61, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0b, 0x14, 0xbe, 0x9c, 0x2e, 0x66, 0x73,
+	0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0f, 0x14, 0x12, 0x11, 0x66, 0x73, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x11, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x90, 0x11, 0x08, 0xef, 0x5f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+	0x11, 0xec, 0xcb, 0xd5, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37,
+	0x37, 0x32, 0x30, 0x36, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x13, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00,
+	0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x04, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xd0, 0x05, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0xe1, 0x50, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x48, 0x00,
+	0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x05, 0x00, 0x08, 0x00, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xe5, 0xa2, 0x42, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0xe5, 0xa2, 0x42, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x40, 0x00, 0x04, 0x02, 0x11, 0x00, 0x08, 0x20, 0x28, 0x00, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x44, 0x06,
+	0x5a, 0x23, 0x52, 0x15, 0x08, 0x00, 0x9a, 0x03, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xf3, 0x5e,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00,
+	0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x04, 0x02, 0x11, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x37, 0x37, 0x37, 0x32, 0x30, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x04,
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x40, 0xc1, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x1b, 0xf8, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x40, 0xc1, 0x45, 0x06, 0x5a, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x38, 0x00, 0x04, 0x02, 0x0f, 0x00, 0x08, 0x20, 0x28, 0x00,
+	0x66, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15,
+	0x08, 0x00, 0xf0, 0x02, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23,
+	0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xd4, 0x69, 0x40, 0x06, 0x5a, 0x23,
+	0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00,
+	0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x18, 0x00, 0x04, 0x02, 0x11, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x37, 0x37, 0x37, 0x32, 0x30, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15,
+	0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x02, 0x0f, 0x00, 0x66, 0x73, 0x65, 0x76,
+	0x65, 0x6e, 0x74, 0x73, 0x64, 0x2d, 0x75, 0x75, 0x69, 0x64, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x72, 0xc6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x08, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f,
+	0x71, 0x56, 0x55, 0x23, 0x52, 0x15, 0xfc, 0x68, 0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xfc, 0x68,
+	0x44, 0x06, 0x5a, 0x23, 0x52, 0x15, 0xc1, 0xd6, 0x73, 0x56, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0xc0, 0x41,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x02,
+	0x0b, 0x00, 0x2e, 0x66, 0x73, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x64, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x71, 0x56, 0x55, 0x23,
+	0x52, 0x15, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12,
+	0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x6b, 0x5b, 0xb8, 0x12,
+	0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xa4, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x10, 0x00, 0x04, 0x02, 0x0c, 0x00, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x2d,
+	0x64, 0x69, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6b, 0x5b, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x41, 0xb8, 0x12, 0x55, 0x23,
+	0x52, 0x15, 0x85, 0x2b, 0x71, 0x56, 0x55, 0x23, 0x52, 0x15, 0x85, 0x2b, 0x71, 0x56, 0x55, 0x23,
+	0x52, 0x15, 0xda, 0x41, 0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x04, 0x02, 0x05, 0x00, 0x72, 0x6f,
+	0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x41,
+	0xb8, 0x12, 0x55, 0x23, 0x52, 0x15, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Define to print the number of reads and bytes read per operation
+#define FSAPFS_TEST_IO_BUDGET_VERBOSE
+ */
+
+/* The I/O budgets are upper bounds of the number of physical reads
+ * and the number of bytes read per operation. An operation that needs
+ * more reads than its budget, for example due to a lost cache or an
+ * additional object map descent, fails the test
+ */
+
+/* The number of reads to open a container in addition to reading
+ * the blocks of the checkpoint descriptor area, which covers the superblock,
+ * the checkpoint maps, the object map and the space manager
+ */
+#define FSAPFS_TEST_IO_BUDGET_CONTAINER_OPEN_NUMBER_OF_READS		16
+
+/* The number of reads to open a volume and look up a path of depth 0
+ */
+#define FSAPFS_TEST_IO_BUDGET_PATH_LOOKUP_NUMBER_OF_READS		16
+
+/* The number of additional reads per path segment
+ */
+#define FSAPFS_TEST_IO_BUDGET_PATH_SEGMENT_NUMBER_OF_READS		4
+
+/* The number of reads to open a volume and list the root directory
+ * in addition to 1 read per sub file entry
+ */
+#define FSAPFS_TEST_IO_BUDGET_DIRECTORY_LISTING_NUMBER_OF_READS		16
+
+/* The number of reads to read the first byte of a compressed file
+ */
+#define FSAPFS_TEST_IO_BUDGET_COMPRESSED_FIRST_BYTE_NUMBER_OF_READS	8
+
+/* The number of bytes in addition to the block reads to read
+ * the first byte of a compressed file, which covers a compressed chunk
+ * stored in the resource fork
+ */
+#define FSAPFS_TEST_IO_BUDGET_COMPRESSED_FIRST_BYTE_READ_SIZE		65536
+
+/* The number of reads to sequentially read a file in addition to
+ * 1 read per block
+ */
+#define FSAPFS_TEST_IO_BUDGET_SEQUENTIAL_READ_NUMBER_OF_READS		8
+
+/* The maximum size of the file that is sequentially read
+ */
+#define FSAPFS_TEST_IO_BUDGET_MAXIMUM_SEQUENTIAL_READ_SIZE		( 64 * 1024 * 1024 )
+
+/* The maximum depth of the scanned directory hierarchy
+ */
+#define FSAPFS_TEST_IO_BUDGET_MAXIMUM_DEPTH				8
+
+/* The maximum number of scanned file entries
+ */
+#define FSAPFS_TEST_IO_BUDGET_MAXIMUM_NUMBER_OF_FILE_ENTRIES		4096
+
+#define FSAPFS_TEST_IO_BUDGET_PATH_SIZE					1024
+
+#define FSAPFS_TEST_IO_BUDGET_BUFFER_SIZE				65536
+
+typedef struct fsapfs_test_io_budget_counters fsapfs_test_io_budget_counters_t;
+
+struct fsapfs_test_io_budget_counters
+{
+	/* The number of reads
+	 */
+	int number_of_reads;
+
+	/* The number of bytes read
+	 */
+	size64_t read_size;
+};
+
+typedef struct fsapfs_test_counting_io_handle fsapfs_test_counting_io_handle_t;
+
+struct fsapfs_test_counting_io_handle
+{
+	/* The file IO handle of which the reads are counted
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The counters, which are shared with clones
+	 */
+	fsapfs_test_io_budget_counters_t *counters;
+};
+
+typedef struct fsapfs_test_io_budget_scan_state fsapfs_test_io_budget_scan_state_t;
+
+struct fsapfs_test_io_budget_scan_state
+{
+	/* The path of the last scanned directory
+	 */
+	char path[ FSAPFS_TEST_IO_BUDGET_PATH_SIZE ];
+
+	/* The depth of the path
+	 */
+	int path_depth;
+
+	/* The identifier of a compressed file
+	 */
+	uint64_t compressed_file_identifier;
+
+	/* The identifier of the largest file that fits the sequential read budget
+	 */
+	uint64_t largest_file_identifier;
+
+	/* The size of the largest file
+	 */
+	size64_t largest_file_size;
+
+	/* The number of scanned file entries
+	 */
+	int number_of_file_entries;
+};
+
+/* Frees a counting IO handle
+ * Returns 1 if succesful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_free(
+     fsapfs_test_counting_io_handle_t **counting_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_free";
+	int result            = 1;
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *counting_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( ( *counting_io_handle )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *counting_io_handle );
+
+		*counting_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the counting IO handle
+ * The clone shares the counters with the source
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_clone(
+     fsapfs_test_counting_io_handle_t **destination_counting_io_handle,
+     fsapfs_test_counting_io_handle_t *source_counting_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_clone";
+
+	if( destination_counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_counting_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination counting IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_counting_io_handle == NULL )
+	{
+		return( 1 );
+	}
+	*destination_counting_io_handle = memory_allocate_structure(
+	                                   fsapfs_test_counting_io_handle_t );
+
+	if( *destination_counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination counting IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_counting_io_handle )->file_io_handle = NULL;
+	( *destination_counting_io_handle )->counters       = source_counting_io_handle->counters;
+
+	if( libbfio_handle_clone(
+	     &( ( *destination_counting_io_handle )->file_io_handle ),
+	     source_counting_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_counting_io_handle != NULL )
+	{
+		memory_free(
+		 *destination_counting_io_handle );
+
+		*destination_counting_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens the counting IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_open(
+     fsapfs_test_counting_io_handle_t *counting_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_open";
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     counting_io_handle->file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the counting IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_close(
+     fsapfs_test_counting_io_handle_t *counting_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_close";
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     counting_io_handle->file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads a buffer from the counting IO handle and counts the read
+ * Returns the number of bytes read if successful, or -1 on error
+ */
+ssize_t fsapfs_test_counting_io_handle_read(
+         fsapfs_test_counting_io_handle_t *counting_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_read";
+	ssize_t read_count    = 0;
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              counting_io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	counting_io_handle->counters->number_of_reads += 1;
+	counting_io_handle->counters->read_size       += (size64_t) read_count;
+
+	return( read_count );
+}
+
+/* Writes a buffer to the counting IO handle
+ * Returns -1 since writing is not supported
+ */
+ssize_t fsapfs_test_counting_io_handle_write(
+         fsapfs_test_counting_io_handle_t *counting_io_handle FSAPFS_TEST_ATTRIBUTE_UNUSED,
+         const uint8_t *buffer FSAPFS_TEST_ATTRIBUTE_UNUSED,
+         size_t size FSAPFS_TEST_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_write";
+
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( counting_io_handle )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( buffer )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: writing is not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the counting IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t fsapfs_test_counting_io_handle_seek_offset(
+         fsapfs_test_counting_io_handle_t *counting_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_seek_offset";
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	offset = libbfio_handle_seek_offset(
+	          counting_io_handle->file_io_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset in file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( offset );
+}
+
+/* Function to determine if the file of the counting IO handle exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int fsapfs_test_counting_io_handle_exists(
+     fsapfs_test_counting_io_handle_t *counting_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_exists";
+	int result            = 0;
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          counting_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle exists.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Check if the counting IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int fsapfs_test_counting_io_handle_is_open(
+     fsapfs_test_counting_io_handle_t *counting_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_is_open";
+	int result            = 0;
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          counting_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the counting IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_get_size(
+     fsapfs_test_counting_io_handle_t *counting_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "fsapfs_test_counting_io_handle_get_size";
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     counting_io_handle->file_io_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a file IO handle that counts the reads of a source file IO handle
+ * The file IO handle takes over management of the source file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_initialize(
+     libbfio_handle_t **file_io_handle,
+     libbfio_handle_t *source_file_io_handle,
+     fsapfs_test_io_budget_counters_t *counters,
+     libcerror_error_t **error )
+{
+	fsapfs_test_counting_io_handle_t *counting_io_handle = NULL;
+	static char *function                                = "fsapfs_test_counting_io_handle_initialize";
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid counters.",
+		 function );
+
+		return( -1 );
+	}
+	counting_io_handle = memory_allocate_structure(
+	                      fsapfs_test_counting_io_handle_t );
+
+	if( counting_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create counting IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	counting_io_handle->file_io_handle = source_file_io_handle;
+	counting_io_handle->counters       = counters;
+
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) counting_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) fsapfs_test_counting_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) fsapfs_test_counting_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) fsapfs_test_counting_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsapfs_test_counting_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) fsapfs_test_counting_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) fsapfs_test_counting_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) fsapfs_test_counting_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsapfs_test_counting_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) fsapfs_test_counting_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) fsapfs_test_counting_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		memory_free(
+		 counting_io_handle );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a file IO handle that counts the reads of a source file
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_counting_io_handle_initialize_from_source(
+     libbfio_handle_t **file_io_handle,
+     const system_character_t *source,
+     off64_t source_offset,
+     fsapfs_test_io_budget_counters_t *counters,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *source_file_io_handle = NULL;
+	static char *function                   = "fsapfs_test_counting_io_handle_initialize_from_source";
+	size_t string_length                    = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_range_initialize(
+	     &source_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create source file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_range_set_name_wide(
+	     source_file_io_handle,
+	     source,
+	     string_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_range_set_name(
+	     source_file_io_handle,
+	     source,
+	     string_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source file IO handle name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_range_set(
+	     source_file_io_handle,
+	     source_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source file IO handle range.",
+		 function );
+
+		goto on_error;
+	}
+	if( fsapfs_test_counting_io_handle_initialize(
+	     file_io_handle,
+	     source_file_io_handle,
+	     counters,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resets the counters
+ */
+void fsapfs_test_io_budget_counters_reset(
+      fsapfs_test_io_budget_counters_t *counters )
+{
+	counters->number_of_reads = 0;
+	counters->read_size       = 0;
+}
+
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+
+/* Prints the counters
+ */
+void fsapfs_test_io_budget_counters_print(
+      fsapfs_test_io_budget_counters_t *counters,
+      const char *operation,
+      int maximum_number_of_reads,
+      size64_t maximum_read_size )
+{
+	fprintf(
+	 stdout,
+	 "%s: %d reads (budget: %d), %" PRIu64 " bytes (budget: %" PRIu64 ")\n",
+	 operation,
+	 counters->number_of_reads,
+	 maximum_number_of_reads,
+	 counters->read_size,
+	 maximum_read_size );
+}
+
+#endif /* defined( FSAPFS_TEST_IO_BUDGET_VERBOSE ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the I/O budget of looking up an inode in a file system B-tree
+ * The root node is read once and retrieved from the node cache afterwards
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_file_system_btree_lookup(
+     void )
+{
+	fsapfs_test_io_budget_counters_t counters;
+
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libbfio_handle_t *source_file_io_handle          = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfsapfs_file_system_btree_t *file_system_btree = NULL;
+	libfsapfs_inode_t *inode                         = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
+	int lookup_index                                 = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	fsapfs_test_io_budget_counters_reset(
+	 &counters );
+
+	result = libbfio_memory_range_initialize(
+	          &source_file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_file_io_handle",
+	 source_file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          source_file_io_handle,
+	          fsapfs_test_io_budget_file_system_btree_data1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_counting_io_handle_initialize(
+	          &file_io_handle,
+	          source_file_io_handle,
+	          &counters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_file_io_handle = NULL;
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( lookup_index = 0;
+	     lookup_index < 2;
+	     lookup_index++ )
+	{
+		result = libfsapfs_file_system_btree_get_inode_by_identifier(
+		          file_system_btree,
+		          file_io_handle,
+		          2,
+		          &inode,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "inode",
+		 inode );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_inode_free(
+		          &inode,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "counters.number_of_reads",
+		 counters.number_of_reads,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+		 "counters.read_size",
+		 counters.read_size,
+		 (uint64_t) 4096 );
+	}
+	/* Clean up
+	 */
+	result = libfsapfs_file_system_btree_free(
+	          &file_system_btree,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_system_btree",
+	 file_system_btree );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsapfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( file_system_btree != NULL )
+	{
+		libfsapfs_file_system_btree_free(
+		 &file_system_btree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( source_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &source_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Scans a directory for the file entries used by the I/O budget tests
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_io_budget_scan_directory(
+     libfsapfs_file_entry_t *directory_entry,
+     fsapfs_test_io_budget_scan_state_t *scan_state,
+     size_t path_length,
+     int depth,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_entry_t *sub_file_entry = NULL;
+	static char *function                  = "fsapfs_test_io_budget_scan_directory";
+	size64_t file_size                     = 0;
+	size_t name_size                       = 0;
+	uint64_t identifier                    = 0;
+	uint16_t file_mode                     = 0;
+	int number_of_sub_file_entries         = 0;
+	int sub_file_entry_index               = 0;
+
+	if( libfsapfs_file_entry_get_number_of_sub_file_entries(
+	     directory_entry,
+	     &number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( scan_state->number_of_file_entries >= FSAPFS_TEST_IO_BUDGET_MAXIMUM_NUMBER_OF_FILE_ENTRIES )
+		{
+			break;
+		}
+		scan_state->number_of_file_entries += 1;
+
+		if( libfsapfs_file_entry_get_sub_file_entry_by_index(
+		     directory_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_entry_get_identifier(
+		     sub_file_entry,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_file_entry_get_file_mode(
+		     sub_file_entry,
+		     &file_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file mode.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( file_mode & 0xf000 ) == 0x8000 )
+		{
+			if( libfsapfs_file_entry_get_size(
+			     sub_file_entry,
+			     &file_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve size.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( scan_state->compressed_file_identifier == 0 )
+			 && ( file_size > 0 )
+			 && ( ( (libfsapfs_internal_file_entry_t *) sub_file_entry )->compressed_data_extended_attribute != NULL ) )
+			{
+				scan_state->compressed_file_identifier = identifier;
+			}
+			if( ( file_size > scan_state->largest_file_size )
+			 && ( file_size <= (size64_t) FSAPFS_TEST_IO_BUDGET_MAXIMUM_SEQUENTIAL_READ_SIZE ) )
+			{
+				scan_state->largest_file_identifier = identifier;
+				scan_state->largest_file_size       = file_size;
+			}
+		}
+		else if( ( ( file_mode & 0xf000 ) == 0x4000 )
+		      && ( depth < FSAPFS_TEST_IO_BUDGET_MAXIMUM_DEPTH ) )
+		{
+			if( libfsapfs_file_entry_get_utf8_name_size(
+			     sub_file_entry,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name size.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( name_size > 1 )
+			 && ( ( path_length + name_size + 1 ) <= FSAPFS_TEST_IO_BUDGET_PATH_SIZE ) )
+			{
+				scan_state->path[ path_length ] = '/';
+
+				if( libfsapfs_file_entry_get_utf8_name(
+				     sub_file_entry,
+				     (uint8_t *) &( scan_state->path[ path_length + 1 ] ),
+				     name_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve name.",
+					 function );
+
+					goto on_error;
+				}
+				scan_state->path_depth = depth + 1;
+
+				if( fsapfs_test_io_budget_scan_directory(
+				     sub_file_entry,
+				     scan_state,
+				     path_length + name_size,
+				     depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to scan sub directory.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libfsapfs_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the I/O budget of opening a container
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_container_open(
+     libfsapfs_container_t *container,
+     libbfio_handle_t *file_io_handle,
+     fsapfs_test_io_budget_counters_t *counters )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsapfs_internal_container_t *internal_container = NULL;
+	size64_t maximum_read_size                        = 0;
+	int maximum_number_of_reads                       = 0;
+	int result                                        = 0;
+
+	fsapfs_test_io_budget_counters_reset(
+	 counters );
+
+	result = libfsapfs_container_open_file_io_handle(
+	          container,
+	          file_io_handle,
+	          LIBFSAPFS_OPEN_READ,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	maximum_number_of_reads = FSAPFS_TEST_IO_BUDGET_CONTAINER_OPEN_NUMBER_OF_READS
+	                        + (int) ( internal_container->superblock->checkpoint_descriptor_area_number_of_blocks & 0x7fffffffUL );
+
+	maximum_read_size = (size64_t) maximum_number_of_reads * internal_container->io_handle->block_size;
+
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+	fsapfs_test_io_budget_counters_print(
+	 counters,
+	 "container open",
+	 maximum_number_of_reads,
+	 maximum_read_size );
+#endif
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_reads",
+	 counters->number_of_reads,
+	 maximum_number_of_reads + 1 );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "read_size",
+	 counters->read_size,
+	 maximum_read_size + 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the I/O budget of opening a volume and looking up a path
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_path_lookup(
+     libfsapfs_container_t *container,
+     fsapfs_test_io_budget_counters_t *counters,
+     const char *path,
+     int path_depth )
+{
+	libcerror_error_t *error            = NULL;
+	libfsapfs_file_entry_t *file_entry  = NULL;
+	libfsapfs_volume_t *volume          = NULL;
+	size64_t maximum_read_size          = 0;
+	size_t path_length                  = 0;
+	uint32_t block_size                 = 0;
+	int maximum_number_of_reads         = 0;
+	int result                          = 0;
+
+	block_size = ( (libfsapfs_internal_container_t *) container )->io_handle->block_size;
+
+	maximum_number_of_reads = FSAPFS_TEST_IO_BUDGET_PATH_LOOKUP_NUMBER_OF_READS
+	                        + ( path_depth * FSAPFS_TEST_IO_BUDGET_PATH_SEGMENT_NUMBER_OF_READS );
+
+	maximum_read_size = (size64_t) maximum_number_of_reads * block_size;
+
+	path_length = narrow_string_length(
+	               path );
+
+	fsapfs_test_io_budget_counters_reset(
+	 counters );
+
+	result = libfsapfs_container_get_volume_by_index(
+	          container,
+	          0,
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          (uint8_t *) path,
+	          path_length,
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+	fsapfs_test_io_budget_counters_print(
+	 counters,
+	 "path lookup",
+	 maximum_number_of_reads,
+	 maximum_read_size );
+#endif
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_reads",
+	 counters->number_of_reads,
+	 maximum_number_of_reads + 1 );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "read_size",
+	 counters->read_size,
+	 maximum_read_size + 1 );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the I/O budget of opening a volume and listing the root directory
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_directory_listing(
+     libfsapfs_container_t *container,
+     fsapfs_test_io_budget_counters_t *counters )
+{
+	libcerror_error_t *error                = NULL;
+	libfsapfs_file_entry_t *root_directory  = NULL;
+	libfsapfs_file_entry_t *sub_file_entry  = NULL;
+	libfsapfs_volume_t *volume              = NULL;
+	size64_t maximum_read_size              = 0;
+	uint32_t block_size                     = 0;
+	int maximum_number_of_reads             = 0;
+	int number_of_sub_file_entries          = 0;
+	int result                              = 0;
+	int sub_file_entry_index                = 0;
+
+	block_size = ( (libfsapfs_internal_container_t *) container )->io_handle->block_size;
+
+	fsapfs_test_io_budget_counters_reset(
+	 counters );
+
+	result = libfsapfs_container_get_volume_by_index(
+	          container,
+	          0,
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_entry_get_number_of_sub_file_entries(
+	          root_directory,
+	          &number_of_sub_file_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		result = libfsapfs_file_entry_get_sub_file_entry_by_index(
+		          root_directory,
+		          sub_file_entry_index,
+		          &sub_file_entry,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_file_entry_free(
+		          &sub_file_entry,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	maximum_number_of_reads = FSAPFS_TEST_IO_BUDGET_DIRECTORY_LISTING_NUMBER_OF_READS
+	                        + number_of_sub_file_entries;
+
+	maximum_read_size = (size64_t) maximum_number_of_reads * block_size;
+
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+	fsapfs_test_io_budget_counters_print(
+	 counters,
+	 "directory listing",
+	 maximum_number_of_reads,
+	 maximum_read_size );
+#endif
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_reads",
+	 counters->number_of_reads,
+	 maximum_number_of_reads + 1 );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "read_size",
+	 counters->read_size,
+	 maximum_read_size + 1 );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &root_directory,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( root_directory != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the I/O budget of reading the first byte of a compressed file
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_compressed_first_byte(
+     libfsapfs_container_t *container,
+     fsapfs_test_io_budget_counters_t *counters,
+     uint64_t identifier )
+{
+	uint8_t data[ 1 ];
+
+	libcerror_error_t *error           = NULL;
+	libfsapfs_file_entry_t *file_entry = NULL;
+	libfsapfs_volume_t *volume         = NULL;
+	size64_t maximum_read_size         = 0;
+	ssize_t read_count                 = 0;
+	uint32_t block_size                = 0;
+	int maximum_number_of_reads        = 0;
+	int result                         = 0;
+
+	block_size = ( (libfsapfs_internal_container_t *) container )->io_handle->block_size;
+
+	maximum_number_of_reads = FSAPFS_TEST_IO_BUDGET_COMPRESSED_FIRST_BYTE_NUMBER_OF_READS;
+
+	maximum_read_size = ( (size64_t) maximum_number_of_reads * block_size )
+	                  + FSAPFS_TEST_IO_BUDGET_COMPRESSED_FIRST_BYTE_READ_SIZE;
+
+	result = libfsapfs_container_get_volume_by_index(
+	          container,
+	          0,
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_get_file_entry_by_identifier(
+	          volume,
+	          identifier,
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only count the reads of the data, not those of the file entry lookup
+	 */
+	fsapfs_test_io_budget_counters_reset(
+	 counters );
+
+	read_count = libfsapfs_file_entry_read_buffer(
+	              file_entry,
+	              data,
+	              1,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+	fsapfs_test_io_budget_counters_print(
+	 counters,
+	 "first byte of compressed file",
+	 maximum_number_of_reads,
+	 maximum_read_size );
+#endif
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_reads",
+	 counters->number_of_reads,
+	 maximum_number_of_reads + 1 );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "read_size",
+	 counters->read_size,
+	 maximum_read_size + 1 );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the I/O budget of sequentially reading a file
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_budget_sequential_read(
+     libfsapfs_container_t *container,
+     fsapfs_test_io_budget_counters_t *counters,
+     uint64_t identifier,
+     size64_t file_size )
+{
+	libcerror_error_t *error           = NULL;
+	libfsapfs_file_entry_t *file_entry = NULL;
+	libfsapfs_volume_t *volume         = NULL;
+	uint8_t *buffer                    = NULL;
+	size64_t maximum_read_size         = 0;
+	size64_t remaining_size            = 0;
+	size_t read_size                   = 0;
+	ssize_t read_count                 = 0;
+	uint32_t block_size                = 0;
+	int maximum_number_of_reads        = 0;
+	int result                         = 0;
+
+	block_size = ( (libfsapfs_internal_container_t *) container )->io_handle->block_size;
+
+	maximum_number_of_reads = FSAPFS_TEST_IO_BUDGET_SEQUENTIAL_READ_NUMBER_OF_READS
+	                        + (int) ( ( file_size + block_size - 1 ) / block_size );
+
+	maximum_read_size = (size64_t) maximum_number_of_reads * block_size;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * FSAPFS_TEST_IO_BUDGET_BUFFER_SIZE );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	result = libfsapfs_container_get_volume_by_index(
+	          container,
+	          0,
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_get_file_entry_by_identifier(
+	          volume,
+	          identifier,
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only count the reads of the data, not those of the file entry lookup
+	 */
+	fsapfs_test_io_budget_counters_reset(
+	 counters );
+
+	remaining_size = file_size;
+
+	while( remaining_size > 0 )
+	{
+		read_size = FSAPFS_TEST_IO_BUDGET_BUFFER_SIZE;
+
+		if( (size64_t) read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		read_count = libfsapfs_file_entry_read_buffer(
+		              file_entry,
+		              buffer,
+		              read_size,
+		              &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		remaining_size -= read_size;
+	}
+#if defined( FSAPFS_TEST_IO_BUDGET_VERBOSE )
+	fsapfs_test_io_budget_counters_print(
+	 counters,
+	 "sequential read",
+	 maximum_number_of_reads,
+	 maximum_read_size );
+#endif
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_reads",
+	 counters->number_of_reads,
+	 maximum_number_of_reads + 1 );
+
+	FSAPFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "read_size",
+	 counters->read_size,
+	 maximum_read_size + 1 );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	fsapfs_test_io_budget_counters_t counters;
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+	fsapfs_test_io_budget_scan_state_t scan_state;
+
+	libfsapfs_file_entry_t *root_directory = NULL;
+	libfsapfs_volume_t *volume             = NULL;
+#endif
+	libbfio_handle_t *file_io_handle       = NULL;
+	libcerror_error_t *error               = NULL;
+	libfsapfs_container_t *container       = NULL;
+	system_character_t *option_offset      = NULL;
+	system_character_t *source             = NULL;
+	system_integer_t option                = 0;
+	size_t string_length                   = 0;
+	off64_t volume_offset                  = 0;
+	int result                             = 0;
+
+	while( ( option = fsapfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:p:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		result = fsapfs_test_system_string_copy_from_64_bit_in_decimal(
+		          option_offset,
+		          string_length + 1,
+		          (uint64_t *) &volume_offset,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSAPFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+	}
+	if( memory_set(
+	     &counters,
+	     0,
+	     sizeof( fsapfs_test_io_budget_counters_t ) ) == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+	if( memory_set(
+	     &scan_state,
+	     0,
+	     sizeof( fsapfs_test_io_budget_scan_state_t ) ) == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	FSAPFS_TEST_RUN(
+	 "file system B-tree lookup",
+	 fsapfs_test_io_budget_file_system_btree_lookup );
+
+#endif
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = fsapfs_test_counting_io_handle_initialize_from_source(
+		          &file_io_handle,
+		          source,
+		          volume_offset,
+		          &counters,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	         "file_io_handle",
+	         file_io_handle );
+
+	        FSAPFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libfsapfs_check_container_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+	if( result != 0 )
+	{
+		/* Initialize test
+		 */
+		result = libfsapfs_container_initialize(
+		          &container,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSAPFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "container open",
+		 fsapfs_test_io_budget_container_open,
+		 container,
+		 file_io_handle,
+		 &counters );
+
+		/* Determine the file entries used by the volume tests
+		 */
+		result = libfsapfs_container_get_volume_by_index(
+		          container,
+		          0,
+		          &volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+	        FSAPFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		result = libfsapfs_volume_is_locked(
+		          volume,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+	        FSAPFS_TEST_ASSERT_IS_NULL(
+	         "error",
+	         error );
+
+		/* The volume tests are skipped for a locked volume
+		 */
+		if( result == 0 )
+		{
+			result = libfsapfs_volume_get_root_directory(
+			          volume,
+			          &root_directory,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        FSAPFS_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+
+			scan_state.path[ 0 ] = '/';
+
+			result = fsapfs_test_io_budget_scan_directory(
+			          root_directory,
+			          &scan_state,
+			          0,
+			          0,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        FSAPFS_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+
+			result = libfsapfs_file_entry_free(
+			          &root_directory,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        FSAPFS_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+
+			result = libfsapfs_volume_free(
+			          &volume,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        FSAPFS_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+
+			FSAPFS_TEST_RUN_WITH_ARGS(
+			 "path lookup",
+			 fsapfs_test_io_budget_path_lookup,
+			 container,
+			 &counters,
+			 scan_state.path,
+			 scan_state.path_depth );
+
+			FSAPFS_TEST_RUN_WITH_ARGS(
+			 "directory listing",
+			 fsapfs_test_io_budget_directory_listing,
+			 container,
+			 &counters );
+
+			if( scan_state.compressed_file_identifier != 0 )
+			{
+				FSAPFS_TEST_RUN_WITH_ARGS(
+				 "first byte of compressed file",
+				 fsapfs_test_io_budget_compressed_first_byte,
+				 container,
+				 &counters,
+				 scan_state.compressed_file_identifier );
+			}
+			if( scan_state.largest_file_identifier != 0 )
+			{
+				FSAPFS_TEST_RUN_WITH_ARGS(
+				 "sequential read",
+				 fsapfs_test_io_budget_sequential_read,
+				 container,
+				 &counters,
+				 scan_state.largest_file_identifier,
+				 scan_state.largest_file_size );
+			}
+		}
+		else
+		{
+			result = libfsapfs_volume_free(
+			          &volume,
+			          &error );
+
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+		        FSAPFS_TEST_ASSERT_IS_NULL(
+		         "error",
+		         error );
+		}
+		/* Clean up
+		 */
+		result = libfsapfs_container_close(
+		          container,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_container_free(
+		          &container,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	if( file_io_handle != NULL )
+	{
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+	if( root_directory != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsapfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+#endif
+	if( container != NULL )
+	{
+		libfsapfs_container_free(
+		 &container,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -537,6 +537,327 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_name_copy_to_decomposed_characters function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_name_copy_to_decomposed_characters(
+     void )
+{
+	uint32_t characters[ 8 ];
+
+	uint8_t utf8_name[ 5 ]      = { 'A', 0xc3, 0xa9, 'z', 0 };
+	libcerror_error_t *error    = NULL;
+	size_t number_of_characters = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          utf8_name,
+	          5,
+	          1,
+	          characters,
+	          8,
+	          &number_of_characters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_characters",
+	 number_of_characters,
+	 (size_t) 4 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "characters[ 0 ]",
+	 characters[ 0 ],
+	 (uint32_t) 'a' );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "characters[ 1 ]",
+	 characters[ 1 ],
+	 (uint32_t) 'e' );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "characters[ 2 ]",
+	 characters[ 2 ],
+	 (uint32_t) 0x00000301UL );
+
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          utf8_name,
+	          5,
+	          0,
+	          characters,
+	          8,
+	          &number_of_characters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "characters[ 0 ]",
+	 characters[ 0 ],
+	 (uint32_t) 'A' );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          NULL,
+	          5,
+	          1,
+	          characters,
+	          8,
+	          &number_of_characters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          utf8_name,
+	          5,
+	          1,
+	          NULL,
+	          8,
+	          &number_of_characters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          utf8_name,
+	          5,
+	          1,
+	          characters,
+	          3,
+	          &number_of_characters,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_name_copy_to_decomposed_characters(
+	          utf8_name,
+	          5,
+	          1,
+	          characters,
+	          8,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_name_match_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_name_match_pattern(
+     void )
+{
+	uint32_t characters[ 12 ] = { 'k', 'e', 'y', 'c', 'h', 'a', 'i', 'n', '.', 'd', 'b', 0 };
+	uint32_t pattern1[ 10 ]   = { '*', 'c', 'h', 'a', 'i', 'n', '*', 0, 0, 0 };
+	uint32_t pattern2[ 10 ]   = { '*', '.', 'd', 'b', 0, 0, 0, 0, 0, 0 };
+	uint32_t pattern3[ 10 ]   = { 'k', 'e', 'y', '?', '*', '.', '?', '?', 0, 0 };
+	uint32_t pattern4[ 10 ]   = { '*', '.', 's', 'q', 'l', 'i', 't', 'e', 0, 0 };
+	uint32_t pattern5[ 10 ]   = { 'k', 'e', 'y', 0, 0, 0, 0, 0, 0, 0 };
+	libcerror_error_t *error  = NULL;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          pattern1,
+	          7,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          pattern2,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          pattern3,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          pattern4,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          pattern5,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_name_match_pattern(
+	          NULL,
+	          11,
+	          pattern1,
+	          7,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_name_match_pattern(
+	          characters,
+	          11,
+	          NULL,
+	          7,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -572,6 +893,14 @@ int main(
 	 "libfsapfs_name_compare_with_utf16_string",
 	 fsapfs_test_name_compare_with_utf16_string );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_name_copy_to_decomposed_characters",
+	 fsapfs_test_name_copy_to_decomposed_characters );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_name_match_pattern",
+	 fsapfs_test_name_match_pattern );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
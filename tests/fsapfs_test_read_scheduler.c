@@ -0,0 +1,1553 @@
+/*
+ * Library read_scheduler type test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcdata.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfdata.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_data_stream.h"
+#include "../libfsapfs/libfsapfs_file_entry.h"
+#include "../libfsapfs/libfsapfs_file_extent.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
+#include "../libfsapfs/libfsapfs_read_scheduler.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+typedef struct fsapfs_test_read_scheduler_output fsapfs_test_read_scheduler_output_t;
+
+struct fsapfs_test_read_scheduler_output
+{
+	/* The data per file entry
+	 */
+	uint8_t data[ 3 ][ 8192 ];
+
+	/* The number of callback function calls
+	 */
+	int number_of_calls;
+};
+
+/* Creates a file entry with file extents for testing
+ * The file extents are defined by triplets of logical offset, physical block number and data size
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_read_scheduler_file_entry_initialize(
+     libfsapfs_file_entry_t **file_entry,
+     libfsapfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint64_t *extent_values,
+     int number_of_extents,
+     size64_t file_size,
+     uint8_t use_data_stream,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *file_extents       = NULL;
+	libfdata_stream_t *data_stream       = NULL;
+	libfsapfs_file_extent_t *file_extent = NULL;
+	int entry_index                      = 0;
+	int extent_index                     = 0;
+
+	if( libcdata_array_initialize(
+	     &file_extents,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		if( libfsapfs_file_extent_initialize(
+		     &file_extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		file_extent->logical_offset        = extent_values[ ( extent_index * 3 ) ];
+		file_extent->physical_block_number = extent_values[ ( extent_index * 3 ) + 1 ];
+		file_extent->data_size             = extent_values[ ( extent_index * 3 ) + 2 ];
+
+		if( libcdata_array_append_entry(
+		     file_extents,
+		     &entry_index,
+		     (intptr_t *) file_extent,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		file_extent = NULL;
+	}
+	if( use_data_stream != 0 )
+	{
+		if( libfsapfs_data_stream_initialize_from_file_extents(
+		     &data_stream,
+		     io_handle,
+		     NULL,
+		     file_extents,
+		     file_size,
+		     1,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfsapfs_file_entry_initialize(
+	     file_entry,
+	     io_handle,
+	     file_io_handle,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->file_size    = file_size;
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->file_extents = file_extents;
+	( (libfsapfs_internal_file_entry_t *) *file_entry )->data_stream  = data_stream;
+
+	return( 1 );
+
+on_error:
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	if( file_extents != NULL )
+	{
+		libcdata_array_free(
+		 &file_extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Stores the data passed by the read scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_read_scheduler_read_callback(
+     libfsapfs_file_entry_t *file_entry,
+     int file_entry_index,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     intptr_t *callback_data,
+     libcerror_error_t **error FSAPFS_TEST_ATTRIBUTE_UNUSED )
+{
+	fsapfs_test_read_scheduler_output_t *output = (fsapfs_test_read_scheduler_output_t *) callback_data;
+
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( file_entry == NULL )
+	 || ( file_entry_index < 0 )
+	 || ( file_entry_index >= 3 )
+	 || ( offset < 0 )
+	 || ( data_size > 8192 )
+	 || ( (size_t) offset > ( 8192 - data_size ) ) )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( ( output->data[ file_entry_index ] )[ offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	output->number_of_calls += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_read_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_read_scheduler_free(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_initialize(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_scheduler = (libfsapfs_read_scheduler_t *) 0x12345678UL;
+
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	read_scheduler = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_read_scheduler_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_read_scheduler_initialize(
+		          &read_scheduler,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( read_scheduler != NULL )
+			{
+				libfsapfs_read_scheduler_free(
+				 &read_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "read_scheduler",
+			 read_scheduler );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_read_scheduler_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_read_scheduler_initialize(
+		          &read_scheduler,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( read_scheduler != NULL )
+			{
+				libfsapfs_read_scheduler_free(
+				 &read_scheduler,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "read_scheduler",
+			 read_scheduler );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_read_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_read_scheduler_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_append_range(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler = NULL;
+	int range_index                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( range_index = 0;
+	     range_index < 100;
+	     range_index++ )
+	{
+		result = libfsapfs_read_scheduler_append_range(
+		          read_scheduler,
+		          range_index,
+		          0,
+		          (off64_t) ( 100 - range_index ) * 4096,
+		          4096,
+		          0,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->number_of_ranges",
+	 read_scheduler->number_of_ranges,
+	 100 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_append_range(
+	          NULL,
+	          0,
+	          0,
+	          4096,
+	          4096,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_read_scheduler_free(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_read_scheduler_append_file_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_append_file_entry(
+     void )
+{
+	/* A sparse range precedes the second file extent and follows the last file extent
+	 */
+	uint64_t extent_values[ 6 ] = {
+		0, 3, 4096,
+		8192, 1, 4096 };
+
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_file_entry_t *file_entry         = NULL;
+	libfsapfs_io_handle_t *io_handle           = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = fsapfs_test_read_scheduler_file_entry_initialize(
+	          &file_entry,
+	          io_handle,
+	          NULL,
+	          extent_values,
+	          2,
+	          20480,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          read_scheduler,
+	          (libfsapfs_internal_file_entry_t *) file_entry,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->number_of_ranges",
+	 read_scheduler->number_of_ranges,
+	 4 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->ranges[ 0 ].file_entry_index",
+	 read_scheduler->ranges[ 0 ].file_entry_index,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 0 ].logical_offset",
+	 (int64_t) read_scheduler->ranges[ 0 ].logical_offset,
+	 (int64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 0 ].physical_offset",
+	 (int64_t) read_scheduler->ranges[ 0 ].physical_offset,
+	 (int64_t) 12288 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_scheduler->ranges[ 0 ].size",
+	 (uint64_t) read_scheduler->ranges[ 0 ].size,
+	 (uint64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 1 ].logical_offset",
+	 (int64_t) read_scheduler->ranges[ 1 ].logical_offset,
+	 (int64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 1 ].physical_offset",
+	 (int64_t) read_scheduler->ranges[ 1 ].physical_offset,
+	 (int64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_scheduler->ranges[ 1 ].size",
+	 (uint64_t) read_scheduler->ranges[ 1 ].size,
+	 (uint64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 2 ].logical_offset",
+	 (int64_t) read_scheduler->ranges[ 2 ].logical_offset,
+	 (int64_t) 8192 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 2 ].physical_offset",
+	 (int64_t) read_scheduler->ranges[ 2 ].physical_offset,
+	 (int64_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 3 ].logical_offset",
+	 (int64_t) read_scheduler->ranges[ 3 ].logical_offset,
+	 (int64_t) 12288 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 3 ].physical_offset",
+	 (int64_t) read_scheduler->ranges[ 3 ].physical_offset,
+	 (int64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_scheduler->ranges[ 3 ].size",
+	 (uint64_t) read_scheduler->ranges[ 3 ].size,
+	 (uint64_t) 8192 );
+
+	/* Compressed data is scheduled as a single range without physical data
+	 */
+	( (libfsapfs_internal_file_entry_t *) file_entry )->compression_method = 1;
+
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          read_scheduler,
+	          (libfsapfs_internal_file_entry_t *) file_entry,
+	          2,
+	          &error );
+
+	( (libfsapfs_internal_file_entry_t *) file_entry )->compression_method = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->number_of_ranges",
+	 read_scheduler->number_of_ranges,
+	 5 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->ranges[ 4 ].file_entry_index",
+	 read_scheduler->ranges[ 4 ].file_entry_index,
+	 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_scheduler->ranges[ 4 ].physical_offset",
+	 (int64_t) read_scheduler->ranges[ 4 ].physical_offset,
+	 (int64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_scheduler->ranges[ 4 ].size",
+	 (uint64_t) read_scheduler->ranges[ 4 ].size,
+	 (uint64_t) 20480 );
+
+	/* Empty data is not scheduled
+	 */
+	( (libfsapfs_internal_file_entry_t *) file_entry )->file_size = 0;
+
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          read_scheduler,
+	          (libfsapfs_internal_file_entry_t *) file_entry,
+	          3,
+	          &error );
+
+	( (libfsapfs_internal_file_entry_t *) file_entry )->file_size = 20480;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "read_scheduler->number_of_ranges",
+	 read_scheduler->number_of_ranges,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          NULL,
+	          (libfsapfs_internal_file_entry_t *) file_entry,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          read_scheduler,
+	          NULL,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	( (libfsapfs_internal_file_entry_t *) file_entry )->io_handle = NULL;
+
+	result = libfsapfs_read_scheduler_append_file_entry(
+	          read_scheduler,
+	          (libfsapfs_internal_file_entry_t *) file_entry,
+	          1,
+	          &error );
+
+	( (libfsapfs_internal_file_entry_t *) file_entry )->io_handle = io_handle;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_read_scheduler_free(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsapfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_read_scheduler_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_sort(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler = NULL;
+	int range_index                            = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 16;
+	     range_index++ )
+	{
+		result = libfsapfs_read_scheduler_append_range(
+		          read_scheduler,
+		          range_index,
+		          0,
+		          (off64_t) ( ( range_index * 7 ) % 16 ) * 4096,
+		          4096,
+		          0,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libfsapfs_read_scheduler_sort(
+	          read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 16;
+	     range_index++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_INT64(
+		 "read_scheduler->ranges[ range_index ].physical_offset",
+		 (int64_t) read_scheduler->ranges[ range_index ].physical_offset,
+		 (int64_t) range_index * 4096 );
+	}
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_sort(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_read_scheduler_free(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_read_scheduler_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_read_scheduler_read(
+     void )
+{
+	/* The first file entry is stored in block 2, the second file entry
+	 * in blocks 3 and 5 and the third file entry starts with a sparse
+	 * range followed by block 1. Blocks 1 to 5 are read with a single
+	 * read and the sparse range is read from the data stream
+	 */
+	uint64_t extent_values[ 3 ][ 6 ] = {
+		{ 0, 2, 4096, 0, 0, 0 },
+		{ 0, 3, 4096, 4096, 5, 4096 },
+		{ 0, 0, 4096, 4096, 1, 4096 } };
+
+	uint8_t expected_data[ 4096 ];
+
+	fsapfs_test_read_scheduler_output_t output;
+
+	libfsapfs_file_entry_t *file_entries[ 3 ]  = { NULL, NULL, NULL };
+	size64_t file_sizes[ 3 ]                   = { 4096, 8192, 8192 };
+	int number_of_extents[ 3 ]                 = { 1, 2, 2 };
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libfsapfs_io_handle_t *io_handle           = NULL;
+	libfsapfs_read_scheduler_t *read_scheduler = NULL;
+	uint8_t *data                              = NULL;
+	void *memset_result                        = NULL;
+	size_t data_offset                         = 0;
+	int file_entry_index                       = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 &output,
+	                 0,
+	                 sizeof( fsapfs_test_read_scheduler_output_t ) );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	data = (uint8_t *) memory_allocate(
+	                    6 * 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	for( data_offset = 0;
+	     data_offset < ( 6 * 4096 );
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset % 251 ) + ( data_offset / 4096 ) );
+	}
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          6 * 4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfsapfs_read_scheduler_initialize(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( file_entry_index = 0;
+	     file_entry_index < 3;
+	     file_entry_index++ )
+	{
+		result = fsapfs_test_read_scheduler_file_entry_initialize(
+		          &( file_entries[ file_entry_index ] ),
+		          io_handle,
+		          file_io_handle,
+		          extent_values[ file_entry_index ],
+		          number_of_extents[ file_entry_index ],
+		          file_sizes[ file_entry_index ],
+		          (uint8_t) ( file_entry_index == 2 ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "file_entry",
+		 file_entries[ file_entry_index ] );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsapfs_read_scheduler_append_file_entry(
+		          read_scheduler,
+		          (libfsapfs_internal_file_entry_t *) file_entries[ file_entry_index ],
+		          file_entry_index,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsapfs_read_scheduler_sort(
+	          read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_read_scheduler_read(
+	          read_scheduler,
+	          file_entries,
+	          3,
+	          &fsapfs_test_read_scheduler_read_callback,
+	          (intptr_t *) &output,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "output.number_of_calls",
+	 output.number_of_calls,
+	 5 );
+
+	result = memory_compare(
+	          output.data[ 0 ],
+	          &( data[ 2 * 4096 ] ),
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          output.data[ 1 ],
+	          &( data[ 3 * 4096 ] ),
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( ( output.data[ 1 ] )[ 4096 ] ),
+	          &( data[ 5 * 4096 ] ),
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memset_result = memory_set(
+	                 expected_data,
+	                 0,
+	                 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = memory_compare(
+	          output.data[ 2 ],
+	          expected_data,
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( ( output.data[ 2 ] )[ 4096 ] ),
+	          &( data[ 4096 ] ),
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_read_scheduler_read(
+	          NULL,
+	          file_entries,
+	          3,
+	          &fsapfs_test_read_scheduler_read_callback,
+	          (intptr_t *) &output,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_read_scheduler_read(
+	          read_scheduler,
+	          NULL,
+	          3,
+	          &fsapfs_test_read_scheduler_read_callback,
+	          (intptr_t *) &output,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_read_scheduler_read(
+	          read_scheduler,
+	          file_entries,
+	          3,
+	          NULL,
+	          (intptr_t *) &output,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file entry index that is out of bounds
+	 */
+	result = libfsapfs_read_scheduler_read(
+	          read_scheduler,
+	          file_entries,
+	          2,
+	          &fsapfs_test_read_scheduler_read_callback,
+	          (intptr_t *) &output,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( file_entry_index = 0;
+	     file_entry_index < 3;
+	     file_entry_index++ )
+	{
+		result = libfsapfs_file_entry_free(
+		          &( file_entries[ file_entry_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfsapfs_read_scheduler_free(
+	          &read_scheduler,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "read_scheduler",
+	 read_scheduler );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( file_entry_index = 0;
+	     file_entry_index < 3;
+	     file_entry_index++ )
+	{
+		if( file_entries[ file_entry_index ] != NULL )
+		{
+			libfsapfs_file_entry_free(
+			 &( file_entries[ file_entry_index ] ),
+			 NULL );
+		}
+	}
+	if( read_scheduler != NULL )
+	{
+		libfsapfs_read_scheduler_free(
+		 &read_scheduler,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_initialize",
+	 fsapfs_test_read_scheduler_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_free",
+	 fsapfs_test_read_scheduler_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_append_range",
+	 fsapfs_test_read_scheduler_append_range );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_append_file_entry",
+	 fsapfs_test_read_scheduler_append_file_entry );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_sort",
+	 fsapfs_test_read_scheduler_sort );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_read_scheduler_read",
+	 fsapfs_test_read_scheduler_read );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2023 @@
+/*
+ * Tools mount_path_cache functions test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../fsapfstools/mount_path_cache.h"
+
+/* Sets a value in the path cache
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_tools_mount_path_cache_set_value(
+     mount_path_cache_t *path_cache,
+     const system_character_t *path,
+     uint64_t parent_identifier,
+     int sub_file_entry_index,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	mount_path_cache_value_t value;
+
+	if( memory_set(
+	     &value,
+	     0,
+	     sizeof( mount_path_cache_value_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	value.parent_identifier    = parent_identifier;
+	value.sub_file_entry_index = sub_file_entry_index;
+	value.size                 = size;
+	value.file_mode            = 0x81a4;
+
+	return( mount_path_cache_set_value_by_path(
+	         path_cache,
+	         path,
+	         system_string_length(
+	          path ),
+	         &value,
+	         error ) );
+}
+
+/* Tests the mount_path_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	mount_path_cache_t *path_cache  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 4;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->maximum_number_of_entries",
+	 path_cache->maximum_number_of_entries,
+	 3 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_entries",
+	 path_cache->number_of_entries,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_cache->number_of_buckets",
+	 path_cache->number_of_buckets,
+	 8 );
+
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_initialize(
+	          NULL,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_cache = (mount_path_cache_t *) 0x12345678UL;
+
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          3,
+	          &error );
+
+	path_cache = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          ( 1 << 24 ) + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test mount_path_cache_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = mount_path_cache_initialize(
+		          &path_cache,
+		          3,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				mount_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test mount_path_cache_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = mount_path_cache_initialize(
+		          &path_cache,
+		          3,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( path_cache != NULL )
+			{
+				mount_path_cache_free(
+				 &path_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "path_cache",
+			 path_cache );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_calculate_path_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_calculate_path_hash(
+     void )
+{
+	uint32_t path_hash = 0;
+
+	/* Test regular cases
+	 */
+	path_hash = mount_path_cache_calculate_path_hash(
+	             _SYSTEM_STRING( "" ),
+	             0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	path_hash = mount_path_cache_calculate_path_hash(
+	             _SYSTEM_STRING( "a" ),
+	             1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	path_hash = mount_path_cache_calculate_path_hash(
+	             _SYSTEM_STRING( "/a/b" ),
+	             4 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0xffa0fc0cUL );
+
+	/* Only the first path length characters are hashed
+	 */
+	path_hash = mount_path_cache_calculate_path_hash(
+	             _SYSTEM_STRING( "ab" ),
+	             1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_calculate_index_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_calculate_index_hash(
+     void )
+{
+	uint32_t index_hash = 0;
+
+	/* Test regular cases
+	 */
+	index_hash = mount_path_cache_calculate_index_hash(
+	              0,
+	              0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "index_hash",
+	 index_hash,
+	 (uint32_t) 0x00000000UL );
+
+	index_hash = mount_path_cache_calculate_index_hash(
+	              16,
+	              3 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "index_hash",
+	 index_hash,
+	 (uint32_t) 0xe52055dcUL );
+
+	index_hash = mount_path_cache_calculate_index_hash(
+	              1,
+	              0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "index_hash",
+	 index_hash,
+	 (uint32_t) 0x2e72b465UL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_touch_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_touch_entry(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	mount_path_cache_t *path_cache = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          0,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/b" ),
+	          2,
+	          1,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/c" ),
+	          2,
+	          2,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 2 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->least_recently_used_entry",
+	 (intptr_t) path_cache->least_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	/* Test regular cases
+	 */
+	mount_path_cache_touch_entry(
+	 path_cache,
+	 &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->least_recently_used_entry",
+	 (intptr_t) path_cache->least_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 1 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->entries[ 0 ].next_used_entry",
+	 (intptr_t) path_cache->entries[ 0 ].next_used_entry,
+	 (intptr_t) &( path_cache->entries[ 2 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->entries[ 1 ].next_used_entry",
+	 (intptr_t) path_cache->entries[ 1 ].next_used_entry,
+	 (intptr_t) NULL );
+
+	mount_path_cache_touch_entry(
+	 path_cache,
+	 &( path_cache->entries[ 2 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 2 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->entries[ 2 ].next_used_entry",
+	 (intptr_t) path_cache->entries[ 2 ].next_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->entries[ 0 ].next_used_entry",
+	 (intptr_t) path_cache->entries[ 0 ].next_used_entry,
+	 (intptr_t) &( path_cache->entries[ 1 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->least_recently_used_entry",
+	 (intptr_t) path_cache->least_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 1 ] ) );
+
+	/* Test error cases
+	 */
+	mount_path_cache_touch_entry(
+	 NULL,
+	 &( path_cache->entries[ 1 ] ) );
+
+	mount_path_cache_touch_entry(
+	 path_cache,
+	 NULL );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 2 ] ) );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_unlink_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_unlink_entry(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	mount_path_cache_entry_t *entry = NULL;
+	mount_path_cache_t *path_cache  = NULL;
+	system_character_t *name        = NULL;
+	size_t name_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          0,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/b" ),
+	          2,
+	          1,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	mount_path_cache_unlink_entry(
+	 path_cache,
+	 &( path_cache->entries[ 1 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->least_recently_used_entry",
+	 (intptr_t) path_cache->least_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->entries[ 0 ].previous_used_entry",
+	 (intptr_t) path_cache->entries[ 0 ].previous_used_entry,
+	 (intptr_t) NULL );
+
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/b" ),
+	          2,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          1,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	mount_path_cache_unlink_entry(
+	 path_cache,
+	 &( path_cache->entries[ 0 ] ) );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache->most_recently_used_entry",
+	 path_cache->most_recently_used_entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache->least_recently_used_entry",
+	 path_cache->least_recently_used_entry );
+
+	/* Test error cases
+	 */
+	mount_path_cache_unlink_entry(
+	 NULL,
+	 &( path_cache->entries[ 0 ] ) );
+
+	mount_path_cache_unlink_entry(
+	 path_cache,
+	 NULL );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_get_entry_by_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_get_entry_by_path(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	mount_path_cache_entry_t *entry = NULL;
+	mount_path_cache_t *path_cache  = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          16,
+	          3,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->path_length",
+	 entry->path_length,
+	 (size_t) 9 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->name_index",
+	 entry->name_index,
+	 (size_t) 5 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "entry->path_hash",
+	 entry->path_hash,
+	 mount_path_cache_calculate_path_hash(
+	  _SYSTEM_STRING( "/dir/name" ),
+	  9 ) );
+
+	entry = NULL;
+
+	/* A prefix of a cached path is not a match
+	 */
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          4,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/Name" ),
+	          9,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_get_entry_by_path(
+	          NULL,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          NULL,
+	          9,
+	          &entry,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_get_entry_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_get_value_by_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_get_value_by_path(
+     void )
+{
+	mount_path_cache_value_t value;
+
+	libcerror_error_t *error       = NULL;
+	mount_path_cache_t *path_cache = NULL;
+	void *memset_result            = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          16,
+	          3,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memset_result = memory_set(
+	                 &value,
+	                 0,
+	                 sizeof( mount_path_cache_value_t ) );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value.parent_identifier",
+	 value.parent_identifier,
+	 (uint64_t) 16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "value.sub_file_entry_index",
+	 value.sub_file_entry_index,
+	 3 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "value.size",
+	 value.size,
+	 (uint64_t) 1024 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT16(
+	 "value.file_mode",
+	 value.file_mode,
+	 (uint16_t) 0x81a4 );
+
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/other" ),
+	          10,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_get_value_by_path(
+	          NULL,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          9,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_get_name_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_get_name_by_index(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	mount_path_cache_t *path_cache = NULL;
+	system_character_t *name       = NULL;
+	size_t name_size               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir/name" ),
+	          16,
+	          3,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_tools_mount_path_cache_set_value(
+	          path_cache,
+	          _SYSTEM_STRING( "/dir" ),
+	          2,
+	          -1,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          16,
+	          3,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 5 );
+
+	result = system_string_compare(
+	          name,
+	          _SYSTEM_STRING( "name" ),
+	          5 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 name );
+
+	name = NULL;
+
+	/* The most recently retrieved entry is marked as the most recently used
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "path_cache->most_recently_used_entry",
+	 (intptr_t) path_cache->most_recently_used_entry,
+	 (intptr_t) &( path_cache->entries[ 0 ] ) );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          16,
+	          4,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          3,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Entries without a sub file entry index are not retrievable by index
+	 */
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          -1,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_get_name_by_index(
+	          NULL,
+	          16,
+	          3,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          16,
+	          3,
+	          NULL,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name = (system_character_t *) 0x12345678UL;
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          16,
+	          3,
+	          &name,
+	          &name_size,
+	          &error );
+
+	name = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          16,
+	          3,
+	          &name,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_path_cache_set_value_by_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_tools_mount_path_cache_set_value_by_path(
+     void )
+{
+	mount_path_cache_value_t value;
+
+	libcerror_error_t *error       = NULL;
+	mount_path_cache_t *path_cache = NULL;
+	system_character_t *name       = NULL;
+	void *memset_result            = NULL;
+	size_t name_size               = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = mount_path_cache_initialize(
+	          &path_cache,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memset_result = memory_set(
+	                 &value,
+	                 0,
+	                 sizeof( mount_path_cache_value_t ) );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	value.parent_identifier    = 2;
+	value.sub_file_entry_index = 0;
+	value.size                 = 1;
+
+	/* Test regular cases
+	 */
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_entries",
+	 path_cache->number_of_entries,
+	 1 );
+
+	/* Setting the value of a cached path replaces the value
+	 * and moves the entry to its new sub file entry index
+	 */
+	value.sub_file_entry_index = 5;
+	value.size                 = 10;
+
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_entries",
+	 path_cache->number_of_entries,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "path_cache->entries[ 0 ].value.size",
+	 path_cache->entries[ 0 ].value.size,
+	 (uint64_t) 10 );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          0,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          5,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "name_size",
+	 name_size,
+	 (size_t) 2 );
+
+	memory_free(
+	 name );
+
+	name = NULL;
+
+	value.sub_file_entry_index = 6;
+
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/b" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_entries",
+	 path_cache->number_of_entries,
+	 2 );
+
+	/* Mark "/a" as the most recently used entry so that "/b" is replaced
+	 * when the cache is full
+	 */
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value.sub_file_entry_index = 7;
+
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/c" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "path_cache->number_of_entries",
+	 path_cache->number_of_entries,
+	 2 );
+
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/b" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_name_by_index(
+	          path_cache,
+	          2,
+	          6,
+	          &name,
+	          &name_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "value.sub_file_entry_index",
+	 value.sub_file_entry_index,
+	 5 );
+
+	result = mount_path_cache_get_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/c" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "value.sub_file_entry_index",
+	 value.sub_file_entry_index,
+	 7 );
+
+	/* Test error cases
+	 */
+	result = mount_path_cache_set_value_by_path(
+	          NULL,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          NULL,
+	          2,
+	          &value,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_path_cache_set_value_by_path(
+	          path_cache,
+	          _SYSTEM_STRING( "/a" ),
+	          2,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_path_cache_free(
+	          &path_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "path_cache",
+	 path_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( path_cache != NULL )
+	{
+		mount_path_cache_free(
+		 &path_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_initialize",
+	 fsapfs_test_tools_mount_path_cache_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_free",
+	 fsapfs_test_tools_mount_path_cache_free );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_calculate_path_hash",
+	 fsapfs_test_tools_mount_path_cache_calculate_path_hash );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_calculate_index_hash",
+	 fsapfs_test_tools_mount_path_cache_calculate_index_hash );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_touch_entry",
+	 fsapfs_test_tools_mount_path_cache_touch_entry );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_unlink_entry",
+	 fsapfs_test_tools_mount_path_cache_unlink_entry );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_get_entry_by_path",
+	 fsapfs_test_tools_mount_path_cache_get_entry_by_path );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_get_value_by_path",
+	 fsapfs_test_tools_mount_path_cache_get_value_by_path );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_get_name_by_index",
+	 fsapfs_test_tools_mount_path_cache_get_name_by_index );
+
+	FSAPFS_TEST_RUN(
+	 "mount_path_cache_set_value_by_path",
+	 fsapfs_test_tools_mount_path_cache_set_value_by_path );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
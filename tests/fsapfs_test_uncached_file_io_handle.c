@@ -0,0 +1,1007 @@
+/*
+ * Library uncached_file_io_handle type test program
+ *
+ * Copyright (C) 2018-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libbfio.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_block_buffer_pool.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_uncached_file_io_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) && defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT )
+
+#define FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME	"fsapfs_test_uncached_file_io_handle.tmp"
+
+/* The size of the test file, which is not a multiple of the buffer size
+ */
+#define FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE	( ( 2 * LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE ) + 12345 )
+
+/* Creates the test file
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_uncached_file_io_handle_create_file(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	FILE *file_stream     = NULL;
+	size_t data_offset    = 0;
+	size_t file_offset    = 0;
+	size_t write_size     = 0;
+
+	file_stream = file_stream_open(
+	               FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	               "wb" );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	while( file_offset < FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE )
+	{
+		write_size = FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE - file_offset;
+
+		if( write_size > 4096 )
+		{
+			write_size = 4096;
+		}
+		for( data_offset = 0;
+		     data_offset < write_size;
+		     data_offset++ )
+		{
+			data[ data_offset ] = (uint8_t) ( ( file_offset + data_offset ) % 251 );
+		}
+		if( file_stream_write(
+		     file_stream,
+		     data,
+		     write_size ) != write_size )
+		{
+			file_stream_close(
+			 file_stream );
+
+			return( -1 );
+		}
+		file_offset += write_size;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Checks if the data matches the data of the test file at the offset
+ * Returns 1 if the data matches or 0 if not
+ */
+int fsapfs_test_uncached_file_io_handle_check_data(
+     const uint8_t *data,
+     size_t data_size,
+     size_t file_offset )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] != (uint8_t) ( ( file_offset + data_offset ) % 251 ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the libfsapfs_uncached_file_io_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_uncached_file_io_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_uncached_file_io_handle_t *io_handle = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 2;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &io_handle,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->file_descriptor",
+	 io_handle->file_descriptor,
+	 -1 );
+
+	result = libfsapfs_uncached_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          NULL,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle = (libfsapfs_uncached_file_io_handle_t *) 0x12345678UL;
+
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &io_handle,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	io_handle = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &io_handle,
+	          NULL,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &io_handle,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_uncached_file_io_handle_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_uncached_file_io_handle_initialize(
+		          &io_handle,
+		          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+		          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( io_handle != NULL )
+			{
+				libfsapfs_uncached_file_io_handle_free(
+				 &io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "io_handle",
+			 io_handle );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_uncached_file_io_handle_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_uncached_file_io_handle_initialize(
+		          &io_handle,
+		          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+		          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( io_handle != NULL )
+			{
+				libfsapfs_uncached_file_io_handle_free(
+				 &io_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "io_handle",
+			 io_handle );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_uncached_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_uncached_file_io_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_uncached_file_io_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_uncached_file_io_handle_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_uncached_file_io_handle_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_uncached_file_io_handle_clone(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libfsapfs_uncached_file_io_handle_t *destination_io_handle = NULL;
+	libfsapfs_uncached_file_io_handle_t *source_io_handle      = NULL;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &source_io_handle,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_uncached_file_io_handle_clone(
+	          &destination_io_handle,
+	          source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_io_handle",
+	 destination_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_io_handle->name_size",
+	 destination_io_handle->name_size,
+	 source_io_handle->name_size );
+
+	result = libfsapfs_uncached_file_io_handle_free(
+	          &destination_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_uncached_file_io_handle_clone(
+	          &destination_io_handle,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_io_handle",
+	 destination_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_uncached_file_io_handle_clone(
+	          NULL,
+	          source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_uncached_file_io_handle_free(
+	          &source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_io_handle != NULL )
+	{
+		libfsapfs_uncached_file_io_handle_free(
+		 &destination_io_handle,
+		 NULL );
+	}
+	if( source_io_handle != NULL )
+	{
+		libfsapfs_uncached_file_io_handle_free(
+		 &source_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_uncached_file_io_handle_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_uncached_file_io_handle_read_buffer(
+     void )
+{
+	uint8_t data[ 5000 ];
+
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_uncached_file_io_handle_t *io_handle = NULL;
+	uint8_t *aligned_buffer                        = NULL;
+	size64_t size                                  = 0;
+	ssize_t read_count                             = 0;
+	off64_t offset                                 = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = fsapfs_test_uncached_file_io_handle_create_file();
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsapfs_uncached_file_io_handle_initialize(
+	          &io_handle,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME,
+	          sizeof( FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME ),
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_uncached_file_io_handle_open(
+	          io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_uncached_file_io_handle_is_open(
+	          io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_uncached_file_io_handle_get_size(
+	          io_handle,
+	          &size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading unaligned data
+	 */
+	offset = libfsapfs_uncached_file_io_handle_seek_offset(
+	          io_handle,
+	          4097,
+	          SEEK_SET,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 4097 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              data,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5000 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_uncached_file_io_handle_check_data(
+	          data,
+	          5000,
+	          4097 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test reading unaligned data that spans the read buffer
+	 */
+	offset = libfsapfs_uncached_file_io_handle_seek_offset(
+	          io_handle,
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE - 1000,
+	          SEEK_SET,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE - 1000 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              data,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 5000 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_uncached_file_io_handle_check_data(
+	          data,
+	          5000,
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE - 1000 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test reading aligned data directly into an aligned buffer
+	 */
+	result = libfsapfs_block_buffer_pool_allocate_aligned_buffer(
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE,
+	          &aligned_buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = libfsapfs_uncached_file_io_handle_seek_offset(
+	          io_handle,
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE + 4096,
+	          SEEK_SET,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE + 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              aligned_buffer,
+	              LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_uncached_file_io_handle_check_data(
+	          aligned_buffer,
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE,
+	          LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_BUFFER_SIZE + 4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfsapfs_block_buffer_pool_free_aligned_buffer(
+	          &aligned_buffer,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading data beyond the end of the file
+	 */
+	offset = libfsapfs_uncached_file_io_handle_seek_offset(
+	          io_handle,
+	          -1000,
+	          SEEK_END,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE - 1000 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              data,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1000 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsapfs_test_uncached_file_io_handle_check_data(
+	          data,
+	          1000,
+	          FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_SIZE - 1000 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              data,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              NULL,
+	              data,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_uncached_file_io_handle_read_buffer(
+	              io_handle,
+	              NULL,
+	              5000,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset = libfsapfs_uncached_file_io_handle_seek_offset(
+	          io_handle,
+	          -1,
+	          SEEK_SET,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_uncached_file_io_handle_close(
+	          io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_uncached_file_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( aligned_buffer != NULL )
+	{
+		libfsapfs_block_buffer_pool_free_aligned_buffer(
+		 &aligned_buffer,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_uncached_file_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	remove(
+	 FSAPFS_TEST_UNCACHED_FILE_IO_HANDLE_NAME );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) && defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) && defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_uncached_file_io_handle_initialize",
+	 fsapfs_test_uncached_file_io_handle_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_uncached_file_io_handle_free",
+	 fsapfs_test_uncached_file_io_handle_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_uncached_file_io_handle_clone",
+	 fsapfs_test_uncached_file_io_handle_clone );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_uncached_file_io_handle_read_buffer",
+	 fsapfs_test_uncached_file_io_handle_read_buffer );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+
+#else
+
+	return( EXIT_SUCCESS );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) && defined( HAVE_LIBFSAPFS_UNCACHED_FILE_IO_HANDLE_SUPPORT ) */
+}
+
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "btree_entry btree_footer btree_node btree_node_header buffer_data_handle checkpoint_map checkpoint_map_entry checksum chunk_information_block container_data_handle container_key_bag container_reaper container_superblock compressed_data_handle compression data_block data_block_data_handle data_stream deflate directory_record encryption_context error extended_attribute extent_reference_tree file_extent file_system_btree file_system_data_handle fusion_middle_tree inode io_handle key_bag_entry key_bag_header key_encrypted_key name name_hash notify object object_map object_map_btree object_map_descriptor profiler snapshot snapshot_metadata snapshot_metadata_tree space_manager volume volume_key_bag"
-$LibraryTestsWithInput = "container support"
+$LibraryTests = "block_buffer_pool btree_entry btree_footer btree_node btree_node_header buffer_data_handle cache_usage checkpoint_map checkpoint_map_entry checksum chunk_information_block container_data_handle container_key_bag container_reaper container_superblock compressed_data_handle compression cursor data_block data_block_data_handle data_stream deflate directory_record disk_usage encryption_context error extended_attribute extended_attribute_sweep extent_reference_tree file_entry file_extent file_reference file_system_btree file_system_data_handle fusion_middle_tree inode integrity_metadata io_handle key_bag_entry key_bag_header key_encrypted_key metadata_index name name_hash name_search node_carver notify object object_map object_map_btree object_map_descriptor profiler read_scheduler snapshot snapshot_metadata snapshot_metadata_tree space_manager uncached_file_io_handle volume volume_key_bag"
+$LibraryTestsWithInput = "container io_budget support"
 $OptionSets = "offset password"
 
 $InputGlob = "*"